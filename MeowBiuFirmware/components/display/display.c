@@ -224,5 +224,9 @@ void LVGL_Setup()
                            sizeof(buf1),
                            LV_DISPLAY_RENDER_MODE_PARTIAL);
 
+    // 40 MHz SPI at 16 bits per pixel: ~400 ns per pixel, and ~200 us per area with a single buffer,
+    // so redraw nearby areas together
+    lv_display_set_flush_cost(disp, 200000, 400);
+
     lv_display_set_default(disp);
 }
\ No newline at end of file
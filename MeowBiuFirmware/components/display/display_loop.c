@@ -0,0 +1,82 @@
+/*
+ * LVGL run loop: instead of polling lv_timer_handler() at a fixed rate the LVGL task
+ * sleeps until the next LVGL timer is due or until something wakes it up:
+ *  - a timer is created or resumed (lv_obj_invalidate() resumes the refresh timer,
+ *    lv_async_call() and lv_anim_start() create/resume timers),
+ *  - display_loop_wake() / display_loop_wake_from_isr() is called (e.g. by an input driver).
+ *
+ * Only the task handling is platform specific (display_loop_esp.c), so this file builds on the host too.
+ */
+
+#include <stdbool.h>
+
+#include "lvgl.h"
+#include "display_loop.h"
+#include "display_loop_port.h"
+
+/* A timer was resumed by the LVGL task itself while lv_timer_handler() was running */
+static volatile bool self_resumed = false;
+
+static display_loop_idle_cb_t idle_cb = NULL;
+static uint32_t idle_min_sleep_ms = 0;
+static void *idle_user_data = NULL;
+
+static void timer_resume_cb(void *data)
+{
+    LV_UNUSED(data);
+
+    /* The time until the next timer is calculated at the end of lv_timer_handler(),
+     * so a timer resumed from the LVGL task only needs one more handler call, not a notification */
+    if (display_loop_port_in_loop_task())
+    {
+        self_resumed = true;
+        return;
+    }
+
+    display_loop_wake();
+}
+
+void display_loop_init(void)
+{
+    display_loop_port_init();
+    lv_timer_handler_set_resume_cb(timer_resume_cb, NULL);
+}
+
+uint32_t display_loop_step(void)
+{
+    self_resumed = false;
+    uint32_t time_till_next = lv_timer_handler();
+
+    /* A timer resumed in a timer callback might be missing from the returned time */
+    if (self_resumed)
+        return 0;
+
+    if (time_till_next == LV_NO_TIMER_READY)
+        return DISPLAY_LOOP_WAIT_FOREVER;
+
+    return time_till_next;
+}
+
+uint32_t display_loop_step_ticks(uint32_t tick_period_ms)
+{
+    uint32_t sleep_ms = display_loop_step();
+    if (sleep_ms == 0)
+        return 0;
+
+    if (idle_cb && sleep_ms >= idle_min_sleep_ms)
+        idle_cb(sleep_ms, idle_user_data);
+
+    if (sleep_ms == DISPLAY_LOOP_WAIT_FOREVER)
+        return DISPLAY_LOOP_WAIT_FOREVER;
+
+    /* Round up so that the timer is really due after waking up. It's at least one tick,
+     * so the lower priority tasks (and the idle task) can run */
+    return (sleep_ms + tick_period_ms - 1) / tick_period_ms;
+}
+
+void display_loop_set_idle_cb(display_loop_idle_cb_t cb, uint32_t min_sleep_ms, void *user_data)
+{
+    idle_cb = cb;
+    idle_min_sleep_ms = min_sleep_ms;
+    idle_user_data = user_data;
+}
@@ -0,0 +1,63 @@
+/*
+ * The FreeRTOS part of the run loop: the LVGL task blocks on its task notification
+ * for the ticks returned by display_loop_step_ticks().
+ */
+
+#include <stdbool.h>
+
+#include "esp_log.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "lvgl.h"
+#include "display_loop.h"
+#include "display_loop_port.h"
+
+static const char *TAG = "display_loop";
+
+static TaskHandle_t loop_task = NULL;
+static volatile uint32_t wakeup_count = 0;
+
+void display_loop_port_init(void)
+{
+    loop_task = xTaskGetCurrentTaskHandle();
+    ESP_LOGI(TAG, "Run loop initialized");
+}
+
+bool display_loop_port_in_loop_task(void)
+{
+    return xTaskGetCurrentTaskHandle() == loop_task;
+}
+
+void display_loop_run(void)
+{
+    while (1)
+    {
+        uint32_t ticks = display_loop_step_ticks(portTICK_PERIOD_MS);
+        if (ticks == 0)
+            continue;
+
+        ulTaskNotifyTake(pdTRUE, ticks == DISPLAY_LOOP_WAIT_FOREVER ? portMAX_DELAY : ticks);
+        wakeup_count++;
+    }
+}
+
+void display_loop_wake(void)
+{
+    if (loop_task)
+        xTaskNotifyGive(loop_task);
+}
+
+void display_loop_wake_from_isr(void)
+{
+    if (loop_task == NULL)
+        return;
+
+    BaseType_t higher_prio_woken = pdFALSE;
+    vTaskNotifyGiveFromISR(loop_task, &higher_prio_woken);
+    portYIELD_FROM_ISR(higher_prio_woken);
+}
+
+uint32_t display_loop_get_wakeup_count(void)
+{
+    return wakeup_count;
+}
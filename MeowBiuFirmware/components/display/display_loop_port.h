@@ -0,0 +1,6 @@
+#pragma once
+#include <stdbool.h>
+
+/* The task handling of the run loop, implemented by display_loop_esp.c (and by the host tests) */
+void display_loop_port_init(void);         // remember the calling task as the LVGL task
+bool display_loop_port_in_loop_task(void); // whether the caller is the LVGL task
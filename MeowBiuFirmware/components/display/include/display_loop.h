@@ -0,0 +1,32 @@
+#pragma once
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/* Wait forever if no LVGL timer is running */
+#define DISPLAY_LOOP_WAIT_FOREVER UINT32_MAX
+
+/* Called before the LVGL task blocks for `sleep_ms` (DISPLAY_LOOP_WAIT_FOREVER if nothing is scheduled).
+ * It runs in the LVGL task, e.g. to allow light sleep or to dim the backlight. */
+typedef void (*display_loop_idle_cb_t)(uint32_t sleep_ms, void *user_data);
+
+void display_loop_init(void);                  // register the wake-up sources, call from the LVGL task after LVGL_Setup()
+void display_loop_run(void);                   // run lv_timer_handler() and sleep between the timers, never returns
+uint32_t display_loop_step(void);              // run lv_timer_handler() once and return how long to sleep [ms]
+
+/* Run lv_timer_handler() once, call the idle callback if the sleep is long enough and return how many
+ * ticks of `tick_period_ms` to block: 0 to run again at once, DISPLAY_LOOP_WAIT_FOREVER until woken up */
+uint32_t display_loop_step_ticks(uint32_t tick_period_ms);
+
+void display_loop_wake(void);                  // wake the LVGL task from another task (e.g. new input data)
+void display_loop_wake_from_isr(void);         // wake the LVGL task from an interrupt (e.g. touch IRQ)
+
+void display_loop_set_idle_cb(display_loop_idle_cb_t cb, uint32_t min_sleep_ms, void *user_data);
+uint32_t display_loop_get_wakeup_count(void);  // number of times the LVGL task woke up since boot
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,324 @@
+/*
+ * The run loop in simulated time: the task notification of the LVGL task is simulated, so the
+ * wake-ups of seconds of animation and idling are counted in a moment.
+ */
+
+#include <stdbool.h>
+#include "unity.h"
+#include "lvgl.h"
+#include "display_loop.h"
+#include "display_loop_port.h"
+
+#define REFR_CNT_PER_S (1000 / LV_DEF_REFR_PERIOD)
+
+static uint32_t tick;
+
+// The simulated task handling: `notified` is the task notification of the LVGL task
+static bool in_loop_task;
+static bool notified;
+static uint32_t wake_cnt;
+
+static uint32_t idle_cnt;
+static uint32_t idle_sleep_ms;
+static uint32_t async_cnt;
+
+static lv_obj_t *obj;
+
+#define MAX_PAUSED 8
+static lv_timer_t *paused_timers[MAX_PAUSED];
+static uint32_t paused_cnt;
+
+void display_loop_port_init(void)
+{
+    in_loop_task = true;
+}
+
+bool display_loop_port_in_loop_task(void)
+{
+    return in_loop_task;
+}
+
+void display_loop_wake(void)
+{
+    wake_cnt++;
+    notified = true;
+}
+
+static uint32_t tick_cb(void)
+{
+    return tick;
+}
+
+// Let `ms` milliseconds pass in the LVGL task as display_loop_run() does with 1 ms ticks.
+// Return the number of wake-ups.
+static uint32_t run(uint32_t ms)
+{
+    uint32_t end = tick + ms;
+    uint32_t wakeup_cnt = 0;
+    while (1)
+    {
+        uint32_t ticks = display_loop_step_ticks(1);
+        if (ticks == 0)
+            continue;
+
+        if (notified)
+        {
+            // ulTaskNotifyTake() returns at once
+            notified = false;
+        }
+        else
+        {
+            if (ticks >= end - tick)
+            {
+                tick = end;
+                return wakeup_cnt;
+            }
+            tick += ticks;
+        }
+        wakeup_cnt++;
+    }
+}
+
+// Call from an other task, e.g. an input driver
+static void run_in_other_task(void (*cb)(void))
+{
+    in_loop_task = false;
+    cb();
+    in_loop_task = true;
+}
+
+static void idle_cb(uint32_t sleep_ms, void *user_data)
+{
+    LV_UNUSED(user_data);
+    idle_cnt++;
+    idle_sleep_ms = sleep_ms;
+}
+
+static void async_cb(void *data)
+{
+    LV_UNUSED(data);
+    async_cnt++;
+}
+
+static void async_call(void)
+{
+    lv_async_call(async_cb, NULL);
+}
+
+static void invalidate(void)
+{
+    lv_obj_invalidate(obj);
+}
+
+static void async_call_timer_cb(lv_timer_t *t)
+{
+    async_call();
+    lv_timer_delete(t);
+}
+
+#if LV_USE_PERF_MONITOR
+// The performance monitor keeps the refresh timer running to measure the FPS, pause it as it happens without it
+static void refr_and_pause_cb(lv_timer_t *t)
+{
+    lv_display_refr_timer(t);
+    lv_timer_pause(t);
+}
+#endif
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static void set_indev_mode(lv_indev_mode_t mode)
+{
+    lv_indev_t *indev = lv_indev_get_next(NULL);
+    while (indev)
+    {
+        lv_indev_set_mode(indev, mode);
+        indev = lv_indev_get_next(indev);
+    }
+}
+
+static void setup(void)
+{
+    if (!lv_is_initialized())
+        lv_init();
+
+    // The test app has no display on the board, add one which is flushed at once
+    if (lv_display_get_default() == NULL)
+    {
+        static uint8_t buf[240 * 24 * LV_COLOR_DEPTH / 8];
+        lv_display_t *disp = lv_display_create(240, 240);
+        lv_display_set_buffers(disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(disp, flush_cb);
+    }
+
+    lv_tick_set_cb(tick_cb);
+    tick = 1000;
+
+    // The input devices report new data by events as the touch driver with an IRQ
+    set_indev_mode(LV_INDEV_MODE_EVENT);
+#if LV_USE_PERF_MONITOR
+    lv_timer_set_cb(lv_display_get_refr_timer(NULL), refr_and_pause_cb);
+#endif
+
+    // Only the refresh timer runs, the other timers are of services of the test build (e.g. the memory monitor)
+    paused_cnt = 0;
+    lv_timer_t *t = lv_timer_get_next(NULL);
+    while (t)
+    {
+        if (t != lv_display_get_refr_timer(NULL) && !lv_timer_get_paused(t))
+        {
+            TEST_ASSERT_LESS_THAN_UINT32(MAX_PAUSED, paused_cnt);
+            paused_timers[paused_cnt++] = t;
+            lv_timer_pause(t);
+        }
+        t = lv_timer_get_next(t);
+    }
+
+    notified = false;
+    wake_cnt = 0;
+    idle_cnt = 0;
+    async_cnt = 0;
+    display_loop_init();
+    display_loop_set_idle_cb(idle_cb, 100, NULL);
+
+    obj = lv_obj_create(lv_screen_active());
+
+    // Render the new object, after that nothing runs
+    run(100);
+}
+
+static void teardown(void)
+{
+    lv_obj_delete(obj);
+    run(100);
+
+    display_loop_set_idle_cb(NULL, 0, NULL);
+    lv_timer_handler_set_resume_cb(NULL, NULL);
+#if LV_USE_PERF_MONITOR
+    lv_timer_set_cb(lv_display_get_refr_timer(NULL), lv_display_refr_timer);
+#endif
+    for (uint32_t i = 0; i < paused_cnt; i++)
+        lv_timer_resume(paused_timers[i]);
+    set_indev_mode(LV_INDEV_MODE_TIMER);
+    lv_tick_set_cb(NULL);
+}
+
+void test_display_loop_sleeps_when_idle(void)
+{
+    setup();
+
+    // Animated for 1 second: about a wake-up per refresh period
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_exec_cb(&a, (lv_anim_exec_xcb_t)lv_obj_set_y);
+    lv_anim_set_values(&a, 0, 100);
+    lv_anim_set_duration(&a, 1000);
+    lv_anim_start(&a);
+
+    idle_cnt = 0;
+    uint32_t wakeup_cnt = run(1000);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * REFR_CNT_PER_S, wakeup_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(REFR_CNT_PER_S / 2, wakeup_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, idle_cnt); // the sleeps are shorter than 100 ms
+
+    // Let the last frame be rendered, after that the task blocks until it's woken up
+    run(100);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, display_loop_step_ticks(1));
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, idle_sleep_ms);
+    TEST_ASSERT_EQUAL_UINT32(0, run(10000));
+    TEST_ASSERT_EQUAL_UINT32(0, wake_cnt);
+
+    teardown();
+}
+
+void test_display_loop_woken_up_by_other_tasks(void)
+{
+    setup();
+
+    // Invalidation resumes the refresh timer
+    run_in_other_task(invalidate);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, wake_cnt);
+    TEST_ASSERT_TRUE(notified);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2, run(100));
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, display_loop_step_ticks(1));
+
+    // Async calls create a timer
+    uint32_t prev_wake_cnt = wake_cnt;
+    run_in_other_task(async_call);
+    TEST_ASSERT_GREATER_THAN_UINT32(prev_wake_cnt, wake_cnt);
+    run(100);
+    TEST_ASSERT_EQUAL_UINT32(1, async_cnt);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, display_loop_step_ticks(1));
+
+    teardown();
+}
+
+void test_display_loop_resumed_in_loop_task(void)
+{
+    setup();
+
+    // A timer started by a timer callback runs in the next step, without a notification
+    lv_timer_create(async_call_timer_cb, 50, NULL);
+    TEST_ASSERT_EQUAL_UINT32(50, display_loop_step_ticks(1));
+    tick += 50;
+    TEST_ASSERT_EQUAL_UINT32(0, display_loop_step_ticks(1));
+    TEST_ASSERT_EQUAL_UINT32(0, async_cnt);
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, display_loop_step_ticks(1));
+    TEST_ASSERT_EQUAL_UINT32(1, async_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, wake_cnt);
+
+    teardown();
+}
+
+void test_display_loop_ticks(void)
+{
+    setup();
+
+    // The sleep is rounded up to whole ticks, and the idle callback is called only before long sleeps
+    lv_timer_t *timer = lv_timer_create(lv_timer_pause, 250, NULL);
+    idle_cnt = 0;
+    TEST_ASSERT_EQUAL_UINT32(25, display_loop_step_ticks(10));
+    TEST_ASSERT_EQUAL_UINT32(1, idle_cnt);
+    TEST_ASSERT_EQUAL_UINT32(250, idle_sleep_ms);
+
+    tick += 249;
+    TEST_ASSERT_EQUAL_UINT32(1, display_loop_step_ticks(10));
+    tick += 1;
+    TEST_ASSERT_EQUAL_UINT32(DISPLAY_LOOP_WAIT_FOREVER, display_loop_step_ticks(10));
+    TEST_ASSERT_EQUAL_UINT32(2, idle_cnt);
+
+    lv_timer_set_period(timer, 25);
+    lv_timer_resume(timer);
+    TEST_ASSERT_EQUAL_UINT32(3, display_loop_step_ticks(10));
+    TEST_ASSERT_EQUAL_UINT32(2, idle_cnt);
+
+    lv_timer_delete(timer);
+    teardown();
+}
+
+#ifdef ESP_PLATFORM
+void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_display_loop_sleeps_when_idle);
+    RUN_TEST(test_display_loop_woken_up_by_other_tasks);
+    RUN_TEST(test_display_loop_resumed_in_loop_task);
+    RUN_TEST(test_display_loop_ticks);
+    UNITY_END();
+}
+#else
+// On the host the tests run with the LVGL tests, which call these
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+#endif
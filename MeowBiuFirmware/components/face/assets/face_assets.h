@@ -0,0 +1,17 @@
+#ifndef FACE_ASSETS_H
+#define FACE_ASSETS_H
+
+// Manifest of the GIFs played by the face. With CONFIG_FACE_STATIC_MEM the memory of the GIF
+// players is sized from it, so update it when a GIF is added or exported again.
+// ../CMakeLists.txt parses these lines to report the budget: keep one GIF per line.
+
+// Number of GIF players shown at the same time
+#define FACE_GIF_PLAYERS 1
+
+//  name            width  height  frames
+#define FACE_GIF_MANIFEST(X)        \
+    X(excited_start, 80, 80, 9)     \
+    X(excited_loop, 80, 80, 13)     \
+    X(excited_end, 80, 80, 5)
+
+#endif // FACE_ASSETS_H
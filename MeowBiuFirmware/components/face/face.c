@@ -1,5 +1,5 @@
+// face.c doesn't include sdkconfig.h so that it builds on the host too: the options are set by CMakeLists.txt
 #include "face.h"
-#include "esp_log.h"
 #include "lvgl.h"
 
 #include "./assets/output/excited_start.c"
@@ -7,75 +7,231 @@
 
 #include "./assets/output/excited_loop.c"
 #include "./assets/output/excited_end.c"
+#include "./assets/face_assets.h"
+
+#ifndef FACE_STATIC_MEM
+#define FACE_STATIC_MEM 0
+#endif
 
 static lv_obj_t *img;
 
-// LV_IMG_DECLARE(excited_start_trans);
-LV_IMG_DECLARE(excited_start);
-LV_IMG_DECLARE(excited_loop);
-LV_IMG_DECLARE(excited_end);
+#if LV_USE_FACE
+// The simple expressions are drawn by lv_face, only the excited sequence is a GIF
+#define FACE_FADE_MS       400
+#define FACE_EXCITED_EVERY 8 // expressions
+
+static lv_obj_t *face;
+static lv_face_timeline_t *face_tl;
+static uint32_t expr_cnt;
+
+// Look left and right, then blink
+static const lv_face_keyframe_t idle_gaze_x_kf[] = {{0, 0}, {400, -80}, {1800, -80}, {2300, 80}, {3600, 80}, {4000, 0}};
+static const lv_face_keyframe_t idle_openness_kf[] = {{4400, 255}, {4480, 0}, {4600, 255}, {5000, 255}};
+static const lv_face_keyframe_t zero_kf[] = {{0, 0}};
+static const lv_face_track_t idle_tracks[] = {
+    {idle_gaze_x_kf, lv_anim_path_ease_in_out, LV_FACE_PARAM_GAZE_X, 6},
+    {zero_kf, NULL, LV_FACE_PARAM_GAZE_Y, 1},
+    {idle_openness_kf, NULL, LV_FACE_PARAM_OPENNESS, 4},
+    {zero_kf, NULL, LV_FACE_PARAM_SQUINT, 1},
+    {zero_kf, NULL, LV_FACE_PARAM_MOOD, 1},
+};
+static const lv_face_expression_t face_idle = {idle_tracks, 5, 0};
+
+static const lv_face_keyframe_t happy_gaze_y_kf[] = {{0, -40}};
+static const lv_face_keyframe_t happy_openness_kf[] = {{1500, 230}, {1580, 0}, {1700, 230}, {2500, 230}};
+static const lv_face_keyframe_t happy_squint_kf[] = {{0, 120}};
+static const lv_face_keyframe_t happy_mood_kf[] = {{0, 127}};
+static const lv_face_track_t happy_tracks[] = {
+    {zero_kf, NULL, LV_FACE_PARAM_GAZE_X, 1},
+    {happy_gaze_y_kf, NULL, LV_FACE_PARAM_GAZE_Y, 1},
+    {happy_openness_kf, NULL, LV_FACE_PARAM_OPENNESS, 4},
+    {happy_squint_kf, NULL, LV_FACE_PARAM_SQUINT, 1},
+    {happy_mood_kf, NULL, LV_FACE_PARAM_MOOD, 1},
+};
+static const lv_face_expression_t face_happy = {happy_tracks, 5, 0};
+
+// Look down and away slowly
+static const lv_face_keyframe_t sad_gaze_x_kf[] = {{0, 0}, {1500, -50}, {3000, -50}};
+static const lv_face_keyframe_t sad_gaze_y_kf[] = {{0, 60}};
+static const lv_face_keyframe_t sad_openness_kf[] = {{0, 170}};
+static const lv_face_keyframe_t sad_mood_kf[] = {{0, -127}};
+static const lv_face_track_t sad_tracks[] = {
+    {sad_gaze_x_kf, lv_anim_path_ease_in_out, LV_FACE_PARAM_GAZE_X, 3},
+    {sad_gaze_y_kf, NULL, LV_FACE_PARAM_GAZE_Y, 1},
+    {sad_openness_kf, NULL, LV_FACE_PARAM_OPENNESS, 1},
+    {zero_kf, NULL, LV_FACE_PARAM_SQUINT, 1},
+    {sad_mood_kf, NULL, LV_FACE_PARAM_MOOD, 1},
+};
+static const lv_face_expression_t face_sad = {sad_tracks, 5, 0};
+
+static void face_show(void);
+#endif
+
+// The excited sequence: each GIF is played `loop_count` times, then the next one
+typedef struct
+{
+    const lv_image_dsc_t *src;
+    int32_t loop_count;
+} face_gif_step_t;
+
+static const face_gif_step_t excited_seq[] = {
+    // {&excited_start_trans, 1},
+    {&excited_start, 1},
+    {&excited_loop, 2},
+    {&excited_end, 1},
+};
+static uint32_t gif_step;
+
+#if FACE_STATIC_MEM
+// The players are created once and decode into this buffer, which fits the largest GIF of the manifest
+#define FACE_GIF_BUF(name, w, h, frames) uint8_t name[LV_GIF_BUF_SIZE(w, h)];
+typedef union
+{
+    FACE_GIF_MANIFEST(FACE_GIF_BUF)
+    uint64_t align;
+} face_gif_buf_t;
+
+#ifdef FACE_ARENA_SIZE
+_Static_assert(sizeof(face_gif_buf_t[FACE_GIF_PLAYERS]) == FACE_ARENA_SIZE,
+               "The GIF buffers don't match the size reported by CMakeLists.txt");
+#endif
 
-static void gif_finished_cb_3(lv_event_t *e);
+static face_gif_buf_t gif_arena[FACE_GIF_PLAYERS];
+static lv_obj_t *gif_players[FACE_GIF_PLAYERS];
+#endif
 
-void gif_finished_cb_2(lv_event_t *e)
+static void gif_ready_cb(lv_event_t *e);
+
+static lv_obj_t *gif_player_create(void)
 {
-    ESP_LOGI("face", "GIF finished, switching to end GIF");
-    
-    img = lv_gif_create(lv_screen_active());
-
-    lv_gif_set_src(img, &excited_end);
-    ESP_LOGI("face", "Set source to loop GIF");
-    lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
-    lv_image_set_scale(img, 700);
-    lv_image_set_antialias(img, true);
-
-    // CRITICAL: Start the GIF!
-    lv_gif_restart(img); // Make sure this is here
-    ESP_LOGI("face", "Restarted");
-    lv_gif_set_loop_count(img, 1);
-    lv_obj_add_event_cb(img, gif_finished_cb_3, LV_EVENT_READY, NULL);
+    lv_obj_t *gif = lv_gif_create(lv_screen_active());
+    lv_obj_align(gif, LV_ALIGN_CENTER, 0, 0);
+    lv_image_set_scale(gif, 700);
+    lv_image_set_antialias(gif, true);
+    lv_obj_add_event_cb(gif, gif_ready_cb, LV_EVENT_READY, NULL);
+    return gif;
 }
 
-static void gif_finished_cb(lv_event_t *e)
+static void gif_play_step(void)
 {
-    ESP_LOGI("face", "GIF finished, switching to loop GIF");
-
-    ESP_LOGI("face", "Deleted previous img object");
-
-    img = lv_gif_create(lv_screen_active());
-
-    lv_gif_set_src(img, &excited_loop);
-    ESP_LOGI("face", "Set source to loop GIF");
-    lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
-    lv_image_set_scale(img, 700);
-    lv_image_set_antialias(img, true);
-    // CRITICAL: Start the GIF!
-    lv_gif_restart(img); // Make sure this is here
-    ESP_LOGI("face", "Restarted");
-    lv_gif_set_loop_count(img, 2);
-    lv_obj_add_event_cb(img, gif_finished_cb_2, LV_EVENT_READY, NULL);
+    const face_gif_step_t *step = &excited_seq[gif_step];
+#if FACE_STATIC_MEM
+    img = gif_players[gif_step % FACE_GIF_PLAYERS];
+    lv_obj_remove_flag(img, LV_OBJ_FLAG_HIDDEN);
+#else
+    img = gif_player_create();
+#endif
+    LV_LOG_INFO("Playing GIF %lu of the sequence", (unsigned long)gif_step);
+    lv_gif_set_src(img, step->src);
+    lv_gif_set_loop_count(img, step->loop_count);
 }
 
-
 void draw_gif()
 {
-    img = lv_gif_create(lv_screen_active());
+    gif_step = 0;
+    gif_play_step();
+}
+
+static void gif_ready_cb(lv_event_t *e)
+{
+    // Hide or delete the finished player. The next GIF may be played by the same one.
+#if FACE_STATIC_MEM
+    lv_obj_add_flag(lv_event_get_target_obj(e), LV_OBJ_FLAG_HIDDEN);
+#else
+    lv_obj_delete_async(lv_event_get_target_obj(e));
+#endif
+
+    gif_step++;
+    if (gif_step < sizeof(excited_seq) / sizeof(excited_seq[0]))
+    {
+        gif_play_step();
+        return;
+    }
+
+#if LV_USE_FACE
+    face_show();
+#else
+    draw_gif();
+#endif
+}
+
+static void gif_init(void)
+{
+#if FACE_STATIC_MEM
+    LV_LOG_INFO("Reserved %u bytes for %d GIF player(s)", (unsigned)sizeof(gif_arena), FACE_GIF_PLAYERS);
+    for (uint32_t i = 0; i < FACE_GIF_PLAYERS; i++)
+    {
+        gif_players[i] = gif_player_create();
+        lv_gif_set_buf(gif_players[i], &gif_arena[i], sizeof(gif_arena[i]));
+        lv_obj_add_flag(gif_players[i], LV_OBJ_FLAG_HIDDEN);
+    }
+#endif
+}
 
-    // lv_gif_set_src(img, &excited_start_trans); // Set source FIRST
-    lv_gif_set_src(img, &excited_start); // Set source FIRST
-    lv_obj_align(img, LV_ALIGN_CENTER, 0, 0);
-    lv_image_set_scale(img, 700);
-    lv_gif_set_loop_count(img, 1); // Set loop count AFTER source
+#if LV_USE_FACE
 
-    // Add event callback for when GIF finishes
-    lv_obj_add_event_cb(img, gif_finished_cb, LV_EVENT_READY, NULL);
+void face_play_expression(const lv_face_expression_t *expr)
+{
+    lv_face_timeline_play(face_tl, expr, FACE_FADE_MS);
 }
 
-void gif_finished_cb_3(lv_event_t *e){
+void face_play_excited(void)
+{
+    lv_face_timeline_stop(face_tl);
+    lv_obj_add_flag(face, LV_OBJ_FLAG_HIDDEN);
     draw_gif();
 }
 
+static void face_show(void)
+{
+    lv_obj_remove_flag(face, LV_OBJ_FLAG_HIDDEN);
+    face_play_expression(&face_idle);
+}
+
+// Pick the next expression when one has finished, and show the excited GIF from time to time
+static void face_completed_cb(lv_face_timeline_t *tl)
+{
+    LV_UNUSED(tl);
+    expr_cnt++;
+    if (expr_cnt % FACE_EXCITED_EVERY == 0)
+    {
+        face_play_excited();
+        return;
+    }
+
+    switch (lv_rand(0, 3))
+    {
+    case 0:
+        face_play_expression(&face_happy);
+        break;
+    case 1:
+        face_play_expression(&face_sad);
+        break;
+    default:
+        face_play_expression(&face_idle);
+        break;
+    }
+}
+
 void face_init()
 {
+    face = lv_face_create(lv_screen_active());
+    lv_obj_set_size(face, LV_PCT(100), LV_PCT(100));
+    lv_obj_center(face);
+
+    gif_init();
+
+    face_tl = lv_face_timeline_create(face);
+    lv_face_timeline_set_completed_cb(face_tl, face_completed_cb);
+    face_play_expression(&face_idle);
+}
+
+#else
+
+void face_init()
+{
+    gif_init();
     draw_gif();
-}
\ No newline at end of file
+}
+
+#endif
\ No newline at end of file
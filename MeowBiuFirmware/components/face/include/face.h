@@ -13,6 +13,14 @@ extern "C" {
 
 void face_init();
 
+#if LV_USE_FACE
+// Cross-fade to an expression of the lv_face widget. The next one is picked when it has finished.
+void face_play_expression(const lv_face_expression_t *expr);
+
+// Hide the face and play the excited GIF sequence once
+void face_play_excited(void);
+#endif
+
 #ifdef __cplusplus
 }
 #endif
@@ -0,0 +1,198 @@
+/*
+ * The face with CONFIG_FACE_STATIC_MEM in simulated time: random expressions and the excited GIF sequence
+ * are played by face.c until a few sequences have finished, and nothing is allocated after face_init()
+ * apart from rendering.
+ */
+
+#include <stdbool.h>
+#include "unity.h"
+#include "lvgl.h"
+#include "face.h"
+
+#define STEP_MS   33
+#define MAX_STEPS (10 * 60 * 1000 / STEP_MS) // 10 minutes, the GIF sequence comes about every 30 s
+#define SEQ_CNT   3
+#define REFR_EVERY 30                          // steps
+
+#define MAX_PAUSED 8
+static lv_timer_t *paused_timers[MAX_PAUSED];
+static uint32_t paused_cnt;
+
+static uint32_t tick;
+
+static uint32_t tick_cb(void)
+{
+    return tick;
+}
+
+static void flush_cb(lv_display_t *disp, const lv_area_t *area, uint8_t *px_map)
+{
+    LV_UNUSED(area);
+    LV_UNUSED(px_map);
+    lv_display_flush_ready(disp);
+}
+
+static lv_obj_t *find_child(const lv_obj_class_t *class_p, uint32_t *cnt)
+{
+    lv_obj_t *found = NULL;
+    *cnt = 0;
+    for (uint32_t i = 0; i < lv_obj_get_child_count(lv_screen_active()); i++)
+    {
+        lv_obj_t *child = lv_obj_get_child(lv_screen_active(), (int32_t)i);
+        if (lv_obj_check_type(child, class_p))
+        {
+            found = child;
+            (*cnt)++;
+        }
+    }
+    return found;
+}
+
+typedef struct
+{
+    uint32_t alloc_cnt; // only with the memory profiler
+    uint32_t live_cnt;
+    size_t live_size;
+} heap_state_t;
+
+static void heap_get(heap_state_t *s)
+{
+#if LV_USE_MEM_PROFILER
+    const lv_mem_profiler_entry_t *total = lv_mem_profiler_get_total();
+    s->alloc_cnt = total->alloc_cnt;
+    s->live_cnt = total->live_cnt;
+    s->live_size = total->live_size;
+#else
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    s->alloc_cnt = 0;
+    s->live_cnt = mon.used_cnt;
+    s->live_size = mon.total_size - mon.free_size;
+#endif
+}
+
+static void setup(void)
+{
+    if (!lv_is_initialized())
+        lv_init();
+
+    // The test app has no display on the board, add one which is flushed at once
+    if (lv_display_get_default() == NULL)
+    {
+        static uint8_t buf[240 * 24 * LV_COLOR_DEPTH / 8];
+        lv_display_t *disp = lv_display_create(240, 240);
+        lv_display_set_buffers(disp, buf, NULL, sizeof(buf), LV_DISPLAY_RENDER_MODE_PARTIAL);
+        lv_display_set_flush_cb(disp, flush_cb);
+    }
+
+    lv_tick_set_cb(tick_cb);
+    tick = 1000;
+
+    // Only the timers of the face run (and the ones resumed by it), not the input devices or monitors
+    paused_cnt = 0;
+    lv_timer_t *t = lv_timer_get_next(NULL);
+    while (t)
+    {
+        if (!lv_timer_get_paused(t))
+        {
+            TEST_ASSERT_LESS_THAN_UINT32(MAX_PAUSED, paused_cnt);
+            paused_timers[paused_cnt++] = t;
+            lv_timer_pause(t);
+        }
+        t = lv_timer_get_next(t);
+    }
+}
+
+void test_face_arena_no_alloc_after_init(void)
+{
+#if LV_USE_FACE && LV_USE_GIF
+    setup();
+    face_init();
+
+    uint32_t face_cnt;
+    uint32_t player_cnt;
+    lv_obj_t *face = find_child(&lv_face_class, &face_cnt);
+    find_child(&lv_gif_class, &player_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, face_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, player_cnt);
+
+    /* Render separately to tell the allocations of the face from the renderer's.
+     * The refresh timer is resumed by the invalidations so make it wait instead. */
+    lv_timer_t *refr_timer = lv_display_get_refr_timer(NULL);
+    lv_timer_set_period(refr_timer, 0x40000000);
+    lv_refr_now(NULL);
+
+    heap_state_t init;
+    heap_get(&init);
+    uint32_t alloc_cnt = init.alloc_cnt;
+
+    // The face is hidden while the GIF sequence plays
+    uint32_t seq_cnt = 0;
+    bool seq_playing = false;
+    uint32_t i;
+    for (i = 0; i < MAX_STEPS && seq_cnt < SEQ_CNT; i++)
+    {
+        tick += STEP_MS;
+        lv_timer_handler();
+
+        heap_state_t now;
+        heap_get(&now);
+        TEST_ASSERT_EQUAL_UINT32_MESSAGE(alloc_cnt, now.alloc_cnt, "Allocated memory after face_init()");
+
+        if (lv_obj_has_flag(face, LV_OBJ_FLAG_HIDDEN))
+        {
+            seq_playing = true;
+        }
+        else if (seq_playing)
+        {
+            seq_playing = false;
+            seq_cnt++;
+        }
+
+        if (i % REFR_EVERY == 0)
+        {
+            lv_refr_now(NULL);
+            heap_get(&now);
+            TEST_ASSERT_EQUAL_UINT32(init.live_cnt, now.live_cnt);
+            TEST_ASSERT_EQUAL_UINT32(init.live_size, now.live_size);
+            alloc_cnt = now.alloc_cnt;
+        }
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(SEQ_CNT, seq_cnt);
+
+    // The sequences reused the player created by face_init()
+    find_child(&lv_gif_class, &player_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, player_cnt);
+
+    lv_refr_now(NULL);
+    heap_state_t end;
+    heap_get(&end);
+    TEST_ASSERT_EQUAL_UINT32(init.live_cnt, end.live_cnt);
+    TEST_ASSERT_EQUAL_UINT32(init.live_size, end.live_size);
+
+    // face.c has no deinit: the face stays on the screen until the end
+    lv_timer_set_period(refr_timer, LV_DEF_REFR_PERIOD);
+    for (i = 0; i < paused_cnt; i++)
+        lv_timer_resume(paused_timers[i]);
+    lv_tick_set_cb(NULL);
+#endif
+}
+
+#ifdef ESP_PLATFORM
+void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_face_arena_no_alloc_after_init);
+    UNITY_END();
+}
+#else
+// On the host the tests run with the LVGL tests, which call these
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+#endif
@@ -80,8 +80,34 @@
         #undef LV_MEM_POOL_INCLUDE
         #undef LV_MEM_POOL_ALLOC
     #endif
+
+    /** Serve the small allocations (animations, timers, event descriptors, linked list nodes, etc.)
+     *  from pages of same-sized slots to not fragment the heap with them. Larger or excess
+     *  allocations still use the heap. */
+    #define LV_MEM_SLAB 0
+    #if LV_MEM_SLAB
+        /** Size difference of the slot size classes. Class `i` has `(i + 1) * LV_MEM_SLAB_CLASS_STEP` bytes slots. */
+        #define LV_MEM_SLAB_CLASS_STEP 16     /**< [bytes] */
+
+        /** Number of size classes. Allocations larger than `LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP` use the heap. */
+        #define LV_MEM_SLAB_CLASS_CNT 8
+
+        /** Size of a page. A page holds slots of a single class and is shared by the classes when it's empty. */
+        #define LV_MEM_SLAB_PAGE_SIZE 1024    /**< [bytes] */
+
+        /** Number of pages, allocated from the heap at once in `lv_mem_init()` */
+        #define LV_MEM_SLAB_PAGE_CNT 16
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Count the memory allocated by `lv_malloc()` per subsystem tag or call site.
+ *  Adds a small header to each allocation. See `lv_mem_profiler_dump()`. */
+#define LV_USE_MEM_PROFILER 0
+#if LV_USE_MEM_PROFILER
+    /** Number of tags and call sites counted separately. Further call sites are counted together. */
+    #define LV_MEM_PROFILER_ENTRY_CNT 32
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -229,6 +255,12 @@
         #define  LV_DRAW_SW_ASM_CUSTOM_INCLUDE ""
     #endif
 
+    #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+        /** 1: Build the AVX2 kernels too and pick them at runtime if the CPU supports AVX2.
+         *  0: Use AVX2 only if the compiler targets it (e.g. `-mavx2`), else SSE2. */
+        #define LV_DRAW_SW_X86_RUNTIME_DETECT 1
+    #endif
+
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #define LV_USE_DRAW_SW_COMPLEX_GRADIENTS    0
 
@@ -461,6 +493,18 @@
 /** Add 2 x 32-bit variables to each `lv_obj_t` to speed up getting style properties */
 #define LV_OBJ_STYLE_CACHE      0
 
+/** 1: Cache the resolved values of the style properties used for drawing per object and part.
+ *  Getting e.g. the background color while drawing becomes an array lookup instead of checking
+ *  all the styles of the object (and its parents) in every rendered strip.
+ *  Needs about 40 bytes per cached part (e.g. `LV_PART_MAIN`) of the drawn objects
+ *  and a pointer size for each property set by their styles. */
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+
+/** 1: Keep the running timers in a min-heap sorted by their next expiry time.
+ *  `lv_timer_handler()` checks only the expired timers instead of every timer and
+ *  paused timers cost nothing. Adds 4 x 32-bit variables to each `lv_timer_t`. */
+#define LV_USE_TIMER_HEAP       0
+
 /** Add `id` field to `lv_obj_t` */
 #define LV_USE_OBJ_ID           0
 
@@ -625,6 +669,11 @@
 
 /** Enables/disables support for compressed fonts. */
 #define LV_USE_FONT_COMPRESSED 0
+#if LV_USE_FONT_COMPRESSED
+    /** Size in bytes of the cache of the decompressed glyph bitmaps shared by all compressed fonts.
+     *  E.g. the 10 digits of a 28 px font need about 10 * 20 * 20 = 4 kB. 0: decompress the glyphs on every draw. */
+    #define LV_FONT_COMPRESSED_CACHE_SIZE 0
+#endif
 
 /** Enable drawing placeholders when glyph dsc is not found. */
 #define LV_USE_FONT_PLACEHOLDER 1
@@ -722,6 +771,8 @@
 
 #define LV_USE_DROPDOWN   1   /**< Requires: lv_label */
 
+#define LV_USE_FACE       0
+
 #define LV_USE_IMAGE      1   /**< Requires: lv_label */
 
 #define LV_USE_IMAGEBUTTON     1
@@ -763,6 +814,8 @@
 
 #define LV_USE_SPINNER    1
 
+#define LV_USE_SPRITE     0  /**< Requires: lv_canvas */
+
 #define LV_USE_SWITCH     1
 
 #define LV_USE_TABLE      1
@@ -922,6 +975,14 @@
 #   define LV_USE_THORVG_EXTERNAL 0
 #endif
 
+#if LV_USE_THORVG_INTERNAL
+/* Number of worker threads preparing the shapes of ThorVG (path transform, stroke, RLE generation)
+ * in parallel with the drawing. They use `LV_DRAW_THREAD_PRIO` and `LV_DRAW_THREAD_STACK_SIZE`.
+ *  - Requires `LV_USE_OS`
+ *  - 0: prepare the shapes on the drawing thread */
+#   define LV_THORVG_WORKER_CNT 0
+#endif
+
 /*Enable LZ4 compress/decompress lib*/
 #ifndef LV_USE_LZ4
 #   define LV_USE_LZ4  0
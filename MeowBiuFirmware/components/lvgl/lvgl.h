@@ -61,6 +61,8 @@ extern "C" {
 #include "src/widgets/chart/lv_chart.h"
 #include "src/widgets/checkbox/lv_checkbox.h"
 #include "src/widgets/dropdown/lv_dropdown.h"
+#include "src/widgets/face/lv_face.h"
+#include "src/widgets/face/lv_face_timeline.h"
 #include "src/widgets/image/lv_image.h"
 #include "src/widgets/imagebutton/lv_imagebutton.h"
 #include "src/widgets/keyboard/lv_keyboard.h"
@@ -77,6 +79,7 @@ extern "C" {
 #include "src/widgets/span/lv_span.h"
 #include "src/widgets/spinbox/lv_spinbox.h"
 #include "src/widgets/spinner/lv_spinner.h"
+#include "src/widgets/sprite/lv_sprite.h"
 #include "src/widgets/switch/lv_switch.h"
 #include "src/widgets/table/lv_table.h"
 #include "src/widgets/tabview/lv_tabview.h"
@@ -84,6 +84,7 @@ extern "C" {
 #include "src/widgets/line/lv_line_private.h"
 #include "src/widgets/animimage/lv_animimage_private.h"
 #include "src/widgets/dropdown/lv_dropdown_private.h"
+#include "src/widgets/face/lv_face_private.h"
 #include "src/widgets/menu/lv_menu_private.h"
 #include "src/widgets/chart/lv_chart_private.h"
 #include "src/widgets/button/lv_button_private.h"
@@ -102,6 +103,7 @@ extern "C" {
 #include "src/libs/rlottie/lv_rlottie_private.h"
 #include "src/libs/ffmpeg/lv_ffmpeg_private.h"
 #include "src/widgets/lottie/lv_lottie_private.h"
+#include "src/widgets/sprite/lv_sprite_private.h"
 #include "src/osal/lv_os_private.h"
 
 /*********************
@@ -1,5 +1,6 @@
 #!/usr/bin/env python3
 import os
+import math
 import logging
 import argparse
 import subprocess
@@ -481,36 +482,72 @@ class LVGLImageHeader:
 
 
 class LVGLCompressData:
+    """
+    Compressed image data. With `rows` every `rows` rows of `stride` bytes
+    are compressed on their own and an index of the chunks is added, so the
+    decoder can decompress only the rows being drawn:
+        uint32 offsets[chunk_cnt + 1]  relative to the end of the index
+        chunks
+    """
 
     def __init__(self,
                  cf: ColorFormat,
                  method: CompressMethod,
-                 raw_data: bytes = b''):
+                 raw_data: bytes = b'',
+                 stride: int = 0,
+                 rows: int = 0):
         self.blk_size = (cf.bpp + 7) // 8
         self.compress = method
         self.raw_data = raw_data
         self.raw_data_len = len(raw_data)
+        self.rows = rows
+        if rows and method != CompressMethod.NONE:
+            if not cf.is_colormap or cf == ColorFormat.RGB565A8:
+                raise ParameterError(f"{cf.name} can't be compressed in chunks")
+            if not 0 < rows < 4096 or stride <= 0:
+                raise ParameterError(f"Invalid chunk rows: {rows}, stride: {stride}")
+            if method == CompressMethod.RLE and stride % self.blk_size:
+                raise ParameterError(f"Stride {stride} is not whole pixels, "
+                                     "pad the rows before compressing")
+            self.chunk_size = stride * rows
+        else:
+            self.rows = 0
         self.compressed = self._compress(raw_data)
 
-    def _compress(self, raw_data: bytes) -> bytearray:
-        if self.compress == CompressMethod.NONE:
-            return raw_data
-
+    def _compress_chunk(self, raw_data: bytes) -> bytes:
         if self.compress == CompressMethod.RLE:
-            # RLE compression performs on pixel unit, pad data to pixel unit
+            # RLE compression performs on pixel unit, pad data to pixel unit.
+            # The rows of chunks are already padded by LVGLImage.
             pad = b'\x00' * 0
-            if self.raw_data_len % self.blk_size:
-                pad = b'\x00' * (self.blk_size - self.raw_data_len % self.blk_size)
-            compressed = RLEImage().rle_compress(raw_data + pad, self.blk_size)
+            if len(raw_data) % self.blk_size:
+                pad = b'\x00' * (self.blk_size - len(raw_data) % self.blk_size)
+            return RLEImage().rle_compress(raw_data + pad, self.blk_size)
         elif self.compress == CompressMethod.LZ4:
-            compressed = lz4.block.compress(raw_data, store_size=False)
+            return lz4.block.compress(raw_data, store_size=False)
         else:
             raise ParameterError(f"Invalid compress method: {self.compress}")
 
+    def _compress(self, raw_data: bytes) -> bytearray:
+        if self.compress == CompressMethod.NONE:
+            return raw_data
+
+        if self.rows:
+            chunks = [self._compress_chunk(raw_data[i:i + self.chunk_size])
+                      for i in range(0, self.raw_data_len, self.chunk_size)]
+            index = bytearray()
+            offset = 0
+            for chunk in chunks:
+                index += uint32_t(offset)
+                offset += len(chunk)
+            index += uint32_t(offset)
+            compressed = bytes(index) + b''.join(chunks)
+        else:
+            compressed = self._compress_chunk(raw_data)
+
         self.compressed_len = len(compressed)
 
         bin = bytearray()
-        bin += uint32_t(self.compress.value)
+        bin += uint32_t(self.compress.value | self.rows << 4)
         bin += uint32_t(self.compressed_len)
         bin += uint32_t(self.raw_data_len)
         bin += compressed
@@ -525,6 +562,7 @@ class LVGLImage:
                  h: int = 0,
                  data: bytes = b'') -> None:
         self.stride = 0  # default no valid stride value
+        self.align = 1  # stride alignment set by adjust_stride
         self.premultiplied = False
         self.rgb565_dither = False
         self.nema_gfx = False
@@ -549,6 +587,7 @@ class LVGLImage:
             # The header with specified stride alignment
             header = LVGLImageHeader(self.cf, self.w, self.h, align=align)
             stride = header.stride
+            self.align = align
         elif stride > 0:
             pass
         else:
@@ -603,6 +642,20 @@ class LVGLImage:
         self.stride = stride
         self.data = bytearray(b''.join(data_out))
 
+    def _pad_rows_to_pixels(self, compress: CompressMethod, rows: int):
+        """
+        RLE compresses whole pixels. Pad every row to whole pixels, keeping
+        the stride aligned, so that the chunks of rows are whole pixels too
+        and the pixels of all rows are compressed the same way.
+        """
+        blk_size = (self.cf.bpp + 7) // 8
+        if compress != CompressMethod.RLE or not rows or \
+                self.stride % blk_size == 0:
+            return
+
+        unit = self.align * blk_size // math.gcd(self.align, blk_size)
+        self.adjust_stride(stride=(self.stride + unit - 1) // unit * unit)
+
     def premultiply(self):
         """
         Pre-multiply image RGB data with alpha, set corresponding image header flags
@@ -774,13 +827,17 @@ class LVGLImage:
 
     def to_bin(self,
                filename: str,
-               compress: CompressMethod = CompressMethod.NONE):
+               compress: CompressMethod = CompressMethod.NONE,
+               rows: int = 0):
         """
         Write this image to file, filename should be ended with '.bin'
+        With `rows` the image is compressed in chunks of this many rows
         """
         self._check_ext(filename, ".bin")
         self._check_dir(filename)
 
+        old_stride = self.stride
+        self._pad_rows_to_pixels(compress, rows)
         with open(filename, "wb+") as f:
             bin = bytearray()
             flags = 0
@@ -793,27 +850,34 @@ class LVGLImage:
                                      self.stride,
                                      flags=flags)
             bin += header.binary
-            compressed = LVGLCompressData(self.cf, compress, self.data)
+            compressed = LVGLCompressData(self.cf, compress, self.data,
+                                          self.stride, rows)
             bin += compressed.compressed
 
             f.write(bin)
 
+        self.adjust_stride(stride=old_stride)
         return self
 
     def to_c_array(self,
                    filename: str,
                    compress: CompressMethod = CompressMethod.NONE,
-                   outputname: str = None):
+                   outputname: str = None,
+                   rows: int = 0):
         self._check_ext(filename, ".c")
         self._check_dir(filename)
 
+        old_stride = self.stride
+        self._pad_rows_to_pixels(compress, rows)
         if compress != CompressMethod.NONE:
-            data = LVGLCompressData(self.cf, compress, self.data).compressed
+            data = LVGLCompressData(self.cf, compress, self.data,
+                                    self.stride, rows).compressed
         else:
             data = self.data
         write_c_array_file(self.w, self.h, self.stride, self.cf, filename, outputname,
                            self.premultiplied,
                            compress, data)
+        self.adjust_stride(stride=old_stride)
 
     def to_png(self, filename: str):
         self._check_ext(filename, ".png")
@@ -1179,7 +1243,11 @@ class RLEImage(LVGLImage):
             f.write(header)
             f.write(compressed)
 
-    def rle_compress(self, data: bytearray, blksize: int, threshold=16):
+    def rle_compress(self, data: bytearray, blksize: int, threshold=None):
+        if threshold is None:
+            # A repeat of about 16 bytes is as fast to decode as a literal,
+            # shorter ones are kept in the literals.
+            threshold = max(16 // blksize, 4)
         index = 0
         data_len = len(data)
         compressed_data = []
@@ -1315,6 +1383,7 @@ class PNGConverter:
                  align: int = 1,
                  premultiply: bool = False,
                  compress: CompressMethod = CompressMethod.NONE,
+                 rows: int = 0,
                  keep_folder=True,
                  rgb565_dither=False,
                  nema_gfx=False) -> None:
@@ -1327,6 +1396,7 @@ class PNGConverter:
         self.align = align
         self.premultiply = premultiply
         self.compress = compress
+        self.rows = rows
         self.background = background
         self.rgb565_dither = rgb565_dither
         self.nema_gfx = nema_gfx
@@ -1364,11 +1434,13 @@ class PNGConverter:
                 output.append((f, img))
                 if self.ofmt == OutputFormat.BIN_FILE:
                     img.to_bin(self._replace_ext(f, ".bin"),
-                               compress=self.compress)
+                               compress=self.compress,
+                               rows=self.rows)
                 elif self.ofmt == OutputFormat.C_ARRAY:
                     img.to_c_array(self._replace_ext(f, ".c", outputname),
                                    compress=self.compress,
-                                   outputname=outputname)
+                                   outputname=outputname,
+                                   rows=self.rows)
                 elif self.ofmt == OutputFormat.PNG_FILE:
                     img.to_png(self._replace_ext(f, ".png"))
 
@@ -1403,6 +1475,14 @@ def main():
                         default="NONE",
                         choices=["NONE", "RLE", "LZ4"])
 
+    parser.add_argument('--rows',
+                        help=("compress every this many rows on their own, "
+                              "so only the drawn rows are decompressed. "
+                              "Default to 0: compress the whole image"),
+                        default=0,
+                        type=int,
+                        metavar='rows')
+
     parser.add_argument('--align',
                         help="stride alignment in bytes for bin image",
                         default=1,
@@ -1462,6 +1542,7 @@ def main():
                              align=args.align,
                              premultiply=args.premultiply,
                              compress=compress,
+                             rows=args.rows,
                              keep_folder=False,
                              rgb565_dither=args.rgb565dither,
                              nema_gfx=args.nemagfx)
@@ -0,0 +1,146 @@
+#!/usr/bin/env python3
+"""
+Pre-parse a Lottie JSON file for lv_lottie_set_src_data().
+
+The JSON tokens are stored in a compact binary stream with the keys and
+strings interned in a string table. ThorVG reads it in place (e.g. from the
+flash) so neither the copy of the JSON nor the JSON parsing is needed.
+
+Layout (little endian):
+    header:
+        char magic[4]           "LTB1"
+        uint32 size             total size in bytes
+        float frame_rate, in_frame, out_frame, w, h
+        uint32 token_size       size of the token stream in bytes
+        uint32 str_size         size of the string table in bytes
+    token stream:
+        uint8 token [+ payload], see BinToken in tvgLottieParserHandler.cpp
+    string table:
+        NUL terminated UTF-8 strings, referred by their offset
+
+E.g.:
+    ./lottie_compiler.py path/to/lottie.json -o lottie.bin
+    ./lottie_compiler.py path/to/lottie.json --hex > out.txt
+"""
+
+import argparse
+import json
+import struct
+import sys
+import textwrap
+
+MAGIC = b'LTB1'
+HEADER = struct.Struct('<4sI5fII')
+
+NULL, FALSE, TRUE, OBJECT_BEGIN, OBJECT_END, ARRAY_BEGIN, ARRAY_END, \
+    KEY, STRING, INT8, INT16, INT32, FLOAT = range(13)
+
+
+class Compiler:
+    def __init__(self):
+        self.tokens = bytearray()
+        self.strings = bytearray()
+        self.offsets = {}
+
+    def intern(self, s):
+        if s not in self.offsets:
+            b = s.encode('utf-8')
+            if b'\x00' in b:
+                raise ValueError('NUL character in string: %r' % s)
+            self.offsets[s] = len(self.strings)
+            self.strings += b + b'\x00'
+        return self.offsets[s]
+
+    def varint(self, v):
+        while True:
+            c = v & 0x7f
+            v >>= 7
+            if v:
+                self.tokens.append(c | 0x80)
+            else:
+                self.tokens.append(c)
+                return
+
+    def ref(self, token, s):
+        self.tokens.append(token)
+        self.varint(self.intern(s))
+
+    def value(self, v):
+        if v is None:
+            self.tokens.append(NULL)
+        elif v is True:
+            self.tokens.append(TRUE)
+        elif v is False:
+            self.tokens.append(FALSE)
+        elif isinstance(v, int) and -2**31 <= v < 2**31:
+            if -128 <= v < 128:
+                self.tokens += struct.pack('<Bb', INT8, v)
+            elif -2**15 <= v < 2**15:
+                self.tokens += struct.pack('<Bh', INT16, v)
+            else:
+                self.tokens += struct.pack('<Bi', INT32, v)
+        elif isinstance(v, (int, float)):
+            self.tokens += struct.pack('<Bf', FLOAT, v)
+        elif isinstance(v, str):
+            self.ref(STRING, v)
+        elif isinstance(v, Object):
+            self.tokens.append(OBJECT_BEGIN)
+            for key, item in v:
+                self.ref(KEY, key)
+                self.value(item)
+            self.tokens.append(OBJECT_END)
+        elif isinstance(v, list):
+            self.tokens.append(ARRAY_BEGIN)
+            for item in v:
+                self.value(item)
+            self.tokens.append(ARRAY_END)
+        else:
+            raise TypeError('Unexpected value: %r' % v)
+
+
+class Object(list):
+    """The key-value pairs of an object in the original order, duplicates included"""
+
+
+def compile_lottie(text):
+    root = json.loads(text, object_pairs_hook=Object)
+    if not isinstance(root, Object):
+        raise ValueError('Not a Lottie file')
+
+    compiler = Compiler()
+    compiler.value(root)
+
+    def number(key):
+        for k, v in root:
+            if k == key and isinstance(v, (int, float)) and not isinstance(v, bool):
+                return float(v)
+        return 0.0
+
+    size = HEADER.size + len(compiler.tokens) + len(compiler.strings)
+    header = HEADER.pack(MAGIC, size, number('fr'), number('ip'), number('op'), number('w'), number('h'),
+                         len(compiler.tokens), len(compiler.strings))
+    return header + bytes(compiler.tokens) + bytes(compiler.strings)
+
+
+def main():
+    parser = argparse.ArgumentParser(description='Pre-parse a Lottie JSON file for LVGL')
+    parser.add_argument('input', help='the Lottie JSON file')
+    parser.add_argument('-o', '--output', help='write the binary to this file')
+    parser.add_argument('--hex', action='store_true', help='print a hex array like filetohex.py')
+    args = parser.parse_args()
+
+    with open(args.input, 'r', encoding='utf-8') as f:
+        data = compile_lottie(f.read())
+
+    if args.output:
+        with open(args.output, 'wb') as f:
+            f.write(data)
+    if args.hex or not args.output:
+        print(textwrap.fill(', '.join([hex(a) for a in data]), 96))
+
+    print('%s: %d bytes -> %d bytes' % (args.input, len(open(args.input, 'rb').read()), len(data)),
+          file=sys.stderr)
+
+
+if __name__ == '__main__':
+    main()
@@ -0,0 +1,79 @@
+#!/usr/bin/env python3
+
+import argparse
+import struct
+import subprocess
+
+TAG_NAMES = ['none', 'obj', 'style', 'draw', 'image', 'font', 'gif']
+FLAG_CALL_SITE = 0x01
+FLAG_OTHERS = 0x02
+FLAG_TOTAL = 0x04
+RECORD = struct.Struct('<BBxxIIIIIIQ')
+
+
+def get_arg():
+    parser = argparse.ArgumentParser(description='Decode the output of lv_mem_profiler_dump_bin().')
+    parser.add_argument('dump_file', metavar='dump_file', type=str,
+                        help='The binary dump, or its hex string if it ends with .hex')
+    parser.add_argument('--elf', type=str,
+                        help='The firmware ELF to resolve the call sites with addr2line')
+    parser.add_argument('--addr2line', type=str, default='addr2line',
+                        help='The addr2line of the toolchain, e.g. xtensa-esp32s3-elf-addr2line')
+    return parser.parse_args()
+
+
+def read_dump(path):
+    if path.endswith('.hex'):
+        with open(path) as f:
+            return bytes.fromhex(''.join(f.read().split()))
+    with open(path, 'rb') as f:
+        return f.read()
+
+
+def decode(data):
+    if data[0:4] != b'LVMP' or data[4] != 1:
+        raise ValueError('Not a memory profiler dump')
+    cnt = data[6] | (data[7] << 8)
+    records = []
+    for i in range(cnt + 1):
+        tag, flags, live_cnt, alloc_cnt, live, peak, frame_peak, frame_max, caller = \
+            RECORD.unpack_from(data, 8 + i * RECORD.size)
+        records.append({'tag': tag, 'flags': flags, 'live_cnt': live_cnt, 'alloc_cnt': alloc_cnt,
+                        'live': live, 'peak': peak, 'frame_peak': frame_peak, 'frame_max': frame_max,
+                        'caller': caller})
+    return records
+
+
+def resolve(records, elf, addr2line):
+    callers = [r['caller'] for r in records if r['flags'] & FLAG_CALL_SITE]
+    if not elf or not callers:
+        return {}
+    out = subprocess.run([addr2line, '-f', '-s', '-e', elf] + [hex(c) for c in callers],
+                         capture_output=True, text=True, check=True).stdout.splitlines()
+    return {c: '%s %s' % (out[2 * i], out[2 * i + 1]) for i, c in enumerate(callers)}
+
+
+def get_name(r, names):
+    if r['flags'] & FLAG_TOTAL:
+        return 'total'
+    if r['flags'] & FLAG_OTHERS:
+        return 'others'
+    if r['flags'] & FLAG_CALL_SITE:
+        return names.get(r['caller'], hex(r['caller']))
+    if r['tag'] < len(TAG_NAMES):
+        return TAG_NAMES[r['tag']]
+    return 'user+%d' % (r['tag'] - len(TAG_NAMES))
+
+
+if __name__ == '__main__':
+    args = get_arg()
+    records = decode(read_dump(args.dump_file))
+    names = resolve(records, args.elf, args.addr2line)
+
+    # The total first in the dump, print it last
+    records = sorted(records[1:], key=lambda r: r['live'], reverse=True) + records[:1]
+    print('%-40s %10s %7s %10s %10s %10s %8s' % ('tag/call site', 'live', 'blocks', 'peak', 'frame',
+                                                 'frame max', 'allocs'))
+    for r in records:
+        print('%-40s %10d %7d %10d %10d %10d %8d' % (get_name(r, names)[:40], r['live'], r['live_cnt'], r['peak'],
+                                                     r['frame_peak'], r['frame_max'], r['alloc_cnt']))
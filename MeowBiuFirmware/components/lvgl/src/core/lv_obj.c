@@ -14,7 +14,7 @@
 #include "lv_obj_class_private.h"
 #include "../indev/lv_indev.h"
 #include "../indev/lv_indev_private.h"
-#include "lv_refr.h"
+#include "lv_refr_private.h"
 #include "lv_group.h"
 #include "../display/lv_display.h"
 #include "../display/lv_display_private.h"
@@ -289,6 +289,10 @@ void lv_obj_remove_flag(lv_obj_t * obj, lv_obj_flag_t f)
         lv_obj_mark_layout_as_dirty(obj);
     }
 
+    if(f & LV_OBJ_FLAG_CACHED_LAYER) {
+        lv_refr_drop_layer_cache(obj);
+    }
+
     if((was_on_layout != lv_obj_is_layout_positioned(obj)) || (f & (LV_OBJ_FLAG_LAYOUT_1 |  LV_OBJ_FLAG_LAYOUT_2))) {
         lv_obj_mark_layout_as_dirty(lv_obj_get_parent(obj));
     }
@@ -376,7 +380,9 @@ void lv_obj_allocate_spec_attr(lv_obj_t * obj)
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
     if(obj->spec_attr == NULL) {
+        LV_MEM_TAG_BEGIN(LV_MEM_TAG_OBJ);
         obj->spec_attr = lv_malloc_zeroed(sizeof(lv_obj_spec_attr_t));
+        LV_MEM_TAG_END;
         LV_ASSERT_MALLOC(obj->spec_attr);
         if(obj->spec_attr == NULL) return;
 
@@ -520,6 +526,7 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_obj_enable_style_refresh(false); /*No need to refresh the style because the object will be deleted*/
     lv_obj_remove_style_all(obj);
     lv_obj_enable_style_refresh(true);
+    lv_obj_style_free_resolved(obj);
 
     /*Remove the animations from this object*/
     lv_anim_delete(obj, NULL);
@@ -548,6 +555,8 @@ static void lv_obj_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
         }
 #endif
 
+        lv_refr_drop_layer_cache(obj);
+
         lv_free(obj->spec_attr);
         obj->spec_attr = NULL;
     }
@@ -923,6 +932,8 @@ static void update_obj_state(lv_obj_t * obj, lv_state_t new_state)
     lv_obj_invalidate(obj);
 
     obj->state = new_state;
+    /*The children might inherit properties which depend on the state*/
+    lv_obj_style_invalidate_resolved(obj, true);
     lv_obj_update_layer_type(obj);
     lv_obj_style_transition_dsc_t * ts = lv_malloc_zeroed(sizeof(lv_obj_style_transition_dsc_t) * STYLE_TRANSITION_MAX);
     uint32_t tsi = 0;
@@ -48,7 +48,9 @@ lv_obj_t * lv_obj_class_create_obj(const lv_obj_class_t * class_p, lv_obj_t * pa
 {
     LV_TRACE_OBJ_CREATE("Creating object with %p class on %p parent", (void *)class_p, (void *)parent);
     uint32_t s = get_instance_size(class_p);
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_OBJ);
     lv_obj_t * obj = lv_malloc_zeroed(s);
+    LV_MEM_TAG_END;
     if(obj == NULL) return NULL;
     obj->class_p = class_p;
     obj->parent = parent;
@@ -109,7 +111,10 @@ void lv_obj_class_init_obj(lv_obj_t * obj)
     lv_obj_enable_style_refresh(false);
 
     lv_theme_apply(obj);
+
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_OBJ);
     lv_obj_construct(obj->class_p, obj);
+    LV_MEM_TAG_END;
 
     lv_obj_enable_style_refresh(true);
     lv_obj_refresh_style(obj, LV_PART_ANY, LV_STYLE_PROP_ANY);
@@ -823,6 +823,9 @@ void lv_obj_invalidate_area(const lv_obj_t * obj, const lv_area_t * area)
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if the area is not redrawn now, the cached layers can't be used anymore*/
+    lv_refr_invalidate_layer_cache((lv_obj_t *)obj);
+
     lv_display_t * disp   = lv_obj_get_display(obj);
     if(!lv_display_is_invalidation_enabled(disp)) return;
 
@@ -50,6 +50,9 @@ struct _lv_obj_spec_attr_t {
     uint16_t scroll_dir : 4;        /**< The allowed scroll direction(s), see `lv_dir_t`*/
     uint16_t layer_type : 2;        /**< Cache the layer type here. Element of lv_intermediate_layer_type_t */
     uint16_t name_static : 1;        /**< 1: `name` was not dynamically allocated */
+    uint16_t layer_cache_valid : 1; /**< 1: `layer_cache` shows the current look of the object and its children */
+
+    lv_draw_buf_t * layer_cache;    /**< The object and its children rendered with `LV_OBJ_FLAG_CACHED_LAYER`*/
 };
 
 struct _lv_obj_t {
@@ -60,6 +63,9 @@ struct _lv_obj_t {
 #if LV_OBJ_STYLE_CACHE
     uint32_t style_main_prop_is_set;
     uint32_t style_other_prop_is_set;
+#endif
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_obj_style_resolved_t * style_resolved;
 #endif
     void * user_data;
 #if LV_USE_OBJ_ID
@@ -76,6 +82,9 @@ struct _lv_obj_t {
     uint16_t h_layout   : 1;
     uint16_t w_layout   : 1;
     uint16_t is_deleting : 1;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint16_t style_resolved_dis : 1;
+#endif
 };
 
 
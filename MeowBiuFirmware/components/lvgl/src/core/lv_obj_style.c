@@ -68,11 +68,92 @@ static void fade_in_anim_completed(lv_anim_t * a);
 static bool style_has_flag(const lv_style_t * style, uint32_t flag);
 static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop,
                                               lv_style_value_t * value_act);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    static lv_obj_style_resolved_t * get_resolved(lv_obj_t * obj, lv_part_t part);
+    static void resolved_reset(lv_obj_style_resolved_t * resolved);
+    static uint32_t count_bits(uint32_t x);
+    static uint32_t resolved_value_index(const lv_obj_style_resolved_t * resolved, uint32_t slot);
+    static void resolved_add(lv_obj_style_resolved_t * resolved, uint32_t slot, const lv_style_value_t * value);
+#endif
 
 /**********************
  *  STATIC VARIABLES
  **********************/
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/*The slot + 1 of the cached properties in `lv_obj_style_resolved_t`. 0: not cached.
+ *Only the properties used for drawing are cached.*/
+static const uint8_t resolved_slots[LV_STYLE_NUM_BUILT_IN_PROPS] = {
+    [LV_STYLE_WIDTH] = 1,
+    [LV_STYLE_RADIUS] = 2,
+    [LV_STYLE_PAD_TOP] = 3,
+    [LV_STYLE_PAD_BOTTOM] = 4,
+    [LV_STYLE_PAD_LEFT] = 5,
+    [LV_STYLE_PAD_RIGHT] = 6,
+    [LV_STYLE_MARGIN_TOP] = 7,
+    [LV_STYLE_MARGIN_BOTTOM] = 8,
+    [LV_STYLE_MARGIN_LEFT] = 9,
+    [LV_STYLE_MARGIN_RIGHT] = 10,
+    [LV_STYLE_BG_COLOR] = 11,
+    [LV_STYLE_BG_OPA] = 12,
+    [LV_STYLE_BG_GRAD_DIR] = 13,
+    [LV_STYLE_BG_MAIN_STOP] = 14,
+    [LV_STYLE_BG_GRAD_STOP] = 15,
+    [LV_STYLE_BG_GRAD_COLOR] = 16,
+    [LV_STYLE_BG_MAIN_OPA] = 17,
+    [LV_STYLE_BG_GRAD_OPA] = 18,
+    [LV_STYLE_BG_GRAD] = 19,
+    [LV_STYLE_BASE_DIR] = 20,
+    [LV_STYLE_BG_IMAGE_SRC] = 21,
+    [LV_STYLE_CLIP_CORNER] = 22,
+    [LV_STYLE_BORDER_WIDTH] = 23,
+    [LV_STYLE_BORDER_COLOR] = 24,
+    [LV_STYLE_BORDER_OPA] = 25,
+    [LV_STYLE_BORDER_SIDE] = 26,
+    [LV_STYLE_BORDER_POST] = 27,
+    [LV_STYLE_OUTLINE_WIDTH] = 28,
+    [LV_STYLE_OUTLINE_COLOR] = 29,
+    [LV_STYLE_OUTLINE_OPA] = 30,
+    [LV_STYLE_OUTLINE_PAD] = 31,
+    [LV_STYLE_SHADOW_WIDTH] = 32,
+    [LV_STYLE_SHADOW_COLOR] = 33,
+    [LV_STYLE_SHADOW_OPA] = 34,
+    [LV_STYLE_SHADOW_OFFSET_X] = 35,
+    [LV_STYLE_SHADOW_OFFSET_Y] = 36,
+    [LV_STYLE_SHADOW_SPREAD] = 37,
+    [LV_STYLE_IMAGE_OPA] = 38,
+    [LV_STYLE_IMAGE_RECOLOR] = 39,
+    [LV_STYLE_IMAGE_RECOLOR_OPA] = 40,
+    [LV_STYLE_LINE_WIDTH] = 41,
+    [LV_STYLE_LINE_ROUNDED] = 42,
+    [LV_STYLE_LINE_COLOR] = 43,
+    [LV_STYLE_LINE_OPA] = 44,
+    [LV_STYLE_ARC_WIDTH] = 45,
+    [LV_STYLE_ARC_ROUNDED] = 46,
+    [LV_STYLE_ARC_COLOR] = 47,
+    [LV_STYLE_ARC_OPA] = 48,
+    [LV_STYLE_TEXT_COLOR] = 49,
+    [LV_STYLE_TEXT_OPA] = 50,
+    [LV_STYLE_TEXT_FONT] = 51,
+    [LV_STYLE_TEXT_LETTER_SPACE] = 52,
+    [LV_STYLE_TEXT_LINE_SPACE] = 53,
+    [LV_STYLE_TEXT_DECOR] = 54,
+    [LV_STYLE_TEXT_ALIGN] = 55,
+    [LV_STYLE_TEXT_OUTLINE_STROKE_WIDTH] = 56,
+    [LV_STYLE_TEXT_OUTLINE_STROKE_OPA] = 57,
+    [LV_STYLE_TEXT_OUTLINE_STROKE_COLOR] = 58,
+    [LV_STYLE_OPA] = 59,
+    [LV_STYLE_OPA_LAYERED] = 60,
+    [LV_STYLE_COLOR_FILTER_DSC] = 61,
+    [LV_STYLE_COLOR_FILTER_OPA] = 62,
+    [LV_STYLE_BLEND_MODE] = 63,
+    [LV_STYLE_TRANSFORM_WIDTH] = 64,
+    [LV_STYLE_TRANSFORM_HEIGHT] = 65,
+    [LV_STYLE_RECOLOR] = 66,
+    [LV_STYLE_RECOLOR_OPA] = 67,
+};
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -123,7 +204,9 @@ void lv_obj_add_style(lv_obj_t * obj, const lv_style_t * style, lv_style_selecto
     /*Allocate space for the new style and shift the rest of the style to the end*/
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
+    LV_MEM_TAG_END;
     LV_ASSERT_MALLOC(obj->styles);
 
     uint32_t j;
@@ -276,6 +359,10 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_style_selector_t selector, lv_style
 {
     LV_ASSERT_OBJ(obj, MY_CLASS);
 
+    /*Even if refreshing is disabled the cached values can't be used anymore*/
+    lv_obj_style_invalidate_resolved(obj, prop == LV_STYLE_PROP_ANY ||
+                                     lv_style_prop_has_flag(prop, LV_STYLE_PROP_FLAG_INHERITABLE));
+
     if(!style_refr) return;
 
     LV_PROFILER_STYLE_BEGIN;
@@ -327,18 +414,87 @@ void lv_obj_enable_style_refresh(bool en)
     style_refr = en;
 }
 
+void lv_obj_enable_style_resolved_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    obj->style_resolved_dis = !en;
+    if(!en) lv_obj_style_free_resolved(obj);
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(en);
+#endif
+}
+
+void lv_obj_style_invalidate_resolved(lv_obj_t * obj, bool children)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    lv_obj_style_resolved_t * resolved;
+    for(resolved = obj->style_resolved; resolved; resolved = resolved->next) {
+        resolved_reset(resolved);
+    }
+
+    if(children) {
+        uint32_t i;
+        uint32_t child_cnt = lv_obj_get_child_count(obj);
+        for(i = 0; i < child_cnt; i++) {
+            lv_obj_style_invalidate_resolved(obj->spec_attr->children[i], true);
+        }
+    }
+#else
+    LV_UNUSED(obj);
+    LV_UNUSED(children);
+#endif
+}
+
+void lv_obj_style_free_resolved(lv_obj_t * obj)
+{
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    while(obj->style_resolved) {
+        lv_obj_style_resolved_t * next = obj->style_resolved->next;
+        lv_free(obj->style_resolved->values);
+        lv_free(obj->style_resolved);
+        obj->style_resolved = next;
+    }
+#else
+    LV_UNUSED(obj);
+#endif
+}
+
 lv_style_value_t lv_obj_get_style_prop(const lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop)
 {
     LV_ASSERT_NULL(obj)
 
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    uint32_t slot = prop < LV_STYLE_NUM_BUILT_IN_PROPS ? resolved_slots[prop] : 0;
+    lv_obj_style_resolved_t * resolved = NULL;
+    /*The transitions are skipped only temporarily, don't cache these values*/
+    if(slot && !obj->skip_trans && !obj->style_resolved_dis) {
+        slot--;
+        resolved = get_resolved((lv_obj_t *)obj, part);
+        if(resolved && (resolved->valid[slot / 32] & ((uint32_t)1 << (slot % 32)))) {
+            if(resolved->is_set[slot / 32] & ((uint32_t)1 << (slot % 32))) {
+                return resolved->values[resolved_value_index(resolved, slot)];
+            }
+            return lv_style_prop_get_default(prop);
+        }
+    }
+    LV_GLOBAL_DEFAULT()->style_resolve_cnt++;
+#endif
+
     lv_style_selector_t selector = part | obj->state;
     lv_style_value_t value_act = { .ptr = NULL };
     lv_style_res_t found;
 
     found = get_selector_style_prop(obj, selector, prop, &value_act);
-    if(found == LV_STYLE_RES_FOUND) return value_act;
+    if(found != LV_STYLE_RES_FOUND) value_act = lv_style_prop_get_default(prop);
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    if(resolved) resolved_add(resolved, slot, found == LV_STYLE_RES_FOUND ? &value_act : NULL);
+#endif
 
-    return lv_style_prop_get_default(prop);
+    return value_act;
 }
 
 bool lv_obj_has_style_prop(const lv_obj_t * obj, lv_style_selector_t selector, lv_style_prop_t prop)
@@ -704,6 +860,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
     LV_ASSERT_MALLOC(obj->styles);
 
@@ -716,6 +873,7 @@ static lv_style_t * get_local_style(lv_obj_t * obj, lv_style_selector_t selector
 
     lv_memzero(&obj->styles[i], sizeof(lv_obj_style_t));
     obj->styles[i].style = lv_malloc_zeroed(sizeof(lv_style_t));
+    LV_MEM_TAG_END;
     lv_style_init((lv_style_t *)obj->styles[i].style);
 
     obj->styles[i].is_local = 1;
@@ -742,6 +900,7 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     obj->style_cnt++;
     LV_ASSERT(obj->style_cnt != 0);
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
     obj->styles = lv_realloc(obj->styles, obj->style_cnt * sizeof(lv_obj_style_t));
 
     for(i = obj->style_cnt - 1; i > 0 ; i--) {
@@ -750,6 +909,7 @@ static lv_obj_style_t * get_trans_style(lv_obj_t * obj,  lv_style_selector_t sel
 
     lv_memzero(&obj->styles[0], sizeof(lv_obj_style_t));
     obj->styles[0].style = lv_malloc(sizeof(lv_style_t));
+    LV_MEM_TAG_END;
     lv_style_init((lv_style_t *)obj->styles[0].style);
 
     obj->styles[0].is_trans = 1;
@@ -1039,6 +1199,8 @@ static lv_layer_type_t calculate_layer_type(lv_obj_t * obj)
 
 static void full_cache_refresh(lv_obj_t * obj, lv_part_t part)
 {
+    lv_obj_style_invalidate_resolved(obj, false);
+
 #if LV_OBJ_STYLE_CACHE
     uint32_t i;
     if(part == LV_PART_MAIN || part == LV_PART_ANY) {
@@ -1191,3 +1353,104 @@ static lv_style_res_t get_selector_style_prop(const lv_obj_t * obj, lv_style_sel
 
     return LV_STYLE_RES_NOT_FOUND;
 }
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+/**
+ * Get the cache of the resolved style properties of an object's part in its current state
+ * @param obj       pointer to an object
+ * @param part      the part
+ * @return          the cache or NULL if it couldn't be allocated
+ */
+static lv_obj_style_resolved_t * get_resolved(lv_obj_t * obj, lv_part_t part)
+{
+    lv_obj_style_resolved_t * resolved;
+    for(resolved = obj->style_resolved; resolved; resolved = resolved->next) {
+        if(resolved->part == part) break;
+    }
+
+    if(resolved == NULL) {
+        LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
+        resolved = lv_malloc_zeroed(sizeof(lv_obj_style_resolved_t));
+        LV_MEM_TAG_END;
+        if(resolved == NULL) return NULL;
+        resolved->part = part;
+        resolved->state = obj->state;
+        resolved->next = obj->style_resolved;
+        obj->style_resolved = resolved;
+    }
+    else if(resolved->state != obj->state) {
+        resolved->state = obj->state;
+        resolved_reset(resolved);
+    }
+
+    return resolved;
+}
+
+/**
+ * Forget the resolved values but keep the memory of the values for the next ones
+ * @param resolved  pointer to a cache
+ */
+static void resolved_reset(lv_obj_style_resolved_t * resolved)
+{
+    lv_memzero(resolved->valid, sizeof(resolved->valid));
+    lv_memzero(resolved->is_set, sizeof(resolved->is_set));
+    resolved->value_cnt = 0;
+}
+
+static uint32_t count_bits(uint32_t x)
+{
+#if defined(__GNUC__) || defined(__clang__)
+    return (uint32_t)__builtin_popcount(x);
+#else
+    x = x - ((x >> 1) & 0x55555555);
+    x = (x & 0x33333333) + ((x >> 2) & 0x33333333);
+    return (((x + (x >> 4)) & 0x0F0F0F0F) * 0x01010101) >> 24;
+#endif
+}
+
+/**
+ * Get the index of a slot's value in `values`
+ * @param resolved  pointer to a cache
+ * @param slot      a slot set by a style
+ * @return          the number of the slots before `slot` which are set by a style
+ */
+static uint32_t resolved_value_index(const lv_obj_style_resolved_t * resolved, uint32_t slot)
+{
+    uint32_t idx = 0;
+    uint32_t i;
+    for(i = 0; i < slot / 32; i++) idx += count_bits(resolved->is_set[i]);
+    return idx + count_bits(resolved->is_set[slot / 32] & (((uint32_t)1 << (slot % 32)) - 1));
+}
+
+/**
+ * Store a resolved value
+ * @param resolved  pointer to a cache
+ * @param slot      the slot of the property
+ * @param value     the value set by a style, or NULL if the property has its default value
+ */
+static void resolved_add(lv_obj_style_resolved_t * resolved, uint32_t slot, const lv_style_value_t * value)
+{
+    uint32_t bit = (uint32_t)1 << (slot % 32);
+    if(value) {
+        if(resolved->value_cnt == resolved->value_size) {
+            /*Grow a few at once as the properties are read one by one while drawing*/
+            uint32_t new_size = LV_MIN(resolved->value_size + 4, LV_OBJ_STYLE_RESOLVED_SLOT_CNT);
+            LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
+            lv_style_value_t * values = lv_realloc(resolved->values, new_size * sizeof(lv_style_value_t));
+            LV_MEM_TAG_END;
+            if(values == NULL) return;
+            resolved->values = values;
+            resolved->value_size = (uint8_t)new_size;
+        }
+
+        uint32_t idx = resolved_value_index(resolved, slot);
+        lv_memmove(&resolved->values[idx + 1], &resolved->values[idx],
+                   (resolved->value_cnt - idx) * sizeof(lv_style_value_t));
+        resolved->values[idx] = *value;
+        resolved->value_cnt++;
+        resolved->is_set[slot / 32] |= bit;
+    }
+
+    resolved->valid[slot / 32] |= bit;
+}
+#endif
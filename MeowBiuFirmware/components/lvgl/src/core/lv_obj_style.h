@@ -117,6 +117,15 @@ void lv_obj_refresh_style(lv_obj_t * obj, lv_part_t part, lv_style_prop_t prop);
  */
 void lv_obj_enable_style_refresh(bool en);
 
+/**
+ * Enable or disable caching the resolved values of the style properties used for drawing.
+ * It's enabled by default if `LV_OBJ_STYLE_RESOLVED_CACHE` is enabled.
+ * Disabling it frees the memory of the cache, e.g. for objects which are rarely drawn.
+ * @param obj       pointer to an object
+ * @param en        true: cache the resolved style properties; false: always check the styles
+ */
+void lv_obj_enable_style_resolved_cache(lv_obj_t * obj, bool en);
+
 /**
  * Get the value of a style property. The current state of the object will be considered.
  * Inherited properties will be inherited.
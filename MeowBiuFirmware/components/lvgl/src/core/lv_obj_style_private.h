@@ -20,6 +20,9 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/** Number of style properties whose resolved value is cached*/
+#define LV_OBJ_STYLE_RESOLVED_SLOT_CNT 67
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -31,6 +34,19 @@ struct _lv_obj_style_t {
     uint32_t is_trans : 1;
 };
 
+/** The resolved values of the cached style properties of an object's part.
+ *  Only the values set by a style are stored, the others are the default values.*/
+struct _lv_obj_style_resolved_t {
+    lv_obj_style_resolved_t * next;
+    lv_style_value_t * values;  /**< The values of the slots set by a style, in the order of the slots*/
+    uint32_t valid[(LV_OBJ_STYLE_RESOLVED_SLOT_CNT + 31) / 32];     /**< A bit for each resolved slot*/
+    uint32_t is_set[(LV_OBJ_STYLE_RESOLVED_SLOT_CNT + 31) / 32];    /**< A bit for each slot set by a style*/
+    lv_part_t part;
+    lv_state_t state;           /**< The state of the object when the values were resolved*/
+    uint8_t value_cnt;          /**< Number of the used `values`*/
+    uint8_t value_size;         /**< Number of the allocated `values`*/
+};
+
 struct _lv_obj_style_transition_dsc_t {
     uint16_t time;
     uint16_t delay;
@@ -84,6 +100,22 @@ lv_style_state_cmp_t lv_obj_style_state_compare(lv_obj_t * obj, lv_state_t state
  */
 void lv_obj_update_layer_type(lv_obj_t * obj);
 
+/**
+ * Forget the cached resolved style properties of an object.
+ * Does nothing if `LV_OBJ_STYLE_RESOLVED_CACHE` is disabled.
+ * @param obj           pointer to an object
+ * @param children      true: forget the cached properties of all the children too,
+ *                      e.g. because an inherited property might have changed
+ */
+void lv_obj_style_invalidate_resolved(lv_obj_t * obj, bool children);
+
+/**
+ * Free the cache of the resolved style properties of an object.
+ * Does nothing if `LV_OBJ_STYLE_RESOLVED_CACHE` is disabled.
+ * @param obj           pointer to an object
+ */
+void lv_obj_style_free_resolved(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
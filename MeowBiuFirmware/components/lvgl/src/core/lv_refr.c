@@ -23,6 +23,7 @@
 #include "../draw/lv_draw_private.h"
 #include "../font/lv_font_fmt_txt.h"
 #include "../stdlib/lv_string.h"
+#include "../misc/cache/instance/lv_image_cache.h"
 #include "lv_global.h"
 
 /*********************
@@ -32,6 +33,10 @@
 /*Display being refreshed*/
 #define disp_refr LV_GLOBAL_DEFAULT()->disp_refresh
 
+/*Smallest area in pixels worth rendering as a separate tile.
+ *Each tile walks the object tree and syncs with the draw units so smaller tiles would cost more than they gain*/
+#define TILE_MIN_SIZE   (64 * 64)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -40,6 +45,8 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_refr_join_area(void);
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area);
+static void join_into_cheapest_area(lv_display_t * disp, const lv_area_t * area);
 static void refr_invalid_areas(void);
 static void refr_sync_areas(void);
 static void refr_area(const lv_area_t * area_p, int32_t y_offset);
@@ -47,7 +54,12 @@ static void refr_configured_layer(lv_layer_t * layer);
 static lv_obj_t * lv_refr_get_top_obj(const lv_area_t * area_p, lv_obj_t * obj);
 static void refr_obj_and_children(lv_layer_t * layer, lv_obj_t * top_obj);
 static void refr_obj(lv_layer_t * layer, lv_obj_t * obj);
+static bool refr_obj_cached(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type, lv_opa_t opa_layered);
+static bool layer_cache_render(lv_obj_t * obj, const lv_area_t * area);
+static void layer_cache_convert_to_rgb565a8(const lv_draw_buf_t * src, lv_draw_buf_t * dest);
+static void layer_remove(lv_layer_t * layer);
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h);
+static uint32_t get_tile_cnt(lv_display_t * disp, lv_layer_t * layer, const lv_area_t * area_p);
 static void draw_buf_flush(lv_display_t * disp);
 static void call_flush_cb(lv_display_t * disp, const lv_area_t * area, uint8_t * px_map);
 static void wait_for_flushing(lv_display_t * disp);
@@ -319,13 +331,14 @@ void lv_inv_area(lv_display_t * disp, const lv_area_t * area_p)
     }
 
     /*Save the area*/
-    lv_area_t * tmp_area_p = &com_area;
-    if(disp->inv_p >= LV_INV_BUF_SIZE) { /*If no place for the area add the screen*/
-        disp->inv_p = 0;
-        tmp_area_p = &scr_area;
+    if(disp->inv_p >= LV_INV_BUF_SIZE) {
+        /*If no place for the area join it to an other area instead of redrawing the whole screen*/
+        join_into_cheapest_area(disp, &com_area);
+    }
+    else {
+        lv_area_copy(&disp->inv_areas[disp->inv_p], &com_area);
+        disp->inv_p++;
     }
-    lv_area_copy(&disp->inv_areas[disp->inv_p], tmp_area_p);
-    disp->inv_p++;
 
     lv_display_send_event(disp, LV_EVENT_REFR_REQUEST, NULL);
 }
@@ -348,6 +361,24 @@ void lv_refr_set_disp_refreshing(lv_display_t * disp)
     disp_refr = disp;
 }
 
+void lv_refr_invalidate_layer_cache(lv_obj_t * obj)
+{
+    while(obj) {
+        if(obj->spec_attr) obj->spec_attr->layer_cache_valid = 0;
+        obj = obj->parent;
+    }
+}
+
+void lv_refr_drop_layer_cache(lv_obj_t * obj)
+{
+    if(obj->spec_attr == NULL || obj->spec_attr->layer_cache == NULL) return;
+
+    lv_image_cache_drop(obj->spec_attr->layer_cache);
+    lv_draw_buf_destroy(obj->spec_attr->layer_cache);
+    obj->spec_attr->layer_cache = NULL;
+    obj->spec_attr->layer_cache_valid = 0;
+}
+
 void lv_display_refr_timer(lv_timer_t * tmr)
 {
     LV_PROFILER_REFR_BEGIN;
@@ -381,6 +412,10 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_display_send_event(disp_refr, LV_EVENT_REFR_START, NULL);
 
+#if LV_USE_MEM_PROFILER
+    lv_mem_profiler_frame_begin();
+#endif
+
     /*Refresh the screen's layout if required*/
     LV_PROFILER_LAYOUT_BEGIN_TAG("layout");
     lv_obj_update_layout(disp_refr->act_scr);
@@ -400,7 +435,10 @@ void lv_display_refr_timer(lv_timer_t * tmr)
 
     lv_refr_join_area();
     refr_sync_areas();
+
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_DRAW);
     refr_invalid_areas();
+    LV_MEM_TAG_END;
 
     if(disp_refr->inv_p == 0) goto refr_finish;
     /*In double buffered direct mode save the updated areas.
@@ -426,6 +464,10 @@ refr_finish:
     lv_draw_sw_mask_cleanup();
 #endif
 
+#if LV_USE_MEM_PROFILER
+    lv_mem_profiler_frame_end();
+#endif
+
     lv_display_send_event(disp_refr, LV_EVENT_REFR_READY, NULL);
 
     LV_TRACE_REFR("finished");
@@ -455,16 +497,18 @@ static void lv_refr_join_area(void)
                 continue;
             }
 
-            /*Check if the areas are on each other*/
-            if(lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
+            /*Check if the areas are on each other.
+             *If flushing has a fixed cost it might be worth joining distinct areas too.*/
+            if(disp_refr->flush_area_cost == 0 &&
+               lv_area_is_on(&disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]) == false) {
                 continue;
             }
 
             lv_area_join(&joined_area, &disp_refr->inv_areas[join_in], &disp_refr->inv_areas[join_from]);
 
-            /*Join two area only if the joined area size is smaller*/
-            if(lv_area_get_size(&joined_area) < (lv_area_get_size(&disp_refr->inv_areas[join_in]) +
-                                                 lv_area_get_size(&disp_refr->inv_areas[join_from]))) {
+            /*Join two area only if refreshing the joined area is cheaper*/
+            if(get_area_cost(disp_refr, &joined_area) < (get_area_cost(disp_refr, &disp_refr->inv_areas[join_in]) +
+                                                         get_area_cost(disp_refr, &disp_refr->inv_areas[join_from]))) {
                 lv_area_copy(&disp_refr->inv_areas[join_in], &joined_area);
 
                 /*Mark 'join_form' is joined into 'join_in'*/
@@ -475,6 +519,51 @@ static void lv_refr_join_area(void)
     LV_PROFILER_REFR_END;
 }
 
+/**
+ * Get the modelled cost of refreshing an area set by `lv_display_set_flush_cost()`
+ * @param disp      pointer to a display
+ * @param area      the area to refresh
+ * @return          the cost of the pixels and the flushes
+ */
+static uint64_t get_area_cost(lv_display_t * disp, const lv_area_t * area)
+{
+    uint64_t cost = (uint64_t)lv_area_get_size(area) * disp->flush_px_cost;
+    if(disp->flush_area_cost == 0) return cost;
+
+    /*In partial mode the areas larger than the buffer are flushed in parts*/
+    uint32_t flush_cnt = 1;
+    if(disp->render_mode == LV_DISPLAY_RENDER_MODE_PARTIAL && disp->buf_act) {
+        uint32_t stride = lv_draw_buf_width_to_stride(lv_area_get_width(area), disp->color_format);
+        uint32_t max_row = stride ? disp->buf_act->data_size / stride : 0;
+        if(max_row) flush_cnt = (lv_area_get_height(area) + max_row - 1) / max_row;
+    }
+
+    return cost + (uint64_t)flush_cnt * disp->flush_area_cost;
+}
+
+/**
+ * Join an area to the invalidated area whose refresh cost grows the least
+ * @param disp      pointer to a display with full `inv_areas`
+ * @param area      the new invalidated area
+ */
+static void join_into_cheapest_area(lv_display_t * disp, const lv_area_t * area)
+{
+    uint32_t best_i = 0;
+    uint64_t best_cost = UINT64_MAX;
+    lv_area_t joined_area;
+    uint32_t i;
+    for(i = 0; i < disp->inv_p; i++) {
+        lv_area_join(&joined_area, &disp->inv_areas[i], area);
+        uint64_t cost = get_area_cost(disp, &joined_area) - get_area_cost(disp, &disp->inv_areas[i]);
+        if(cost < best_cost) {
+            best_cost = cost;
+            best_i = i;
+        }
+    }
+
+    lv_area_join(&disp->inv_areas[best_i], &disp->inv_areas[best_i], area);
+}
+
 /**
  * Refresh the sync areas
  */
@@ -709,22 +798,9 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         layer_reshape_draw_buf(layer, disp_refr->stride_is_auto ? LV_STRIDE_AUTO : layer->draw_buf->header.stride);
     }
 
-    /*Try to divide the area to smaller tiles*/
-    uint32_t tile_cnt = 1;
-    int32_t tile_h = lv_area_get_height(area_p);
-    if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format) == false) {
-        /* Assume that the the buffer size (can be screen sized or smaller in case of partial mode)
-         * and max tile size are the optimal scenario. From this calculate the ideal tile size
-         * and set the tile count and tile height accordingly.
-         */
-        uint32_t max_tile_cnt = disp_refr->tile_cnt;
-        uint32_t total_buf_size = layer->draw_buf->data_size;
-        uint32_t ideal_tile_size = total_buf_size / max_tile_cnt;
-        uint32_t area_buf_size = lv_area_get_size(area_p) * lv_color_format_get_size(layer->color_format);
-
-        tile_cnt = (area_buf_size + (ideal_tile_size - 1)) / ideal_tile_size; /*Round up*/
-        tile_h = lv_area_get_height(area_p) / tile_cnt;
-    }
+    /*Try to divide the area to horizontal tiles which can be rendered in parallel*/
+    uint32_t tile_cnt = get_tile_cnt(disp_refr, layer, area_p);
+    int32_t area_h = lv_area_get_height(area_p);
 
     if(tile_cnt == 1) {
         refr_configured_layer(layer);
@@ -742,13 +818,10 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
         }
         uint32_t i;
         for(i = 0; i < tile_cnt; i++) {
+            /*Distribute the remainder rows evenly so that no tile is much larger than the others*/
             lv_area_t tile_area;
-            lv_area_set(&tile_area, area_p->x1, area_p->y1 + i * tile_h,
-                        area_p->x2, area_p->y1 + (i + 1) * tile_h - 1);
-
-            if(i == tile_cnt - 1) {
-                tile_area.y2 = area_p->y2;
-            }
+            lv_area_set(&tile_area, area_p->x1, area_p->y1 + (int32_t)(i * area_h / tile_cnt),
+                        area_p->x2, area_p->y1 + (int32_t)((i + 1) * area_h / tile_cnt) - 1);
 
             lv_layer_t * tile_layer = &tile_layers[i];
             lv_draw_layer_init(tile_layer, NULL, layer->color_format, &tile_area);
@@ -766,16 +839,7 @@ static void refr_area(const lv_area_t * area_p, int32_t y_offset)
                 lv_draw_dispatch();
             }
 
-            lv_layer_t * layer_i = disp_refr->layer_head;
-            while(layer_i) {
-                if(layer_i->next == tile_layer) {
-                    layer_i->next = tile_layer->next;
-                    break;
-                }
-                layer_i = layer_i->next;
-            }
-
-            if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, tile_layer);
+            layer_remove(tile_layer);
         }
         lv_free(tile_layers);
     }
@@ -1205,7 +1269,10 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     layer->recolor = lv_obj_style_apply_recolor(obj, LV_PART_MAIN, layer->recolor);
 
     lv_layer_type_t layer_type = lv_obj_get_layer_type(obj);
-    if(layer_type == LV_LAYER_TYPE_NONE) {
+    if(lv_obj_has_flag(obj, LV_OBJ_FLAG_CACHED_LAYER) && refr_obj_cached(layer, obj, layer_type, opa_layered)) {
+        /*Blended from the cached layer*/
+    }
+    else if(layer_type == LV_LAYER_TYPE_NONE) {
         lv_obj_redraw(layer, obj);
     }
 #if LV_DRAW_TRANSFORM_USE_MATRIX
@@ -1296,6 +1363,155 @@ static void refr_obj(lv_layer_t * layer, lv_obj_t * obj)
     layer->recolor = layer_recolor;
 }
 
+/**
+ * Blend an object and its children from their cached layer. Render the cached layer first if it's outdated.
+ * @param layer         the layer to draw to
+ * @param obj           an object with `LV_OBJ_FLAG_CACHED_LAYER`
+ * @param layer_type    the layer type of the object
+ * @param opa_layered   the layered opacity of the object
+ * @return              true: the object is drawn (or it's not visible); false: draw it as usual
+ */
+static bool refr_obj_cached(lv_layer_t * layer, lv_obj_t * obj, lv_layer_type_t layer_type, lv_opa_t opa_layered)
+{
+    /*The transformations, masks, opacity and recolor are applied while drawing, so they can't be cached*/
+    if(layer_type == LV_LAYER_TYPE_TRANSFORM) return false;
+    if(lv_obj_get_style_bitmap_mask_src(obj, 0) != NULL) return false;
+    if(layer->opa < LV_OPA_MAX || layer->recolor.alpha > LV_OPA_MIN) return false;
+#if LV_DRAW_TRANSFORM_USE_MATRIX
+    if(!lv_matrix_is_identity(&layer->matrix)) return false;
+#endif
+
+    lv_area_t layer_area;
+    lv_area_t obj_draw_size;
+    lv_result_t res = layer_get_area(layer, obj, LV_LAYER_TYPE_SIMPLE, &layer_area, &obj_draw_size);
+    if(res != LV_RESULT_OK) return true;
+
+    lv_obj_allocate_spec_attr(obj);
+    if(obj->spec_attr == NULL) return false;
+
+    /*Always render the whole object so that the cached layer can be used for any area later*/
+    lv_draw_buf_t * cache = obj->spec_attr->layer_cache;
+    if(cache && (cache->header.w != lv_area_get_width(&obj_draw_size) ||
+                 cache->header.h != lv_area_get_height(&obj_draw_size))) {
+        lv_refr_drop_layer_cache(obj);
+    }
+
+    if(obj->spec_attr->layer_cache == NULL || !obj->spec_attr->layer_cache_valid) {
+        if(!layer_cache_render(obj, &obj_draw_size)) return false;
+    }
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = obj->spec_attr->layer_cache;
+    img_dsc.opa = opa_layered;
+    img_dsc.blend_mode = lv_obj_get_style_blend_mode(obj, 0);
+    lv_draw_image(layer, &img_dsc, &obj_draw_size);
+
+    return true;
+}
+
+/**
+ * Render an object and its children to its cached layer
+ * @param obj   an object with `LV_OBJ_FLAG_CACHED_LAYER` and `spec_attr`
+ * @param area  the area to render, the object's coordinates increased by the extra draw size
+ * @return      true: the cached layer is ready; false: out of memory
+ */
+static bool layer_cache_render(lv_obj_t * obj, const lv_area_t * area)
+{
+    LV_PROFILER_REFR_BEGIN;
+    lv_obj_spec_attr_t * attr = obj->spec_attr;
+    int32_t w = lv_area_get_width(area);
+    int32_t h = lv_area_get_height(area);
+
+    /*The layer is still used by the image cache from the previous frames*/
+    lv_draw_buf_t * cache = attr->layer_cache;
+    if(cache) lv_image_cache_drop(cache);
+
+    /*The widgets can be rendered only to ARGB8888 with alpha*/
+    lv_draw_buf_t * argb = cache;
+    if(cache == NULL || cache->header.cf != LV_COLOR_FORMAT_ARGB8888) {
+        argb = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        if(argb == NULL) {
+            LV_LOG_WARN("Couldn't allocate the cached layer");
+            LV_PROFILER_REFR_END;
+            return false;
+        }
+    }
+    lv_draw_buf_clear(argb, NULL);
+
+    /*Set as valid before rendering, so if something is invalidated meanwhile it's rendered again*/
+    attr->layer_cache_valid = 1;
+
+    lv_layer_t cache_layer;
+    lv_draw_layer_init(&cache_layer, NULL, LV_COLOR_FORMAT_ARGB8888, area);
+    cache_layer.draw_buf = argb;
+    lv_obj_redraw(&cache_layer, obj);
+    while(cache_layer.draw_task_head) {
+        lv_draw_dispatch_wait_for_request();
+        lv_draw_dispatch();
+    }
+    layer_remove(&cache_layer);
+
+    /*On RGB565 displays store it as RGB565A8 which is smaller and faster to blend*/
+    if(argb != cache && disp_refr->color_format == LV_COLOR_FORMAT_RGB565) {
+        if(cache == NULL) cache = lv_draw_buf_create(w, h, LV_COLOR_FORMAT_RGB565A8, LV_STRIDE_AUTO);
+
+        if(cache) {
+            layer_cache_convert_to_rgb565a8(argb, cache);
+            lv_draw_buf_destroy(argb);
+        }
+        else {
+            cache = argb;
+        }
+    }
+    else if(argb != cache) {
+        if(cache) lv_draw_buf_destroy(cache);
+        cache = argb;
+    }
+
+    attr->layer_cache = cache;
+    LV_PROFILER_REFR_END;
+    return true;
+}
+
+static void layer_cache_convert_to_rgb565a8(const lv_draw_buf_t * src, lv_draw_buf_t * dest)
+{
+    int32_t w = src->header.w;
+    int32_t h = src->header.h;
+    uint32_t dest_stride = dest->header.stride;
+    uint8_t * alpha = dest->data + dest_stride * h;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        const lv_color32_t * src_px = (const lv_color32_t *)(src->data + src->header.stride * y);
+        uint16_t * dest_px = (uint16_t *)(dest->data + dest_stride * y);
+        lv_opa_t * dest_a = alpha + (dest_stride / 2) * y;
+        int32_t x;
+        for(x = 0; x < w; x++) {
+            dest_px[x] = lv_color_to_u16(lv_color_make(src_px[x].red, src_px[x].green, src_px[x].blue));
+            dest_a[x] = src_px[x].alpha;
+        }
+    }
+}
+
+/**
+ * Remove a finished layer from the display's layers
+ * @param layer     a layer initialized by `lv_draw_layer_init()` without parent
+ */
+static void layer_remove(lv_layer_t * layer)
+{
+    lv_layer_t * layer_i = disp_refr->layer_head;
+    while(layer_i) {
+        if(layer_i->next == layer) {
+            layer_i->next = layer->next;
+            break;
+        }
+        layer_i = layer_i->next;
+    }
+
+    if(disp_refr->layer_deinit) disp_refr->layer_deinit(disp_refr, layer);
+}
+
 static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
 {
     lv_color_format_t cf = disp->color_format;
@@ -1341,6 +1557,28 @@ static uint32_t get_max_row(lv_display_t * disp, int32_t area_w, int32_t area_h)
     return max_row;
 }
 
+/**
+ * Get the number of tiles to divide an area to.
+ * The area is split to at most `disp->tile_cnt` tiles but the tiles are never smaller than
+ * `TILE_MIN_SIZE` pixels or 1 row. This way a single large draw task (e.g. a full screen image)
+ * is also rendered by all the draw units, while small areas are not fragmented needlessly.
+ * @param disp      pointer to the display being refreshed
+ * @param layer     the display's layer
+ * @param area_p    the area to render
+ * @return          the number of tiles (>= 1)
+ */
+static uint32_t get_tile_cnt(lv_display_t * disp, lv_layer_t * layer, const lv_area_t * area_p)
+{
+    if(disp->tile_cnt <= 1) return 1;
+    if(LV_COLOR_FORMAT_IS_INDEXED(layer->color_format)) return 1;
+
+    uint32_t tile_cnt = lv_area_get_size(area_p) / TILE_MIN_SIZE;
+    tile_cnt = LV_MIN(tile_cnt, disp->tile_cnt);
+    tile_cnt = LV_MIN(tile_cnt, (uint32_t)lv_area_get_height(area_p));
+
+    return LV_MAX(tile_cnt, 1);
+}
+
 /**
  * Flush the content of the draw buffer
  */
@@ -58,6 +58,19 @@ lv_display_t * lv_refr_get_disp_refreshing(void);
  */
 void lv_refr_set_disp_refreshing(lv_display_t * disp);
 
+/**
+ * Mark the cached layers of an object and its parents as outdated.
+ * They will be rendered again when they are drawn the next time.
+ * @param obj pointer to an object whose content has changed
+ */
+void lv_refr_invalidate_layer_cache(lv_obj_t * obj);
+
+/**
+ * Free the cached layer of an object (see `LV_OBJ_FLAG_CACHED_LAYER`)
+ * @param obj pointer to an object
+ */
+void lv_refr_drop_layer_cache(lv_obj_t * obj);
+
 /**********************
  *      MACROS
  **********************/
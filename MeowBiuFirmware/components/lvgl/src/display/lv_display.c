@@ -84,6 +84,10 @@ lv_display_t * lv_display_create(int32_t hor_res, int32_t ver_res)
     disp->tile_cnt = 1;
 #endif
 
+    /*By default minimize the number of redrawn pixels*/
+    disp->flush_area_cost = 0;
+    disp->flush_px_cost = 1;
+
     disp->layer_head = lv_malloc(sizeof(lv_layer_t));
     LV_ASSERT_MALLOC(disp->layer_head);
     if(disp->layer_head == NULL) return NULL;
@@ -590,6 +594,15 @@ uint32_t lv_display_get_tile_cnt(lv_display_t * disp)
     return disp->tile_cnt;
 }
 
+void lv_display_set_flush_cost(lv_display_t * disp, uint32_t area_cost, uint32_t px_cost)
+{
+    if(disp == NULL) disp = lv_display_get_default();
+    if(disp == NULL) return;
+
+    disp->flush_area_cost = area_cost;
+    disp->flush_px_cost = px_cost;
+}
+
 void lv_display_set_antialiasing(lv_display_t * disp, bool en)
 {
     if(disp == NULL) disp = lv_display_get_default();
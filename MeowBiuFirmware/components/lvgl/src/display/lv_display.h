@@ -357,6 +357,18 @@ void lv_display_set_tile_cnt(lv_display_t * disp, uint32_t tile_cnt);
  */
 uint32_t lv_display_get_tile_cnt(lv_display_t * disp);
 
+/**
+ * Set the modelled cost of sending an area to the display. The invalidated areas are joined
+ * if refreshing the joined area costs less than refreshing them one by one.
+ * E.g. on SPI panels every flush has a fixed cost (setting the window, DMA setup, etc.),
+ * so refreshing a few larger areas can be faster than refreshing many small ones.
+ * By default `area_cost = 0` and `px_cost = 1`, i.e. the number of redrawn pixels is minimized.
+ * @param disp              pointer to a display
+ * @param area_cost         cost of a flush in any unit, e.g. ns
+ * @param px_cost           cost of a pixel in the same unit
+ */
+void lv_display_set_flush_cost(lv_display_t * disp, uint32_t area_cost, uint32_t px_cost);
+
 /**
  * Enable anti-aliasing for the render engine
  * @param disp      pointer to a display
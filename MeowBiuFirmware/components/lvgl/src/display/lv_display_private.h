@@ -107,6 +107,10 @@ struct _lv_display_t {
     uint32_t inv_p;
     int32_t inv_en_cnt;
 
+    /** Modelled cost of refreshing an area: `flush_area_cost` for every flush + `flush_px_cost` for every pixel*/
+    uint32_t flush_area_cost;
+    uint32_t flush_px_cost;
+
     /** Double buffer sync areas (redrawn during last refresh) */
     lv_ll_t sync_areas;
 
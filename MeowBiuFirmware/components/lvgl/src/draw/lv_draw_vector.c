@@ -791,6 +791,16 @@ void lv_vector_dsc_skew(lv_vector_dsc_t * dsc, float skew_x, float skew_y)
     lv_matrix_skew(&(dsc->current_dsc.matrix), skew_x, skew_y);
 }
 
+void lv_vector_for_each_task(lv_ll_t * task_list, vector_draw_task_cb cb, void * data)
+{
+    if(task_list == NULL) return;
+
+    lv_vector_draw_task * task;
+    LV_LL_READ(task_list, task) {
+        cb(data, task->path, &(task->dsc));
+    }
+}
+
 void lv_vector_for_each_destroy_tasks(lv_ll_t * task_list, vector_draw_task_cb cb, void * data)
 {
     if(task_list == NULL) return;
@@ -96,6 +96,15 @@ struct _lv_vector_dsc_t {
 
 void lv_vector_for_each_destroy_tasks(lv_ll_t * task_list, vector_draw_task_cb cb, void * data);
 
+/**
+ * Call a function for each task of a task list without destroying them,
+ * e.g. to check which features are used before drawing them.
+ * @param task_list     the task list
+ * @param cb            the function to call for each task
+ * @param data          user data to pass to `cb`
+ */
+void lv_vector_for_each_task(lv_ll_t * task_list, vector_draw_task_cb cb, void * data);
+
 /**********************
  *      MACROS
  **********************/
@@ -97,10 +97,14 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
     dsc->src = src;
     dsc->src_type = lv_image_src_get_type(src);
 
+    /*Volatile images are changed in place all the time, caching them would just cause overhead*/
+    bool is_volatile = dsc->src_type == LV_IMAGE_SRC_VARIABLE &&
+                       (((const lv_image_dsc_t *)src)->header.flags & LV_IMAGE_FLAGS_VOLATILE);
+
     if(lv_image_cache_is_enabled()) {
         dsc->cache = img_cache_p;
         /*Try cache first, unless we are told to ignore cache.*/
-        if(!(args && args->no_cache)) {
+        if(!(args && args->no_cache) && !is_volatile) {
             /*
             * Check the cache first
             * If the image is found in the cache, just return it.*/
@@ -121,12 +125,16 @@ lv_result_t lv_image_decoder_open(lv_image_decoder_dsc_t * dsc, const void * src
         .flush_cache = false,
     };
 
+    if(is_volatile) dsc->args.no_cache = true;
+
     /*
      * We assume that if a decoder can get the info, it can open the image.
      * If decoder open failed, free the source and return error.
      * If decoder open succeed, add the image to cache if enabled.
      * */
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_IMAGE);
     lv_result_t res = dsc->decoder->open_cb(dsc->decoder, dsc);
+    LV_MEM_TAG_END;
 
     if(res == LV_RESULT_OK && dsc->decoded != NULL) {
         LV_ASSERT_MSG(dsc->decoded->unaligned_data && dsc->decoded->handlers, "Invalid draw buffer");
@@ -151,7 +159,9 @@ lv_result_t lv_image_decoder_get_area(lv_image_decoder_dsc_t * dsc, const lv_are
                                       lv_area_t * decoded_area)
 {
     lv_result_t res = LV_RESULT_INVALID;
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_IMAGE);
     if(dsc->decoder->get_area_cb) res = dsc->decoder->get_area_cb(dsc->decoder, dsc, full_area, decoded_area);
+    LV_MEM_TAG_END;
 
     return res;
 }
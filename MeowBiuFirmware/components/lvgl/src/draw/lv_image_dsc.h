@@ -60,6 +60,12 @@ typedef enum _lvimage_flags_t {
      */
     LV_IMAGE_FLAGS_CUSTOM_DRAW      = 0x0040,
 
+    /**
+     * The image data is changed in place frequently (e.g. frames of an animation).
+     * The decoded image is never looked up in, added to, or dropped from the image cache.
+     */
+    LV_IMAGE_FLAGS_VOLATILE         = 0x0080,
+
     /**
      * Flags reserved for user, lvgl won't use these bits.
      */
@@ -0,0 +1,1047 @@
+/**
+ * @file lv_blend_x86.c
+ *
+ * SSE2 and AVX2 versions of the hottest software rendering kernels.
+ * Every kernel produces the same result as its generic C counterpart
+ * so the reference images of the tests are valid for both.
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_blend_x86.h"
+#if LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && (defined(__SSE2__) || defined(_M_X64))
+
+#include <emmintrin.h>
+#include "../lv_draw_sw_blend_private.h"
+#include "../../../../misc/lv_color.h"
+#include "../../../../misc/lv_color_op.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Have AVX2 code either because the compiler targets it or because it can be enabled per function*/
+#if defined(__AVX2__)
+    #include <immintrin.h>
+    #define X86_AVX2_CODE   1
+    #define X86_AVX2_ATTR
+#elif LV_DRAW_SW_X86_RUNTIME_DETECT && (defined(__GNUC__) || defined(__clang__))
+    #include <immintrin.h>
+    #define X86_AVX2_CODE   1
+    #define X86_AVX2_ATTR   __attribute__((target("avx2")))
+#else
+    #define X86_AVX2_CODE   0
+#endif
+
+/*0x7E0F81F = 0b00000111111000001111100000011111, the RGB565 channels spread for the mix*/
+#define RGB565_SPREAD_MASK  0x7E0F81F
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+
+static void fill_row_u16(uint16_t * dest, int32_t w, uint16_t color);
+static void fill_row_u32(uint32_t * dest, int32_t w, uint32_t color);
+static void copy_row(uint8_t * dest, const uint8_t * src, int32_t len);
+
+static inline __m128i mullo_epi32_sse2(__m128i a, __m128i b);
+static inline __m128i pack_u32_to_u16_sse2(__m128i v);
+static inline __m128i load_4_opa(const lv_opa_t * p);
+static inline __m128i rgb565_mix_4(__m128i fg, __m128i bg, __m128i mix);
+static inline __m128i argb8888_to_rgb565_mix_4(__m128i src, __m128i dest, __m128i mix);
+static inline __m128i blend_select(__m128i mask, __m128i a, __m128i b);
+
+static inline uint16_t rgb565_mix_24_16(const uint8_t * c1, uint16_t c2, uint8_t mix);
+static lv_color32_t color_32_32_mix(lv_color32_t fg, lv_color32_t bg);
+static void argb8888_blend_row(lv_color32_t * dest, const lv_color32_t * src, int32_t w, lv_opa_t opa);
+
+static void transform_argb8888_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                  int32_t xs_ups, int32_t ys_ups, lv_color32_t * dest, bool aa);
+static inline __m128i transform_mix_step(__m128i d, __m128i n, __m128i f);
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_draw_sw_x86_level_t lv_draw_sw_x86_get_level(void)
+{
+#if defined(__AVX2__)
+    return LV_DRAW_SW_X86_LEVEL_AVX2;
+#elif X86_AVX2_CODE
+    /*A race here is harmless as every thread would write the same value*/
+    static int32_t level = -1;
+    if(level < 0) {
+        __builtin_cpu_init();
+        level = __builtin_cpu_supports("avx2") ? LV_DRAW_SW_X86_LEVEL_AVX2 : LV_DRAW_SW_X86_LEVEL_SSE2;
+    }
+    return (lv_draw_sw_x86_level_t)level;
+#else
+    return LV_DRAW_SW_X86_LEVEL_SSE2;
+#endif
+}
+
+lv_result_t lv_color_blend_to_rgb565_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        fill_row_u16(dest_buf_u16, w, color16);
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    __m128i fg = _mm_set1_epi32((int32_t)color16);
+    __m128i mix = _mm_set1_epi32((opa + 4) >> 3);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], opa);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_with_mask_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    __m128i fg = _mm_set1_epi32((int32_t)color16);
+    __m128i four = _mm_set1_epi32(4);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i mix = _mm_srli_epi32(_mm_add_epi32(load_4_opa(&mask[x]), four), 3);
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], mask[x]);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_rgb565_mix_mask_opa_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t color16 = lv_color_to_u16(dsc->color);
+    lv_opa_t opa = dsc->opa;
+    const lv_opa_t * mask = dsc->mask_buf;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+
+    __m128i fg = _mm_set1_epi32((int32_t)color16);
+    __m128i opa_v = _mm_set1_epi32(opa);
+    __m128i four = _mm_set1_epi32(4);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            /*LV_OPA_MIX2: the product fits into 16 bit so a 16 bit multiply is enough*/
+            __m128i m = _mm_srli_epi32(_mm_mullo_epi16(load_4_opa(&mask[x]), opa_v), 8);
+            __m128i mix = _mm_srli_epi32(_mm_add_epi32(m, four), 3);
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(color16, dest_buf_u16[x], LV_OPA_MIX2(mask[x], opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        mask += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t h = dsc->dest_h;
+    uint8_t * dest_buf = dsc->dest_buf;
+    const uint8_t * src_buf = dsc->src_buf;
+    int32_t line_in_bytes = dsc->dest_w * 2;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        copy_row(dest_buf, src_buf, line_in_bytes);
+        dest_buf += dsc->dest_stride;
+        src_buf += dsc->src_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+
+    __m128i mix = _mm_set1_epi32((opa + 4) >> 3);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i fg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&src_buf_u16[x]), _mm_setzero_si128());
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], opa);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    __m128i four = _mm_set1_epi32(4);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i mix = _mm_srli_epi32(_mm_add_epi32(load_4_opa(&mask_buf[x]), four), 3);
+            __m128i fg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&src_buf_u16[x]), _mm_setzero_si128());
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], mask_buf[x]);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_rgb565_blend_normal_to_rgb565_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint16_t * src_buf_u16 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    __m128i opa_v = _mm_set1_epi32(opa);
+    __m128i four = _mm_set1_epi32(4);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i m = _mm_srli_epi32(_mm_mullo_epi16(load_4_opa(&mask_buf[x]), opa_v), 8);
+            __m128i mix = _mm_srli_epi32(_mm_add_epi32(m, four), 3);
+            __m128i fg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&src_buf_u16[x]), _mm_setzero_si128());
+            __m128i bg = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], rgb565_mix_4(fg, bg, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = lv_color_16_16_mix(src_buf_u16[x], dest_buf_u16[x], LV_OPA_MIX2(mask_buf[x], opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u16 = drawbuf_next_row(src_buf_u16, dsc->src_stride);
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u8[x * 4]);
+            __m128i dest = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            __m128i mix = _mm_srli_epi32(src, 24);
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], argb8888_to_rgb565_mix_4(src, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = rgb565_mix_24_16(&src_buf_u8[x * 4], dest_buf_u16[x], src_buf_u8[x * 4 + 3]);
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+
+    __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u8[x * 4]);
+            __m128i dest = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            __m128i mix = _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(src, 24), opa_v), 8);
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], argb8888_to_rgb565_mix_4(src, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = rgb565_mix_24_16(&src_buf_u8[x * 4], dest_buf_u16[x], LV_OPA_MIX2(src_buf_u8[x * 4 + 3], opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_with_mask_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u8[x * 4]);
+            __m128i dest = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            __m128i mix = _mm_srli_epi32(_mm_mullo_epi16(_mm_srli_epi32(src, 24), load_4_opa(&mask_buf[x])), 8);
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], argb8888_to_rgb565_mix_4(src, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = rgb565_mix_24_16(&src_buf_u8[x * 4], dest_buf_u16[x],
+                                               LV_OPA_MIX2(src_buf_u8[x * 4 + 3], mask_buf[x]));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_rgb565_mix_mask_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    lv_opa_t opa = dsc->opa;
+    uint16_t * dest_buf_u16 = dsc->dest_buf;
+    const uint8_t * src_buf_u8 = dsc->src_buf;
+    const lv_opa_t * mask_buf = dsc->mask_buf;
+
+    __m128i opa_v = _mm_set1_epi32(opa);
+
+    int32_t x;
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        for(x = 0; x + 4 <= w; x += 4) {
+            __m128i src = _mm_loadu_si128((const __m128i *)&src_buf_u8[x * 4]);
+            __m128i dest = _mm_unpacklo_epi16(_mm_loadl_epi64((const __m128i *)&dest_buf_u16[x]), _mm_setzero_si128());
+            /*LV_OPA_MIX3: (a * m) fits into 16 bit and the high half of `* opa` is the `>> 16`*/
+            __m128i am = _mm_mullo_epi16(_mm_srli_epi32(src, 24), load_4_opa(&mask_buf[x]));
+            __m128i mix = _mm_mulhi_epu16(am, opa_v);
+            _mm_storel_epi64((__m128i *)&dest_buf_u16[x], argb8888_to_rgb565_mix_4(src, dest, mix));
+        }
+        for(; x < w; x++) {
+            dest_buf_u16[x] = rgb565_mix_24_16(&src_buf_u8[x * 4], dest_buf_u16[x],
+                                               LV_OPA_MIX3(src_buf_u8[x * 4 + 3], mask_buf[x], opa));
+        }
+        dest_buf_u16 = drawbuf_next_row(dest_buf_u16, dsc->dest_stride);
+        src_buf_u8 += dsc->src_stride;
+        mask_buf += dsc->mask_stride;
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_color_blend_to_argb8888_x86(lv_draw_sw_blend_fill_dsc_t * dsc)
+{
+    int32_t w = dsc->dest_w;
+    int32_t h = dsc->dest_h;
+    uint32_t color32 = lv_color_to_u32(dsc->color);
+    uint32_t * dest_buf = dsc->dest_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        fill_row_u32(dest_buf, w, color32);
+        dest_buf = drawbuf_next_row(dest_buf, dsc->dest_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t h = dsc->dest_h;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_row(dest_buf_c32, src_buf_c32, dsc->dest_w, LV_OPA_COVER);
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dsc->dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_argb8888_blend_normal_to_argb8888_with_opa_x86(lv_draw_sw_blend_image_dsc_t * dsc)
+{
+    int32_t h = dsc->dest_h;
+    lv_color32_t * dest_buf_c32 = dsc->dest_buf;
+    const lv_color32_t * src_buf_c32 = dsc->src_buf;
+
+    int32_t y;
+    for(y = 0; y < h; y++) {
+        argb8888_blend_row(dest_buf_c32, src_buf_c32, dsc->dest_w, dsc->opa);
+        dest_buf_c32 = drawbuf_next_row(dest_buf_c32, dsc->dest_stride);
+        src_buf_c32 = drawbuf_next_row(src_buf_c32, dsc->src_stride);
+    }
+
+    return LV_RESULT_OK;
+}
+
+#if X86_AVX2_CODE
+static X86_AVX2_ATTR void rgb565_swap_avx2(uint16_t * buf16, uint32_t buf_size_px)
+{
+    const __m256i shuffle = _mm256_setr_epi8(1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14,
+                                             1, 0, 3, 2, 5, 4, 7, 6, 9, 8, 11, 10, 13, 12, 15, 14);
+    uint32_t i;
+    for(i = 0; i + 16 <= buf_size_px; i += 16) {
+        __m256i v = _mm256_loadu_si256((const __m256i *)&buf16[i]);
+        _mm256_storeu_si256((__m256i *)&buf16[i], _mm256_shuffle_epi8(v, shuffle));
+    }
+    for(; i < buf_size_px; i++) {
+        buf16[i] = (uint16_t)((buf16[i] >> 8) | (buf16[i] << 8));
+    }
+}
+#endif
+
+lv_result_t lv_draw_sw_rgb565_swap_x86(void * buf, uint32_t buf_size_px)
+{
+    uint16_t * buf16 = buf;
+
+#if X86_AVX2_CODE
+    if(lv_draw_sw_x86_get_level() == LV_DRAW_SW_X86_LEVEL_AVX2) {
+        rgb565_swap_avx2(buf16, buf_size_px);
+        return LV_RESULT_OK;
+    }
+#endif
+
+    uint32_t i;
+    for(i = 0; i + 8 <= buf_size_px; i += 8) {
+        __m128i v = _mm_loadu_si128((const __m128i *)&buf16[i]);
+        v = _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+        _mm_storeu_si128((__m128i *)&buf16[i], v);
+    }
+    for(; i < buf_size_px; i++) {
+        buf16[i] = (uint16_t)((buf16[i] >> 8) | (buf16[i] << 8));
+    }
+
+    return LV_RESULT_OK;
+}
+
+lv_result_t lv_draw_sw_transform_argb8888_x86(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                              int32_t xs_ups, int32_t ys_ups, int32_t xs_step, int32_t ys_step,
+                                              int32_t x_end, uint8_t * dest_buf, bool aa)
+{
+    /*Rotated rows walk diagonally on the source, leave them to the generic code*/
+    if(ys_step != 0) return LV_RESULT_INVALID;
+
+    lv_color32_t * dest_c32 = (lv_color32_t *) dest_buf;
+    int32_t xs_ups_start = xs_ups;
+    int32_t ys_int = ys_ups >> 8;
+    int32_t ys_fract = ys_ups & 0xFF;
+    int32_t y_next;
+    if(ys_fract < 0x80) {
+        y_next = -1;
+        ys_fract = 0x7F - ys_fract;
+    }
+    else {
+        y_next = 1;
+        ys_fract = ys_fract - 0x80;
+    }
+
+    /*The vertical neighbor is the same for the whole row, so check it only once*/
+    bool row_simd = aa && ys_int >= 0 && ys_int < src_h && ys_int + y_next >= 0 && ys_int + y_next <= src_h - 1;
+
+    int32_t x = 0;
+    if(row_simd) {
+        const uint32_t * row = (const uint32_t *)(src + ys_int * src_stride);
+        const uint32_t * row_ver = (const uint32_t *)(src + (ys_int + y_next) * src_stride);
+        __m128i yf = _mm_set1_epi16((int16_t)ys_fract);
+
+        for(; x + 4 <= x_end; x += 4) {
+            LV_ATTRIBUTE_MEM_ALIGN uint32_t px[4];
+            LV_ATTRIBUTE_MEM_ALIGN uint32_t px_hor[4];
+            LV_ATTRIBUTE_MEM_ALIGN uint32_t px_ver[4];
+            int16_t xf[4];
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                int32_t xs = xs_ups_start + ((xs_step * (x + i)) >> 8);
+                int32_t xs_int = xs >> 8;
+                int32_t xs_fract = xs & 0xFF;
+                int32_t x_next;
+                if(xs_fract < 0x80) {
+                    x_next = -1;
+                    xs_fract = 0x7F - xs_fract;
+                }
+                else {
+                    x_next = 1;
+                    xs_fract = xs_fract - 0x80;
+                }
+
+                /*Out of the image or on its edge: not a plain bilinear pixel*/
+                if(xs_int < 0 || xs_int >= src_w || xs_int + x_next < 0 || xs_int + x_next > src_w - 1) break;
+
+                px[i] = row[xs_int];
+                px_hor[i] = row[xs_int + x_next];
+                px_ver[i] = row_ver[xs_int];
+                xf[i] = (int16_t)xs_fract;
+            }
+
+            if(i < 4) {
+                for(i = 0; i < 4; i++) {
+                    transform_argb8888_px(src, src_w, src_h, src_stride, xs_ups_start + ((xs_step * (x + i)) >> 8), ys_ups,
+                                          &dest_c32[x + i], aa);
+                }
+                continue;
+            }
+
+            __m128i zero = _mm_setzero_si128();
+            __m128i d = _mm_load_si128((const __m128i *)px);
+            __m128i v = _mm_load_si128((const __m128i *)px_ver);
+            __m128i hz = _mm_load_si128((const __m128i *)px_hor);
+
+            /*Work on 16 bit channels, 2 pixels per register*/
+            __m128i d_lo = _mm_unpacklo_epi8(d, zero);
+            __m128i d_hi = _mm_unpackhi_epi8(d, zero);
+            d_lo = transform_mix_step(d_lo, _mm_unpacklo_epi8(v, zero), yf);
+            d_hi = transform_mix_step(d_hi, _mm_unpackhi_epi8(v, zero), yf);
+
+            __m128i xf_lo = _mm_set_epi16(xf[1], xf[1], xf[1], xf[1], xf[0], xf[0], xf[0], xf[0]);
+            __m128i xf_hi = _mm_set_epi16(xf[3], xf[3], xf[3], xf[3], xf[2], xf[2], xf[2], xf[2]);
+            d_lo = transform_mix_step(d_lo, _mm_unpacklo_epi8(hz, zero), xf_lo);
+            d_hi = transform_mix_step(d_hi, _mm_unpackhi_epi8(hz, zero), xf_hi);
+
+            _mm_storeu_si128((__m128i *)&dest_c32[x], _mm_packus_epi16(d_lo, d_hi));
+        }
+    }
+
+    for(; x < x_end; x++) {
+        transform_argb8888_px(src, src_w, src_h, src_stride, xs_ups_start + ((xs_step * x) >> 8), ys_ups,
+                              &dest_c32[x], aa);
+    }
+
+    return LV_RESULT_OK;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if X86_AVX2_CODE
+static X86_AVX2_ATTR void fill_row_u16_avx2(uint16_t * dest, int32_t w, uint16_t color)
+{
+    __m256i v = _mm256_set1_epi16((int16_t)color);
+    int32_t x;
+    for(x = 0; x + 16 <= w; x += 16) {
+        _mm256_storeu_si256((__m256i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static X86_AVX2_ATTR void fill_row_u32_avx2(uint32_t * dest, int32_t w, uint32_t color)
+{
+    __m256i v = _mm256_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x + 8 <= w; x += 8) {
+        _mm256_storeu_si256((__m256i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static X86_AVX2_ATTR void copy_row_avx2(uint8_t * dest, const uint8_t * src, int32_t len)
+{
+    int32_t i;
+    for(i = 0; i + 32 <= len; i += 32) {
+        _mm256_storeu_si256((__m256i *)&dest[i], _mm256_loadu_si256((const __m256i *)&src[i]));
+    }
+    for(; i < len; i++) {
+        dest[i] = src[i];
+    }
+}
+#endif
+
+static void fill_row_u16(uint16_t * dest, int32_t w, uint16_t color)
+{
+#if X86_AVX2_CODE
+    if(lv_draw_sw_x86_get_level() == LV_DRAW_SW_X86_LEVEL_AVX2) {
+        fill_row_u16_avx2(dest, w, color);
+        return;
+    }
+#endif
+
+    __m128i v = _mm_set1_epi16((int16_t)color);
+    int32_t x;
+    for(x = 0; x + 8 <= w; x += 8) {
+        _mm_storeu_si128((__m128i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static void fill_row_u32(uint32_t * dest, int32_t w, uint32_t color)
+{
+#if X86_AVX2_CODE
+    if(lv_draw_sw_x86_get_level() == LV_DRAW_SW_X86_LEVEL_AVX2) {
+        fill_row_u32_avx2(dest, w, color);
+        return;
+    }
+#endif
+
+    __m128i v = _mm_set1_epi32((int32_t)color);
+    int32_t x;
+    for(x = 0; x + 4 <= w; x += 4) {
+        _mm_storeu_si128((__m128i *)&dest[x], v);
+    }
+    for(; x < w; x++) {
+        dest[x] = color;
+    }
+}
+
+static void copy_row(uint8_t * dest, const uint8_t * src, int32_t len)
+{
+#if X86_AVX2_CODE
+    if(lv_draw_sw_x86_get_level() == LV_DRAW_SW_X86_LEVEL_AVX2) {
+        copy_row_avx2(dest, src, len);
+        return;
+    }
+#endif
+
+    int32_t i;
+    for(i = 0; i + 16 <= len; i += 16) {
+        _mm_storeu_si128((__m128i *)&dest[i], _mm_loadu_si128((const __m128i *)&src[i]));
+    }
+    for(; i < len; i++) {
+        dest[i] = src[i];
+    }
+}
+
+/**
+ * 32 bit lane-wise multiply with SSE2 only (`_mm_mullo_epi32` is SSE4.1)
+ */
+static inline __m128i mullo_epi32_sse2(__m128i a, __m128i b)
+{
+    __m128i even = _mm_mul_epu32(a, b);
+    __m128i odd = _mm_mul_epu32(_mm_srli_epi64(a, 32), _mm_srli_epi64(b, 32));
+    return _mm_unpacklo_epi32(_mm_shuffle_epi32(even, _MM_SHUFFLE(0, 0, 2, 0)),
+                              _mm_shuffle_epi32(odd, _MM_SHUFFLE(0, 0, 2, 0)));
+}
+
+/**
+ * Pack four 0..0xFFFF values from 32 bit lanes into the low 64 bit as 16 bit values.
+ * `_mm_packs_epi32` saturates to signed 16 bit so move the values to the signed range first.
+ */
+static inline __m128i pack_u32_to_u16_sse2(__m128i v)
+{
+    v = _mm_sub_epi32(v, _mm_set1_epi32(0x8000));
+    v = _mm_packs_epi32(v, v);
+    return _mm_add_epi16(v, _mm_set1_epi16((int16_t)0x8000));
+}
+
+/**
+ * Load 4 opacity values into 32 bit lanes
+ */
+static inline __m128i load_4_opa(const lv_opa_t * p)
+{
+    int32_t v;
+    lv_memcpy(&v, p, sizeof(v));
+    __m128i zero = _mm_setzero_si128();
+    return _mm_unpacklo_epi16(_mm_unpacklo_epi8(_mm_cvtsi32_si128(v), zero), zero);
+}
+
+/**
+ * The same as `lv_color_16_16_mix()` on 4 pixels.
+ * The early returns of the C version give the same result as the formula so they are not needed.
+ * @param fg    foreground colors in 32 bit lanes
+ * @param bg    background colors in 32 bit lanes
+ * @param mix   the already converted `(mix + 4) >> 3` values in 32 bit lanes
+ * @return      the 4 mixed colors in the low 64 bit
+ */
+static inline __m128i rgb565_mix_4(__m128i fg, __m128i bg, __m128i mix)
+{
+    __m128i spread_mask = _mm_set1_epi32(RGB565_SPREAD_MASK);
+    fg = _mm_and_si128(_mm_or_si128(fg, _mm_slli_epi32(fg, 16)), spread_mask);
+    bg = _mm_and_si128(_mm_or_si128(bg, _mm_slli_epi32(bg, 16)), spread_mask);
+
+    __m128i res = mullo_epi32_sse2(_mm_sub_epi32(fg, bg), mix);
+    res = _mm_and_si128(_mm_add_epi32(_mm_srli_epi32(res, 5), bg), spread_mask);
+    res = _mm_and_si128(_mm_or_si128(res, _mm_srli_epi32(res, 16)), _mm_set1_epi32(0xFFFF));
+    return pack_u32_to_u16_sse2(res);
+}
+
+/**
+ * The same as `lv_color_24_16_mix()` on 4 pixels.
+ * All the products fit into 16 bit so `_mm_mullo_epi16` can be used on the 32 bit lanes.
+ * @param src   4 ARGB8888 pixels
+ * @param dest  4 RGB565 pixels in 32 bit lanes
+ * @param mix   the mix ratios in 32 bit lanes
+ * @return      the 4 mixed colors in the low 64 bit
+ */
+static inline __m128i argb8888_to_rgb565_mix_4(__m128i src, __m128i dest, __m128i mix)
+{
+    __m128i ff = _mm_set1_epi32(0xFF);
+    __m128i mix_inv = _mm_sub_epi32(ff, mix);
+
+    __m128i b = _mm_and_si128(src, ff);
+    __m128i g = _mm_and_si128(_mm_srli_epi32(src, 8), ff);
+    __m128i r = _mm_and_si128(_mm_srli_epi32(src, 16), ff);
+
+    __m128i dr = _mm_and_si128(_mm_srli_epi32(dest, 11), _mm_set1_epi32(0x1F));
+    __m128i dg = _mm_and_si128(_mm_srli_epi32(dest, 5), _mm_set1_epi32(0x3F));
+    __m128i db = _mm_and_si128(dest, _mm_set1_epi32(0x1F));
+
+    __m128i rr = _mm_add_epi32(_mm_mullo_epi16(_mm_srli_epi32(r, 3), mix), _mm_mullo_epi16(dr, mix_inv));
+    __m128i rg = _mm_add_epi32(_mm_mullo_epi16(_mm_srli_epi32(g, 2), mix), _mm_mullo_epi16(dg, mix_inv));
+    __m128i rb = _mm_add_epi32(_mm_mullo_epi16(_mm_srli_epi32(b, 3), mix), _mm_mullo_epi16(db, mix_inv));
+
+    __m128i res = _mm_and_si128(_mm_slli_epi32(rr, 3), _mm_set1_epi32(0xF800));
+    res = _mm_add_epi32(res, _mm_and_si128(_mm_srli_epi32(rg, 3), _mm_set1_epi32(0x07E0)));
+    res = _mm_add_epi32(res, _mm_srli_epi32(rb, 8));
+
+    /*mix == 255: convert the source color only*/
+    __m128i cover = _mm_slli_epi32(_mm_and_si128(r, _mm_set1_epi32(0xF8)), 8);
+    cover = _mm_add_epi32(cover, _mm_slli_epi32(_mm_and_si128(g, _mm_set1_epi32(0xFC)), 3));
+    cover = _mm_add_epi32(cover, _mm_srli_epi32(_mm_and_si128(b, _mm_set1_epi32(0xF8)), 3));
+
+    res = blend_select(_mm_cmpeq_epi32(mix, ff), cover, res);
+    res = blend_select(_mm_cmpeq_epi32(mix, _mm_setzero_si128()), dest, res);
+    return pack_u32_to_u16_sse2(res);
+}
+
+/**
+ * Select `a` where `mask` is set, else `b`
+ */
+static inline __m128i blend_select(__m128i mask, __m128i a, __m128i b)
+{
+    return _mm_or_si128(_mm_and_si128(mask, a), _mm_andnot_si128(mask, b));
+}
+
+/**
+ * Scalar version of `argb8888_to_rgb565_mix_4()` for the last pixels of the rows
+ */
+static inline uint16_t rgb565_mix_24_16(const uint8_t * c1, uint16_t c2, uint8_t mix)
+{
+    if(mix == 0) {
+        return c2;
+    }
+    else if(mix == 255) {
+        return ((c1[2] & 0xF8) << 8)  + ((c1[1] & 0xFC) << 3) + ((c1[0] & 0xF8) >> 3);
+    }
+    else {
+        lv_opa_t mix_inv = 255 - mix;
+
+        return ((((c1[2] >> 3) * mix + ((c2 >> 11) & 0x1F) * mix_inv) << 3) & 0xF800) +
+               ((((c1[1] >> 2) * mix + ((c2 >> 5) & 0x3F) * mix_inv) >> 3) & 0x07E0) +
+               (((c1[0] >> 3) * mix + (c2 & 0x1F) * mix_inv) >> 8);
+    }
+}
+
+/**
+ * The same as `lv_color_32_32_mix()` of the generic ARGB8888 blender but without caching.
+ * Used for the pixels where both colors are semi-transparent.
+ */
+static lv_color32_t color_32_32_mix(lv_color32_t fg, lv_color32_t bg)
+{
+    if(fg.alpha >= LV_OPA_MAX || bg.alpha <= LV_OPA_MIN) {
+        return fg;
+    }
+    else if(fg.alpha <= LV_OPA_MIN) {
+        return bg;
+    }
+    else if(bg.alpha == 255) {
+        return lv_color_mix32(fg, bg);
+    }
+    else {
+        uint32_t res_alpha = 255 - LV_OPA_MIX2(255 - fg.alpha, 255 - bg.alpha);
+        fg.alpha = (uint32_t)((uint32_t)fg.alpha * 255) / res_alpha;
+        lv_color32_t res = lv_color_mix32(fg, bg);
+        res.alpha = res_alpha;
+        return res;
+    }
+}
+
+/**
+ * Blend a row of ARGB8888 pixels to an ARGB8888 row. `opa >= LV_OPA_MAX` means no opacity.
+ * 4 pixels are mixed at once if the destination is opaque or one of the colors decides alone,
+ * else the pixels are mixed one by one.
+ */
+static void argb8888_blend_row(lv_color32_t * dest, const lv_color32_t * src, int32_t w, lv_opa_t opa)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i ff = _mm_set1_epi32(0xFF);
+    __m128i opa_v = _mm_set1_epi32(opa);
+    __m128i alpha_mask = _mm_set1_epi32((int32_t)0xFF000000);
+
+    int32_t x;
+    for(x = 0; x + 4 <= w; x += 4) {
+        __m128i fg = _mm_loadu_si128((const __m128i *)&src[x]);
+        __m128i bg = _mm_loadu_si128((const __m128i *)&dest[x]);
+
+        __m128i fa = _mm_srli_epi32(fg, 24);
+        if(opa < LV_OPA_MAX) {
+            fa = _mm_srli_epi32(_mm_mullo_epi16(fa, opa_v), 8);
+            fg = _mm_or_si128(_mm_andnot_si128(alpha_mask, fg), _mm_slli_epi32(fa, 24));
+        }
+        __m128i ba = _mm_srli_epi32(bg, 24);
+
+        __m128i use_fg = _mm_or_si128(_mm_cmpgt_epi32(fa, _mm_set1_epi32(LV_OPA_MAX - 1)),
+                                      _mm_cmplt_epi32(ba, _mm_set1_epi32(LV_OPA_MIN + 1)));
+        __m128i use_bg = _mm_andnot_si128(use_fg, _mm_cmplt_epi32(fa, _mm_set1_epi32(LV_OPA_MIN + 1)));
+        __m128i use_mix = _mm_andnot_si128(_mm_or_si128(use_fg, use_bg), _mm_cmpeq_epi32(ba, ff));
+
+        if(_mm_movemask_epi8(_mm_or_si128(_mm_or_si128(use_fg, use_bg), use_mix)) != 0xFFFF) {
+            int32_t i;
+            for(i = 0; i < 4; i++) {
+                lv_color32_t c = src[x + i];
+                if(opa < LV_OPA_MAX) c.alpha = LV_OPA_MIX2(c.alpha, opa);
+                dest[x + i] = color_32_32_mix(c, dest[x + i]);
+            }
+            continue;
+        }
+
+        /*lv_color_mix32() with an opaque background: LV_UDIV255(fg * a + bg * (255 - a)) and keep the bg's alpha.
+         *LV_UDIV255(x) is (x * 0x8081) >> 23 which is the high half of the 16 bit product shifted by 7*/
+        __m128i mix = _mm_or_si128(fa, _mm_slli_epi32(fa, 16));
+        mix = _mm_or_si128(mix, _mm_slli_epi32(mix, 8));
+        __m128i mix_lo = _mm_unpacklo_epi8(mix, zero);
+        __m128i mix_hi = _mm_unpackhi_epi8(mix, zero);
+        __m128i ff16 = _mm_set1_epi16(0xFF);
+        __m128i div = _mm_set1_epi16((int16_t)0x8081);
+
+        __m128i res_lo = _mm_add_epi16(_mm_mullo_epi16(_mm_unpacklo_epi8(fg, zero), mix_lo),
+                                       _mm_mullo_epi16(_mm_unpacklo_epi8(bg, zero), _mm_sub_epi16(ff16, mix_lo)));
+        __m128i res_hi = _mm_add_epi16(_mm_mullo_epi16(_mm_unpackhi_epi8(fg, zero), mix_hi),
+                                       _mm_mullo_epi16(_mm_unpackhi_epi8(bg, zero), _mm_sub_epi16(ff16, mix_hi)));
+        res_lo = _mm_srli_epi16(_mm_mulhi_epu16(res_lo, div), 7);
+        res_hi = _mm_srli_epi16(_mm_mulhi_epu16(res_hi, div), 7);
+        __m128i res = _mm_or_si128(_mm_andnot_si128(alpha_mask, _mm_packus_epi16(res_lo, res_hi)),
+                                   _mm_and_si128(bg, alpha_mask));
+
+        res = blend_select(use_fg, fg, blend_select(use_bg, bg, res));
+        _mm_storeu_si128((__m128i *)&dest[x], res);
+    }
+
+    for(; x < w; x++) {
+        lv_color32_t c = src[x];
+        if(opa < LV_OPA_MAX) c.alpha = LV_OPA_MIX2(c.alpha, opa);
+        dest[x] = color_32_32_mix(c, dest[x]);
+    }
+}
+
+/**
+ * One pixel of `transform_argb8888()` in `lv_draw_sw_transform.c`.
+ * Used on the edges where the vector path can't be used.
+ */
+static void transform_argb8888_px(const uint8_t * src, int32_t src_w, int32_t src_h, int32_t src_stride,
+                                  int32_t xs_ups, int32_t ys_ups, lv_color32_t * dest, bool aa)
+{
+    int32_t xs_int = xs_ups >> 8;
+    int32_t ys_int = ys_ups >> 8;
+
+    /*Fully out of the image*/
+    if(xs_int < 0 || xs_int >= src_w || ys_int < 0 || ys_int >= src_h) {
+        *((uint32_t *)dest) = 0x00000000;
+        return;
+    }
+
+    int32_t xs_fract = xs_ups & 0xFF;
+    int32_t ys_fract = ys_ups & 0xFF;
+
+    int32_t x_next;
+    int32_t y_next;
+    if(xs_fract < 0x80) {
+        x_next = -1;
+        xs_fract = 0x7F - xs_fract;
+    }
+    else {
+        x_next = 1;
+        xs_fract = xs_fract - 0x80;
+    }
+    if(ys_fract < 0x80) {
+        y_next = -1;
+        ys_fract = 0x7F - ys_fract;
+    }
+    else {
+        y_next = 1;
+        ys_fract = ys_fract - 0x80;
+    }
+
+    const lv_color32_t * src_c32 = (const lv_color32_t *)(src + ys_int * src_stride + xs_int * 4);
+
+    *dest = src_c32[0];
+
+    if(aa &&
+       xs_int + x_next >= 0 &&
+       xs_int + x_next <= src_w - 1 &&
+       ys_int + y_next >= 0 &&
+       ys_int + y_next <= src_h - 1) {
+
+        lv_color32_t px_hor = src_c32[x_next];
+        lv_color32_t px_ver = *(const lv_color32_t *)((uint8_t *)src_c32 + y_next * src_stride);
+
+        if(px_ver.alpha == 0) {
+            dest->alpha = (dest->alpha * (0xFF - ys_fract)) >> 8;
+        }
+        else if(!lv_color32_eq(*dest, px_ver)) {
+            if(dest->alpha) dest->alpha = ((px_ver.alpha * ys_fract) + (dest->alpha * (0xFF - ys_fract))) >> 8;
+            px_ver.alpha = ys_fract;
+            *dest = lv_color_mix32(px_ver, *dest);
+        }
+
+        if(px_hor.alpha == 0) {
+            dest->alpha = (dest->alpha * (0xFF - xs_fract)) >> 8;
+        }
+        else if(!lv_color32_eq(*dest, px_hor)) {
+            if(dest->alpha) dest->alpha = ((px_hor.alpha * xs_fract) + (dest->alpha * (0xFF - xs_fract))) >> 8;
+            px_hor.alpha = xs_fract;
+            *dest = lv_color_mix32(px_hor, *dest);
+        }
+    }
+    /*Partially out of the image*/
+    else {
+        if((xs_int == 0 && x_next < 0) || (xs_int == src_w - 1 && x_next > 0))  {
+            dest->alpha = (dest->alpha * (0x7F - xs_fract)) >> 7;
+        }
+        else if((ys_int == 0 && y_next < 0) || (ys_int == src_h - 1 && y_next > 0))  {
+            dest->alpha = (dest->alpha * (0x7F - ys_fract)) >> 7;
+        }
+    }
+}
+
+/**
+ * One neighbor mixing step of the bilinear sampling on 2 pixels with 16 bit channels (B, G, R, A).
+ * The same as the `px_ver`/`px_hor` steps of `transform_argb8888_px()`.
+ * @param d     the current pixels
+ * @param n     the neighbor pixels
+ * @param f     the fraction (0..127) of each pixel broadcast to its 4 channels
+ * @return      the mixed pixels
+ */
+static inline __m128i transform_mix_step(__m128i d, __m128i n, __m128i f)
+{
+    __m128i zero = _mm_setzero_si128();
+    __m128i a_lanes = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    __m128i f_inv = _mm_sub_epi16(_mm_set1_epi16(0xFF), f);
+
+    /*All products are <= 255 * 255 so they fit into unsigned 16 bit*/
+    __m128i d_inv = _mm_mullo_epi16(d, f_inv);
+    __m128i prod = _mm_add_epi16(_mm_mullo_epi16(n, f), d_inv);
+
+    /*Neighbor is transparent: only fade the alpha*/
+    __m128i cand_n0 = blend_select(a_lanes, _mm_srli_epi16(d_inv, 8), d);
+
+    /*Else mix the alpha (if not 0) and mix the color with LV_UDIV255 (if f > LV_OPA_MIN)*/
+    __m128i a_mix = _mm_srli_epi16(prod, 8);
+    __m128i d_a0 = _mm_cmpeq_epi16(d, zero);
+    d_a0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(d_a0, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    a_mix = _mm_andnot_si128(d_a0, a_mix);
+    __m128i rgb_mix = _mm_srli_epi16(_mm_mulhi_epu16(prod, _mm_set1_epi16((int16_t)0x8081)), 7);
+    __m128i f_small = _mm_cmplt_epi16(f, _mm_set1_epi16(LV_OPA_MIN + 1));
+    rgb_mix = blend_select(f_small, d, rgb_mix);
+    __m128i cand_mix = blend_select(a_lanes, a_mix, rgb_mix);
+
+    /*Per pixel conditions broadcast to the 4 channels*/
+    __m128i n_a0 = _mm_cmpeq_epi16(n, zero);
+    n_a0 = _mm_shufflehi_epi16(_mm_shufflelo_epi16(n_a0, _MM_SHUFFLE(3, 3, 3, 3)), _MM_SHUFFLE(3, 3, 3, 3));
+    __m128i eq = _mm_cmpeq_epi16(d, n);
+    eq = _mm_and_si128(eq, _mm_shufflehi_epi16(_mm_shufflelo_epi16(eq, _MM_SHUFFLE(2, 3, 0, 1)), _MM_SHUFFLE(2, 3, 0, 1)));
+    eq = _mm_and_si128(eq, _mm_shufflehi_epi16(_mm_shufflelo_epi16(eq, _MM_SHUFFLE(1, 0, 3, 2)), _MM_SHUFFLE(1, 0, 3, 2)));
+
+    return blend_select(n_a0, cand_n0, blend_select(eq, d, cand_mix));
+}
+
+static inline void * drawbuf_next_row(const void * buf, uint32_t stride)
+{
+    return (void *)((uint8_t *)buf + stride);
+}
+
+#endif /*LV_USE_DRAW_SW && LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86 && (defined(__SSE2__) || defined(_M_X64))*/
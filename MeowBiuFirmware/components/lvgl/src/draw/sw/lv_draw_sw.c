@@ -50,7 +50,7 @@
     static void render_thread_cb(void * ptr);
 #endif
 
-static void execute_drawing(lv_draw_task_t * t);
+static void execute_drawing(lv_draw_task_t * t, uint32_t thread_idx);
 
 static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer);
 static int32_t evaluate(lv_draw_unit_t * draw_unit, lv_draw_task_t * task);
@@ -82,7 +82,7 @@ void lv_draw_sw_init(void)
     lv_draw_sw_unit_t * draw_sw_unit = lv_draw_create_unit(sizeof(lv_draw_sw_unit_t));
     draw_sw_unit->base_unit.dispatch_cb = dispatch;
     draw_sw_unit->base_unit.evaluate_cb = evaluate;
-    draw_sw_unit->base_unit.delete_cb = LV_USE_OS ? lv_draw_sw_delete : NULL;
+    draw_sw_unit->base_unit.delete_cb = lv_draw_sw_delete;
 #if LV_USE_DRAW_ARM2D_SYNC
     draw_sw_unit->base_unit.name = "SW_ARM2D";
 #else
@@ -101,12 +101,17 @@ void lv_draw_sw_init(void)
 #endif
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+#if LV_USE_THORVG_INTERNAL
+    /*The internal ThorVG runs its workers on LVGL's threads*/
+    tvg_engine_init(TVG_ENGINE_SW, LV_USE_OS ? LV_THORVG_WORKER_CNT : 0);
+#else
     if(LV_DRAW_SW_DRAW_UNIT_CNT > 1) {
         tvg_engine_init(TVG_ENGINE_SW, LV_DRAW_SW_DRAW_UNIT_CNT);
     }
     else {
         tvg_engine_init(TVG_ENGINE_SW, 0);
     }
+#endif
 #endif
 
     lv_ll_init(&LV_GLOBAL_DEFAULT()->draw_sw_blend_handler_ll, sizeof(lv_draw_sw_custom_blend_handler_t));
@@ -125,11 +130,12 @@ void lv_draw_sw_deinit(void)
 
 static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
 {
-#if LV_USE_OS
     lv_draw_sw_unit_t * draw_sw_unit = (lv_draw_sw_unit_t *) draw_unit;
+    LV_UNUSED(draw_sw_unit);
 
     uint32_t i;
     for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+#if LV_USE_OS
         lv_draw_sw_thread_dsc_t * thread_dsc = &draw_sw_unit->thread_dscs[i];
 
         LV_LOG_INFO("cancel software rendering thread");
@@ -139,13 +145,15 @@ static int32_t lv_draw_sw_delete(lv_draw_unit_t * draw_unit)
             lv_thread_sync_signal(&thread_dsc->sync);
         }
         lv_thread_delete(&thread_dsc->thread);
+#endif
+
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+        /*The thread doesn't run anymore so its vector context can be freed*/
+        lv_draw_sw_vector_ctx_deinit(&draw_sw_unit->vector_ctxs[i]);
+#endif
     }
 
     return 0;
-#else
-    LV_UNUSED(draw_unit);
-    return 0;
-#endif
 }
 
 bool lv_draw_sw_register_blend_handler(lv_draw_sw_custom_blend_handler_t * handler)
@@ -296,6 +304,7 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
         all_idle = false;
         taken_cnt++;
         t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+        t->draw_unit = draw_unit;
         thread_dsc->task_act = t;
 
         /*Let the render thread work*/
@@ -326,9 +335,10 @@ static int32_t dispatch(lv_draw_unit_t * draw_unit, lv_layer_t * layer)
     }
 
     t->state = LV_DRAW_TASK_STATE_IN_PROGRESS;
+    t->draw_unit = draw_unit;
     draw_sw_unit->task_act = t;
 
-    execute_drawing(t);
+    execute_drawing(t, 0);
     draw_sw_unit->task_act->state = LV_DRAW_TASK_STATE_READY;
     draw_sw_unit->task_act = NULL;
 
@@ -362,7 +372,7 @@ static void render_thread_cb(void * ptr)
             break;
         }
 
-        execute_drawing(thread_dsc->task_act);
+        execute_drawing(thread_dsc->task_act, thread_dsc->idx);
 #if LV_USE_PARALLEL_DRAW_DEBUG
         parallel_debug_draw(thread_dsc->task_act, thread_dsc->idx);
 #endif
@@ -380,8 +390,10 @@ static void render_thread_cb(void * ptr)
 }
 #endif
 
-static void execute_drawing(lv_draw_task_t * t)
+static void execute_drawing(lv_draw_task_t * t, uint32_t thread_idx)
 {
+    LV_UNUSED(thread_idx);
+
     LV_PROFILER_DRAW_BEGIN;
     /*Render the draw task*/
     switch(t->type) {
@@ -420,7 +432,7 @@ static void execute_drawing(lv_draw_task_t * t)
             break;
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
         case LV_DRAW_TASK_TYPE_VECTOR:
-            lv_draw_sw_vector(t, t->draw_dsc);
+            lv_draw_sw_vector_with_ctx(t, t->draw_dsc, &((lv_draw_sw_unit_t *)t->draw_unit)->vector_ctxs[thread_idx]);
             break;
 #endif
         default:
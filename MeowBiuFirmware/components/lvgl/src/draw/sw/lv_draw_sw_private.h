@@ -31,6 +31,17 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * Kept between the vector draw tasks of a render thread so that
+ * the ThorVG canvas and the scratch buffer are not created for each task
+ */
+typedef struct {
+    struct _Tvg_Canvas * canvas;    /**< Canvas with its own memory pool, re-targeted for each task*/
+    lv_draw_buf_t * buf;            /**< ARGB8888 buffer for the layers which can't be drawn directly*/
+} lv_draw_sw_vector_ctx_t;
+#endif
+
 typedef struct {
     lv_draw_task_t * task_act;
     lv_thread_t thread;
@@ -48,6 +59,9 @@ struct _lv_draw_sw_unit_t {
 #else
     lv_draw_task_t * task_act;
 #endif
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+    lv_draw_sw_vector_ctx_t vector_ctxs[LV_DRAW_SW_DRAW_UNIT_CNT];   /**< One for each render thread*/
+#endif
 };
 
 #if LV_DRAW_SW_SHADOW_CACHE_SIZE
@@ -62,6 +76,22 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
+/**
+ * Draw vector graphics with SW render reusing the canvas and buffer of a render thread.
+ * @param t             pointer to a draw task
+ * @param dsc           the draw descriptor
+ * @param ctx           the context of the render thread or NULL to use a temporary canvas
+ */
+void lv_draw_sw_vector_with_ctx(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc, lv_draw_sw_vector_ctx_t * ctx);
+
+/**
+ * Free the canvas and the scratch buffer of a vector context
+ * @param ctx           pointer to a vector context
+ */
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -15,9 +15,16 @@
 #include "../../misc/lv_color.h"
 #include "../../stdlib/lv_string.h"
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "blend/x86/lv_blend_x86.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
+#ifndef LV_DRAW_SW_TRANSFORM_ARGB8888
+    #define LV_DRAW_SW_TRANSFORM_ARGB8888(...)  LV_RESULT_INVALID
+#endif
 
 /**********************
  *      TYPEDEFS
@@ -257,8 +264,11 @@ void lv_draw_sw_transform(const lv_area_t * dest_area, const void * src_buf,
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888
             case LV_COLOR_FORMAT_ARGB8888:
-                transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
-                                   aa);
+                if(LV_RESULT_INVALID == LV_DRAW_SW_TRANSFORM_ARGB8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups,
+                                                                      xs_step_256, ys_step_256, dest_w, dest_buf, aa)) {
+                    transform_argb8888(src_buf, src_w, src_h, src_stride, xs_ups, ys_ups, xs_step_256, ys_step_256, dest_w, dest_buf,
+                                       aa);
+                }
                 break;
 #endif
 #if LV_DRAW_SW_SUPPORT_ARGB8888_PREMULTIPLIED
@@ -9,6 +9,10 @@
 #include "lv_draw_sw_utils.h"
 #if LV_USE_DRAW_SW
 
+#if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+    #include "blend/x86/lv_blend_x86.h"
+#endif
+
 /*********************
  *      DEFINES
  *********************/
@@ -9,7 +9,7 @@
 #include "../lv_image_decoder_private.h"
 #include "../lv_draw_vector_private.h"
 #include "../lv_draw_private.h"
-#include "lv_draw_sw.h"
+#include "lv_draw_sw_private.h"
 
 #if LV_USE_VECTOR_GRAPHIC && LV_USE_THORVG
 #if LV_USE_THORVG_EXTERNAL
@@ -18,6 +18,7 @@
     #include "../../libs/thorvg/thorvg_capi.h"
 #endif
 #include "../../stdlib/lv_string.h"
+#include "../../misc/lv_area_private.h"
 #include "blend/lv_draw_sw_blend_private.h"
 #include "blend/lv_draw_sw_blend_to_rgb565.h"
 #include "blend/lv_draw_sw_blend_to_rgb888.h"
@@ -49,6 +50,11 @@ typedef struct {
     int32_t translate_x;
     int32_t translate_y;
 } _tvg_draw_state;
+
+typedef struct {
+    lv_area_t area;
+    bool found;
+} _tvg_bounds;
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -378,14 +384,21 @@ static void _set_paint_blend_mode(Tvg_Paint * obj, lv_vector_blend_t blend)
     tvg_paint_set_blend_method(obj, lv_blend_to_tvg(blend));
 }
 
-static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area, const lv_draw_buf_t * new_buf,
-                            const lv_area_t * src_area)
+/**
+ * Blend the ARGB8888 buffer rendered for an area to the layer
+ * @param draw_buf      the buffer of the layer
+ * @param buf_area      the area of `draw_buf`
+ * @param area          the area rendered to `new_buf`, it's in `buf_area`
+ * @param new_buf       the ARGB8888 buffer with the pixels of `area` at its top left
+ */
+static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * buf_area, const lv_area_t * area,
+                            const lv_draw_buf_t * new_buf)
 {
     lv_draw_sw_blend_image_dsc_t fill_dsc;
-    fill_dsc.dest_w = src_area->x2;
-    fill_dsc.dest_h = src_area->y2;
+    fill_dsc.dest_w = lv_area_get_width(area);
+    fill_dsc.dest_h = lv_area_get_height(area);
     fill_dsc.dest_stride = draw_buf->header.stride;
-    fill_dsc.dest_buf = draw_buf->data;
+    fill_dsc.dest_buf = lv_draw_buf_goto_xy(draw_buf, area->x1 - buf_area->x1, area->y1 - buf_area->y1);
 
     fill_dsc.opa = LV_OPA_100;
     fill_dsc.blend_mode = LV_BLEND_MODE_NORMAL;
@@ -396,8 +409,9 @@ static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area
     fill_dsc.mask_buf = NULL;
     fill_dsc.mask_stride = 0;
 
-    fill_dsc.relative_area = *dst_area;
-    fill_dsc.src_area  = *src_area;
+    fill_dsc.relative_area = *area;
+    lv_area_move(&fill_dsc.relative_area, -buf_area->x1, -buf_area->y1);
+    lv_area_set(&fill_dsc.src_area, 0, 0, fill_dsc.dest_w - 1, fill_dsc.dest_h - 1);
 
     switch(draw_buf->header.cf) {
 #if LV_DRAW_SW_SUPPORT_RGB565
@@ -416,6 +430,64 @@ static void _blend_draw_buf(lv_draw_buf_t * draw_buf, const lv_area_t * dst_area
     }
 }
 
+static void _task_rgb565_check_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
+{
+    bool * direct = ctx;
+    if(!path) return; /*clear*/
+
+    /*ThorVG can draw only shapes with normal blending directly to RGB565*/
+    if(dsc->fill_dsc.style == LV_VECTOR_DRAW_STYLE_PATTERN ||
+       lv_blend_to_tvg(dsc->blend_mode) != TVG_BLEND_METHOD_NORMAL) {
+        *direct = false;
+    }
+}
+
+static void _task_bounds_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
+{
+    _tvg_bounds * bounds = ctx;
+    lv_area_t area = dsc->scissor_area;
+
+    /*A path covers the hull of its points. Not known with perspective, use the scissor area then.*/
+    const lv_matrix_t * m = &dsc->matrix;
+    if(path && !lv_array_is_empty(&path->points) &&
+       m->m[2][0] == 0.0f && m->m[2][1] == 0.0f && m->m[2][2] == 1.0f) {
+        const lv_fpoint_t * pts = lv_array_front(&path->points);
+        uint32_t cnt = lv_array_size(&path->points);
+        float x1 = (float)LV_COORD_MAX;
+        float y1 = (float)LV_COORD_MAX;
+        float x2 = (float)-LV_COORD_MAX;
+        float y2 = (float)-LV_COORD_MAX;
+        uint32_t i;
+        for(i = 0; i < cnt; i++) {
+            float x = m->m[0][0] * pts[i].x + m->m[0][1] * pts[i].y + m->m[0][2];
+            float y = m->m[1][0] * pts[i].x + m->m[1][1] * pts[i].y + m->m[1][2];
+            x1 = LV_MIN(x1, x);
+            y1 = LV_MIN(y1, y);
+            x2 = LV_MAX(x2, x);
+            y2 = LV_MAX(y2, y);
+        }
+
+        /*The stroke reaches out by half of its width, or more at the miter joins and square caps.
+         *1 more pixel for the antialiasing and rounding.*/
+        float pad = 2.0f;
+        if(dsc->stroke_dsc.width > 0.0f) {
+            float scale = LV_MAX(LV_ABS(m->m[0][0]) + LV_ABS(m->m[0][1]), LV_ABS(m->m[1][0]) + LV_ABS(m->m[1][1]));
+            pad += dsc->stroke_dsc.width / 2.0f * LV_MAX(dsc->stroke_dsc.miter_limit, 2) * scale;
+        }
+
+        lv_area_t path_area;
+        path_area.x1 = (int32_t)LV_CLAMP((float)-LV_COORD_MAX, x1 - pad, (float)LV_COORD_MAX);
+        path_area.y1 = (int32_t)LV_CLAMP((float)-LV_COORD_MAX, y1 - pad, (float)LV_COORD_MAX);
+        path_area.x2 = (int32_t)LV_CLAMP((float)-LV_COORD_MAX, x2 + pad, (float)LV_COORD_MAX);
+        path_area.y2 = (int32_t)LV_CLAMP((float)-LV_COORD_MAX, y2 + pad, (float)LV_COORD_MAX);
+        if(!lv_area_intersect(&area, &area, &path_area)) return;
+    }
+
+    if(bounds->found) lv_area_join(&bounds->area, &bounds->area, &area);
+    else bounds->area = area;
+    bounds->found = true;
+}
+
 static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_vector_draw_dsc_t * dsc)
 {
     _tvg_draw_state * state = (_tvg_draw_state *)ctx;
@@ -463,11 +535,51 @@ static void _task_draw_cb(void * ctx, const lv_vector_path_t * path, const lv_ve
     tvg_canvas_push(canvas, obj);
 }
 
+/**
+ * Get a cleared ARGB8888 buffer of at least `w` x `h` pixels.
+ * The buffer of the context is reused and reallocated only if it's too small.
+ * @param ctx   pointer to a vector context
+ * @param w     required width
+ * @param h     required height
+ * @return      the buffer or NULL on error
+ */
+static lv_draw_buf_t * _get_scratch_buf(lv_draw_sw_vector_ctx_t * ctx, int32_t w, int32_t h)
+{
+    lv_draw_buf_t * buf = ctx->buf;
+    int32_t buf_w = w;
+    int32_t buf_h = h;
+    if(buf && (buf->header.w < w || buf->header.h < h)) {
+        /*Grow in both directions to avoid reallocating if the shapes have various sizes*/
+        buf_w = LV_MAX(w, buf->header.w);
+        buf_h = LV_MAX(h, buf->header.h);
+        lv_draw_buf_destroy(buf);
+        buf = NULL;
+    }
+
+    if(buf == NULL) {
+        buf = lv_draw_buf_create(buf_w, buf_h, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+        ctx->buf = buf;
+        if(buf == NULL) {
+            LV_LOG_WARN("Couldn't allocate the %"LV_PRId32"x%"LV_PRId32" vector scratch buffer", buf_w, buf_h);
+            return NULL;
+        }
+    }
+
+    lv_area_t area = {0, 0, w - 1, h - 1};
+    lv_draw_buf_clear(buf, &area);
+    return buf;
+}
+
 /**********************
  *   GLOBAL FUNCTIONS
  **********************/
 
 void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc)
+{
+    lv_draw_sw_vector_with_ctx(t, dsc, NULL);
+}
+
+void lv_draw_sw_vector_with_ctx(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc, lv_draw_sw_vector_ctx_t * ctx)
 {
     if(dsc->task_list == NULL)
         return;
@@ -477,6 +589,13 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc)
     if(draw_buf == NULL)
         return;
 
+    /*Without a context of a render thread (e.g. for vector fonts) use a temporary canvas and buffer*/
+    lv_draw_sw_vector_ctx_t tmp_ctx;
+    if(ctx == NULL) {
+        lv_memzero(&tmp_ctx, sizeof(tmp_ctx));
+        ctx = &tmp_ctx;
+    }
+
     void * buf = draw_buf->data;
     int32_t width = lv_area_get_width(&layer->buf_area);
     int32_t height = lv_area_get_height(&layer->buf_area);
@@ -486,23 +605,58 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc)
 
     bool allow_buffer = false;
     lv_draw_buf_t * new_buf = NULL;
+    Tvg_Colorspace tvg_cs = TVG_COLORSPACE_ARGB8888;
+    uint32_t px_size = 4;
+    /*The top left corner of the target buffer*/
+    lv_area_t target_area = layer->buf_area;
+
+    /*Draw the shapes directly to RGB565 if possible, else render to an ARGB8888 buffer and blend it*/
+    bool direct = true;
+    if(cf == LV_COLOR_FORMAT_RGB565) lv_vector_for_each_task(dsc->task_list, _task_rgb565_check_cb, &direct);
+
+    if(cf == LV_COLOR_FORMAT_RGB565 && direct) {
+        tvg_cs = TVG_COLORSPACE_RGB565;
+        px_size = 2;
+    }
+    else if(cf != LV_COLOR_FORMAT_ARGB8888 && \
+            cf != LV_COLOR_FORMAT_XRGB8888) {
+        /*Clear and blend only the area of the shapes, not the whole layer*/
+        _tvg_bounds bounds = {{0}, false};
+        lv_vector_for_each_task(dsc->task_list, _task_bounds_cb, &bounds);
+        if(bounds.found &&
+           lv_area_intersect(&target_area, &bounds.area, &t->clip_area) &&
+           lv_area_intersect(&target_area, &target_area, &layer->buf_area)) {
+            width = lv_area_get_width(&target_area);
+            height = lv_area_get_height(&target_area);
+            new_buf = _get_scratch_buf(ctx, width, height);
+        }
 
-    if(cf != LV_COLOR_FORMAT_ARGB8888 && \
-       cf != LV_COLOR_FORMAT_XRGB8888) {
+        if(new_buf == NULL) {
+            lv_vector_for_each_destroy_tasks(dsc->task_list, NULL, NULL);
+            dsc->task_list = NULL;
+            if(ctx == &tmp_ctx) lv_draw_sw_vector_ctx_deinit(ctx);
+            return;
+        }
         allow_buffer = true;
-        new_buf = lv_draw_buf_create(width, height, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
-        lv_draw_buf_clear(new_buf, NULL);
         buf = new_buf->data;
         stride = new_buf->header.stride;
     }
-    Tvg_Canvas * canvas = tvg_swcanvas_create();
-    tvg_swcanvas_set_target(canvas, buf, stride / 4, width, height, TVG_COLORSPACE_ARGB8888);
+
+    if(ctx->canvas == NULL) {
+        ctx->canvas = tvg_swcanvas_create();
+        /*The render threads can draw in parallel, so don't use the shared memory pool*/
+        tvg_swcanvas_set_mempool(ctx->canvas, TVG_MEMPOOL_POLICY_INDIVIDUAL);
+    }
+    Tvg_Canvas * canvas = ctx->canvas;
+    tvg_swcanvas_set_target(canvas, buf, stride / px_size, width, height, tvg_cs);
 
     _tvg_rect rc;
     lv_area_to_tvg(&rc, &t->clip_area);
-    tvg_canvas_set_viewport(canvas, (int32_t)rc.x, (int32_t)(rc.y - layer->partial_y_offset), (int32_t)rc.w, (int32_t)rc.h);
+    tvg_canvas_set_viewport(canvas, (int32_t)rc.x - target_area.x1 + layer->buf_area.x1,
+                            (int32_t)(rc.y - layer->partial_y_offset) - target_area.y1 + layer->buf_area.y1,
+                            (int32_t)rc.w, (int32_t)rc.h);
 
-    _tvg_draw_state state = {canvas, layer->partial_y_offset, -layer->buf_area.x1, -layer->buf_area.y1};
+    _tvg_draw_state state = {canvas, layer->partial_y_offset, -target_area.x1, -target_area.y1};
 
     lv_ll_t * task_list = dsc->task_list;
     lv_vector_for_each_destroy_tasks(task_list, _task_draw_cb, &state);
@@ -512,13 +666,27 @@ void lv_draw_sw_vector(lv_draw_task_t * t, lv_draw_vector_task_dsc_t * dsc)
         tvg_canvas_sync(canvas);
     }
 
+    /*Free the paints but keep the canvas (and its memory pool) for the next task*/
+    tvg_canvas_clear(canvas, true);
+
     if(allow_buffer) {
-        lv_area_t src_area = {0, 0, width, height};
-        _blend_draw_buf(draw_buf, &layer->buf_area, new_buf, &src_area);
-        lv_draw_buf_destroy(new_buf);
+        _blend_draw_buf(draw_buf, &layer->buf_area, &target_area, new_buf);
     }
 
-    tvg_canvas_destroy(canvas);
+    if(ctx == &tmp_ctx) lv_draw_sw_vector_ctx_deinit(ctx);
+}
+
+void lv_draw_sw_vector_ctx_deinit(lv_draw_sw_vector_ctx_t * ctx)
+{
+    if(ctx->canvas) {
+        tvg_canvas_destroy(ctx->canvas);
+        ctx->canvas = NULL;
+    }
+
+    if(ctx->buf) {
+        lv_draw_buf_destroy(ctx->buf);
+        ctx->buf = NULL;
+    }
 }
 
 /**********************
@@ -101,10 +101,14 @@ lv_font_t * lv_binfont_create(const char * path)
     lv_fs_res_t fs_res = lv_fs_open(&file, path, LV_FS_MODE_RD);
     if(fs_res != LV_FS_RES_OK) return NULL;
 
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_FONT);
     lv_font_t * font = lv_malloc_zeroed(sizeof(lv_font_t));
     LV_ASSERT_MALLOC(font);
 
-    if(!lvgl_load_font(&file, font)) {
+    bool loaded = lvgl_load_font(&file, font);
+    LV_MEM_TAG_END;
+
+    if(!loaded) {
         LV_LOG_WARN("Error loading font file: %s", path);
         /*
         * When `lvgl_load_font` fails it can leak some pointers.
@@ -137,6 +141,10 @@ void lv_binfont_destroy(lv_font_t * font)
     const lv_font_fmt_txt_dsc_t * dsc = font->dsc;
     if(dsc == NULL) return;
 
+#if LV_USE_FONT_COMPRESSED
+    if(dsc->bitmap_format != LV_FONT_FMT_TXT_PLAIN) lv_font_fmt_txt_glyph_cache_drop(font);
+#endif
+
     if(dsc->kern_classes == 0) {
         const lv_font_fmt_txt_kern_pair_t * kern_dsc = dsc->kern_dsc;
         if(NULL != kern_dsc) {
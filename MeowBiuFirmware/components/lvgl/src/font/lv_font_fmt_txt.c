@@ -13,6 +13,7 @@
 #include "../misc/lv_types.h"
 #include "../misc/lv_log.h"
 #include "../misc/lv_utils.h"
+#include "../misc/cache/lv_cache.h"
 #include "../stdlib/lv_mem.h"
 
 /*********************
@@ -20,6 +21,9 @@
  *********************/
 #if LV_USE_FONT_COMPRESSED
     #define font_rle LV_GLOBAL_DEFAULT()->font_fmt_rle
+    #define glyph_cache LV_GLOBAL_DEFAULT()->font_fmt_glyph_cache
+    #define font_draw_buf_handlers &(LV_GLOBAL_DEFAULT()->font_draw_buf_handlers)
+    #define CACHE_NAME "FONT_GLYPH"
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 /**********************
@@ -30,6 +34,15 @@ typedef struct {
     uint32_t gid_right;
 } kern_pair_ref_t;
 
+#if LV_USE_FONT_COMPRESSED
+typedef struct {
+    lv_cache_slot_size_t slot;
+    const lv_font_t * font;
+    uint32_t gid;
+    lv_draw_buf_t * draw_buf;       /*The decompressed A8 bitmap*/
+} glyph_cache_data_t;
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
@@ -45,6 +58,12 @@ static int kern_pair_16_compare(const void * ref, const void * element);
     static inline uint8_t get_bits(const uint8_t * in, uint32_t bit_pos, uint8_t len);
     static inline void rle_init(const uint8_t * in,  uint8_t bpp);
     static inline uint8_t rle_next(void);
+
+    static const lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc,
+                                                     const lv_font_fmt_txt_glyph_dsc_t * gdsc);
+    static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data);
+    static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data);
+    static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs);
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 static lv_font_t * builtin_font_create_cb(const lv_font_info_t * info, const void * src);
@@ -203,6 +222,10 @@ const void * lv_font_get_bitmap_fmt_txt(lv_font_glyph_dsc_t * g_dsc, lv_draw_buf
     /*Handle compressed bitmap*/
     else {
 #if LV_USE_FONT_COMPRESSED
+        /*Decompressing is slow, so reuse the bitmap of the recently drawn glyphs*/
+        const lv_draw_buf_t * cached = glyph_cache_acquire(g_dsc, gdsc);
+        if(cached) return cached;
+
         bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
         decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], bitmap_out, gdsc->box_w, gdsc->box_h,
                    (uint8_t)fdsc->bpp, prefilter);
@@ -271,6 +294,48 @@ bool lv_font_get_glyph_dsc_fmt_txt(const lv_font_t * font, lv_font_glyph_dsc_t *
     return true;
 }
 
+#if LV_USE_FONT_COMPRESSED
+
+void lv_font_fmt_txt_glyph_cache_init(uint32_t size)
+{
+    if(size == 0 || glyph_cache) return;
+
+    lv_cache_ops_t ops = {
+        .compare_cb = (lv_cache_compare_cb_t)glyph_cache_compare_cb,
+        .create_cb = (lv_cache_create_cb_t)glyph_cache_create_cb,
+        .free_cb = (lv_cache_free_cb_t)glyph_cache_free_cb,
+    };
+
+    glyph_cache = lv_cache_create(&lv_cache_class_lru_rb_size, sizeof(glyph_cache_data_t), size, ops);
+    if(glyph_cache) lv_cache_set_name(glyph_cache, CACHE_NAME);
+}
+
+void lv_font_fmt_txt_glyph_cache_deinit(void)
+{
+    if(glyph_cache == NULL) return;
+
+    lv_cache_destroy(glyph_cache, NULL);
+    glyph_cache = NULL;
+}
+
+void lv_font_fmt_txt_glyph_cache_drop(const lv_font_t * font)
+{
+    LV_UNUSED(font);
+    if(glyph_cache == NULL) return;
+
+    /*Fonts are rarely freed, so simply drop all glyphs instead of searching the font's glyphs*/
+    lv_cache_drop_all(glyph_cache, NULL);
+}
+
+void lv_font_fmt_txt_glyph_release(lv_font_glyph_dsc_t * g_dsc)
+{
+    LV_ASSERT_NULL(glyph_cache);
+    lv_cache_release(glyph_cache, g_dsc->entry, NULL);
+    g_dsc->entry = NULL;
+}
+
+#endif /*LV_USE_FONT_COMPRESSED*/
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -599,6 +664,71 @@ static inline uint8_t rle_next(void)
 
     return ret;
 }
+
+/**
+ * Get the decompressed bitmap of a glyph from the cache. Decompress it into a new entry if it's not cached yet.
+ * @param g_dsc     the glyph descriptor, the acquired entry is saved in its `entry` field
+ * @param gdsc      the glyph's descriptor in the font
+ * @return          the cached bitmap or NULL if the glyph can't be cached
+ */
+static const lv_draw_buf_t * glyph_cache_acquire(lv_font_glyph_dsc_t * g_dsc,
+                                                 const lv_font_fmt_txt_glyph_dsc_t * gdsc)
+{
+    if(glyph_cache == NULL) return NULL;
+
+    /*E.g. a tab is drawn with the glyph of the space but wider*/
+    if(g_dsc->box_w != gdsc->box_w || g_dsc->box_h != gdsc->box_h) return NULL;
+
+    glyph_cache_data_t search_key = {
+        .slot.size = lv_draw_buf_width_to_stride(gdsc->box_w, LV_COLOR_FORMAT_A8) * gdsc->box_h,
+        .font = g_dsc->resolved_font,
+        .gid = g_dsc->gid.index,
+    };
+
+    /*Glyphs larger than the whole cache are decompressed directly into the draw buffer*/
+    if(search_key.slot.size > lv_cache_get_max_size(glyph_cache, NULL)) return NULL;
+
+    lv_cache_entry_t * entry = lv_cache_acquire_or_create(glyph_cache, &search_key, (void *)gdsc);
+    if(entry == NULL) return NULL;
+
+    g_dsc->entry = entry;
+    glyph_cache_data_t * data = lv_cache_entry_get_data(entry);
+    return data->draw_buf;
+}
+
+static bool glyph_cache_create_cb(glyph_cache_data_t * data, void * user_data)
+{
+    const lv_font_fmt_txt_glyph_dsc_t * gdsc = user_data;
+    const lv_font_fmt_txt_dsc_t * fdsc = data->font->dsc;
+
+    data->draw_buf = lv_draw_buf_create_ex(font_draw_buf_handlers, gdsc->box_w, gdsc->box_h, LV_COLOR_FORMAT_A8,
+                                           LV_STRIDE_AUTO);
+    if(data->draw_buf == NULL) return false;
+
+    /*It runs with the cache locked, so `font_rle` is not used by two draw units at the same time*/
+    bool prefilter = fdsc->bitmap_format == LV_FONT_FMT_TXT_COMPRESSED;
+    decompress(&fdsc->glyph_bitmap[gdsc->bitmap_index], data->draw_buf->data, gdsc->box_w, gdsc->box_h,
+               (uint8_t)fdsc->bpp, prefilter);
+    lv_draw_buf_flush_cache(data->draw_buf, NULL);
+    return true;
+}
+
+static void glyph_cache_free_cb(glyph_cache_data_t * data, void * user_data)
+{
+    LV_UNUSED(user_data);
+    if(data->draw_buf) lv_draw_buf_destroy(data->draw_buf);
+}
+
+static lv_cache_compare_res_t glyph_cache_compare_cb(const glyph_cache_data_t * lhs, const glyph_cache_data_t * rhs)
+{
+    if(lhs->font != rhs->font) {
+        return lhs->font > rhs->font ? 1 : -1;
+    }
+    if(lhs->gid != rhs->gid) {
+        return lhs->gid > rhs->gid ? 1 : -1;
+    }
+    return 0;
+}
 #endif /*LV_USE_FONT_COMPRESSED*/
 
 /** Code Comparator.
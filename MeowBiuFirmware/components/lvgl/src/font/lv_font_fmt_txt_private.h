@@ -45,6 +45,31 @@ typedef struct {
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_FONT_COMPRESSED
+/**
+ * Create the cache of the decompressed glyph bitmaps shared by all compressed fonts.
+ * @param size      size of the cache in bytes. 0: don't cache the glyphs.
+ */
+void lv_font_fmt_txt_glyph_cache_init(uint32_t size);
+
+/**
+ * Free the glyph cache and all the bitmaps in it.
+ */
+void lv_font_fmt_txt_glyph_cache_deinit(void);
+
+/**
+ * Remove the glyphs of a font from the cache. Call it before freeing a compressed font.
+ * @param font      pointer to a font
+ */
+void lv_font_fmt_txt_glyph_cache_drop(const lv_font_t * font);
+
+/**
+ * Release the cache entry returned in `g_dsc->entry` by `lv_font_get_bitmap_fmt_txt()`.
+ * @param g_dsc     the glyph descriptor used to get the bitmap
+ */
+void lv_font_fmt_txt_glyph_release(lv_font_glyph_dsc_t * g_dsc);
+#endif
+
 /**********************
  *      MACROS
  **********************/
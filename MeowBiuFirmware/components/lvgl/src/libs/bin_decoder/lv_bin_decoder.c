@@ -41,12 +41,19 @@
 
 typedef struct _lv_image_compressed_t {
     uint32_t method: 4; /*Compression method, see `lv_image_compress_t`*/
-    uint32_t reserved : 28;  /*Reserved to be used later*/
+    uint32_t chunk_rows : 12;  /*If not 0 every this many rows are compressed independently, see below*/
+    uint32_t reserved : 16;  /*Reserved to be used later*/
     uint32_t compressed_size;  /*Compressed data size in byte*/
     uint32_t decompressed_size;  /*Decompressed data size in byte*/
     const uint8_t * data; /*Compressed data*/
 } lv_image_compressed_t;
 
+/* With `chunk_rows` the compressed data starts with an index of `chunk_cnt + 1`
+ * little endian uint32 offsets, relative to the end of the index, followed by
+ * the chunks. Chunk `i` is `chunk_rows` rows (the last one can be shorter)
+ * compressed on its own, so `get_area_cb` can decompress only the chunks of
+ * the rows being drawn.*/
+
 typedef struct {
     lv_fs_file_t * f;
     lv_color32_t * palette;
@@ -56,6 +63,10 @@ typedef struct {
     lv_draw_buf_t * decompressed;       /*Decompressed data could be used directly, thus must also be draw buf*/
     lv_draw_buf_t c_array;              /*An C-array image that need to be converted to a draw buf*/
     lv_draw_buf_t * decoded_partial;    /*A draw buf for decoded image via get_area_cb*/
+    uint8_t * chunk_index;              /*Chunk index of a compressed file, read to RAM*/
+    uint8_t * chunk_buf;                /*A compressed chunk read from a file*/
+    uint32_t chunk_buf_size;
+    int32_t chunk_decoded;              /*The chunk in `decoded_partial`, -1 if none*/
 } decoder_data_t;
 
 /**********************
@@ -72,10 +83,15 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out);
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc);
+static lv_result_t load_chunk_index(lv_image_decoder_dsc_t * dsc);
+static lv_result_t decode_compressed_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                          lv_area_t * decoded_area);
 
 static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff, uint32_t btr, uint32_t * br);
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed);
+static uint32_t decompress_data(lv_image_decoder_dsc_t * dsc, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t output_len);
 
 /**********************
  *  STATIC VARIABLES
@@ -392,6 +408,10 @@ lv_result_t lv_bin_decoder_get_area(lv_image_decoder_t * decoder, lv_image_decod
 {
     LV_UNUSED(decoder); /*Unused*/
 
+    if(dsc->header.flags & LV_IMAGE_FLAGS_COMPRESSED) {
+        return decode_compressed_area(dsc, full_area, decoded_area);
+    }
+
     lv_color_format_t cf = dsc->header.cf;
     /*Check if cf is supported*/
 
@@ -560,6 +580,8 @@ static void free_decoder_data(lv_image_decoder_dsc_t * dsc)
     if(decoder_data->decoded) lv_draw_buf_destroy(decoder_data->decoded);
     if(decoder_data->decompressed) lv_draw_buf_destroy(decoder_data->decompressed);
     lv_free(decoder_data->palette);
+    lv_free(decoder_data->chunk_index);
+    lv_free(decoder_data->chunk_buf);
     lv_free(decoder_data);
     dsc->user_data = NULL;
 }
@@ -915,7 +937,6 @@ static lv_result_t decode_alpha_only(lv_image_decoder_t * decoder, lv_image_deco
 
 static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_decoder_dsc_t * dsc)
 {
-#if LV_BIN_DECODER_RAM_LOAD
     uint32_t rn;
     uint32_t len;
     uint32_t compressed_len;
@@ -923,6 +944,9 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
     lv_result_t res;
     lv_fs_res_t fs_res;
     uint8_t * file_buf = NULL;
+
+    if(decoder_data == NULL) return LV_RESULT_INVALID;
+
     lv_image_compressed_t * compressed = &decoder_data->compressed;
 
     lv_memzero(compressed, sizeof(lv_image_compressed_t));
@@ -952,6 +976,10 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
             return LV_RESULT_INVALID;
         }
 
+        /*Only the index is loaded, the chunks are read when drawn*/
+        if(compressed->chunk_rows) return load_chunk_index(dsc);
+
+#if LV_BIN_DECODER_RAM_LOAD
         file_buf = lv_malloc(compressed_len);
         if(file_buf == NULL) {
             LV_LOG_WARN("No memory for compressed file");
@@ -970,6 +998,7 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 
         /*Decompress the image*/
         compressed->data = file_buf;
+#endif
     }
     else if(dsc->src_type == LV_IMAGE_SRC_VARIABLE) {
         lv_image_dsc_t * image = (lv_image_dsc_t *)dsc->src;
@@ -984,12 +1013,15 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
             LV_LOG_WARN("Compressed size mismatch: %" LV_PRIu32" != %" LV_PRIu32, compressed->compressed_size, compressed_len);
             return LV_RESULT_INVALID;
         }
+
+        if(compressed->chunk_rows) return load_chunk_index(dsc);
     }
     else {
         LV_LOG_WARN("Compressed image only support file or variable");
         return LV_RESULT_INVALID;
     }
 
+#if LV_BIN_DECODER_RAM_LOAD
     res = decompress_image(dsc, compressed);
     compressed->data = NULL; /*No need to store the data any more*/
     lv_free(file_buf);
@@ -1026,12 +1058,176 @@ static lv_result_t decode_compressed(lv_image_decoder_t * decoder, lv_image_deco
 #else
     LV_UNUSED(decompress_image);
     LV_UNUSED(decoder);
-    LV_UNUSED(dsc);
-    LV_LOG_ERROR("Need LV_BIN_DECODER_RAM_LOAD to be enabled");
+    LV_UNUSED(res);
+    LV_UNUSED(file_buf);
+    LV_LOG_ERROR("Need LV_BIN_DECODER_RAM_LOAD to be enabled or the image to be compressed in chunks");
     return LV_RESULT_INVALID;
 #endif
 }
 
+static uint32_t get_chunk_offset(const uint8_t * index, uint32_t i)
+{
+    index += i * 4;
+    return (uint32_t)index[0] | ((uint32_t)index[1] << 8) | ((uint32_t)index[2] << 16) | ((uint32_t)index[3] << 24);
+}
+
+static lv_result_t load_chunk_index(lv_image_decoder_dsc_t * dsc)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    lv_image_compressed_t * compressed = &decoder_data->compressed;
+    lv_color_format_t cf = dsc->header.cf;
+
+    /*Only the formats which are stored row by row in a single plane*/
+    bool supported = cf == LV_COLOR_FORMAT_ARGB8888 \
+                     || cf == LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED \
+                     || cf == LV_COLOR_FORMAT_XRGB8888 \
+                     || cf == LV_COLOR_FORMAT_RGB888   \
+                     || cf == LV_COLOR_FORMAT_RGB565   \
+                     || cf == LV_COLOR_FORMAT_RGB565_SWAPPED   \
+                     || cf == LV_COLOR_FORMAT_ARGB8565;
+    if(!supported) {
+        LV_LOG_WARN("CF: %d can't be compressed in chunks", cf);
+        return LV_RESULT_INVALID;
+    }
+
+    if(compressed->decompressed_size != dsc->header.stride * dsc->header.h) {
+        LV_LOG_WARN("Decompressed size mismatch: %" LV_PRIu32 " != %" LV_PRIu32, compressed->decompressed_size,
+                    (uint32_t)(dsc->header.stride * dsc->header.h));
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t chunk_cnt = (dsc->header.h + compressed->chunk_rows - 1) / compressed->chunk_rows;
+    uint32_t index_size = (chunk_cnt + 1) * 4;
+    if(index_size > compressed->compressed_size) {
+        LV_LOG_WARN("Chunk index is truncated");
+        return LV_RESULT_INVALID;
+    }
+
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        uint8_t * index = lv_malloc(index_size);
+        if(index == NULL) {
+            LV_LOG_WARN("No memory for the chunk index");
+            return LV_RESULT_INVALID;
+        }
+
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + 12, index, index_size, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != index_size) {
+            LV_LOG_WARN("Read chunk index failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                        index_size);
+            lv_free(index);
+            return LV_RESULT_INVALID;
+        }
+
+        decoder_data->chunk_index = index; /*Free on decoder close*/
+        compressed->data = index;
+    }
+
+    if(get_chunk_offset(compressed->data, chunk_cnt) != compressed->compressed_size - index_size) {
+        LV_LOG_WARN("Chunk index size mismatch");
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->chunk_decoded = -1;
+
+    /*It needs to be read by get_area_cb later*/
+    return LV_RESULT_OK;
+}
+
+static lv_result_t decode_compressed_area(lv_image_decoder_dsc_t * dsc, const lv_area_t * full_area,
+                                          lv_area_t * decoded_area)
+{
+    decoder_data_t * decoder_data = dsc->user_data;
+    if(decoder_data == NULL) {
+        LV_LOG_ERROR("Unexpected null decoder data");
+        return LV_RESULT_INVALID;
+    }
+
+    const lv_image_compressed_t * compressed = &decoder_data->compressed;
+    if(compressed->chunk_rows == 0) return LV_RESULT_INVALID; /*Decompressed as a whole on open*/
+
+    /*Return whole chunks, the rows of the next one after the previous call*/
+    int32_t y = decoded_area->y1 == LV_COORD_MIN ? full_area->y1 : decoded_area->y2 + 1;
+    if(y > full_area->y2 || y >= (int32_t)dsc->header.h) return LV_RESULT_INVALID;
+
+    int32_t chunk = y / compressed->chunk_rows;
+    decoded_area->x1 = 0;
+    decoded_area->x2 = dsc->header.w - 1;
+    decoded_area->y1 = chunk * compressed->chunk_rows;
+    decoded_area->y2 = LV_MIN(decoded_area->y1 + compressed->chunk_rows, (int32_t)dsc->header.h) - 1;
+
+    if(chunk == decoder_data->chunk_decoded) {
+        dsc->decoded = decoder_data->decoded_partial;
+        return LV_RESULT_OK;
+    }
+
+    int32_t h = lv_area_get_height(decoded_area);
+    lv_draw_buf_t * decoded = lv_draw_buf_reshape(decoder_data->decoded_partial, dsc->header.cf, dsc->header.w, h,
+                                                  dsc->header.stride);
+    if(decoded == NULL) {
+        if(decoder_data->decoded_partial != NULL) {
+            lv_draw_buf_destroy(decoder_data->decoded_partial);
+            decoder_data->decoded_partial = NULL;
+        }
+        decoded = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, h, dsc->header.cf,
+                                        dsc->header.stride);
+        if(decoded == NULL) return LV_RESULT_INVALID;
+        decoder_data->decoded_partial = decoded; /*Free on decoder close*/
+    }
+    decoder_data->chunk_decoded = -1;
+
+    uint32_t chunk_cnt = (dsc->header.h + compressed->chunk_rows - 1) / compressed->chunk_rows;
+    uint32_t data_ofs = (chunk_cnt + 1) * 4;
+    uint32_t chunk_ofs = get_chunk_offset(compressed->data, chunk);
+    uint32_t chunk_end = get_chunk_offset(compressed->data, chunk + 1);
+    if(chunk_ofs > chunk_end || chunk_end > compressed->compressed_size - data_ofs) {
+        LV_LOG_WARN("Invalid chunk: %" LV_PRId32, chunk);
+        return LV_RESULT_INVALID;
+    }
+
+    uint32_t chunk_len = chunk_end - chunk_ofs;
+    const uint8_t * input;
+    if(dsc->src_type == LV_IMAGE_SRC_FILE) {
+        if(decoder_data->chunk_buf_size < chunk_len) {
+            uint8_t * buf = lv_realloc(decoder_data->chunk_buf, chunk_len);
+            if(buf == NULL) {
+                LV_LOG_WARN("No memory for compressed chunk");
+                return LV_RESULT_INVALID;
+            }
+            decoder_data->chunk_buf = buf; /*Free on decoder close*/
+            decoder_data->chunk_buf_size = chunk_len;
+        }
+
+        uint32_t rn;
+        lv_fs_res_t fs_res = fs_read_file_at(decoder_data->f, sizeof(lv_image_header_t) + 12 + data_ofs + chunk_ofs,
+                                             decoder_data->chunk_buf, chunk_len, &rn);
+        if(fs_res != LV_FS_RES_OK || rn != chunk_len) {
+            LV_LOG_WARN("Read compressed chunk failed: %d, with len: %" LV_PRIu32 ", expected: %" LV_PRIu32, fs_res, rn,
+                        chunk_len);
+            return LV_RESULT_INVALID;
+        }
+        input = decoder_data->chunk_buf;
+    }
+    else {
+        input = compressed->data + data_ofs + chunk_ofs;
+    }
+
+    uint32_t out_len = dsc->header.stride * h;
+    uint32_t len = decompress_data(dsc, compressed->method, input, chunk_len, decoded->data, out_len);
+    if(len != out_len) {
+        LV_LOG_WARN("Decompress chunk failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+        return LV_RESULT_INVALID;
+    }
+
+    if(dsc->header.flags & LV_IMAGE_FLAGS_PREMULTIPLIED) {
+        lv_draw_buf_set_flag(decoded, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    }
+
+    decoder_data->chunk_decoded = chunk;
+    dsc->decoded = decoded;
+    return LV_RESULT_OK;
+}
+
 static lv_result_t decode_indexed_line(lv_color_format_t color_format, const lv_color32_t * palette, int32_t x,
                                        int32_t w_px, const uint8_t * in, lv_color32_t * out)
 {
@@ -1100,36 +1296,14 @@ static lv_fs_res_t fs_read_file_at(lv_fs_file_t * f, uint32_t pos, void * buff,
 
 static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image_compressed_t * compressed)
 {
-    /* At least one compression method must be enabled */
-#if (LV_USE_LZ4 || LV_USE_RLE)
-    /* Check if the decompression method is enabled and valid */
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
-#if !LV_USE_RLE
-        LV_LOG_WARN("RLE decompression is not enabled");
-        return LV_RESULT_INVALID;
-#endif
-    }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
-#if !LV_USE_LZ4
-        LV_LOG_WARN("LZ4 decompression is not enabled");
-        return LV_RESULT_INVALID;
-#endif
-    }
-    else {
-        LV_LOG_WARN("Unknown compression method: %" LV_PRIu32, compressed->method);
-        return LV_RESULT_INVALID;
-    }
-
     /*Need to store decompressed data to decoder to free on close*/
     decoder_data_t * decoder_data = get_decoder_data(dsc);
     if(decoder_data == NULL) {
         return LV_RESULT_INVALID;
     }
 
-    uint8_t * img_data;
     uint32_t out_len = compressed->decompressed_size;
     uint32_t input_len = compressed->compressed_size;
-    uint32_t len = 0;
 
     lv_draw_buf_t * decompressed = lv_draw_buf_create_ex(image_cache_draw_buf_handlers, dsc->header.w, dsc->header.h,
                                                          dsc->header.cf,
@@ -1145,9 +1319,30 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
         return LV_RESULT_INVALID;
     }
 
-    img_data = decompressed->data;
+    uint32_t len = decompress_data(dsc, compressed->method, compressed->data, input_len, decompressed->data, out_len);
+    if(len != compressed->decompressed_size) {
+        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
+        lv_draw_buf_destroy(decompressed);
+        return LV_RESULT_INVALID;
+    }
+
+    decoder_data->decompressed = decompressed; /*Free on decoder close*/
+    return LV_RESULT_OK;
+}
+
+/**
+ * Decompress `input` with `method`
+ * @return  the number of bytes written to `output`, 0 on error
+ */
+static uint32_t decompress_data(lv_image_decoder_dsc_t * dsc, uint32_t method, const uint8_t * input, uint32_t input_len,
+                                uint8_t * output, uint32_t output_len)
+{
+    /* At least one compression method must be enabled */
+#if (LV_USE_LZ4 || LV_USE_RLE)
+    uint32_t len = 0;
 
-    if(compressed->method == LV_IMAGE_COMPRESS_RLE) {
+    /* Check if the decompression method is enabled and valid */
+    if(method == LV_IMAGE_COMPRESS_RLE) {
 #if LV_USE_RLE
         /*Compress always happen on byte*/
         uint32_t pixel_byte;
@@ -1156,37 +1351,36 @@ static lv_result_t decompress_image(lv_image_decoder_dsc_t * dsc, const lv_image
         else
             pixel_byte = (lv_color_format_get_bpp(dsc->header.cf) + 7) >> 3;
 
-        const uint8_t * input = compressed->data;
-        uint8_t * output = img_data;
-
-        len = lv_rle_decompress(input, input_len, output, out_len, pixel_byte);
+        len = lv_rle_decompress(input, input_len, output, output_len, pixel_byte);
+#else
+        LV_LOG_WARN("RLE decompression is not enabled");
 #endif /* LV_USE_RLE */
     }
-    else if(compressed->method == LV_IMAGE_COMPRESS_LZ4) {
+    else if(method == LV_IMAGE_COMPRESS_LZ4) {
 #if LV_USE_LZ4
-        const char * input = (const char *)compressed->data;
-        char * output = (char *)img_data;
-
-        int ret = LZ4_decompress_safe(input, output, (int)input_len, (int)out_len);
+        int ret = LZ4_decompress_safe((const char *)input, (char *)output, (int)input_len, (int)output_len);
         if(ret >= 0) {
             /* Cast is safe because of the above check */
             len = (uint32_t)ret;
         }
+#else
+        LV_LOG_WARN("LZ4 decompression is not enabled");
 #endif /* LV_USE_LZ4 */
     }
-
-    if(len != compressed->decompressed_size) {
-        LV_LOG_WARN("Decompress failed: %" LV_PRIu32 ", got: %" LV_PRIu32, out_len, len);
-        lv_draw_buf_destroy(decompressed);
-        return LV_RESULT_INVALID;
+    else {
+        LV_LOG_WARN("Unknown compression method: %" LV_PRIu32, method);
     }
 
-    decoder_data->decompressed = decompressed; /*Free on decoder close*/
-    return LV_RESULT_OK;
+    LV_UNUSED(dsc);
+    return len;
 #else
     LV_UNUSED(dsc);
-    LV_UNUSED(compressed);
+    LV_UNUSED(method);
+    LV_UNUSED(input);
+    LV_UNUSED(input_len);
+    LV_UNUSED(output);
+    LV_UNUSED(output_len);
     LV_LOG_WARN("At least one compression method must be enabled");
-    return LV_RESULT_INVALID;
+    return 0;
 #endif /* (LV_USE_LZ4 || LV_USE_RLE) */
 }
@@ -26,10 +26,13 @@ typedef struct Table {
 #if LV_GIF_CACHE_DECODE_DATA
 #define LZW_MAXBITS                 12
 #define LZW_TABLE_SIZE              (1 << LZW_MAXBITS)
-#define LZW_CACHE_SIZE              (LZW_TABLE_SIZE * 4)
+#define LZW_CACHE_SIZE              GD_LZW_BUF_SIZE
+#else
+typedef char gd_lzw_buf_size_check[sizeof(Entry) * 0x1000 == GD_LZW_BUF_SIZE ? 1 : -1];
 #endif
+typedef char gd_state_size_check[sizeof(gd_GIF) <= GD_GIF_STATE_SIZE ? 1 : -1];
 
-static gd_GIF  * gif_open(gd_GIF * gif);
+static gd_GIF  * gif_open(gd_GIF * gif, void * buf, size_t buf_size);
 static bool f_gif_open(gd_GIF * gif, const void * path, bool is_file);
 static void f_gif_read(gd_GIF * gif, void * buf, size_t len);
 static int f_gif_seek(gd_GIF * gif, size_t pos, int k);
@@ -57,7 +60,7 @@ gd_open_gif_file(const char * fname)
     bool res = f_gif_open(&gif_base, fname, true);
     if(!res) return NULL;
 
-    return gif_open(&gif_base);
+    return gif_open(&gif_base, NULL, 0);
 }
 
 gd_GIF *
@@ -69,10 +72,34 @@ gd_open_gif_data(const void * data)
     bool res = f_gif_open(&gif_base, data, false);
     if(!res) return NULL;
 
-    return gif_open(&gif_base);
+    return gif_open(&gif_base, NULL, 0);
+}
+
+gd_GIF *
+gd_open_gif_file_buf(const char * fname, void * buf, size_t buf_size)
+{
+    gd_GIF gif_base;
+    memset(&gif_base, 0, sizeof(gif_base));
+
+    bool res = f_gif_open(&gif_base, fname, true);
+    if(!res) return NULL;
+
+    return gif_open(&gif_base, buf, buf_size);
+}
+
+gd_GIF *
+gd_open_gif_data_buf(const void * data, void * buf, size_t buf_size)
+{
+    gd_GIF gif_base;
+    memset(&gif_base, 0, sizeof(gif_base));
+
+    bool res = f_gif_open(&gif_base, data, false);
+    if(!res) return NULL;
+
+    return gif_open(&gif_base, buf, buf_size);
 }
 
-static gd_GIF * gif_open(gd_GIF * gif_base)
+static gd_GIF * gif_open(gd_GIF * gif_base, void * buf, size_t buf_size)
 {
     uint8_t sigver[3];
     uint16_t width, height, depth;
@@ -117,21 +144,32 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
         LV_LOG_WARN("Zero size image");
         goto fail;
     }
+    /* The canvas, the LZW table and the frame follow the gd_GIF */
+    size_t state_size = buf ? GD_GIF_STATE_SIZE : sizeof(gd_GIF);
 #if LV_GIF_CACHE_DECODE_DATA
-    if(0 == (INT_MAX - sizeof(gd_GIF) - LZW_CACHE_SIZE) / width / height / 5){
-        LV_LOG_WARN("Image dimensions are too large");
-        goto fail;
-    } 
-    gif = lv_malloc(sizeof(gd_GIF) + 5 * width * height + LZW_CACHE_SIZE);
-    #else
-    if(0 == (INT_MAX - sizeof(gd_GIF)) / width / height / 5){
+    size_t lzw_size = LZW_CACHE_SIZE;
+#else
+    /* Without a buffer the LZW table is allocated for each frame */
+    size_t lzw_size = buf ? GD_LZW_BUF_SIZE : 0;
+#endif
+    if(0 == (INT_MAX - state_size - lzw_size) / width / height / 5){
         LV_LOG_WARN("Image dimensions are too large");
         goto fail;
-    } 
-    gif = lv_malloc(sizeof(gd_GIF) + 5 * width * height);
-    #endif
+    }
+    if(buf) {
+        if(buf_size < GD_GIF_BUF_SIZE(width, height)) {
+            LV_LOG_WARN("The buffer is too small for a %dx%d GIF: %zu < %zu bytes", width, height, buf_size,
+                        GD_GIF_BUF_SIZE(width, height));
+            goto fail;
+        }
+        gif = buf;
+    }
+    else {
+        gif = lv_malloc(state_size + 5 * width * height + lzw_size);
+    }
     if(!gif) goto fail;
     memcpy(gif, gif_base, sizeof(gd_GIF));
+    gif->ext_buf = buf != NULL;
     gif->width  = width;
     gif->height = height;
     gif->depth  = depth;
@@ -140,15 +178,17 @@ static gd_GIF * gif_open(gd_GIF * gif_base)
     f_gif_read(gif, gif->gct.colors, 3 * gif->gct.size);
     gif->palette = &gif->gct;
     gif->bgindex = bgidx;
-    gif->canvas = (uint8_t *) &gif[1];
-    gif->frame = &gif->canvas[4 * width * height];
+    gif->canvas = (uint8_t *) gif + state_size;
+    gif->frame = &gif->canvas[4 * width * height + lzw_size];
+#if LV_GIF_CACHE_DECODE_DATA
+    gif->lzw_cache = &gif->canvas[4 * width * height];
+#else
+    gif->lzw_table = lzw_size ? &gif->canvas[4 * width * height] : NULL;
+#endif
     if(gif->bgindex) {
         memset(gif->frame, gif->bgindex, gif->width * gif->height);
     }
     bgcolor = &gif->palette->colors[gif->bgindex * 3];
-    #if LV_GIF_CACHE_DECODE_DATA
-    gif->lzw_cache = gif->frame + width * height;
-    #endif
 
 #ifdef GIFDEC_FILL_BG
     GIFDEC_FILL_BG(gif->canvas, gif->width * gif->height, 1, gif->width * gif->height, bgcolor, 0xff);
@@ -479,24 +519,37 @@ read_image_data(gd_GIF *gif, int interlace)
     return ret;
 }
 #else
+static void
+init_table(Table * table, int key_size)
+{
+    int key;
+    table->nentries = (1 << key_size) + 2;
+    for(key = 0; key < (1 << key_size); key++)
+        table->entries[key] = (Entry) {
+        1, 0xFFF, key
+    };
+}
+
 static Table *
 new_table(int key_size)
 {
-    int key;
     int init_bulk = MAX(1 << (key_size + 1), 0x100);
     Table * table = lv_malloc(sizeof(*table) + sizeof(Entry) * init_bulk);
     if(table) {
         table->bulk = init_bulk;
-        table->nentries = (1 << key_size) + 2;
         table->entries = (Entry *) &table[1];
-        for(key = 0; key < (1 << key_size); key++)
-            table->entries[key] = (Entry) {
-            1, 0xFFF, key
-        };
+        init_table(table, key_size);
     }
     return table;
 }
 
+/* The table in the buffer of the GIF can't grow but it has room for all the 0x1000 codes */
+static void
+free_table(gd_GIF * gif, Table * table)
+{
+    if(gif->lzw_table == NULL) lv_free(table);
+}
+
 /* Add table entry. Return value:
  *  0 on success
  *  +1 if key size must be incremented after this addition
@@ -554,6 +607,7 @@ read_image_data(gd_GIF * gif, int interlace)
     uint16_t key, clear, stop;
     int ret;
     Table * table;
+    Table ext_table;
     Entry entry = {0};
     size_t start, end;
 
@@ -565,7 +619,16 @@ read_image_data(gd_GIF * gif, int interlace)
     f_gif_seek(gif, start, LV_FS_SEEK_SET);
     clear = 1 << key_size;
     stop = clear + 1;
-    table = new_table(key_size);
+    if(gif->lzw_table) {
+        table = &ext_table;
+        table->bulk = 0x1000;
+        table->entries = gif->lzw_table;
+        init_table(table, key_size);
+    }
+    else {
+        table = new_table(key_size);
+        if(!table) return -1;
+    }
     key_size++;
     init_key_size = key_size;
     sub_len = shift = 0;
@@ -582,7 +645,7 @@ read_image_data(gd_GIF * gif, int interlace)
         else if(!table_is_full) {
             ret = add_entry(&table, str_len + 1, key, entry.suffix);
             if(ret == -1) {
-                lv_free(table);
+                free_table(gif, table);
                 return -1;
             }
             if(table->nentries == 0x1000) {
@@ -598,7 +661,7 @@ read_image_data(gd_GIF * gif, int interlace)
         str_len = entry.length;
 	if(frm_off + str_len > frm_size){
 		LV_LOG_WARN("LZW table token overflows the frame buffer");
-		lv_free(table);
+		free_table(gif, table);
 		return -1;
 	}
         for(i = 0; i < str_len; i++) {
@@ -617,7 +680,7 @@ read_image_data(gd_GIF * gif, int interlace)
         if(key < table->nentries - 1 && !table_is_full)
             table->entries[table->nentries - 1].suffix = entry.suffix;
     }
-    lv_free(table);
+    free_table(gif, table);
     if(key == stop) f_gif_read(gif, &sub_len, 1);  /* Must be zero! */
     f_gif_seek(gif, end, LV_FS_SEEK_SET);
     return 0;
@@ -767,7 +830,7 @@ void
 gd_close_gif(gd_GIF * gif)
 {
     f_gif_close(gif);
-    lv_free(gif);
+    if(!gif->ext_buf) lv_free(gif);
 }
 
 static bool f_gif_open(gd_GIF * gif, const void * path, bool is_file)
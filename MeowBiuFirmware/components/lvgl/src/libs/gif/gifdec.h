@@ -49,13 +49,35 @@ typedef struct _gd_GIF {
     uint8_t * canvas, * frame;
     #if LV_GIF_CACHE_DECODE_DATA
     uint8_t *lzw_cache;
+    #else
+    void * lzw_table;   /*In the buffer of the GIF or NULL to allocate it for each frame*/
     #endif
+    uint8_t ext_buf;    /*Opened into a buffer of the caller, don't free it*/
 } gd_GIF;
 
+/*Space for the `gd_GIF` in the buffer of `gd_open_gif_*_buf()`*/
+#define GD_GIF_STATE_SIZE   2048
+
+#if LV_GIF_CACHE_DECODE_DATA
+#define GD_LZW_BUF_SIZE     (0x1000 * 4)
+#else
+#define GD_LZW_BUF_SIZE     (0x1000 * 6)    /*LZW table of 4096 entries*/
+#endif
+
+/*Size of the buffer needed by `gd_open_gif_*_buf()` for a `w` x `h` GIF*/
+#define GD_GIF_BUF_SIZE(w, h)   \
+    ((GD_GIF_STATE_SIZE + 5 * (size_t)(w) * (h) + GD_LZW_BUF_SIZE + 7) & ~(size_t)7)
+
 gd_GIF * gd_open_gif_file(const char * fname);
 
 gd_GIF * gd_open_gif_data(const void * data);
 
+/*Open a GIF into `buf` instead of allocating memory. Nothing is allocated while decoding either.
+ *`buf` must be aligned to 8 bytes and `gd_close_gif()` doesn't free it.*/
+gd_GIF * gd_open_gif_file_buf(const char * fname, void * buf, size_t buf_size);
+
+gd_GIF * gd_open_gif_data_buf(const void * data, void * buf, size_t buf_size);
+
 void gd_render_frame(gd_GIF * gif, uint8_t * buffer);
 
 int gd_get_frame(gd_GIF * gif);
@@ -19,6 +19,9 @@
  *********************/
 #define MY_CLASS (&lv_gif_class)
 
+/*Shortest time between frames [ms]. Used for frames without delay too.*/
+#define MIN_FRAME_PERIOD    10
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -66,19 +69,22 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 
     /*Close previous gif if any*/
     if(gif != NULL) {
-        lv_image_cache_drop(lv_image_get_src(obj));
         gd_close_gif(gif);
         gifobj->gif = NULL;
         gifobj->imgdsc.data = NULL;
     }
 
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_GIF);
     if(lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE) {
         const lv_image_dsc_t * img_dsc = src;
-        gif = gd_open_gif_data(img_dsc->data);
+        if(gifobj->buf) gif = gd_open_gif_data_buf(img_dsc->data, gifobj->buf, gifobj->buf_size);
+        else gif = gd_open_gif_data(img_dsc->data);
     }
     else if(lv_image_src_get_type(src) == LV_IMAGE_SRC_FILE) {
-        gif = gd_open_gif_file(src);
+        if(gifobj->buf) gif = gd_open_gif_file_buf(src, gifobj->buf, gifobj->buf_size);
+        else gif = gd_open_gif_file(src);
     }
+    LV_MEM_TAG_END;
     if(gif == NULL) {
         LV_LOG_WARN("Couldn't load the source");
         return;
@@ -87,15 +93,13 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
     gifobj->gif = gif;
     gifobj->imgdsc.data = gif->canvas;
     gifobj->imgdsc.header.magic = LV_IMAGE_HEADER_MAGIC;
-    gifobj->imgdsc.header.flags = LV_IMAGE_FLAGS_MODIFIABLE;
+    gifobj->imgdsc.header.flags = LV_IMAGE_FLAGS_MODIFIABLE | LV_IMAGE_FLAGS_VOLATILE;
     gifobj->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
     gifobj->imgdsc.header.h = gif->height;
     gifobj->imgdsc.header.w = gif->width;
     gifobj->imgdsc.header.stride = gif->width * 4;
     gifobj->imgdsc.data_size = gif->width * gif->height * 4;
 
-    gifobj->last_call = lv_tick_get();
-
     lv_image_set_src(obj, &gifobj->imgdsc);
 
     lv_timer_resume(gifobj->timer);
@@ -105,6 +109,14 @@ void lv_gif_set_src(lv_obj_t * obj, const void * src)
 
 }
 
+void lv_gif_set_buf(lv_obj_t * obj, void * buf, size_t buf_size)
+{
+    lv_gif_t * gifobj = (lv_gif_t *) obj;
+
+    gifobj->buf = buf;
+    gifobj->buf_size = buf ? buf_size : 0;
+}
+
 void lv_gif_restart(lv_obj_t * obj)
 {
     lv_gif_t * gifobj = (lv_gif_t *) obj;
@@ -178,7 +190,9 @@ static void lv_gif_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     lv_gif_t * gifobj = (lv_gif_t *) obj;
 
     gifobj->gif = NULL;
-    gifobj->timer = lv_timer_create(next_frame_task_cb, 10, obj);
+    gifobj->buf = NULL;
+    gifobj->buf_size = 0;
+    gifobj->timer = lv_timer_create(next_frame_task_cb, MIN_FRAME_PERIOD, obj);
     lv_timer_pause(gifobj->timer);
 }
 
@@ -187,8 +201,6 @@ static void lv_gif_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
     LV_UNUSED(class_p);
     lv_gif_t * gifobj = (lv_gif_t *) obj;
 
-    lv_image_cache_drop(lv_image_get_src(obj));
-
     if(gifobj->gif)
         gd_close_gif(gifobj->gif);
     lv_timer_delete(gifobj->timer);
@@ -198,22 +210,24 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = t->user_data;
     lv_gif_t * gifobj = (lv_gif_t *) obj;
-    uint32_t elaps = lv_tick_elaps(gifobj->last_call);
-    if(elaps < gifobj->gif->gce.delay * 10) return;
-
-    gifobj->last_call = lv_tick_get();
 
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_GIF);
     int has_next = gd_get_frame(gifobj->gif);
+    LV_MEM_TAG_END;
     if(has_next == 0) {
-        /*It was the last repeat*/
-        lv_result_t res = lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+        /*It was the last repeat. Pause first, so the event can restart it or set a new source.*/
         lv_timer_pause(t);
+        lv_result_t res = lv_obj_send_event(obj, LV_EVENT_READY, NULL);
         if(res != LV_RESULT_OK) return;
+        /*Restarted or a new source was set which has rendered its first frame*/
+        if(!t->paused) return;
     }
 
     gd_render_frame(gifobj->gif, (uint8_t *)gifobj->imgdsc.data);
 
-    lv_image_cache_drop(lv_image_get_src(obj));
+    /*Run again exactly when the next frame is due instead of polling*/
+    lv_timer_set_period(t, LV_MAX(gifobj->gif->gce.delay * 10, MIN_FRAME_PERIOD));
+
     lv_obj_invalidate(obj);
 }
 
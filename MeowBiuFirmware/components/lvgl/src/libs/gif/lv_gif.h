@@ -29,6 +29,13 @@ extern "C" {
  *      DEFINES
  *********************/
 
+/**
+ * Size of the buffer of `lv_gif_set_buf()` for a `w` x `h` GIF: the decoder,
+ * the ARGB8888 canvas, the LZW table and the color indices of the frame.
+ * It's a constant expression if `w` and `h` are constants.
+ */
+#define LV_GIF_BUF_SIZE(w, h)   GD_GIF_BUF_SIZE(w, h)
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -54,6 +61,18 @@ lv_obj_t * lv_gif_create(lv_obj_t * parent);
  */
 void lv_gif_set_src(lv_obj_t * obj, const void * src);
 
+/**
+ * Decode the GIFs into a buffer instead of allocating memory for each source.
+ * Nothing is allocated while playing them either, so a player which is created
+ * once and gets new sources doesn't use the heap after its creation.
+ * Takes effect with the next `lv_gif_set_src()`.
+ * @param obj       pointer to a gif object
+ * @param buf       buffer aligned to 8 bytes with at least `LV_GIF_BUF_SIZE(w, h)` bytes
+ *                  for the largest GIF, or NULL to allocate memory again
+ * @param buf_size  size of `buf` in bytes. Larger GIFs fail to load.
+ */
+void lv_gif_set_buf(lv_obj_t * obj, void * buf, size_t buf_size);
+
 /**
  * Restart a gif animation.
  * @param obj pointer to a gif obj
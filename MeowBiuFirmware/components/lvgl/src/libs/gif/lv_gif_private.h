@@ -36,7 +36,8 @@ struct _lv_gif_t {
     gd_GIF * gif;
     lv_timer_t * timer;
     lv_image_dsc_t imgdsc;
-    uint32_t last_call;
+    void * buf;         /**< Set by `lv_gif_set_buf()` or NULL*/
+    size_t buf_size;
 };
 
 
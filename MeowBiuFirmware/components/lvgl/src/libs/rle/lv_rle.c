@@ -23,6 +23,9 @@
  *  STATIC PROTOTYPES
  **********************/
 
+static inline uint8_t * copy_literal(uint8_t * output, const uint8_t * input, uint32_t len);
+static uint8_t * fill_pattern(uint8_t * output, const uint8_t * blk, uint32_t blk_size, uint32_t len);
+
 /**********************
  *  STATIC VARIABLES
  **********************/
@@ -35,70 +38,58 @@
  *   GLOBAL FUNCTIONS
  **********************/
 
-uint32_t lv_rle_decompress(const uint8_t * input,
-                           uint32_t input_buff_len, uint8_t * output,
-                           uint32_t output_buff_len, uint8_t blk_size)
+uint32_t LV_ATTRIBUTE_FAST_MEM lv_rle_decompress(const uint8_t * input,
+                                                 uint32_t input_buff_len, uint8_t * output,
+                                                 uint32_t output_buff_len, uint8_t blk_size)
 {
-    uint32_t ctrl_byte;
-    uint32_t rd_len = 0;
+    const uint8_t * input_end = input + input_buff_len;
     uint32_t wr_len = 0;
 
-    while(rd_len < input_buff_len) {
-        ctrl_byte = input[0];
-        rd_len++;
+    while(input < input_end) {
+        uint32_t ctrl_byte = *input;
         input++;
-        if(rd_len > input_buff_len)
-            return 0;
 
         if(ctrl_byte & 0x80) {
             /* copy directly from input to output */
             uint32_t bytes = blk_size * (ctrl_byte & 0x7f);
-            rd_len += bytes;
-            if(rd_len > input_buff_len)
+            if(bytes > (uint32_t)(input_end - input))
                 return 0;
 
-            wr_len += bytes;
-            if(wr_len > output_buff_len) {
-                if(wr_len > output_buff_len + blk_size)
+            if(bytes > output_buff_len - wr_len) {
+                if(bytes > output_buff_len - wr_len + blk_size)
                     return 0; /* Error */
-                lv_memcpy(output, input, output_buff_len - (wr_len - bytes));
+                /* The last pixel was padded to a whole block*/
+                copy_literal(output, input, output_buff_len - wr_len);
                 return output_buff_len;
             }
 
-            lv_memcpy(output, input, bytes);
-            output += bytes;
+            output = copy_literal(output, input, bytes);
             input += bytes;
+            wr_len += bytes;
         }
         else {
-            rd_len += blk_size;
-            if(rd_len > input_buff_len)
+            if(blk_size > (uint32_t)(input_end - input))
                 return 0;
 
-            wr_len += blk_size * ctrl_byte;
-            if(wr_len > output_buff_len) {
-                if(wr_len > output_buff_len + blk_size)
+            uint32_t bytes = blk_size * ctrl_byte;
+            if(bytes > output_buff_len - wr_len) {
+                if(bytes > output_buff_len - wr_len + blk_size)
                     return 0; /* Error happened */
-
-                /* Skip the last pixel, which could overflow output buffer.*/
-                for(uint32_t i = 0; i < ctrl_byte - 1; i++) {
-                    lv_memcpy(output, input, blk_size);
-                    output += blk_size;
-                }
+                /* The last pixel was padded to a whole block*/
+                fill_pattern(output, input, blk_size, output_buff_len - wr_len);
                 return output_buff_len;
             }
 
             if(blk_size == 1) {
                 /* optimize the most common case. */
-                lv_memset(output, input[0], ctrl_byte);
-                output += ctrl_byte;
+                lv_memset(output, input[0], bytes);
+                output += bytes;
             }
             else {
-                for(uint32_t i = 0; i < ctrl_byte; i++) {
-                    lv_memcpy(output, input, blk_size);
-                    output += blk_size;
-                }
+                output = fill_pattern(output, input, blk_size, bytes);
             }
             input += blk_size;
+            wr_len += bytes;
         }
     }
 
@@ -109,4 +100,94 @@ uint32_t lv_rle_decompress(const uint8_t * input,
  *   STATIC FUNCTIONS
  **********************/
 
+/**
+ * Copy a literal run. Short runs are copied inline as calling `lv_memcpy` costs more than
+ * the copy itself, the long ones with `lv_memcpy` which copies words.
+ */
+static inline uint8_t * copy_literal(uint8_t * output, const uint8_t * input, uint32_t len)
+{
+    if(len >= 16) {
+        lv_memcpy(output, input, len);
+        return output + len;
+    }
+
+    while(len) {
+        *output = *input;
+        output++;
+        input++;
+        len--;
+    }
+    return output;
+}
+
+/**
+ * Repeat `blk` to fill `len` bytes. Blocks of 2, 3 and 4 bytes are written with aligned
+ * 32 bit stores: a 2 and 4 bytes pattern repeats in every word, a 3 bytes pattern in
+ * every 3 words.
+ */
+static uint8_t * fill_pattern(uint8_t * output, const uint8_t * blk, uint32_t blk_size, uint32_t len)
+{
+    uint32_t phase = 0;
+
+    if(blk_size <= 4 && len >= 16) {
+        /*Bytes until the output is aligned*/
+        while((lv_uintptr_t)output & 0x3) {
+            *output = blk[phase];
+            output++;
+            len--;
+            phase = phase + 1 == blk_size ? 0 : phase + 1;
+        }
+
+        /*The pattern in the byte order of the output starting at the current phase*/
+        union {
+            uint8_t b[12];
+            uint32_t w[3];
+        } pattern;
+        uint32_t i;
+        uint32_t p = phase;
+        for(i = 0; i < 12; i++) {
+            pattern.b[i] = blk[p];
+            p = p + 1 == blk_size ? 0 : p + 1;
+        }
+
+        uint32_t * out32 = (uint32_t *)output;
+        if(blk_size == 3) {
+            while(len >= 12) {
+                out32[0] = pattern.w[0];
+                out32[1] = pattern.w[1];
+                out32[2] = pattern.w[2];
+                out32 += 3;
+                len -= 12;
+            }
+        }
+        else {
+            uint32_t w = pattern.w[0];
+            while(len >= 16) {
+                out32[0] = w;
+                out32[1] = w;
+                out32[2] = w;
+                out32[3] = w;
+                out32 += 4;
+                len -= 16;
+            }
+            while(len >= 4) {
+                *out32 = w;
+                out32++;
+                len -= 4;
+            }
+        }
+        /*Whole periods were written so the phase is unchanged*/
+        output = (uint8_t *)out32;
+    }
+
+    while(len) {
+        *output = blk[phase];
+        output++;
+        len--;
+        phase = phase + 1 == blk_size ? 0 : phase + 1;
+    }
+
+    return output;
+}
+
 #endif /*LV_USE_RLE*/
@@ -29,6 +29,16 @@ extern "C" {
  * GLOBAL PROTOTYPES
  **********************/
 
+/**
+ * Decompress LVGL's RLE data, e.g. written by `LVGLImage.py --compress RLE`
+ * @param input             the compressed data
+ * @param input_buff_len    size of the compressed data in bytes
+ * @param output            buffer for the decompressed data
+ * @param output_buff_len   size of the decompressed data in bytes. The last block can be
+ *                          truncated if the data was padded to whole blocks when compressed.
+ * @param blk_size          bytes per pixel (1, 2, 3 or 4), repeats are counted in blocks of this size
+ * @return                  the number of bytes written to `output` or 0 on error
+ */
 uint32_t lv_rle_decompress(const uint8_t * input,
                            uint32_t input_buff_len, uint8_t * output,
                            uint32_t output_buff_len, uint8_t blk_size);
@@ -31,6 +31,9 @@
 static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_rlottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void next_frame_task_cb(lv_timer_t * t);
+static void restart_timing(lv_rlottie_t * rlottie);
+static void update_timer_period(lv_rlottie_t * rlottie);
+static size_t get_frame_by_time(lv_rlottie_t * rlottie, bool * ended);
 
 /**********************
  *  STATIC VARIABLES
@@ -95,6 +98,14 @@ void lv_rlottie_set_play_mode(lv_obj_t * obj, const lv_rlottie_ctrl_t ctrl)
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
     rlottie->play_ctrl = ctrl;
 
+    /*Playing again after the end starts over instead of ending again at once*/
+    if(rlottie->ended && (ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PLAY) {
+        bool backward = (ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD;
+        rlottie->current_frame = backward ? rlottie->total_frames - 1 : 0;
+        rlottie->ended = false;
+    }
+    restart_timing(rlottie);
+
     if(rlottie->task && (rlottie->dest_frame != rlottie->current_frame ||
                          (rlottie->play_ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PLAY)) {
         lv_timer_resume(rlottie->task);
@@ -105,6 +116,29 @@ void lv_rlottie_set_current_frame(lv_obj_t * obj, const size_t goto_frame)
 {
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
     rlottie->current_frame = goto_frame < rlottie->total_frames ? goto_frame : rlottie->total_frames - 1;
+    rlottie->ended = false;
+    restart_timing(rlottie);
+}
+
+void lv_rlottie_set_max_fps(lv_obj_t * obj, uint32_t fps)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    rlottie->max_fps = fps;
+    update_timer_period(rlottie);
+}
+
+uint32_t lv_rlottie_get_target_fps(lv_obj_t * obj)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    uint32_t fps = (uint32_t)rlottie->framerate;
+    if(rlottie->max_fps && rlottie->max_fps < fps) fps = rlottie->max_fps;
+    return fps;
+}
+
+uint32_t lv_rlottie_get_achieved_fps(lv_obj_t * obj)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    return rlottie->achieved_fps;
 }
 
 /**********************
@@ -141,6 +175,7 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
     }
 
     rlottie->imgdsc.header.cf = LV_COLOR_FORMAT_ARGB8888;
+    rlottie->imgdsc.header.flags = LV_IMAGE_FLAGS_VOLATILE;
     rlottie->imgdsc.header.h = create_info.height;
     rlottie->imgdsc.header.w = create_info.width;
     rlottie->imgdsc.data = (void *)rlottie->allocated_buf;
@@ -150,8 +185,12 @@ static void lv_rlottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * ob
 
     rlottie->play_ctrl = LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY | LV_RLOTTIE_CTRL_LOOP;
     rlottie->dest_frame = rlottie->total_frames; /* invalid destination frame so it's possible to pause on frame 0 */
+    rlottie->rendered_frame = rlottie->total_frames;
 
-    rlottie->task = lv_timer_create(next_frame_task_cb, 1000 / rlottie->framerate, obj);
+    rlottie->task = lv_timer_create(next_frame_task_cb, 1000, obj);
+    update_timer_period(rlottie);
+    restart_timing(rlottie);
+    rlottie->fps_start = lv_tick_get();
 
     lv_obj_update_layout(obj);
 }
@@ -191,6 +230,7 @@ static void next_frame_task_cb(lv_timer_t * t)
 {
     lv_obj_t * obj = lv_timer_get_user_data(t);
     lv_rlottie_t * rlottie = (lv_rlottie_t *) obj;
+    bool ended = false;
 
     if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_PAUSE) == LV_RLOTTIE_CTRL_PAUSE) {
         if(rlottie->current_frame == rlottie->dest_frame) {
@@ -201,44 +241,80 @@ static void next_frame_task_cb(lv_timer_t * t)
         rlottie->dest_frame = rlottie->current_frame;
     }
     else {
-        if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD) {
-            if(rlottie->current_frame > 0)
-                --rlottie->current_frame;
-            else { /* Looping ? */
-                if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP)
-                    rlottie->current_frame = rlottie->total_frames - 1;
-                else {
-                    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
-                    lv_timer_pause(t);
-                    return;
-                }
-            }
-        }
-        else {
-            if(rlottie->current_frame < rlottie->total_frames)
-                ++rlottie->current_frame;
-            else { /* Looping ? */
-                if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP)
-                    rlottie->current_frame = 0;
-                else {
-                    lv_obj_send_event(obj, LV_EVENT_READY, NULL);
-                    lv_timer_pause(t);
-                    return;
-                }
-            }
-        }
+        rlottie->current_frame = get_frame_by_time(rlottie, &ended);
+    }
+
+    /*The timer can be faster than the frames, or slow rendering can make it skip frames*/
+    if(rlottie->current_frame != rlottie->rendered_frame) {
+        lottie_animation_render(
+            rlottie->animation,
+            rlottie->current_frame,
+            rlottie->allocated_buf,
+            rlottie->imgdsc.header.w,
+            rlottie->imgdsc.header.h,
+            rlottie->scanline_width
+        );
+        rlottie->rendered_frame = rlottie->current_frame;
+        rlottie->fps_frame_cnt++;
+
+        lv_obj_invalidate(obj);
+    }
+
+    uint32_t elaps = lv_tick_elaps(rlottie->fps_start);
+    if(elaps >= 1000) {
+        rlottie->achieved_fps = rlottie->fps_frame_cnt * 1000 / elaps;
+        rlottie->fps_frame_cnt = 0;
+        rlottie->fps_start = lv_tick_get();
     }
 
-    lottie_animation_render(
-        rlottie->animation,
-        rlottie->current_frame,
-        rlottie->allocated_buf,
-        rlottie->imgdsc.header.w,
-        rlottie->imgdsc.header.h,
-        rlottie->scanline_width
-    );
+    if(ended) {
+        rlottie->ended = true;
+        /*Pause first so that it can be played again in LV_EVENT_READY*/
+        lv_timer_pause(t);
+        lv_obj_send_event(obj, LV_EVENT_READY, NULL);
+    }
+}
 
-    lv_obj_invalidate(obj);
+static void restart_timing(lv_rlottie_t * rlottie)
+{
+    rlottie->play_start = lv_tick_get();
+    rlottie->start_frame = rlottie->current_frame;
+}
+
+static void update_timer_period(lv_rlottie_t * rlottie)
+{
+    if(rlottie->task == NULL) return;
+    uint32_t fps = lv_rlottie_get_target_fps((lv_obj_t *)rlottie);
+    lv_timer_set_period(rlottie->task, 1000 / LV_MAX(fps, 1));
+}
+
+/**
+ * Get the frame to show according to the time elapsed since `play_start`
+ * @param rlottie   pointer to an rlottie widget
+ * @param ended     set to true if the animation doesn't loop and reached its end
+ * @return          the index of the frame
+ */
+static size_t get_frame_by_time(lv_rlottie_t * rlottie, bool * ended)
+{
+    size_t total = rlottie->total_frames;
+    size_t start = rlottie->start_frame;
+    size_t frame_cnt = (size_t)lv_tick_elaps(rlottie->play_start) * rlottie->framerate / 1000;
+    bool loop = (rlottie->play_ctrl & LV_RLOTTIE_CTRL_LOOP) == LV_RLOTTIE_CTRL_LOOP;
+
+    if(total == 0) return 0;
+
+    if((rlottie->play_ctrl & LV_RLOTTIE_CTRL_BACKWARD) == LV_RLOTTIE_CTRL_BACKWARD) {
+        if(frame_cnt <= start) return start - frame_cnt;
+        if(loop) return total - 1 - ((frame_cnt - start - 1) % total);
+        *ended = true;
+        return 0;
+    }
+    else {
+        if(start + frame_cnt < total) return start + frame_cnt;
+        if(loop) return (start + frame_cnt) % total;
+        *ended = true;
+        return total - 1;
+    }
 }
 
 #endif /*LV_USE_RLOTTIE*/
@@ -45,6 +45,29 @@ lv_obj_t * lv_rlottie_create_from_raw(lv_obj_t * parent, int32_t width, int32_t
 void lv_rlottie_set_play_mode(lv_obj_t * rlottie, const lv_rlottie_ctrl_t ctrl);
 void lv_rlottie_set_current_frame(lv_obj_t * rlottie, const size_t goto_frame);
 
+/**
+ * Limit the render rate below the frame rate of the animation.
+ * The frames are picked by the elapsed time, so the duration stays the same.
+ * @param rlottie   pointer to an rlottie widget
+ * @param fps       maximum frames per second, 0: the frame rate of the animation
+ */
+void lv_rlottie_set_max_fps(lv_obj_t * rlottie, uint32_t fps);
+
+/**
+ * Get the render rate the widget aims for
+ * @param rlottie   pointer to an rlottie widget
+ * @return          the frame rate of the animation or the limit set by `lv_rlottie_set_max_fps()`
+ */
+uint32_t lv_rlottie_get_target_fps(lv_obj_t * rlottie);
+
+/**
+ * Get the number of frames rendered in the last second while playing.
+ * It's below the target if the rendering is slow and frames are skipped.
+ * @param rlottie   pointer to an rlottie widget
+ * @return          rendered frames per second
+ */
+uint32_t lv_rlottie_get_achieved_fps(lv_obj_t * rlottie);
+
 /**********************
  *      MACROS
  **********************/
@@ -42,6 +42,14 @@ struct _lv_rlottie_t {
     size_t scanline_width;
     lv_rlottie_ctrl_t play_ctrl;
     size_t dest_frame;
+    uint32_t play_start;        /**< Tick when playing started from `start_frame`*/
+    size_t start_frame;
+    size_t rendered_frame;      /**< `total_frames` if no frame was rendered yet*/
+    bool ended;                 /**< Reached the end without looping, playing again starts over*/
+    uint32_t max_fps;           /**< Limit of the render rate, 0: the frame rate of the animation*/
+    uint32_t fps_start;         /**< Start of the window measuring the achieved fps*/
+    uint32_t fps_frame_cnt;
+    uint32_t achieved_fps;
 };
 
 /**********************
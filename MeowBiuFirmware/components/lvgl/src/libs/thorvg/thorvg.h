@@ -1657,6 +1657,8 @@ public:
         ARGB8888,          ///< The channels are joined in the order: alpha, red, green, blue. Colors are alpha-premultiplied. (a << 24 | r << 16 | g << 8 | b)
         ABGR8888S,         ///< The channels are joined in the order: alpha, blue, green, red. Colors are un-alpha-premultiplied. @since 0.12
         ARGB8888S,         ///< The channels are joined in the order: alpha, red, green, blue. Colors are un-alpha-premultiplied. @since 0.12
+        RGB565 = 5,        ///< 16 bits without alpha: (r << 11 | g << 5 | b). Only shapes with the normal blending are drawn, compositions and images are not supported.
+        RGB565S,           ///< The same as RGB565 with swapped bytes, e.g. for SPI displays.
     };
 
     /**
@@ -1716,6 +1718,28 @@ public:
     */
     Result mempool(MempoolPolicy policy) noexcept;
 
+    /**
+     * @brief Measures the area of the target which has to be redrawn to show the current state of the paints.
+     *
+     * The paints are compared to their state at the previous measurement: the old and the new bounds of
+     * every paint whose path, fill, stroke, transformation, opacity or composition changed are damaged.
+     * The first measurement after setting the target damages the whole target.
+     *
+     * It only measures; the caller should clear the damaged area, set it as the viewport and draw the canvas,
+     * so that the rest of the target still holds the previous drawing.
+     *
+     * @param[out] x The x coordinate of the damaged area.
+     * @param[out] y The y coordinate of the damaged area.
+     * @param[out] w The width of the damaged area, 0 if nothing changed.
+     * @param[out] h The height of the damaged area, 0 if nothing changed.
+     *
+     * @retval Result::InsufficientCondition If the canvas has no target or it's performing rendering.
+     * @retval Result::NonSupport In case the software engine is not supported.
+     *
+     * @note Experimental API
+     */
+    Result damage(int32_t* x, int32_t* y, int32_t* w, int32_t* h) noexcept;
+
     /**
      * @brief Creates a new SwCanvas object.
      * @return A new SwCanvas object.
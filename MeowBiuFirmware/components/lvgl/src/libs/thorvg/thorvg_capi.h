@@ -445,7 +445,9 @@ typedef enum {
     TVG_COLORSPACE_ABGR8888 = 0, ///< The channels are joined in the order: alpha, blue, green, red. Colors are alpha-premultiplied. (a << 24 | b << 16 | g << 8 | r)
     TVG_COLORSPACE_ARGB8888,     ///< The channels are joined in the order: alpha, red, green, blue. Colors are alpha-premultiplied. (a << 24 | r << 16 | g << 8 | b)
     TVG_COLORSPACE_ABGR8888S,    ///< The channels are joined in the order: alpha, blue, green, red. Colors are un-alpha-premultiplied. @since 0.13
-    TVG_COLORSPACE_ARGB8888S     ///< The channels are joined in the order: alpha, red, green, blue. Colors are un-alpha-premultiplied. @since 0.13
+    TVG_COLORSPACE_ARGB8888S,    ///< The channels are joined in the order: alpha, red, green, blue. Colors are un-alpha-premultiplied. @since 0.13
+    TVG_COLORSPACE_RGB565 = 5,   ///< 16 bits without alpha: (r << 11 | g << 5 | b). Only shapes with the normal blending are drawn, compositions and images are not supported.
+    TVG_COLORSPACE_RGB565S       ///< The same as TVG_COLORSPACE_RGB565 with swapped bytes, e.g. for SPI displays.
 } Tvg_Colorspace;
 
 
@@ -490,6 +492,7 @@ TVG_API Tvg_Canvas* tvg_swcanvas_create(void);
 * \param[in] cs The colorspace value defining the way the 32-bits colors should be read/written.
 * - TVG_COLORSPACE_ABGR8888
 * - TVG_COLORSPACE_ARGB8888
+* - TVG_COLORSPACE_RGB565, TVG_COLORSPACE_RGB565S: @p buffer points to 16-bits pixels and @p stride is counted in 16-bits pixels
 *
 * \return Tvg_Result enumeration.
 * \retval TVG_RESULT_INVALID_ARGUMENTS An invalid canvas or buffer pointer passed or one of the @p stride, @p w or @p h being zero.
@@ -528,6 +531,32 @@ TVG_API Tvg_Result tvg_swcanvas_set_target(Tvg_Canvas* canvas, uint32_t* buffer,
 */
 TVG_API Tvg_Result tvg_swcanvas_set_mempool(Tvg_Canvas* canvas, Tvg_Mempool_Policy policy);
 
+
+/*!
+* \brief Measures the area of the target which has to be redrawn to show the current state of the paints.
+*
+* The paints are compared to their state at the previous measurement: the old and the new bounds of
+* every paint whose path, fill, stroke, transformation, opacity or composition changed are damaged.
+* The first measurement after setting the target damages the whole target.
+*
+* It only measures; the caller should clear the damaged area, set it with tvg_canvas_set_viewport() and draw the canvas,
+* so that the rest of the target still holds the previous drawing.
+*
+* \param[in] canvas The Tvg_Canvas object to measure.
+* \param[out] x The x coordinate of the damaged area.
+* \param[out] y The y coordinate of the damaged area.
+* \param[out] w The width of the damaged area, 0 if nothing changed.
+* \param[out] h The height of the damaged area, 0 if nothing changed.
+*
+* \return Tvg_Result enumeration.
+* \retval TVG_RESULT_INVALID_ARGUMENTS An invalid canvas pointer passed.
+* \retval TVG_RESULT_INSUFFICIENT_CONDITION The canvas has no target or it's performing rendering.
+* \retval TVG_RESULT_NOT_SUPPORTED The software engine is not supported.
+*
+* \note Experimental API
+*/
+TVG_API Tvg_Result tvg_swcanvas_get_damage(Tvg_Canvas* canvas, int32_t* x, int32_t* y, int32_t* w, int32_t* h);
+
 /** \} */   // end defgroup ThorVGCapi_SwCanvas
 
 
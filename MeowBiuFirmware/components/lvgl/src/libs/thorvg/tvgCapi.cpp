@@ -86,6 +86,13 @@ TVG_API Tvg_Result tvg_swcanvas_set_mempool(Tvg_Canvas* canvas, Tvg_Mempool_Poli
 }
 
 
+TVG_API Tvg_Result tvg_swcanvas_get_damage(Tvg_Canvas* canvas, int32_t* x, int32_t* y, int32_t* w, int32_t* h)
+{
+    if (!canvas) return TVG_RESULT_INVALID_ARGUMENT;
+    return (Tvg_Result) reinterpret_cast<SwCanvas*>(canvas)->damage(x, y, w, h);
+}
+
+
 TVG_API Tvg_Result tvg_swcanvas_set_target(Tvg_Canvas* canvas, uint32_t* buffer, uint32_t stride, uint32_t w, uint32_t h, Tvg_Colorspace cs)
 {
     if (!canvas) return TVG_RESULT_INVALID_ARGUMENT;
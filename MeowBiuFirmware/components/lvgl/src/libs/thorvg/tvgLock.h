@@ -62,6 +62,49 @@ namespace tvg {
 
 #else //THORVG_THREAD_SUPPORT
 
+#include "tvgTaskScheduler.h"
+
+#ifdef THORVG_LV_THREAD_SUPPORT
+
+namespace tvg {
+
+    struct Key
+    {
+        lv_mutex_t mtx;
+
+        Key()
+        {
+            lv_mutex_init(&mtx);
+        }
+
+        ~Key()
+        {
+            lv_mutex_delete(&mtx);
+        }
+    };
+
+    struct ScopedLock
+    {
+        Key* key = nullptr;
+
+        ScopedLock(Key& k)
+        {
+            if (TaskScheduler::threads() > 0) {
+                lv_mutex_lock(&k.mtx);
+                key = &k;
+            }
+        }
+
+        ~ScopedLock()
+        {
+            if (key) lv_mutex_unlock(&key->mtx);
+        }
+    };
+
+}
+
+#else //THORVG_LV_THREAD_SUPPORT
+
 namespace tvg {
 
     struct Key {};
@@ -73,6 +116,8 @@ namespace tvg {
 
 }
 
+#endif //THORVG_LV_THREAD_SUPPORT
+
 #endif //THORVG_THREAD_SUPPORT
 
 #endif //_TVG_LOCK_H_
@@ -40,7 +40,7 @@ void LottieLoader::run(unsigned tid)
         builder->update(comp, frameNo);
     //initial loading
     } else {
-        LottieParser parser(content, dirName);
+        LottieParser parser(content, dirName, size);
         if (!parser.parse()) return;
         {
             ScopedLock lock(key);
@@ -105,6 +105,18 @@ bool LottieLoader::header()
         }
     }
 
+    //The pre-parsed data carries the animation info in its header.
+    LottieBinHeader hdr;
+    if (LookaheadParserHandler::binHeader(content, size, hdr)) {
+        if (hdr.frameRate < FLOAT_EPSILON) return false;
+        frameRate = hdr.frameRate;
+        w = hdr.w;
+        h = hdr.h;
+        frameCnt = (hdr.outFrame - hdr.inFrame);
+        frameDuration = frameCnt / frameRate;
+        return true;
+    }
+
     //Quickly validate the given Lottie file without parsing in order to get the animation info.
     auto startFrame = 0.0f;
     auto endFrame = 0.0f;
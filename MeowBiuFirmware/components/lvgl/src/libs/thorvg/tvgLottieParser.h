@@ -33,7 +33,7 @@
 struct LottieParser : LookaheadParserHandler
 {
 public:
-    LottieParser(const char *str, const char* dirName) : LookaheadParserHandler(str)
+    LottieParser(const char *str, const char* dirName, uint32_t size = 0) : LookaheadParserHandler(str, size)
     {
         this->dirName = dirName;
     }
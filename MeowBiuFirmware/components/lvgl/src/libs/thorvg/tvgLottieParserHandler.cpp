@@ -54,6 +54,35 @@
 
 static const int PARSE_FLAGS = kParseDefaultFlags | kParseInsituFlag;
 
+//tokens of the pre-parsed stream, see scripts/lottie_compiler.py
+enum BinToken : uint8_t
+{
+    BinNull = 0,
+    BinFalse,
+    BinTrue,
+    BinObjectBegin,
+    BinObjectEnd,
+    BinArrayBegin,
+    BinArrayEnd,
+    BinKey,             //+ varint offset in the string table
+    BinString,          //+ varint offset in the string table
+    BinInt8,            //+ int8_t
+    BinInt16,           //+ int16_t
+    BinInt32,           //+ int32_t
+    BinFloat            //+ float
+};
+
+
+//the data can be unaligned in the flash
+template<typename T>
+static T _read(const uint8_t*& p)
+{
+    T v;
+    memcpy(&v, p, sizeof(T));
+    p += sizeof(T);
+    return v;
+}
+
 
 /************************************************************************/
 /* External Class Implementation                                        */
@@ -153,8 +182,97 @@ void LookaheadParserHandler::getNull()
 }
 
 
+bool LookaheadParserHandler::binHeader(const char* data, uint32_t size, LottieBinHeader& hdr)
+{
+    if (!data || size < sizeof(LottieBinHeader)) return false;
+    memcpy(&hdr, data, sizeof(LottieBinHeader));
+    if (memcmp(hdr.magic, LOTTIE_BIN_MAGIC, sizeof(hdr.magic))) return false;
+    if (hdr.size > size || hdr.tokenSize > hdr.size || hdr.strSize > hdr.size) return false;
+    if (sizeof(LottieBinHeader) + hdr.tokenSize + hdr.strSize != hdr.size) return false;
+    //every string must be terminated in the table
+    if (hdr.strSize > 0 && data[hdr.size - 1] != '\0') return false;
+    return true;
+}
+
+
+bool LookaheadParserHandler::parseNextBin()
+{
+    auto p = bin;
+    auto error = [&]() {
+        Error();
+        bin = binEnd;
+        return false;
+    };
+    auto avail = [&](uint32_t n) {
+        return (uint32_t)(binEnd - p) >= n;
+    };
+
+    //the root value has been closed, nothing to report like the JSON reader
+    if (binDepth == 0 && state != kInit) return (bin == binEnd) ? true : error();
+
+    if (!avail(1)) return error();
+
+    auto token = *p++;
+    switch (token) {
+        case BinNull: state = kHasNull; val.SetNull(); break;
+        case BinFalse:
+        case BinTrue: state = kHasBool; val.SetBool(token == BinTrue); break;
+        case BinObjectBegin: state = kEnteringObject; ++binDepth; break;
+        case BinObjectEnd: state = kExitingObject; --binDepth; break;
+        case BinArrayBegin: state = kEnteringArray; ++binDepth; break;
+        case BinArrayEnd: state = kExitingArray; --binDepth; break;
+        case BinKey:
+        case BinString: {
+            uint32_t ofs = 0;
+            uint32_t shift = 0;
+            while (true) {
+                if (!avail(1) || shift > 28) return error();
+                auto c = *p++;
+                ofs |= (uint32_t)(c & 0x7f) << shift;
+                if (!(c & 0x80)) break;
+                shift += 7;
+            }
+            if (ofs >= strSize) return error();
+            state = (token == BinKey) ? kHasKey : kHasString;
+            val.SetString(StringRef(strs + ofs));
+            break;
+        }
+        case BinInt8: {
+            if (!avail(1)) return error();
+            state = kHasNumber;
+            val.SetInt(_read<int8_t>(p));
+            break;
+        }
+        case BinInt16: {
+            if (!avail(2)) return error();
+            state = kHasNumber;
+            val.SetInt(_read<int16_t>(p));
+            break;
+        }
+        case BinInt32: {
+            if (!avail(4)) return error();
+            state = kHasNumber;
+            val.SetInt(_read<int32_t>(p));
+            break;
+        }
+        case BinFloat: {
+            if (!avail(4)) return error();
+            state = kHasNumber;
+            val.SetDouble(_read<float>(p));
+            break;
+        }
+        default: return error();
+    }
+    if (binDepth < 0) return error();
+
+    bin = p;
+    return true;
+}
+
+
 bool LookaheadParserHandler::parseNext()
 {
+    if (bin) return parseNextBin();
     if (reader.HasParseError()) {
         Error();
         return false;
@@ -55,6 +55,25 @@
 using namespace rapidjson;
 
 
+//Pre-parsed Lottie: the JSON tokens compiled by scripts/lottie_compiler.py.
+//Layout (little endian): header, token stream, NUL terminated strings.
+//The data is read in place, so it can stay in the flash.
+#define LOTTIE_BIN_MAGIC "LTB1"
+
+struct LottieBinHeader
+{
+    char magic[4];
+    uint32_t size;                  //total size in bytes
+    float frameRate;
+    float inFrame;
+    float outFrame;
+    float w;
+    float h;
+    uint32_t tokenSize;             //size of the token stream in bytes
+    uint32_t strSize;               //size of the string table in bytes
+};
+
+
 struct LookaheadParserHandler
 {
     enum LookaheadParsingState {
@@ -76,11 +95,26 @@ struct LookaheadParserHandler
     Reader                  reader;
     InsituStringStream      iss;
 
-    LookaheadParserHandler(const char *str) : iss((char*)str)
+    //pre-parsed token stream, null for JSON
+    const uint8_t*          bin = nullptr;
+    const uint8_t*          binEnd = nullptr;
+    const char*             strs = nullptr;
+    uint32_t                strSize = 0;
+    int                     binDepth = 0;
+
+    LookaheadParserHandler(const char *str, uint32_t size = 0) : iss((char*)str)
     {
-        reader.IterativeParseInit();
+        LottieBinHeader hdr;
+        if (binHeader(str, size, hdr)) {
+            bin = (const uint8_t*)str + sizeof(LottieBinHeader);
+            binEnd = bin + hdr.tokenSize;
+            strs = (const char*)binEnd;
+            strSize = hdr.strSize;
+        } else reader.IterativeParseInit();
     }
 
+    static bool binHeader(const char* data, uint32_t size, LottieBinHeader& hdr);
+
     bool Null()
     {
         state = kHasNull;
@@ -194,6 +228,7 @@ struct LookaheadParserHandler
     bool getBool();
     void getNull();
     bool parseNext();
+    bool parseNextBin();
     const char* nextObjectKey();
     void skip(const char* key);
     void skipOut(int depth);
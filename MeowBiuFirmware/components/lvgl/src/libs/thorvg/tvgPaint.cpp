@@ -246,6 +246,11 @@ RenderData Paint::Impl::update(RenderMethod* renderer, const Matrix& pm, Array<R
 
     if (renderFlag & RenderUpdateFlag::Transform) tr.update();
 
+    //Blending, composition and post effects are applied on the whole subtree
+    auto damageSig = static_cast<uint32_t>(blendMethod) | (static_cast<uint32_t>(MULTIPLY(opacity, this->opacity)) << 8);
+    if (compData) damageSig |= (static_cast<uint32_t>(compData->method) << 16) | (static_cast<uint32_t>(P(compData->target)->opacity) << 24);
+    renderer->damagePush(damageSig, paint->type() == Type::Scene && P((Scene*)paint)->effects);
+
     /* 1. Composition Pre Processing */
     RenderData trd = nullptr;                 //composite target render data
     RenderRegion viewport;
@@ -306,6 +311,8 @@ RenderData Paint::Impl::update(RenderMethod* renderer, const Matrix& pm, Array<R
     if (compFastTrack == Result::Success) renderer->viewport(viewport);
     else if (this->clipper) clips.pop();
 
+    renderer->damagePop();
+
     return rd;
 }
 
@@ -48,6 +48,8 @@ enum ColorSpace : uint8_t
     ABGR8888S,         //The channels are joined in the order: alpha, blue, green, red. Colors are un-alpha-premultiplied.
     ARGB8888S,         //The channels are joined in the order: alpha, red, green, blue. Colors are un-alpha-premultiplied.
     Grayscale8,        //One single channel data.
+    RGB565,            //16 bits: red, green, blue. Only for the target of the SwCanvas.
+    RGB565S,           //16 bits: red, green, blue with swapped bytes. Only for the target of the SwCanvas.
     Unsupported        //TODO: Change to the default, At the moment, we put it in the last to align with SwCanvas::Colorspace.
 };
 
@@ -56,6 +58,7 @@ struct RenderSurface
     union {
         pixel_t* data = nullptr;    //system based data pointer
         uint32_t* buf32;            //for explicit 32bits channels
+        uint16_t* buf16;            //for explicit 16bits RGB565 channels
         uint8_t*  buf8;             //for explicit 8bits grayscale
     };
     Key key;                        //a reserved lock for the thread safety
@@ -336,6 +339,11 @@ public:
 
     virtual bool prepare(RenderEffect* effect) = 0;
     virtual bool effect(RenderCompositor* cmp, const RenderEffect* effect) = 0;
+
+    //Damage tracking (optional): the paint properties which are not passed to prepare().
+    //spread: the paint may draw outside of its children's bounds (e.g. post effects)
+    virtual void damagePush(TVG_UNUSED uint32_t sig, TVG_UNUSED bool spread) {}
+    virtual void damagePop() {}
 };
 
 static inline bool MASK_REGION_MERGING(CompositeMethod method)
@@ -370,6 +378,9 @@ static inline uint8_t CHANNEL_SIZE(ColorSpace cs)
             return sizeof(uint32_t);
         case ColorSpace::Grayscale8:
             return sizeof(uint8_t);
+        case ColorSpace::RGB565:
+        case ColorSpace::RGB565S:
+            return sizeof(uint16_t);
         case ColorSpace::Unsupported:
         default:
             TVGERR("RENDERER", "Unsupported Channel Size! = %d", (int)cs);
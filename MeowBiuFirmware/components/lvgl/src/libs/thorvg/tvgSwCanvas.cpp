@@ -98,7 +98,8 @@ Result SwCanvas::target(uint32_t* buffer, uint32_t stride, uint32_t w, uint32_t
     renderer->viewport(Canvas::pImpl->vport);
 
     //FIXME: The value must be associated with an individual canvas instance.
-    ImageLoader::cs = static_cast<ColorSpace>(cs);
+    //The images are always decoded to 32 bits.
+    if (CHANNEL_SIZE(static_cast<ColorSpace>(cs)) == sizeof(uint32_t)) ImageLoader::cs = static_cast<ColorSpace>(cs);
 
     //Paints must be updated again with this new target.
     Canvas::pImpl->status = Status::Damaged;
@@ -109,6 +110,39 @@ Result SwCanvas::target(uint32_t* buffer, uint32_t stride, uint32_t w, uint32_t
 }
 
 
+Result SwCanvas::damage(int32_t* x, int32_t* y, int32_t* w, int32_t* h) noexcept
+{
+#ifdef THORVG_SW_RASTER_SUPPORT
+    if (Canvas::pImpl->status == Status::Drawing) return Result::InsufficientCondition;
+
+    //We know renderer type, avoid dynamic_cast for performance.
+    auto renderer = static_cast<SwRenderer*>(Canvas::pImpl->renderer);
+    if (!renderer) return Result::MemoryCorruption;
+
+    if (!renderer->damageBegin()) return Result::InsufficientCondition;
+
+    //Measure the whole paint tree, nothing is prepared for drawing
+    Array<RenderData> clips;
+    auto m = Matrix{1, 0, 0, 0, 1, 0, 0, 0, 1};
+    for (auto paint : Canvas::pImpl->paints) {
+        paint->pImpl->update(renderer, m, clips, 255, RenderUpdateFlag::All);
+    }
+
+    auto region = renderer->damageEnd();
+    if (x) *x = region.x;
+    if (y) *y = region.y;
+    if (w) *w = region.w;
+    if (h) *h = region.h;
+
+    //The measurement consumed the update flags of the paints.
+    Canvas::pImpl->status = Status::Damaged;
+
+    return Result::Success;
+#endif
+    return Result::NonSupport;
+}
+
+
 unique_ptr<SwCanvas> SwCanvas::gen() noexcept
 {
 #ifdef THORVG_SW_RASTER_SUPPORT
@@ -323,6 +323,160 @@ static uint32_t _interpDownScaler(const uint32_t *img, uint32_t stride, uint32_t
 }
 
 
+/************************************************************************/
+/* RGB565                                                               */
+/************************************************************************/
+
+//The colors are joined as alpha-premultiplied ARGB8888 and converted to RGB565 when written.
+constexpr auto RGB565_LINE_SIZE = 64;
+
+static inline bool _rgb565(const SwSurface* surface)
+{
+    return surface->channelSize == sizeof(uint16_t);
+}
+
+
+static inline uint16_t _rgb565Swap(uint16_t c)
+{
+    return (c >> 8) | (c << 8);
+}
+
+
+static inline uint16_t _rgb565Pack(uint32_t c)
+{
+    return ((c >> 8) & 0xf800) | ((c >> 5) & 0x07e0) | ((c >> 3) & 0x001f);
+}
+
+
+static inline uint32_t _rgb565Unpack(uint16_t c)
+{
+    uint32_t r = (c >> 11) & 0x1f;
+    uint32_t g = (c >> 5) & 0x3f;
+    uint32_t b = c & 0x1f;
+    return 0xff000000 | (((r << 3) | (r >> 2)) << 16) | (((g << 2) | (g >> 4)) << 8) | ((b << 3) | (b >> 2));
+}
+
+
+static inline uint16_t _rgb565Blend(uint32_t src, uint16_t dst, bool swap)
+{
+    if (swap) dst = _rgb565Swap(dst);
+    auto c = _rgb565Pack(src + ALPHA_BLEND(_rgb565Unpack(dst), IA(src)));
+    return swap ? _rgb565Swap(c) : c;
+}
+
+
+//Blend a premultiplied color on len pixels
+static void _rasterRgb565Color(const SwSurface* surface, uint16_t* dst, uint32_t src, uint32_t len)
+{
+    auto swap = (surface->cs == ColorSpace::RGB565S);
+    auto a = A(src);
+    if (a == 0) return;
+    if (a == 255) {
+        auto c = _rgb565Pack(src);
+        if (swap) c = _rgb565Swap(c);
+        for (uint32_t x = 0; x < len; ++x) dst[x] = c;
+    } else {
+        for (uint32_t x = 0; x < len; ++x) dst[x] = _rgb565Blend(src, dst[x], swap);
+    }
+}
+
+
+//Blend len premultiplied colors with a coverage
+static void _rasterRgb565Line(const SwSurface* surface, uint16_t* dst, const uint32_t* src, uint32_t len, uint8_t coverage)
+{
+    auto swap = (surface->cs == ColorSpace::RGB565S);
+    for (uint32_t x = 0; x < len; ++x) {
+        auto c = (coverage == 255) ? src[x] : ALPHA_BLEND(src[x], coverage);
+        dst[x] = _rgb565Blend(c, dst[x], swap);
+    }
+}
+
+
+static bool _rasterRgb565Supported(const SwSurface* surface)
+{
+    if (_compositing(surface) || _blending(surface)) {
+        TVGERR("SW_ENGINE", "Composition and blending are not supported with the RGB565 target!");
+        return false;
+    }
+    return true;
+}
+
+
+static bool _rasterRgb565Rect(SwSurface* surface, const SwBBox& region, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    if (!_rasterRgb565Supported(surface)) return false;
+
+    auto w = static_cast<uint32_t>(region.max.x - region.min.x);
+    auto h = static_cast<uint32_t>(region.max.y - region.min.y);
+    auto color = surface->join(r, g, b, a);
+    auto buffer = surface->buf16 + (region.min.y * surface->stride) + region.min.x;
+
+    for (uint32_t y = 0; y < h; ++y) {
+        _rasterRgb565Color(surface, buffer + y * surface->stride, color, w);
+    }
+    return true;
+}
+
+
+static bool _rasterRgb565Rle(SwSurface* surface, const SwRle* rle, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
+{
+    if (!_rasterRgb565Supported(surface)) return false;
+
+    auto span = rle->spans;
+    auto color = surface->join(r, g, b, a);
+
+    for (uint32_t i = 0; i < rle->size; ++i, ++span) {
+        auto src = (span->coverage == 255) ? color : ALPHA_BLEND(color, span->coverage);
+        _rasterRgb565Color(surface, &surface->buf16[span->y * surface->stride + span->x], src, span->len);
+    }
+    return true;
+}
+
+
+//The gradient is fetched to a small 32 bits line buffer and blended from there
+template<typename fillMethod>
+static void _rasterRgb565GradientSpan(SwSurface* surface, const SwFill* fill, uint32_t y, uint32_t x, uint32_t len, uint8_t coverage)
+{
+    uint32_t line[RGB565_LINE_SIZE];
+    auto dst = &surface->buf16[y * surface->stride + x];
+
+    while (len > 0) {
+        auto cnt = (len > RGB565_LINE_SIZE) ? RGB565_LINE_SIZE : len;
+        fillMethod()(fill, line, y, x, cnt, opBlendSrcOver, 255);
+        _rasterRgb565Line(surface, dst, line, cnt, coverage);
+        dst += cnt;
+        x += cnt;
+        len -= cnt;
+    }
+}
+
+
+template<typename fillMethod>
+static bool _rasterRgb565GradientRect(SwSurface* surface, const SwBBox& region, const SwFill* fill)
+{
+    if (!_rasterRgb565Supported(surface)) return false;
+
+    auto w = static_cast<uint32_t>(region.max.x - region.min.x);
+    for (auto y = region.min.y; y < region.max.y; ++y) {
+        _rasterRgb565GradientSpan<fillMethod>(surface, fill, y, region.min.x, w, 255);
+    }
+    return true;
+}
+
+
+template<typename fillMethod>
+static bool _rasterRgb565GradientRle(SwSurface* surface, const SwRle* rle, const SwFill* fill)
+{
+    if (!_rasterRgb565Supported(surface)) return false;
+
+    auto span = rle->spans;
+    for (uint32_t i = 0; i < rle->size; ++i, ++span) {
+        _rasterRgb565GradientSpan<fillMethod>(surface, fill, span->y, span->x, span->len, span->coverage);
+    }
+    return true;
+}
+
+
 /************************************************************************/
 /* Rect                                                                 */
 /************************************************************************/
@@ -476,6 +630,8 @@ static bool _rasterSolidRect(SwSurface* surface, const SwBBox& region, uint8_t r
 
 static bool _rasterRect(SwSurface* surface, const SwBBox& region, uint8_t r, uint8_t g, uint8_t b, uint8_t a)
 {
+    if (_rgb565(surface)) return _rasterRgb565Rect(surface, region, r, g, b, a);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterMattedRect(surface, region, r, g, b, a);
         else return _rasterMaskedRect(surface, region, r, g, b, a);
@@ -665,6 +821,8 @@ static bool _rasterRle(SwSurface* surface, SwRle* rle, uint8_t r, uint8_t g, uin
 {
     if (!rle) return false;
 
+    if (_rgb565(surface)) return _rasterRgb565Rle(surface, rle, r, g, b, a);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterMattedRle(surface, rle, r, g, b, a);
         else return _rasterMaskedRle(surface, rle, r, g, b, a);
@@ -1244,6 +1402,11 @@ static bool _directImage(SwSurface* surface, const SwImage* image, const SwBBox&
 //Blenders for the following scenarios: [RLE / Whole] * [Direct / Scaled / Transformed]
 static bool _rasterImage(SwSurface* surface, SwImage* image, const Matrix& transform, const SwBBox& region, uint8_t opacity)
 {
+    if (_rgb565(surface)) {
+        TVGERR("SW_ENGINE", "Images are not supported with the RGB565 target!");
+        return false;
+    }
+
     //RLE Image
     if (image->rle) {
         if (image->direct) return _directRleImage(surface, image, opacity);
@@ -1404,6 +1567,8 @@ static bool _rasterSolidGradientRect(SwSurface* surface, const SwBBox& region, c
 
 static bool _rasterLinearGradientRect(SwSurface* surface, const SwBBox& region, const SwFill* fill)
 {
+    if (_rgb565(surface)) return _rasterRgb565GradientRect<FillLinear>(surface, region, fill);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterGradientMattedRect<FillLinear>(surface, region, fill);
         else return _rasterGradientMaskedRect<FillLinear>(surface, region, fill);
@@ -1419,6 +1584,8 @@ static bool _rasterLinearGradientRect(SwSurface* surface, const SwBBox& region,
 
 static bool _rasterRadialGradientRect(SwSurface* surface, const SwBBox& region, const SwFill* fill)
 {
+    if (_rgb565(surface)) return _rasterRgb565GradientRect<FillRadial>(surface, region, fill);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterGradientMattedRect<FillRadial>(surface, region, fill);
         else return _rasterGradientMaskedRect<FillRadial>(surface, region, fill);
@@ -1567,6 +1734,8 @@ static bool _rasterLinearGradientRle(SwSurface* surface, const SwRle* rle, const
 {
     if (!rle) return false;
 
+    if (_rgb565(surface)) return _rasterRgb565GradientRle<FillLinear>(surface, rle, fill);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterGradientMattedRle<FillLinear>(surface, rle, fill);
         else return _rasterGradientMaskedRle<FillLinear>(surface, rle, fill);
@@ -1584,6 +1753,8 @@ static bool _rasterRadialGradientRle(SwSurface* surface, const SwRle* rle, const
 {
     if (!rle) return false;
 
+    if (_rgb565(surface)) return _rasterRgb565GradientRle<FillRadial>(surface, rle, fill);
+
     if (_compositing(surface)) {
         if (_matting(surface)) return _rasterGradientMattedRle<FillRadial>(surface, rle, fill);
         else return _rasterGradientMaskedRle<FillRadial>(surface, rle, fill);
@@ -1636,7 +1807,7 @@ bool rasterCompositor(SwSurface* surface)
         surface->join = _abgrJoin;
         surface->alphas[2] = _abgrLuma;
         surface->alphas[3] = _abgrInvLuma;
-    } else if (surface->cs == ColorSpace::ARGB8888 || surface->cs == ColorSpace::ARGB8888S) {
+    } else if (surface->cs == ColorSpace::ARGB8888 || surface->cs == ColorSpace::ARGB8888S || surface->cs == ColorSpace::RGB565 || surface->cs == ColorSpace::RGB565S) {
         surface->join = _argbJoin;
         surface->alphas[2] = _argbLuma;
         surface->alphas[3] = _argbInvLuma;
@@ -1663,6 +1834,14 @@ bool rasterClear(SwSurface* surface, uint32_t x, uint32_t y, uint32_t w, uint32_
                 rasterPixel32(surface->buf32, val, (surface->stride * y + x) + (surface->stride * i), w);
             }
         }
+    //16 bits
+    } else if (surface->channelSize == sizeof(uint16_t)) {
+        auto c = _rgb565Pack(val);
+        if (surface->cs == ColorSpace::RGB565S) c = _rgb565Swap(c);
+        for (uint32_t i = 0; i < h; i++) {
+            auto dst = surface->buf16 + surface->stride * (y + i) + x;
+            for (uint32_t j = 0; j < w; j++) dst[j] = c;
+        }
     //8 bits
     } else if (surface->channelSize == sizeof(uint8_t)) {
         //full clear
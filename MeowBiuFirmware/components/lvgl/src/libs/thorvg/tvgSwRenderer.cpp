@@ -28,6 +28,7 @@
 #endif
 #include <algorithm>
 #include "tvgMath.h"
+#include "tvgFill.h"
 #include "tvgSwCommon.h"
 #include "tvgTaskScheduler.h"
 #include "tvgSwRenderer.h"
@@ -271,6 +272,202 @@ static void _termEngine()
 }
 
 
+struct SwDamageItem
+{
+    uint64_t sig;                         //hash of everything affecting the drawn pixels
+    SwBBox bbox;                          //conservative bounds of the drawn pixels
+};
+
+
+struct SwDamage
+{
+    Array<SwDamageItem> items[2];         //the previous and the current measurement
+    Array<uint64_t> groups;               //signatures of the enclosing paints
+    RenderRegion vport;                   //viewport to restore after the measurement
+    uint8_t cur = 0;
+    bool spread[2] = {false, false};      //a paint may draw outside of the measured bounds
+    bool measuring = false;
+    bool valid = false;                   //the previous measurement was drawn to the current target
+};
+
+
+static uint64_t _hash(uint64_t h, const void* data, uint32_t size)
+{
+    //FNV-1a
+    auto p = static_cast<const uint8_t*>(data);
+    for (uint32_t i = 0; i < size; ++i) {
+        h ^= p[i];
+        h *= 0x100000001b3ULL;
+    }
+    return h;
+}
+
+
+template<typename T>
+static uint64_t _hash(uint64_t h, const T& val)
+{
+    return _hash(h, &val, sizeof(T));
+}
+
+
+static uint64_t _hash(uint64_t h, const Matrix& m)
+{
+    const float e[] = {m.e11, m.e12, m.e13, m.e21, m.e22, m.e23, m.e31, m.e32, m.e33};
+    return _hash(h, e, sizeof(e));
+}
+
+
+static uint64_t _hash(uint64_t h, const RenderRegion& r)
+{
+    const int32_t v[] = {r.x, r.y, r.w, r.h};
+    return _hash(h, v, sizeof(v));
+}
+
+
+static uint64_t _hashFill(uint64_t h, const Fill* fill)
+{
+    if (!fill) return _hash(h, uint8_t(0));
+
+    const Fill::ColorStop* stops = nullptr;
+    auto cnt = fill->colorStops(&stops);
+    for (uint32_t i = 0; i < cnt; ++i) {
+        h = _hash(h, stops[i].offset);
+        const uint8_t c[] = {stops[i].r, stops[i].g, stops[i].b, stops[i].a};
+        h = _hash(h, c, sizeof(c));
+    }
+    h = _hash(h, fill->spread());
+    h = _hash(h, fill->transform());
+
+    if (fill->type() == Type::LinearGradient) {
+        auto linear = P(static_cast<const LinearGradient*>(fill));
+        const float v[] = {linear->x1, linear->y1, linear->x2, linear->y2};
+        h = _hash(h, v, sizeof(v));
+    } else if (fill->type() == Type::RadialGradient) {
+        auto radial = P(static_cast<const RadialGradient*>(fill));
+        const float v[] = {radial->cx, radial->cy, radial->r, radial->fx, radial->fy, radial->fr};
+        h = _hash(h, v, sizeof(v));
+    }
+    return h;
+}
+
+
+static uint64_t _hashStroke(uint64_t h, const RenderStroke* stroke)
+{
+    if (!stroke) return _hash(h, uint8_t(0));
+
+    h = _hash(h, stroke->width);
+    h = _hash(h, stroke->color, sizeof(stroke->color));
+    h = _hashFill(h, stroke->fill);
+    h = _hash(h, stroke->dashCnt);
+    if (stroke->dashCnt > 0) h = _hash(h, stroke->dashPattern, sizeof(float) * stroke->dashCnt);
+    h = _hash(h, stroke->dashOffset);
+    h = _hash(h, stroke->cap);
+    h = _hash(h, stroke->join);
+    h = _hash(h, stroke->miterlimit);
+    h = _hash(h, stroke->strokeFirst);
+    const float trim[] = {stroke->trim.begin, stroke->trim.end};
+    h = _hash(h, trim, sizeof(trim));
+    return _hash(h, stroke->trim.simultaneous);
+}
+
+
+//Add the bounds of the transformed points extended by ext pixels. Anti-aliasing may touch one more pixel.
+static void _damageAdd(SwDamage* damage, uint64_t sig, const Point* pts, uint32_t cnt, const Matrix& m, float ext, const RenderRegion& vport, const SwSurface* surface)
+{
+    SwDamageItem item;
+    item.sig = sig;
+    item.bbox.reset();
+
+    if (cnt > 0) {
+        auto min = pts[0] * m;
+        auto max = min;
+        for (uint32_t i = 1; i < cnt; ++i) {
+            auto pt = pts[i] * m;
+            if (pt.x < min.x) min.x = pt.x;
+            if (pt.y < min.y) min.y = pt.y;
+            if (pt.x > max.x) max.x = pt.x;
+            if (pt.y > max.y) max.y = pt.y;
+        }
+
+        auto x1 = std::max(static_cast<float>(std::max(vport.x, 0)), floorf(min.x - ext) - 1.0f);
+        auto y1 = std::max(static_cast<float>(std::max(vport.y, 0)), floorf(min.y - ext) - 1.0f);
+        auto x2 = std::min(static_cast<float>(std::min(vport.x + vport.w, static_cast<int32_t>(surface->w))), ceilf(max.x + ext) + 1.0f);
+        auto y2 = std::min(static_cast<float>(std::min(vport.y + vport.h, static_cast<int32_t>(surface->h))), ceilf(max.y + ext) + 1.0f);
+
+        if (x1 < x2 && y1 < y2) {
+            item.bbox.min = {static_cast<SwCoord>(x1), static_cast<SwCoord>(y1)};
+            item.bbox.max = {static_cast<SwCoord>(x2), static_cast<SwCoord>(y2)};
+        }
+    }
+
+    damage->items[damage->cur].push(item);
+}
+
+
+static void _damageShape(SwDamage* damage, const RenderShape& rshape, const Matrix& transform, uint8_t opacity, bool clipper, const RenderRegion& vport, const SwSurface* surface)
+{
+    auto h = _hash(damage->groups.count > 0 ? damage->groups.last() : 0xcbf29ce484222325ULL, uint8_t(1));
+    h = _hash(h, transform);
+    h = _hash(h, opacity);
+    h = _hash(h, clipper);
+    h = _hash(h, vport);
+    h = _hash(h, rshape.path.cmds.data, sizeof(PathCommand) * rshape.path.cmds.count);
+    h = _hash(h, rshape.path.pts.data, sizeof(Point) * rshape.path.pts.count);
+    h = _hash(h, rshape.rule);
+    h = _hash(h, rshape.color, sizeof(rshape.color));
+    h = _hashFill(h, rshape.fill);
+    h = _hashStroke(h, rshape.stroke);
+
+    //Invisible
+    if (opacity == 0 && !clipper) {
+        _damageAdd(damage, h, nullptr, 0, transform, 0.0f, vport, surface);
+        return;
+    }
+
+    //The stroke can reach out by half of its width, by the miter limit at the joins or diagonally at the square caps.
+    auto ext = 0.0f;
+    if (rshape.stroke && rshape.stroke->width > 0.0f) {
+        auto scale = sqrtf(transform.e11 * transform.e11 + transform.e12 * transform.e12 + transform.e21 * transform.e21 + transform.e22 * transform.e22);
+        auto limit = 1.415f;
+        if (rshape.stroke->join == StrokeJoin::Miter && rshape.stroke->miterlimit > limit) limit = rshape.stroke->miterlimit;
+        ext = 0.5f * rshape.stroke->width * scale * limit;
+    }
+
+    _damageAdd(damage, h, rshape.path.pts.data, rshape.path.pts.count, transform, ext, vport, surface);
+}
+
+
+static void _damageImage(SwDamage* damage, const RenderSurface* source, const Matrix& transform, uint8_t opacity, const RenderRegion& vport, const SwSurface* surface)
+{
+    auto h = _hash(damage->groups.count > 0 ? damage->groups.last() : 0xcbf29ce484222325ULL, uint8_t(2));
+    h = _hash(h, transform);
+    h = _hash(h, opacity);
+    h = _hash(h, vport);
+    h = _hash(h, source->data);
+    const uint32_t v[] = {source->w, source->h, source->stride, static_cast<uint32_t>(source->cs)};
+    h = _hash(h, v, sizeof(v));
+
+    auto w = static_cast<float>(source->w);
+    auto sh = static_cast<float>(source->h);
+    Point pts[] = {{0.0f, 0.0f}, {w, 0.0f}, {0.0f, sh}, {w, sh}};
+    _damageAdd(damage, h, pts, opacity > 0 ? 4 : 0, transform, 0.0f, vport, surface);
+}
+
+
+static void _damageUnion(SwBBox& area, const SwBBox& bbox)
+{
+    if (bbox.min.x >= bbox.max.x || bbox.min.y >= bbox.max.y) return;
+    if (area.min.x >= area.max.x || area.min.y >= area.max.y) {
+        area = bbox;
+        return;
+    }
+    if (bbox.min.x < area.min.x) area.min.x = bbox.min.x;
+    if (bbox.min.y < area.min.y) area.min.y = bbox.min.y;
+    if (bbox.max.x > area.max.x) area.max.x = bbox.max.x;
+    if (bbox.max.y > area.max.y) area.max.y = bbox.max.y;
+}
+
+
 static void _renderFill(SwShapeTask* task, SwSurface* surface, uint8_t opacity)
 {
     uint8_t r, g, b, a;
@@ -308,6 +505,8 @@ SwRenderer::~SwRenderer()
 
     if (!sharedMpool) mpoolTerm(mpool);
 
+    delete(damage);
+
     --rendererCnt;
 
     if (rendererCnt == 0 && initEngineCnt == 0) _termEngine();
@@ -326,7 +525,8 @@ bool SwRenderer::clear()
     }
     tasks.clear();
 
-    if (!sharedMpool) mpoolClear(mpool);
+    //The outlines are reset when they are returned to the pool.
+    //Keep the memory of an individual pool for the next drawing, it's freed with the renderer.
 
     if (surface) {
         vport.x = vport.y = 0;
@@ -373,6 +573,9 @@ bool SwRenderer::target(pixel_t* data, uint32_t stride, uint32_t w, uint32_t h,
     surface->channelSize = CHANNEL_SIZE(cs);
     surface->premultiplied = true;
 
+    //The previous drawing is not on this target
+    if (damage) damage->valid = false;
+
     return rasterCompositor(surface);
 }
 
@@ -599,6 +802,12 @@ RenderCompositor* SwRenderer::target(const RenderRegion& region, ColorSpace cs)
     //Out of boundary
     if (x >= sw || y >= sh || x + w < 0 || y + h < 0) return nullptr;
 
+    //The compositions are blended with 32 bits, not supported on 16 bits targets
+    if (surface->channelSize == sizeof(uint16_t)) {
+        TVGERR("SW_ENGINE", "Composition is not supported with the RGB565 target!");
+        return nullptr;
+    }
+
     auto cmp = request(CHANNEL_SIZE(cs));
 
     //Boundary Check
@@ -736,6 +945,11 @@ RenderData SwRenderer::prepare(RenderSurface* surface, RenderData data, const Ma
 
     task->source = surface;
 
+    if (damage && damage->measuring) {
+        _damageImage(damage, surface, transform, opacity, vport, this->surface);
+        return task;
+    }
+
     return prepareCommon(task, transform, clips, opacity, flags);
 }
 
@@ -750,10 +964,89 @@ RenderData SwRenderer::prepare(const RenderShape& rshape, RenderData data, const
     task->rshape = &rshape;
     task->clipper = clipper;
 
+    if (damage && damage->measuring) {
+        _damageShape(damage, rshape, transform, opacity, clipper, vport, surface);
+        return task;
+    }
+
     return prepareCommon(task, transform, clips, opacity, flags);
 }
 
 
+bool SwRenderer::damageBegin()
+{
+    if (!surface) return false;
+
+    if (!damage) damage = new SwDamage;
+
+    damage->cur = !damage->cur;
+    damage->items[damage->cur].clear();
+    damage->spread[damage->cur] = false;
+    damage->groups.clear();
+    damage->measuring = true;
+
+    //Measure in the whole target
+    damage->vport = vport;
+    vport = {0, 0, static_cast<int32_t>(surface->w), static_cast<int32_t>(surface->h)};
+
+    return true;
+}
+
+
+RenderRegion SwRenderer::damageEnd()
+{
+    damage->measuring = false;
+    vport = damage->vport;
+
+    RenderRegion full = {0, 0, static_cast<int32_t>(surface->w), static_cast<int32_t>(surface->h)};
+    if (!damage->valid) {
+        damage->valid = true;
+        return full;
+    }
+
+    //Damage the old and the new bounds of the paints which differ in the drawing order
+    auto& cur = damage->items[damage->cur];
+    auto& prev = damage->items[!damage->cur];
+    auto cnt = std::max(cur.count, prev.count);
+    auto changed = false;
+    SwBBox area;
+    area.reset();
+
+    for (uint32_t i = 0; i < cnt; ++i) {
+        auto a = i < cur.count ? &cur[i] : nullptr;
+        auto b = i < prev.count ? &prev[i] : nullptr;
+        if (a && b && a->sig == b->sig && a->bbox.min.x == b->bbox.min.x && a->bbox.min.y == b->bbox.min.y &&
+            a->bbox.max.x == b->bbox.max.x && a->bbox.max.y == b->bbox.max.y) continue;
+        changed = true;
+        if (a) _damageUnion(area, a->bbox);
+        if (b) _damageUnion(area, b->bbox);
+    }
+
+    if (!changed) return {0, 0, 0, 0};
+    if (damage->spread[0] || damage->spread[1]) return full;
+
+    return {static_cast<int32_t>(area.min.x), static_cast<int32_t>(area.min.y),
+            static_cast<int32_t>(area.max.x - area.min.x), static_cast<int32_t>(area.max.y - area.min.y)};
+}
+
+
+void SwRenderer::damagePush(uint32_t sig, bool spread)
+{
+    if (!damage || !damage->measuring) return;
+
+    if (spread) damage->spread[damage->cur] = true;
+    damage->groups.push(_hash(damage->groups.count > 0 ? damage->groups.last() : 0xcbf29ce484222325ULL, sig));
+}
+
+
+void SwRenderer::damagePop()
+{
+    if (!damage || !damage->measuring) return;
+
+    if (damage->groups.count > 0) damage->groups.pop();
+}
+
+
 SwRenderer::SwRenderer():mpool(globalMpool)
 {
 }
@@ -32,6 +32,7 @@ struct SwSurface;
 struct SwTask;
 struct SwCompositor;
 struct SwMpool;
+struct SwDamage;
 
 namespace tvg
 {
@@ -66,6 +67,11 @@ public:
     bool prepare(RenderEffect* effect) override;
     bool effect(RenderCompositor* cmp, const RenderEffect* effect) override;
 
+    bool damageBegin();
+    RenderRegion damageEnd();
+    void damagePush(uint32_t sig, bool spread) override;
+    void damagePop() override;
+
     static SwRenderer* gen();
     static bool init(uint32_t threads);
     static int32_t init();
@@ -78,6 +84,7 @@ private:
     SwMpool*             mpool;                       //private memory pool
     RenderRegion         vport;                       //viewport
     bool                 sharedMpool = true;          //memory-pool behavior policy
+    SwDamage*            damage = nullptr;            //damage tracking, created on the first measurement
 
     SwRenderer();
     ~SwRenderer();
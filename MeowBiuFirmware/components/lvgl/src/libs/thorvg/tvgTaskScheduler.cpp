@@ -27,7 +27,7 @@
 #include "tvgInlist.h"
 #include "tvgTaskScheduler.h"
 
-#ifdef THORVG_THREAD_SUPPORT
+#if defined(THORVG_THREAD_SUPPORT) || defined(THORVG_LV_THREAD_SUPPORT)
     #include <thread>
     #include <atomic>
 #endif
@@ -179,6 +179,131 @@ struct TaskSchedulerImpl
     }
 };
 
+#elif defined(THORVG_LV_THREAD_SUPPORT)
+
+static thread_local bool _async = true;
+
+struct TaskSchedulerImpl;
+
+struct TaskQueue {
+    Inlist<Task>             taskDeque;
+    lv_mutex_t               mtx;
+    lv_thread_sync_t         ready;                 //signaled when a task is pushed
+    lv_thread_t              thread;
+    TaskSchedulerImpl*       scheduler;
+    uint32_t                 id;
+    volatile bool            done = false;
+
+    TaskQueue(TaskSchedulerImpl* scheduler, uint32_t id) : scheduler(scheduler), id(id)
+    {
+        lv_mutex_init(&mtx);
+        lv_thread_sync_init(&ready);
+    }
+
+    ~TaskQueue()
+    {
+        lv_thread_sync_delete(&ready);
+        lv_mutex_delete(&mtx);
+    }
+
+    Task* pop()
+    {
+        lv_mutex_lock(&mtx);
+        auto task = taskDeque.front();
+        lv_mutex_unlock(&mtx);
+        return task;
+    }
+
+    void push(Task* task)
+    {
+        lv_mutex_lock(&mtx);
+        taskDeque.back(task);
+        lv_mutex_unlock(&mtx);
+        lv_thread_sync_signal(&ready);
+    }
+
+    void complete()
+    {
+        done = true;
+        lv_thread_sync_signal(&ready);
+    }
+};
+
+
+struct TaskSchedulerImpl
+{
+    Array<TaskQueue*>              taskQueues;
+    atomic<uint32_t>               idx{0};
+
+    TaskSchedulerImpl(uint32_t threadCnt)
+    {
+        taskQueues.reserve(threadCnt);
+
+        for (uint32_t i = 0; i < threadCnt; ++i) {
+            taskQueues.push(new TaskQueue(this, i));
+        }
+        for (uint32_t i = 0; i < threadCnt; ++i) {
+            lv_thread_init(&taskQueues[i]->thread, "tvgworker", LV_DRAW_THREAD_PRIO, worker, LV_DRAW_THREAD_STACK_SIZE, taskQueues[i]);
+        }
+    }
+
+    ~TaskSchedulerImpl()
+    {
+        for (auto tq = taskQueues.begin(); tq < taskQueues.end(); ++tq) {
+            (*tq)->complete();
+        }
+        //The workers take tasks from each other's queues so join all of them before freeing any queue
+        for (auto tq = taskQueues.begin(); tq < taskQueues.end(); ++tq) {
+            lv_thread_delete(&(*tq)->thread);
+        }
+        for (auto tq = taskQueues.begin(); tq < taskQueues.end(); ++tq) {
+            delete(*tq);
+        }
+    }
+
+    static void worker(void* data)
+    {
+        auto tq = static_cast<TaskQueue*>(data);
+        tq->scheduler->run(tq->id);
+    }
+
+    void run(unsigned i)
+    {
+        //Thread Loop
+        while (true) {
+            //Take from the own queue first, then help the others
+            Task* task = nullptr;
+            for (uint32_t x = 0; x < taskQueues.count && !task; ++x) {
+                task = taskQueues[(i + x) % taskQueues.count]->pop();
+            }
+            if (task) {
+                (*task)(i + 1);
+                continue;
+            }
+            if (taskQueues[i]->done) break;
+            //A push since the queues were checked leaves the signal set
+            lv_thread_sync_wait(&taskQueues[i]->ready);
+        }
+    }
+
+    void request(Task* task)
+    {
+        //Async
+        if (taskQueues.count > 0 && _async) {
+            task->prepare();
+            taskQueues[idx++ % taskQueues.count]->push(task);
+        //Sync
+        } else {
+            task->run(0);
+        }
+    }
+
+    uint32_t threadCnt()
+    {
+        return taskQueues.count;
+    }
+};
+
 #else //THORVG_THREAD_SUPPORT
 
 static bool _async = true;
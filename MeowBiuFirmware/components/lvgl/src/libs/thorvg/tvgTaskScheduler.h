@@ -33,6 +33,12 @@
 #include "tvgCommon.h"
 #include "tvgInlist.h"
 
+//Run the tasks on LVGL's threads if there is no native thread support
+#if !defined(THORVG_THREAD_SUPPORT) && LV_USE_OS != LV_OS_NONE
+    #define THORVG_LV_THREAD_SUPPORT
+    #include "../../osal/lv_os.h"
+#endif
+
 using std::mutex;
 using std::condition_variable;
 using std::unique_lock;
@@ -88,6 +94,54 @@ private:
     friend struct TaskSchedulerImpl;
 };
 
+#elif defined(THORVG_LV_THREAD_SUPPORT)
+
+struct Task
+{
+private:
+    lv_thread_sync_t        sync;                   //signaled when the task is finished
+    bool                    syncInited = false;
+    bool                    pending = false;
+
+public:
+    INLIST_ITEM(Task);
+
+    virtual ~Task()
+    {
+        if (syncInited) lv_thread_sync_delete(&sync);
+    }
+
+    //Only the thread requesting the task may wait for it
+    void done()
+    {
+        if (!pending) return;
+
+        lv_thread_sync_wait(&sync);
+        pending = false;
+    }
+
+protected:
+    virtual void run(unsigned tid) = 0;
+
+private:
+    void operator()(unsigned tid)
+    {
+        run(tid);
+        lv_thread_sync_signal(&sync);
+    }
+
+    void prepare()
+    {
+        if (!syncInited) {
+            lv_thread_sync_init(&sync);
+            syncInited = true;
+        }
+        pending = true;
+    }
+
+    friend struct TaskSchedulerImpl;
+};
+
 #else  //THORVG_THREAD_SUPPORT
 
 struct Task
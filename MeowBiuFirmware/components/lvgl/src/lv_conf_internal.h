@@ -28,6 +28,7 @@
 #define LV_DRAW_SW_ASM_NONE         0
 #define LV_DRAW_SW_ASM_NEON         1
 #define LV_DRAW_SW_ASM_HELIUM       2
+#define LV_DRAW_SW_ASM_X86          3
 #define LV_DRAW_SW_ASM_CUSTOM       255
 
 #define LV_NEMA_HAL_CUSTOM          0
@@ -228,8 +229,76 @@
             #endif
         #endif
     #endif
+
+    /** Serve the small allocations (animations, timers, event descriptors, linked list nodes, etc.)
+     *  from pages of same-sized slots to not fragment the heap with them. Larger or excess
+     *  allocations still use the heap. */
+    #ifndef LV_MEM_SLAB
+        #ifdef CONFIG_LV_MEM_SLAB
+            #define LV_MEM_SLAB CONFIG_LV_MEM_SLAB
+        #else
+            #define LV_MEM_SLAB 0
+        #endif
+    #endif
+    #if LV_MEM_SLAB
+        /** Size difference of the slot size classes. Class `i` has `(i + 1) * LV_MEM_SLAB_CLASS_STEP` bytes slots. */
+        #ifndef LV_MEM_SLAB_CLASS_STEP
+            #ifdef CONFIG_LV_MEM_SLAB_CLASS_STEP
+                #define LV_MEM_SLAB_CLASS_STEP CONFIG_LV_MEM_SLAB_CLASS_STEP
+            #else
+                #define LV_MEM_SLAB_CLASS_STEP 16     /**< [bytes] */
+            #endif
+        #endif
+
+        /** Number of size classes. Allocations larger than `LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP` use the heap. */
+        #ifndef LV_MEM_SLAB_CLASS_CNT
+            #ifdef CONFIG_LV_MEM_SLAB_CLASS_CNT
+                #define LV_MEM_SLAB_CLASS_CNT CONFIG_LV_MEM_SLAB_CLASS_CNT
+            #else
+                #define LV_MEM_SLAB_CLASS_CNT 8
+            #endif
+        #endif
+
+        /** Size of a page. A page holds slots of a single class and is shared by the classes when it's empty. */
+        #ifndef LV_MEM_SLAB_PAGE_SIZE
+            #ifdef CONFIG_LV_MEM_SLAB_PAGE_SIZE
+                #define LV_MEM_SLAB_PAGE_SIZE CONFIG_LV_MEM_SLAB_PAGE_SIZE
+            #else
+                #define LV_MEM_SLAB_PAGE_SIZE 1024    /**< [bytes] */
+            #endif
+        #endif
+
+        /** Number of pages, allocated from the heap at once in `lv_mem_init()` */
+        #ifndef LV_MEM_SLAB_PAGE_CNT
+            #ifdef CONFIG_LV_MEM_SLAB_PAGE_CNT
+                #define LV_MEM_SLAB_PAGE_CNT CONFIG_LV_MEM_SLAB_PAGE_CNT
+            #else
+                #define LV_MEM_SLAB_PAGE_CNT 16
+            #endif
+        #endif
+    #endif
 #endif  /*LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN*/
 
+/** 1: Count the memory allocated by `lv_malloc()` per subsystem tag or call site.
+ *  Adds a small header to each allocation. See `lv_mem_profiler_dump()`. */
+#ifndef LV_USE_MEM_PROFILER
+    #ifdef CONFIG_LV_USE_MEM_PROFILER
+        #define LV_USE_MEM_PROFILER CONFIG_LV_USE_MEM_PROFILER
+    #else
+        #define LV_USE_MEM_PROFILER 0
+    #endif
+#endif
+#if LV_USE_MEM_PROFILER
+    /** Number of tags and call sites counted separately. Further call sites are counted together. */
+    #ifndef LV_MEM_PROFILER_ENTRY_CNT
+        #ifdef CONFIG_LV_MEM_PROFILER_ENTRY_CNT
+            #define LV_MEM_PROFILER_ENTRY_CNT CONFIG_LV_MEM_PROFILER_ENTRY_CNT
+        #else
+            #define LV_MEM_PROFILER_ENTRY_CNT 32
+        #endif
+    #endif
+#endif
+
 /*====================
    HAL SETTINGS
  *====================*/
@@ -633,6 +702,22 @@
         #endif
     #endif
 
+    #if LV_USE_DRAW_SW_ASM == LV_DRAW_SW_ASM_X86
+        /** 1: Build the AVX2 kernels too and pick them at runtime if the CPU supports AVX2.
+         *  0: Use AVX2 only if the compiler targets it (e.g. `-mavx2`), else SSE2. */
+        #ifndef LV_DRAW_SW_X86_RUNTIME_DETECT
+            #ifdef LV_KCONFIG_PRESENT
+                #ifdef CONFIG_LV_DRAW_SW_X86_RUNTIME_DETECT
+                    #define LV_DRAW_SW_X86_RUNTIME_DETECT CONFIG_LV_DRAW_SW_X86_RUNTIME_DETECT
+                #else
+                    #define LV_DRAW_SW_X86_RUNTIME_DETECT 0
+                #endif
+            #else
+                #define LV_DRAW_SW_X86_RUNTIME_DETECT 1
+            #endif
+        #endif
+    #endif
+
     /** Enable drawing complex gradients in software: linear at an angle, radial or conical */
     #ifndef LV_USE_DRAW_SW_COMPLEX_GRADIENTS
         #ifdef CONFIG_LV_USE_DRAW_SW_COMPLEX_GRADIENTS
@@ -1355,6 +1440,30 @@
     #endif
 #endif
 
+/** 1: Cache the resolved values of the style properties used for drawing per object and part.
+ *  Getting e.g. the background color while drawing becomes an array lookup instead of checking
+ *  all the styles of the object (and its parents) in every rendered strip.
+ *  Needs about 40 bytes per cached part (e.g. `LV_PART_MAIN`) of the drawn objects
+ *  and a pointer size for each property set by their styles. */
+#ifndef LV_OBJ_STYLE_RESOLVED_CACHE
+    #ifdef CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+        #define LV_OBJ_STYLE_RESOLVED_CACHE CONFIG_LV_OBJ_STYLE_RESOLVED_CACHE
+    #else
+        #define LV_OBJ_STYLE_RESOLVED_CACHE 0
+    #endif
+#endif
+
+/** 1: Keep the running timers in a min-heap sorted by their next expiry time.
+ *  `lv_timer_handler()` checks only the expired timers instead of every timer and
+ *  paused timers cost nothing. Adds 4 x 32-bit variables to each `lv_timer_t`. */
+#ifndef LV_USE_TIMER_HEAP
+    #ifdef CONFIG_LV_USE_TIMER_HEAP
+        #define LV_USE_TIMER_HEAP CONFIG_LV_USE_TIMER_HEAP
+    #else
+        #define LV_USE_TIMER_HEAP       0
+    #endif
+#endif
+
 /** Add `id` field to `lv_obj_t` */
 #ifndef LV_USE_OBJ_ID
     #ifdef CONFIG_LV_USE_OBJ_ID
@@ -1905,6 +2014,17 @@
         #define LV_USE_FONT_COMPRESSED 0
     #endif
 #endif
+#if LV_USE_FONT_COMPRESSED
+    /** Size in bytes of the cache of the decompressed glyph bitmaps shared by all compressed fonts.
+     *  E.g. the 10 digits of a 28 px font need about 10 * 20 * 20 = 4 kB. 0: decompress the glyphs on every draw. */
+    #ifndef LV_FONT_COMPRESSED_CACHE_SIZE
+        #ifdef CONFIG_LV_FONT_COMPRESSED_CACHE_SIZE
+            #define LV_FONT_COMPRESSED_CACHE_SIZE CONFIG_LV_FONT_COMPRESSED_CACHE_SIZE
+        #else
+            #define LV_FONT_COMPRESSED_CACHE_SIZE 0
+        #endif
+    #endif
+#endif
 
 /** Enable drawing placeholders when glyph dsc is not found. */
 #ifndef LV_USE_FONT_PLACEHOLDER
@@ -2226,6 +2346,14 @@
     #endif
 #endif
 
+#ifndef LV_USE_FACE
+    #ifdef CONFIG_LV_USE_FACE
+        #define LV_USE_FACE CONFIG_LV_USE_FACE
+    #else
+        #define LV_USE_FACE       0
+    #endif
+#endif
+
 #ifndef LV_USE_IMAGE
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_IMAGE
@@ -2455,6 +2583,14 @@
     #endif
 #endif
 
+#ifndef LV_USE_SPRITE
+    #ifdef CONFIG_LV_USE_SPRITE
+        #define LV_USE_SPRITE CONFIG_LV_USE_SPRITE
+    #else
+        #define LV_USE_SPRITE     0  /**< Requires: lv_canvas */
+    #endif
+#endif
+
 #ifndef LV_USE_SWITCH
     #ifdef LV_KCONFIG_PRESENT
         #ifdef CONFIG_LV_USE_SWITCH
@@ -3093,6 +3229,19 @@
         #define LV_USE_THORVG_INTERNAL 0
     #endif
 #endif
+#if LV_USE_THORVG_INTERNAL
+    /** Number of worker threads preparing the shapes of ThorVG (path transform, stroke, RLE generation)
+     *  in parallel with the drawing. They use `LV_DRAW_THREAD_PRIO` and `LV_DRAW_THREAD_STACK_SIZE`.
+     *  - Requires `LV_USE_OS`
+     *  - 0: prepare the shapes on the drawing thread */
+    #ifndef LV_THORVG_WORKER_CNT
+        #ifdef CONFIG_LV_THORVG_WORKER_CNT
+            #define LV_THORVG_WORKER_CNT CONFIG_LV_THORVG_WORKER_CNT
+        #else
+            #define LV_THORVG_WORKER_CNT 0
+        #endif
+    #endif
+#endif
 
 /** Enable ThorVG by assuming that its installed and linked to the project */
 #ifndef LV_USE_THORVG_EXTERNAL
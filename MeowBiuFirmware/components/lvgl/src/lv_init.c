@@ -9,6 +9,7 @@
 #include "misc/lv_timer_private.h"
 #include "misc/lv_profiler_builtin_private.h"
 #include "misc/lv_anim_private.h"
+#include "stdlib/lv_mem_private.h"
 #include "draw/lv_image_decoder_private.h"
 #include "draw/lv_draw_buf_private.h"
 #include "core/lv_refr_private.h"
@@ -187,6 +188,11 @@ void lv_init(void)
     /*Initialize members of static variable lv_global */
     LV_GLOBAL_INIT(LV_GLOBAL_DEFAULT());
 
+#if LV_USE_MEM_PROFILER
+    /*Before lv_mem_init() as it already allocates through the profiler*/
+    lv_mem_profiler_init();
+#endif
+
     lv_mem_init();
 
     lv_draw_buf_init_handlers();
@@ -280,6 +286,10 @@ void lv_init(void)
     lv_image_decoder_init(LV_CACHE_DEF_SIZE, LV_IMAGE_HEADER_CACHE_DEF_CNT);
     lv_bin_decoder_init();  /*LVGL built-in binary image decoder*/
 
+#if LV_USE_FONT_COMPRESSED
+    lv_font_fmt_txt_glyph_cache_init(LV_FONT_COMPRESSED_CACHE_SIZE);
+#endif
+
 #if LV_USE_DRAW_VG_LITE
     lv_draw_vg_lite_init();
 #endif
@@ -441,6 +451,10 @@ void lv_deinit(void)
 
     lv_image_decoder_deinit();
 
+#if LV_USE_FONT_COMPRESSED
+    lv_font_fmt_txt_glyph_cache_deinit();
+#endif
+
     lv_refr_deinit();
 
     lv_obj_style_deinit();
@@ -501,6 +515,11 @@ void lv_deinit(void)
 
     lv_mem_deinit();
 
+#if LV_USE_MEM_PROFILER
+    /*After lv_mem_deinit() as it still frees through the profiler*/
+    lv_mem_profiler_deinit();
+#endif
+
     lv_initialized = false;
 
     LV_LOG_INFO("lv_deinit done");
@@ -79,6 +79,12 @@ void lv_image_cache_resize(uint32_t new_size, bool evict_now)
 
 void lv_image_cache_drop(const void * src)
 {
+    /*Volatile images are never added to the cache*/
+    if(src && lv_image_src_get_type(src) == LV_IMAGE_SRC_VARIABLE &&
+       (((const lv_image_dsc_t *)src)->header.flags & LV_IMAGE_FLAGS_VOLATILE)) {
+        return;
+    }
+
     /*If user invalidate image, the header cache should be invalidated too.*/
     lv_image_header_cache_drop(src);
 
@@ -100,6 +106,16 @@ bool lv_image_cache_is_enabled(void)
     return lv_cache_is_enabled(img_cache_p);
 }
 
+void lv_image_cache_get_stats(lv_cache_stats_t * stats)
+{
+    lv_cache_get_stats(img_cache_p, stats);
+}
+
+void lv_image_cache_reset_stats(void)
+{
+    lv_cache_reset_stats(img_cache_p);
+}
+
 lv_iter_t * lv_image_cache_iter_create(void)
 {
     return lv_cache_iter_create(img_cache_p);
@@ -110,7 +126,12 @@ void lv_image_cache_dump(void)
     lv_iter_t * iter = lv_image_cache_iter_create();
     if(iter == NULL) return;
 
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(img_cache_p, &stats);
+
     LV_LOG_USER("Image cache dump:");
+    LV_LOG_USER("\thit: %" LV_PRIu32 ", miss: %" LV_PRIu32 ", evict: %" LV_PRIu32 ", drop: %" LV_PRIu32,
+                stats.hit_cnt, stats.miss_cnt, stats.evict_cnt, stats.drop_cnt);
     LV_LOG_USER("\tsize\tdata_size\tcf\trc\ttype\tdecoded\t\t\tsrc");
     lv_iter_inspect(iter, iter_inspect_cb);
 }
@@ -55,6 +55,17 @@ void lv_image_cache_drop(const void * src);
  */
 bool lv_image_cache_is_enabled(void);
 
+/**
+ * Get the hit/miss/evict/drop counters of the image cache.
+ * @param stats pointer to a `lv_cache_stats_t` variable to store the counters.
+ */
+void lv_image_cache_get_stats(lv_cache_stats_t * stats);
+
+/**
+ * Reset the counters of the image cache to zero.
+ */
+void lv_image_cache_reset_stats(void);
+
 /**
  * Create an iterator to iterate over the image cache.
  * @return an iterator to iterate over the image cache.
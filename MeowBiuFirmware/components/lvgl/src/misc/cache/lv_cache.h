@@ -177,6 +177,19 @@ size_t lv_cache_get_free_size(lv_cache_t * cache, void * user_data);
  */
 bool lv_cache_is_enabled(lv_cache_t * cache);
 
+/**
+ * Get the usage counters of the cache.
+ * @param cache         The cache object pointer to get the counters of.
+ * @param stats         Pointer to a `lv_cache_stats_t` variable to store the counters.
+ */
+void lv_cache_get_stats(lv_cache_t * cache, lv_cache_stats_t * stats);
+
+/**
+ * Reset the usage counters of the cache to zero.
+ * @param cache         The cache object pointer to reset the counters of.
+ */
+void lv_cache_reset_stats(lv_cache_t * cache);
+
 /**
  * Set the compare callback of the cache.
  * @param cache         The cache object pointer to set the compare callback.
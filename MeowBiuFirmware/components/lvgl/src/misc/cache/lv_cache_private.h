@@ -120,6 +120,17 @@ struct _lv_cache_ops_t {
     lv_cache_free_cb_t free_cb;          /**< Free function for nodes */
 };
 
+/**
+ * Usage counters of a cache. They are collected since the creation of the cache
+ * or since the last `lv_cache_reset_stats()` call.
+ */
+struct _lv_cache_stats_t {
+    uint32_t hit_cnt;       /**< Number of lookups which have found the entry */
+    uint32_t miss_cnt;      /**< Number of lookups which haven't found the entry */
+    uint32_t evict_cnt;     /**< Number of entries removed by the eviction policy to make room for new ones */
+    uint32_t drop_cnt;      /**< Number of entries removed explicitly by `lv_cache_drop()` */
+};
+
 /**
  * The cache entry struct
  */
@@ -138,6 +149,8 @@ struct _lv_cache_t {
     lv_mutex_t lock;                  /**< Cache lock used to protect the cache in multithreading environments */
 
     const char * name;                /**< Name of the cache */
+
+    lv_cache_stats_t stats;           /**< Hit/miss/evict/drop counters */
 };
 
 /**
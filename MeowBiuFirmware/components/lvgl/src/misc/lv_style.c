@@ -292,7 +292,9 @@ bool lv_style_remove_prop(lv_style_t * style, lv_style_prop_t prop)
             lv_style_value_t * old_values = (lv_style_value_t *)style->values_and_props;
 
             size_t size = (style->prop_cnt - 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+            LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
             uint8_t * new_values_and_props = lv_malloc(size);
+            LV_MEM_TAG_END;
             if(new_values_and_props == NULL) {
                 LV_PROFILER_STYLE_END;
                 return false;
@@ -351,7 +353,9 @@ void lv_style_set_prop(lv_style_t * style, lv_style_prop_t prop, lv_style_value_
     }
 
     size_t size = (style->prop_cnt + 1) * (sizeof(lv_style_value_t) + sizeof(lv_style_prop_t));
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_STYLE);
     uint8_t * values_and_props = lv_realloc(style->values_and_props, size);
+    LV_MEM_TAG_END;
     if(values_and_props == NULL) {
         LV_PROFILER_STYLE_END;
         return;
@@ -11,6 +11,7 @@
 #include "../stdlib/lv_mem.h"
 #include "../stdlib/lv_sprintf.h"
 #include "lv_assert.h"
+#include "lv_math.h"
 #include "lv_ll.h"
 #include "lv_profiler.h"
 
@@ -22,6 +23,13 @@
 #define DEF_PERIOD 500
 
 #define state LV_GLOBAL_DEFAULT()->timer_state
+
+#if LV_USE_TIMER_HEAP
+/*The expiries are compared as signed differences, so they need to be closer than 2^31 ms (~24 days)
+ *to each other. Longer periods (e.g. UINT32_MAX to never run) are waited in steps of at most this long
+ *and the other half is left for the timers which are overdue.*/
+#define HEAP_MAX_WAIT (INT32_MAX / 2)
+#endif
 #define timer_ll_p &(state.timer_ll)
 
 /**********************
@@ -34,6 +42,11 @@
 static bool lv_timer_exec(lv_timer_t * timer);
 static uint32_t lv_timer_time_remaining(lv_timer_t * timer);
 static void lv_timer_handler_resume(void);
+#if LV_USE_TIMER_HEAP
+    static void timer_heap_schedule(lv_timer_t * timer);
+    static void timer_heap_remove(lv_timer_t * timer);
+    static uint32_t timer_heap_collect_due(uint32_t seq_start);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -90,6 +103,27 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
         }
     }
 
+#if LV_USE_TIMER_HEAP
+    /*Run the expired timers. The heap is updated by every timer operation
+     *so there is no need to restart if a timer is created or deleted.
+     *Collect again only if a timer became ready meanwhile.*/
+    uint32_t seq_start = state_p->seq;
+    while(timer_heap_collect_due(seq_start)) {
+        uint32_t i;
+        for(i = 0; i < state_p->due_cnt; i++) {
+            /*NULL if deleted by an other timer*/
+            if(state_p->due[i]) lv_timer_exec(state_p->due[i]);
+        }
+        state_p->due_cnt = 0;
+    }
+
+    uint32_t time_until_next = LV_NO_TIMER_READY;
+    if(state_p->heap_cnt) {
+        /*Not the remaining time of the timer as a long period ends in the heap earlier*/
+        int32_t wait = (int32_t)(state_p->heap[0]->expire - lv_tick_get());
+        time_until_next = wait > 0 ? (uint32_t)wait : 0;
+    }
+#else
     /*Run all timer from the list*/
     lv_timer_t * next;
     lv_timer_t * timer_active;
@@ -127,6 +161,7 @@ LV_ATTRIBUTE_TIMER_HANDLER uint32_t lv_timer_handler(void)
 
         next = lv_ll_get_next(timer_head, next); /*Find the next timer*/
     }
+#endif /*LV_USE_TIMER_HEAP*/
 
     state_p->busy_time += lv_tick_elaps(handler_start);
     uint32_t idle_period_time = lv_tick_elaps(state_p->idle_period_start);
@@ -178,6 +213,13 @@ lv_timer_t * lv_timer_create(lv_timer_cb_t timer_xcb, uint32_t period, void * us
     new_timer->user_data = user_data;
     new_timer->auto_delete = true;
 
+#if LV_USE_TIMER_HEAP
+    new_timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    new_timer->create_id = state.create_cnt++;
+    new_timer->seq = state.seq++;
+    timer_heap_schedule(new_timer);
+#endif
+
     state.timer_created = true;
 
     lv_timer_handler_resume();
@@ -193,6 +235,17 @@ void lv_timer_set_cb(lv_timer_t * timer, lv_timer_cb_t timer_cb)
 
 void lv_timer_delete(lv_timer_t * timer)
 {
+#if LV_USE_TIMER_HEAP
+    timer_heap_remove(timer);
+    if(state.timer_exec == timer) state.timer_exec = NULL;
+
+    /*Don't run it if it's collected to run in this `lv_timer_handler()` call*/
+    uint32_t i;
+    for(i = 0; i < state.due_cnt; i++) {
+        if(state.due[i] == timer) state.due[i] = NULL;
+    }
+#endif
+
     lv_ll_remove(timer_ll_p, timer);
     state.timer_deleted = true;
 
@@ -203,12 +256,18 @@ void lv_timer_pause(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = true;
+#if LV_USE_TIMER_HEAP
+    timer_heap_remove(timer);
+#endif
 }
 
 void lv_timer_resume(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->paused = false;
+#if LV_USE_TIMER_HEAP
+    timer_heap_schedule(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -216,12 +275,18 @@ void lv_timer_set_period(lv_timer_t * timer, uint32_t period)
 {
     LV_ASSERT_NULL(timer);
     timer->period = period;
+#if LV_USE_TIMER_HEAP
+    timer_heap_schedule(timer);
+#endif
 }
 
 void lv_timer_ready(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get() - timer->period - 1;
+#if LV_USE_TIMER_HEAP
+    timer_heap_schedule(timer);
+#endif
 }
 
 void lv_timer_set_repeat_count(lv_timer_t * timer, int32_t repeat_count)
@@ -246,6 +311,9 @@ void lv_timer_reset(lv_timer_t * timer)
 {
     LV_ASSERT_NULL(timer);
     timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+    timer_heap_schedule(timer);
+#endif
     lv_timer_handler_resume();
 }
 
@@ -260,6 +328,17 @@ void lv_timer_core_deinit(void)
     lv_timer_enable(false);
 
     lv_ll_clear(timer_ll_p);
+
+#if LV_USE_TIMER_HEAP
+    lv_free(state.heap);
+    state.heap = NULL;
+    state.heap_cnt = 0;
+    state.heap_size = 0;
+
+    lv_free(state.due);
+    state.due = NULL;
+    state.due_cnt = 0;
+#endif
 }
 
 uint32_t lv_timer_get_idle(void)
@@ -320,6 +399,11 @@ static bool lv_timer_exec(lv_timer_t * timer)
         int32_t original_repeat_count = timer->repeat_count;
         if(timer->repeat_count > 0) timer->repeat_count--;
         timer->last_run = lv_tick_get();
+#if LV_USE_TIMER_HEAP
+        timer->seq = state.seq++;
+        timer_heap_schedule(timer);
+        state.timer_exec = timer;
+#endif
         LV_TRACE_TIMER("calling timer callback: %p", *((void **)&timer->timer_cb));
 
         if(timer->timer_cb && original_repeat_count != 0) {
@@ -339,7 +423,15 @@ static bool lv_timer_exec(lv_timer_t * timer)
         exec = true;
     }
 
-    if(state.timer_deleted == false) { /*The timer might be deleted by itself as well*/
+#if LV_USE_TIMER_HEAP
+    /*Only the deletion of this timer matters as the heap is always up to date*/
+    bool timer_deleted = exec && state.timer_exec == NULL;
+    state.timer_exec = NULL;
+#else
+    bool timer_deleted = state.timer_deleted;
+#endif
+
+    if(timer_deleted == false) { /*The timer might be deleted by itself as well*/
         if(timer->repeat_count == 0) { /*The repeat count is over, delete the timer*/
             if(timer->auto_delete) {
                 LV_TRACE_TIMER("deleting timer with %p callback because the repeat count is over", *((void **)&timer->timer_cb));
@@ -386,3 +478,196 @@ void lv_timer_handler_set_resume_cb(lv_timer_handler_resume_cb_t cb, void * data
     state.resume_cb = cb;
     state.resume_data = data;
 }
+
+#if LV_USE_TIMER_HEAP
+
+/**
+ * Compare the expiry of two timers
+ * @param a     pointer to a timer
+ * @param b     pointer to an other timer
+ * @return      true: `a` should run before `b`
+ */
+static inline bool timer_heap_less(const lv_timer_t * a, const lv_timer_t * b)
+{
+    /*Compare the difference to handle the overflow of the tick*/
+    int32_t diff = (int32_t)(a->expire - b->expire);
+    if(diff != 0) return diff < 0;
+    return (int32_t)(a->seq - b->seq) < 0;
+}
+
+/**
+ * Check if the expiry of the timer in the heap has passed. With a long period it passes
+ * before the period elapses.
+ * @param timer     pointer to a timer
+ * @param now       the current tick
+ * @return          true: the timer's expiry has passed
+ */
+static inline bool timer_heap_expired(const lv_timer_t * timer, uint32_t now)
+{
+    return (int32_t)(now - timer->expire) >= 0;
+}
+
+static inline void timer_heap_set(uint32_t idx, lv_timer_t * timer)
+{
+    state.heap[idx] = timer;
+    timer->heap_idx = idx;
+}
+
+static void timer_heap_sift_up(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(idx > 0) {
+        uint32_t parent = (idx - 1) / 2;
+        if(!timer_heap_less(timer, state.heap[parent])) break;
+        timer_heap_set(idx, state.heap[parent]);
+        idx = parent;
+    }
+    timer_heap_set(idx, timer);
+}
+
+static void timer_heap_sift_down(uint32_t idx)
+{
+    lv_timer_t * timer = state.heap[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= state.heap_cnt) break;
+        if(child + 1 < state.heap_cnt && timer_heap_less(state.heap[child + 1], state.heap[child])) child++;
+        if(!timer_heap_less(state.heap[child], timer)) break;
+        timer_heap_set(idx, state.heap[child]);
+        idx = child;
+    }
+    timer_heap_set(idx, timer);
+}
+
+/**
+ * Add the timer to the heap or move it to its new place according to its `last_run` and `period`.
+ * Paused timers are removed from the heap.
+ * @param timer     pointer to a timer
+ */
+static void timer_heap_schedule(lv_timer_t * timer)
+{
+    if(timer->paused) {
+        timer_heap_remove(timer);
+        return;
+    }
+
+    timer->expire = lv_tick_get() + LV_MIN(lv_timer_time_remaining(timer), HEAP_MAX_WAIT);
+
+    if(timer->heap_idx == LV_TIMER_HEAP_IDX_NONE) {
+        if(state.heap_cnt == state.heap_size) {
+            /*The due timers are collected from the heap, so their array grows with it.
+             *This way `lv_timer_handler()` doesn't allocate memory.*/
+            uint32_t new_size = state.heap_size ? state.heap_size * 2 : 16;
+            lv_timer_t ** new_due = lv_realloc(state.due, new_size * sizeof(lv_timer_t *));
+            LV_ASSERT_MALLOC(new_due);
+            if(new_due == NULL) {
+                LV_LOG_WARN("Couldn't allocate memory for the timer heap, the timer won't run");
+                return;
+            }
+            state.due = new_due;
+
+            lv_timer_t ** new_heap = lv_realloc(state.heap, new_size * sizeof(lv_timer_t *));
+            LV_ASSERT_MALLOC(new_heap);
+            if(new_heap == NULL) {
+                LV_LOG_WARN("Couldn't allocate memory for the timer heap, the timer won't run");
+                return;
+            }
+            state.heap = new_heap;
+            state.heap_size = new_size;
+        }
+
+        state.heap_cnt++;
+        timer_heap_set(state.heap_cnt - 1, timer);
+        timer_heap_sift_up(state.heap_cnt - 1);
+    }
+    else {
+        timer_heap_sift_up(timer->heap_idx);
+        timer_heap_sift_down(timer->heap_idx);
+    }
+}
+
+static void timer_due_sift_down(uint32_t idx, uint32_t cnt)
+{
+    lv_timer_t ** due = state.due;
+    lv_timer_t * timer = due[idx];
+    while(1) {
+        uint32_t child = idx * 2 + 1;
+        if(child >= cnt) break;
+        if(child + 1 < cnt && (int32_t)(due[child + 1]->create_id - due[child]->create_id) < 0) child++;
+        if((int32_t)(due[child]->create_id - timer->create_id) >= 0) break;
+        due[idx] = due[child];
+        idx = child;
+    }
+    due[idx] = timer;
+}
+
+/**
+ * Collect the due timers into `state.due` in the order of the timer list, i.e. the most recently
+ * created first. This way the due timers run in the same order as without the heap (e.g. the display
+ * refresh timer which updates the layout runs before the older animation timer).
+ * Only the expired part of the heap is visited as the children of a not expired timer are not expired either.
+ * @param seq_start `seq` at the start of `lv_timer_handler()`, to skip the timers created or run in this call
+ * @return          number of the collected timers
+ */
+static uint32_t timer_heap_collect_due(uint32_t seq_start)
+{
+    uint32_t now = lv_tick_get();
+    state.due_cnt = 0;
+    if(state.heap_cnt == 0 || !timer_heap_expired(state.heap[0], now)) return 0;
+    state.due[state.due_cnt++] = state.heap[0];
+
+    /*Breadth-first walk of the due subtree using the collected timers as the queue*/
+    uint32_t i;
+    for(i = 0; i < state.due_cnt; i++) {
+        uint32_t child = state.due[i]->heap_idx * 2 + 1;
+        uint32_t child_end = LV_MIN(child + 2, state.heap_cnt);
+        for(; child < child_end; child++) {
+            if(timer_heap_expired(state.heap[child], now)) state.due[state.due_cnt++] = state.heap[child];
+        }
+    }
+
+    /*Don't run timers again which were scheduled in this call (e.g. period = 0).
+     *The timers with a long period which isn't elapsed yet are just scheduled for the next step.*/
+    uint32_t cnt = 0;
+    for(i = 0; i < state.due_cnt; i++) {
+        lv_timer_t * timer = state.due[i];
+        if(lv_timer_time_remaining(timer) != 0) timer_heap_schedule(timer);
+        else if((int32_t)(timer->seq - seq_start) < 0) state.due[cnt++] = timer;
+    }
+
+    /*Heap sort to descending `create_id`: build a min-heap and move the minimum to the end repeatedly*/
+    if(cnt > 1) {
+        for(i = cnt / 2; i > 0; i--) timer_due_sift_down(i - 1, cnt);
+        for(i = cnt - 1; i > 0; i--) {
+            lv_timer_t * tmp = state.due[0];
+            state.due[0] = state.due[i];
+            state.due[i] = tmp;
+            timer_due_sift_down(0, i);
+        }
+    }
+
+    state.due_cnt = cnt;
+    return cnt;
+}
+
+/**
+ * Remove a timer from the heap. Nothing happens if it's not in the heap.
+ * @param timer     pointer to a timer
+ */
+static void timer_heap_remove(lv_timer_t * timer)
+{
+    uint32_t idx = timer->heap_idx;
+    if(idx == LV_TIMER_HEAP_IDX_NONE) return;
+
+    timer->heap_idx = LV_TIMER_HEAP_IDX_NONE;
+    state.heap_cnt--;
+    if(idx == state.heap_cnt) return;
+
+    /*Move the last timer to the place of the removed one*/
+    lv_timer_t * last = state.heap[state.heap_cnt];
+    timer_heap_set(idx, last);
+    timer_heap_sift_up(idx);
+    timer_heap_sift_down(last->heap_idx);
+}
+
+#endif /*LV_USE_TIMER_HEAP*/
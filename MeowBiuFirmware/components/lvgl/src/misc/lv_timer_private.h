@@ -20,6 +20,8 @@ extern "C" {
  *      DEFINES
  *********************/
 
+#define LV_TIMER_HEAP_IDX_NONE  UINT32_MAX
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,6 +37,12 @@ struct _lv_timer_t {
     int32_t repeat_count;      /**< 1: One time;  -1 : infinity;  n>0: residual times */
     uint32_t paused : 1;
     uint32_t auto_delete : 1;
+#if LV_USE_TIMER_HEAP
+    uint32_t expire;           /**< Tick when the timer should run next */
+    uint32_t seq;              /**< Updated when the timer is created or runs, to run it at most once per `lv_timer_handler()` */
+    uint32_t heap_idx;         /**< Index in the heap or `LV_TIMER_HEAP_IDX_NONE` if not scheduled (e.g. paused) */
+    uint32_t create_id;        /**< Creation order. The due timers run in the order of the timer list, newest first */
+#endif
 };
 
 typedef struct {
@@ -54,6 +62,17 @@ typedef struct {
 
     lv_timer_handler_resume_cb_t resume_cb;
     void * resume_data;
+
+#if LV_USE_TIMER_HEAP
+    lv_timer_t ** heap;        /**< Min-heap of the not paused timers sorted by `expire`*/
+    uint32_t heap_cnt;
+    uint32_t heap_size;
+    uint32_t seq;
+    uint32_t create_cnt;
+    lv_timer_t * timer_exec;   /**< The timer whose callback is running. Set to NULL if it's deleted*/
+    lv_timer_t ** due;         /**< The due timers to run in the current `lv_timer_handler()` call, `heap_size` long*/
+    uint32_t due_cnt;
+#endif
 } lv_timer_state_t;
 
 /**********************
@@ -161,6 +161,8 @@ typedef struct _lv_cache_t lv_cache_t;
 
 typedef struct _lv_cache_entry_t lv_cache_entry_t;
 
+typedef struct _lv_cache_stats_t lv_cache_stats_t;
+
 typedef struct _lv_fs_file_cache_t lv_fs_file_cache_t;
 
 typedef struct _lv_fs_path_ex_t lv_fs_path_ex_t;
@@ -185,6 +187,8 @@ typedef struct _lv_obj_style_t lv_obj_style_t;
 
 typedef struct _lv_obj_style_transition_dsc_t lv_obj_style_transition_dsc_t;
 
+typedef struct _lv_obj_style_resolved_t lv_obj_style_resolved_t;
+
 typedef struct _lv_hit_test_info_t lv_hit_test_info_t;
 
 typedef struct _lv_cover_check_info_t lv_cover_check_info_t;
@@ -38,6 +38,19 @@
 #endif
 #define state LV_GLOBAL_DEFAULT()->tlsf_state
 
+#if LV_MEM_SLAB
+    #define SLAB_SIZE_MAX   (LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP)
+    #if LV_MEM_SLAB_CLASS_STEP & ALIGN_MASK || LV_MEM_SLAB_PAGE_SIZE & ALIGN_MASK
+        #error "LV_MEM_SLAB_CLASS_STEP and LV_MEM_SLAB_PAGE_SIZE should be multiples of the pointer size"
+    #endif
+    #if SLAB_SIZE_MAX > LV_MEM_SLAB_PAGE_SIZE
+        #error "LV_MEM_SLAB_PAGE_SIZE should be at least LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP"
+    #endif
+    #if LV_MEM_SLAB_PAGE_CNT > INT16_MAX || LV_MEM_SLAB_PAGE_SIZE / LV_MEM_SLAB_CLASS_STEP > UINT16_MAX
+        #error "Too many slab pages or too many slots in a page"
+    #endif
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -46,6 +59,14 @@
  *  STATIC PROTOTYPES
  **********************/
 static void lv_mem_walker(void * ptr, size_t size, int used, void * user);
+#if LV_MEM_SLAB
+    static void slab_init(void);
+    static void * slab_alloc(size_t size);
+    static void slab_free(void * p);
+    static bool slab_contains(const void * p);
+    static void page_list_insert(int16_t * head, int32_t page_id);
+    static void page_list_remove(int16_t * head, int32_t page_id);
+#endif
 
 /**********************
  *  STATIC VARIABLES
@@ -86,6 +107,10 @@ void lv_mem_init(void)
     state.tlsf = lv_tlsf_create_with_pool((void *)LV_MEM_ADR, LV_MEM_SIZE);
 #endif
 
+#if LV_MEM_SLAB
+    slab_init();
+#endif
+
     lv_ll_init(&state.pool_ll, sizeof(lv_pool_t));
 
     /*Record the first pool*/
@@ -102,6 +127,9 @@ void lv_mem_deinit(void)
 {
     lv_ll_clear(&state.pool_ll);
     lv_tlsf_destroy(state.tlsf);
+#if LV_MEM_SLAB
+    state.slab_mem = NULL;
+#endif
 #if LV_USE_OS
     lv_mutex_delete(&state.mutex);
 #endif
@@ -141,11 +169,17 @@ void * lv_malloc_core(size_t size)
 #if LV_USE_OS
     lv_mutex_lock(&state.mutex);
 #endif
-    void * p = lv_tlsf_malloc(state.tlsf, size);
-
-    if(p) {
-        state.cur_used += lv_tlsf_block_size(p);
-        state.max_used = LV_MAX(state.cur_used, state.max_used);
+    void * p = NULL;
+#if LV_MEM_SLAB
+    if(size <= SLAB_SIZE_MAX) p = slab_alloc(size);
+    if(p == NULL)
+#endif
+    {
+        p = lv_tlsf_malloc(state.tlsf, size);
+        if(p) {
+            state.cur_used += lv_tlsf_block_size(p);
+            state.max_used = LV_MAX(state.cur_used, state.max_used);
+        }
     }
 
 #if LV_USE_OS
@@ -160,6 +194,33 @@ void * lv_realloc_core(void * p, size_t new_size)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_MEM_SLAB
+    if(slab_contains(p)) {
+        /*Keep the slot if the new size fits, else move to a larger class or to the heap*/
+        size_t slot_size = state.slab_mon[state.slab_pages[((uint8_t *)p - state.slab_mem) /
+                                                           LV_MEM_SLAB_PAGE_SIZE].class_id].slot_size;
+        void * p_new = p;
+        if(new_size > slot_size) {
+            p_new = new_size <= SLAB_SIZE_MAX ? slab_alloc(new_size) : NULL;
+            if(p_new == NULL) {
+                p_new = lv_tlsf_malloc(state.tlsf, new_size);
+                if(p_new) {
+                    state.cur_used += lv_tlsf_block_size(p_new);
+                    state.max_used = LV_MAX(state.cur_used, state.max_used);
+                }
+            }
+            if(p_new) {
+                lv_memcpy(p_new, p, slot_size);
+                slab_free(p);
+            }
+        }
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return p_new;
+    }
+#endif
+
     size_t old_size = lv_tlsf_block_size(p);
     void * p_new = lv_tlsf_realloc(state.tlsf, p, new_size);
 
@@ -181,6 +242,16 @@ void lv_free_core(void * p)
     lv_mutex_lock(&state.mutex);
 #endif
 
+#if LV_MEM_SLAB
+    if(slab_contains(p)) {
+        slab_free(p);
+#if LV_USE_OS
+        lv_mutex_unlock(&state.mutex);
+#endif
+        return;
+    }
+#endif
+
 #if LV_MEM_ADD_JUNK
     lv_memset(p, 0xbb, lv_tlsf_block_size(data));
 #endif
@@ -216,6 +287,20 @@ void lv_mem_monitor_core(lv_mem_monitor_t * mon_p)
 
     mon_p->max_used = state.max_used;
 
+#if LV_MEM_SLAB
+    /*The slots in use are allocations too*/
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        mon_p->slab[i] = state.slab_mon[i];
+        mon_p->used_cnt += state.slab_mon[i].used_cnt;
+    }
+
+    int32_t page_id;
+    for(page_id = state.slab_free_pages; page_id >= 0; page_id = state.slab_pages[page_id].next) {
+        mon_p->slab_free_page_cnt++;
+    }
+#endif
+
     LV_TRACE_MEM("finished");
 }
 
@@ -270,4 +355,121 @@ static void lv_mem_walker(void * ptr, size_t size, int used, void * user)
             mon_p->free_biggest_size = size;
     }
 }
+#if LV_MEM_SLAB
+
+static void slab_init(void)
+{
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        state.slab_class_pages[i] = -1;
+        lv_memzero(&state.slab_mon[i], sizeof(lv_mem_slab_monitor_t));
+        state.slab_mon[i].slot_size = (i + 1) * LV_MEM_SLAB_CLASS_STEP;
+    }
+
+    state.slab_free_pages = -1;
+    state.slab_mem = lv_tlsf_malloc(state.tlsf, LV_MEM_SLAB_PAGE_CNT * LV_MEM_SLAB_PAGE_SIZE);
+    if(state.slab_mem == NULL) {
+        LV_LOG_WARN("couldn't allocate the slab pages, using only the heap");
+        return;
+    }
+
+    state.cur_used += lv_tlsf_block_size(state.slab_mem);
+    state.max_used = LV_MAX(state.cur_used, state.max_used);
+
+    for(i = LV_MEM_SLAB_PAGE_CNT; i > 0; i--) {
+        page_list_insert(&state.slab_free_pages, i - 1);
+    }
+}
+
+static void * slab_alloc(size_t size)
+{
+    uint32_t class_id = (uint32_t)(size - 1) / LV_MEM_SLAB_CLASS_STEP;
+    lv_mem_slab_monitor_t * mon = &state.slab_mon[class_id];
+    int32_t page_id = state.slab_class_pages[class_id];
+
+    if(page_id < 0) {
+        /*Take an empty page and link its slots*/
+        page_id = state.slab_free_pages;
+        if(page_id < 0) {
+            mon->fallback_cnt++;
+            return NULL;
+        }
+
+        page_list_remove(&state.slab_free_pages, page_id);
+        page_list_insert(&state.slab_class_pages[class_id], page_id);
+        mon->page_cnt++;
+
+        lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+        page->class_id = (uint16_t)class_id;
+        page->used_cnt = 0;
+        page->free_slot = NULL;
+        uint8_t * page_mem = state.slab_mem + page_id * LV_MEM_SLAB_PAGE_SIZE;
+        uint32_t slot_cnt = LV_MEM_SLAB_PAGE_SIZE / mon->slot_size;
+        while(slot_cnt) {
+            slot_cnt--;
+            void ** slot = (void **)(page_mem + slot_cnt * mon->slot_size);
+            *slot = page->free_slot;
+            page->free_slot = slot;
+        }
+    }
+
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    void * p = page->free_slot;
+    page->free_slot = *(void **)p;
+    page->used_cnt++;
+    if(page->free_slot == NULL) page_list_remove(&state.slab_class_pages[class_id], page_id);
+
+    mon->used_cnt++;
+    mon->max_used_cnt = LV_MAX(mon->used_cnt, mon->max_used_cnt);
+    return p;
+}
+
+static void slab_free(void * p)
+{
+    int32_t page_id = ((uint8_t *)p - state.slab_mem) / LV_MEM_SLAB_PAGE_SIZE;
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    uint32_t class_id = page->class_id;
+
+    /*A full page has free slots again*/
+    if(page->free_slot == NULL) page_list_insert(&state.slab_class_pages[class_id], page_id);
+
+    *(void **)p = page->free_slot;
+    page->free_slot = p;
+    page->used_cnt--;
+    state.slab_mon[class_id].used_cnt--;
+
+    /*Give the empty page to the other classes, but keep the last one with free slots
+     *to not relink its slots when a single object is allocated and freed repeatedly*/
+    if(page->used_cnt == 0 && (page->prev >= 0 || page->next >= 0)) {
+        page_list_remove(&state.slab_class_pages[class_id], page_id);
+        page_list_insert(&state.slab_free_pages, page_id);
+        state.slab_mon[class_id].page_cnt--;
+    }
+}
+
+static bool slab_contains(const void * p)
+{
+    return state.slab_mem && (const uint8_t *)p >= state.slab_mem &&
+           (const uint8_t *)p < state.slab_mem + LV_MEM_SLAB_PAGE_CNT * LV_MEM_SLAB_PAGE_SIZE;
+}
+
+static void page_list_insert(int16_t * head, int32_t page_id)
+{
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    page->prev = -1;
+    page->next = *head;
+    if(*head >= 0) state.slab_pages[*head].prev = (int16_t)page_id;
+    *head = (int16_t)page_id;
+}
+
+static void page_list_remove(int16_t * head, int32_t page_id)
+{
+    lv_mem_slab_page_t * page = &state.slab_pages[page_id];
+    if(page->prev >= 0) state.slab_pages[page->prev].next = page->next;
+    else *head = page->next;
+    if(page->next >= 0) state.slab_pages[page->next].prev = page->prev;
+}
+
+#endif /*LV_MEM_SLAB*/
+
 #endif /*LV_STDLIB_BUILTIN*/
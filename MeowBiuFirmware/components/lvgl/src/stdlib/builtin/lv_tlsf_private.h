@@ -17,6 +17,7 @@ extern "C" {
  *********************/
 
 #include "lv_tlsf.h"
+#include "../lv_mem.h"
 #include "../../osal/lv_os.h"
 
 /*********************
@@ -27,6 +28,16 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_MEM_SLAB
+typedef struct {
+    void * free_slot;           /**< First free slot, the free slots are linked through their first word*/
+    uint16_t used_cnt;
+    uint16_t class_id;
+    int16_t prev;               /**< Neighbors in the list of the class or of the free pages, -1: none*/
+    int16_t next;
+} lv_mem_slab_page_t;
+#endif
+
 typedef struct {
 #if LV_USE_OS
     lv_mutex_t mutex;
@@ -35,6 +46,13 @@ typedef struct {
     size_t cur_used;
     size_t max_used;
     lv_ll_t  pool_ll;
+#if LV_MEM_SLAB
+    uint8_t * slab_mem;                                         /**< The pages, allocated at once*/
+    lv_mem_slab_page_t slab_pages[LV_MEM_SLAB_PAGE_CNT];
+    int16_t slab_class_pages[LV_MEM_SLAB_CLASS_CNT];            /**< The pages of the classes with free slots*/
+    int16_t slab_free_pages;                                    /**< The pages not used by any class*/
+    lv_mem_slab_monitor_t slab_mon[LV_MEM_SLAB_CLASS_CNT];
+#endif
 } lv_tlsf_state_t;
 
 /**********************
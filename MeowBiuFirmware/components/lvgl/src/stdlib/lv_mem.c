@@ -10,6 +10,7 @@
 #include "../misc/lv_assert.h"
 #include "../misc/lv_log.h"
 #include "../core/lv_global.h"
+#include "../stdlib/lv_sprintf.h"
 
 #if LV_USE_OS == LV_OS_PTHREAD
     #include <pthread.h>
@@ -25,13 +26,84 @@
 
 #define zero_mem LV_GLOBAL_DEFAULT()->memory_zero
 
+#if LV_USE_MEM_PROFILER
+    #define profiler LV_GLOBAL_DEFAULT()->mem_profiler
+
+    #define HEADER_MAGIC    0x4D50
+    #define OTHERS_ID       LV_MEM_PROFILER_ENTRY_CNT
+    #define TOTAL_ID        (LV_MEM_PROFILER_ENTRY_CNT + 1)
+    #define others_entry    profiler.entries[OTHERS_ID]
+    #define total_entry     profiler.entries[TOTAL_ID]
+    #define HASH_SIZE       (LV_MEM_PROFILER_ENTRY_CNT * 2)
+
+    #if LV_MEM_PROFILER_ENTRY_CNT >= 0xFFFF
+        #error "LV_MEM_PROFILER_ENTRY_CNT should be less than 65535"
+    #endif
+
+    #if defined(__GNUC__) || defined(__clang__)
+        #define CALLER  __builtin_return_address(0)
+    #endif
+
+    #define BIN_HEADER_SIZE 8
+    #define BIN_RECORD_SIZE 36
+
+    /*The tag is set by each thread for itself, e.g. the drawing threads decode images
+     *while the LVGL thread tags the rendering with `LV_MEM_TAG_DRAW`*/
+    #if LV_USE_OS == LV_OS_NONE
+        #define THREAD_LOCAL
+    #elif defined(__GNUC__) || defined(__clang__)
+        #define THREAD_LOCAL __thread
+    #elif defined(_MSC_VER)
+        #define THREAD_LOCAL __declspec(thread)
+    #elif defined(__STDC_VERSION__) && __STDC_VERSION__ >= 201112L
+        #define THREAD_LOCAL _Thread_local
+    #else
+        #warning "No thread-local storage: the allocations of concurrent threads may get each other's tags"
+        #define THREAD_LOCAL
+    #endif
+#endif
+
+#ifndef CALLER
+    #define CALLER  NULL
+#endif
+
 /**********************
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_MEM_PROFILER
+/*Stored before each allocation. Padded to the alignment of the largest fundamental types
+ *(as `max_align_t` in C11) so that the memory after it is aligned as `lv_malloc_core()`'s*/
+typedef union {
+    struct {
+        uint32_t size;
+        uint16_t entry_id;
+        uint16_t magic;
+    } info;
+    long double align_ld;
+    long long align_ll;
+    void * align_p;
+} profiler_header_t;
+#endif
+
 /**********************
  *  STATIC PROTOTYPES
  **********************/
+static void * malloc_zeroed(size_t size, const void * caller);
+static void * realloc_caller(void * data_p, size_t new_size, const void * caller);
+static void * alloc_core(size_t size, const void * caller);
+static void * realloc_core(void * p, size_t new_size, const void * caller);
+static void free_core(void * p);
+
+#if LV_USE_MEM_PROFILER
+    static uint32_t get_entry_id(lv_mem_tag_t tag, const void * caller);
+    static void entry_add(lv_mem_profiler_entry_t * e, size_t size);
+    static void lock(void);
+    static void unlock(void);
+    static const char * get_tag_name(uint32_t tag, char * buf, uint32_t buf_size);
+    static uint8_t * write_u32(uint8_t * p, uint32_t v);
+    static uint8_t * write_record(uint8_t * p, const lv_mem_profiler_entry_t * e, uint8_t flags);
+#endif
 
 /**********************
  *  GLOBAL PROTOTYPES
@@ -45,6 +117,9 @@ lv_result_t lv_mem_test_core(void);
 /**********************
  *  STATIC VARIABLES
  **********************/
+#if LV_USE_MEM_PROFILER
+    static THREAD_LOCAL lv_mem_tag_t thread_tag;
+#endif
 
 /**********************
  *      MACROS
@@ -67,7 +142,7 @@ void * lv_malloc(size_t size)
         return &zero_mem;
     }
 
-    void * alloc = lv_malloc_core(size);
+    void * alloc = alloc_core(size, CALLER);
 
     if(alloc == NULL) {
         LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
@@ -91,40 +166,18 @@ void * lv_malloc(size_t size)
 
 void * lv_malloc_zeroed(size_t size)
 {
-    LV_TRACE_MEM("allocating %lu bytes", (unsigned long)size);
-    if(size == 0) {
-        LV_TRACE_MEM("using zero_mem");
-        return &zero_mem;
-    }
-
-    void * alloc = lv_malloc_core(size);
-    if(alloc == NULL) {
-        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
-#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
-        lv_mem_monitor_t mon;
-        lv_mem_monitor(&mon);
-        LV_LOG_INFO("used: %zu (%3d %%), frag: %3d %%, biggest free: %zu",
-                    mon.total_size - mon.free_size, mon.used_pct, mon.frag_pct,
-                    mon.free_biggest_size);
-#endif
-        return NULL;
-    }
-
-    lv_memzero(alloc, size);
-
-    LV_TRACE_MEM("allocated at %p", alloc);
-    return alloc;
+    return malloc_zeroed(size, CALLER);
 }
 
 void * lv_calloc(size_t num, size_t size)
 {
     LV_TRACE_MEM("allocating number of %zu each %zu bytes", num, size);
-    return lv_malloc_zeroed(num * size);
+    return malloc_zeroed(num * size, CALLER);
 }
 
 void * lv_zalloc(size_t size)
 {
-    return lv_malloc_zeroed(size);
+    return malloc_zeroed(size, CALLER);
 }
 
 void lv_free(void * data)
@@ -133,12 +186,12 @@ void lv_free(void * data)
     if(data == &zero_mem) return;
     if(data == NULL) return;
 
-    lv_free_core(data);
+    free_core(data);
 }
 
 void * lv_reallocf(void * data_p, size_t new_size)
 {
-    void * new = lv_realloc(data_p, new_size);
+    void * new = realloc_caller(data_p, new_size, CALLER);
     if(!new) {
         lv_free(data_p);
     }
@@ -146,6 +199,228 @@ void * lv_reallocf(void * data_p, size_t new_size)
 }
 
 void * lv_realloc(void * data_p, size_t new_size)
+{
+    return realloc_caller(data_p, new_size, CALLER);
+}
+
+lv_result_t lv_mem_test(void)
+{
+    if(zero_mem != ZERO_MEM_SENTINEL) {
+        LV_LOG_WARN("zero_mem is written");
+        return LV_RESULT_INVALID;
+    }
+
+    return lv_mem_test_core();
+}
+
+void lv_mem_monitor(lv_mem_monitor_t * mon_p)
+{
+    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
+    lv_mem_monitor_core(mon_p);
+}
+
+#if LV_USE_MEM_PROFILER
+
+void lv_mem_profiler_init(void)
+{
+#if LV_USE_OS
+    lv_mutex_init(&profiler.mutex);
+#endif
+}
+
+void lv_mem_profiler_deinit(void)
+{
+#if LV_USE_OS
+    lv_mutex_delete(&profiler.mutex);
+#endif
+}
+
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag)
+{
+    lv_mem_tag_t prev = thread_tag;
+    thread_tag = tag;
+    return prev;
+}
+
+lv_mem_tag_t lv_mem_get_tag(void)
+{
+    return thread_tag;
+}
+
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_tag(lv_mem_tag_t tag)
+{
+    uint32_t i;
+    for(i = 0; i < profiler.entry_cnt; i++) {
+        if(profiler.entries[i].tag == tag && tag != LV_MEM_TAG_NONE) return &profiler.entries[i];
+    }
+
+    return NULL;
+}
+
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_total(void)
+{
+    return &total_entry;
+}
+
+uint32_t lv_mem_profiler_get_entry_count(void)
+{
+    return profiler.entry_cnt + (others_entry.alloc_cnt ? 1 : 0);
+}
+
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_entry(uint32_t idx)
+{
+    if(idx < profiler.entry_cnt) return &profiler.entries[idx];
+    if(idx == profiler.entry_cnt && others_entry.alloc_cnt) return &others_entry;
+    return NULL;
+}
+
+void lv_mem_profiler_reset_peak(void)
+{
+    lock();
+    uint32_t i;
+    for(i = 0; i <= TOTAL_ID; i++) {
+        lv_mem_profiler_entry_t * e = &profiler.entries[i];
+        e->peak_size = e->live_size;
+        e->frame_max_size = e->last_frame_peak_size;
+    }
+    unlock();
+}
+
+void lv_mem_profiler_frame_begin(void)
+{
+    lock();
+    uint32_t i;
+    for(i = 0; i <= TOTAL_ID; i++) {
+        lv_mem_profiler_entry_t * e = &profiler.entries[i];
+        e->frame_peak_size = e->live_size;
+    }
+    unlock();
+}
+
+void lv_mem_profiler_frame_end(void)
+{
+    lock();
+    uint32_t i;
+    for(i = 0; i <= TOTAL_ID; i++) {
+        lv_mem_profiler_entry_t * e = &profiler.entries[i];
+        e->last_frame_peak_size = e->frame_peak_size;
+        if(e->frame_max_size < e->frame_peak_size) e->frame_max_size = e->frame_peak_size;
+    }
+    unlock();
+}
+
+void lv_mem_profiler_dump(void (*flush_cb)(const char * buf))
+{
+    char line[128];
+    char name[24];
+
+    lv_snprintf(line, sizeof(line), "%-20s %10s %7s %10s %10s %10s %8s",
+                "tag/call site", "live", "blocks", "peak", "frame", "frame max", "allocs");
+    if(flush_cb) flush_cb(line);
+    else LV_LOG("%s\n", line);
+
+    /*Other threads can allocate meanwhile, so copy the entries under the lock and print them after it*/
+    lock();
+    uint32_t cnt = profiler.entry_cnt;
+    bool has_others = others_entry.alloc_cnt != 0;
+    unlock();
+
+    uint32_t i;
+    for(i = 0; i <= cnt + (has_others ? 1 : 0); i++) {
+        lv_mem_profiler_entry_t e;
+        const char * n;
+        lock();
+        if(i < cnt) e = profiler.entries[i];
+        else if(i == cnt && has_others) e = others_entry;
+        else e = total_entry;
+        unlock();
+
+        if(i < cnt) {
+            if(e.tag == LV_MEM_TAG_NONE) {
+                lv_snprintf(name, sizeof(name), "%p", e.caller);
+                n = name;
+            }
+            else n = get_tag_name(e.tag, name, sizeof(name));
+        }
+        else if(i == cnt && has_others) n = "others";
+        else n = "total";
+
+        lv_snprintf(line, sizeof(line), "%-20s %10zu %7" LV_PRIu32 " %10zu %10zu %10zu %8" LV_PRIu32,
+                    n, e.live_size, e.live_cnt, e.peak_size, e.last_frame_peak_size, e.frame_max_size,
+                    e.alloc_cnt);
+        if(flush_cb) flush_cb(line);
+        else LV_LOG("%s\n", line);
+    }
+}
+
+uint32_t lv_mem_profiler_dump_bin(void * buf, uint32_t buf_size)
+{
+    /*Nothing is allocated here, so the lock can be kept while writing*/
+    lock();
+    uint32_t cnt = lv_mem_profiler_get_entry_count();
+    uint32_t size = BIN_HEADER_SIZE + (cnt + 1) * BIN_RECORD_SIZE;
+    if(buf == NULL || buf_size < size) {
+        unlock();
+        return buf == NULL ? size : 0;
+    }
+
+    /*Little endian, see `scripts/mem_profiler_decode.py`*/
+    uint8_t * p = buf;
+    *p++ = 'L';
+    *p++ = 'V';
+    *p++ = 'M';
+    *p++ = 'P';
+    *p++ = 1;   /*Version*/
+    *p++ = (uint8_t)sizeof(void *);
+    *p++ = (uint8_t)(cnt & 0xFF);
+    *p++ = (uint8_t)(cnt >> 8);
+
+    p = write_record(p, &total_entry, 0x04);
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_entry(i);
+        uint8_t flags = e == &others_entry ? 0x02 : (e->tag == LV_MEM_TAG_NONE ? 0x01 : 0x00);
+        p = write_record(p, e, flags);
+    }
+    unlock();
+
+    return size;
+}
+
+#endif /*LV_USE_MEM_PROFILER*/
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void * malloc_zeroed(size_t size, const void * caller)
+{
+    LV_TRACE_MEM("allocating %lu bytes", (unsigned long)size);
+    if(size == 0) {
+        LV_TRACE_MEM("using zero_mem");
+        return &zero_mem;
+    }
+
+    void * alloc = alloc_core(size, caller);
+    if(alloc == NULL) {
+        LV_LOG_INFO("couldn't allocate memory (%lu bytes)", (unsigned long)size);
+#if LV_LOG_LEVEL <= LV_LOG_LEVEL_INFO
+        lv_mem_monitor_t mon;
+        lv_mem_monitor(&mon);
+        LV_LOG_INFO("used: %zu (%3d %%), frag: %3d %%, biggest free: %zu",
+                    mon.total_size - mon.free_size, mon.used_pct, mon.frag_pct,
+                    mon.free_biggest_size);
+#endif
+        return NULL;
+    }
+
+    lv_memzero(alloc, size);
+
+    LV_TRACE_MEM("allocated at %p", alloc);
+    return alloc;
+}
+
+static void * realloc_caller(void * data_p, size_t new_size, const void * caller)
 {
     LV_TRACE_MEM("reallocating %p with %lu size", data_p, (unsigned long)new_size);
     if(new_size == 0) {
@@ -154,9 +429,9 @@ void * lv_realloc(void * data_p, size_t new_size)
         return &zero_mem;
     }
 
-    if(data_p == &zero_mem) return lv_malloc(new_size);
+    if(data_p == &zero_mem) data_p = NULL;
 
-    void * new_p = lv_realloc_core(data_p, new_size);
+    void * new_p = realloc_core(data_p, new_size, caller);
 
     if(new_p == NULL) {
         LV_LOG_ERROR("couldn't reallocate memory");
@@ -167,22 +442,174 @@ void * lv_realloc(void * data_p, size_t new_size)
     return new_p;
 }
 
-lv_result_t lv_mem_test(void)
+#if LV_USE_MEM_PROFILER == 0
+
+static void * alloc_core(size_t size, const void * caller)
 {
-    if(zero_mem != ZERO_MEM_SENTINEL) {
-        LV_LOG_WARN("zero_mem is written");
-        return LV_RESULT_INVALID;
+    LV_UNUSED(caller);
+    return lv_malloc_core(size);
+}
+
+static void * realloc_core(void * p, size_t new_size, const void * caller)
+{
+    LV_UNUSED(caller);
+    if(p == NULL) return lv_malloc_core(new_size);
+    return lv_realloc_core(p, new_size);
+}
+
+static void free_core(void * p)
+{
+    lv_free_core(p);
+}
+
+#else
+
+static void * alloc_core(size_t size, const void * caller)
+{
+    if(size > UINT32_MAX - sizeof(profiler_header_t)) return NULL;
+
+    profiler_header_t * h = lv_malloc_core(size + sizeof(profiler_header_t));
+    if(h == NULL) return NULL;
+
+    lock();
+    h->info.size = (uint32_t)size;
+    h->info.entry_id = (uint16_t)get_entry_id(thread_tag, caller);
+    h->info.magic = HEADER_MAGIC;
+
+    lv_mem_profiler_entry_t * e = &profiler.entries[h->info.entry_id];
+    e->live_cnt++;
+    e->alloc_cnt++;
+    entry_add(e, size);
+    total_entry.live_cnt++;
+    total_entry.alloc_cnt++;
+    entry_add(&total_entry, size);
+    unlock();
+
+    return h + 1;
+}
+
+static void * realloc_core(void * p, size_t new_size, const void * caller)
+{
+    if(p == NULL) return alloc_core(new_size, caller);
+    if(new_size > UINT32_MAX - sizeof(profiler_header_t)) return NULL;
+
+    profiler_header_t * h = (profiler_header_t *)p - 1;
+    LV_ASSERT_MSG(h->info.magic == HEADER_MAGIC, "Not allocated by lv_malloc");
+    uint32_t old_size = h->info.size;
+
+    h = lv_realloc_core(h, new_size + sizeof(profiler_header_t));
+    if(h == NULL) return NULL;
+
+    /*Keep counting the memory where it was first allocated*/
+    lock();
+    h->info.size = (uint32_t)new_size;
+    lv_mem_profiler_entry_t * e = &profiler.entries[h->info.entry_id];
+    e->live_size -= old_size;
+    entry_add(e, new_size);
+    total_entry.live_size -= old_size;
+    entry_add(&total_entry, new_size);
+    unlock();
+
+    return h + 1;
+}
+
+static void free_core(void * p)
+{
+    profiler_header_t * h = (profiler_header_t *)p - 1;
+    LV_ASSERT_MSG(h->info.magic == HEADER_MAGIC, "Not allocated by lv_malloc");
+
+    lock();
+    lv_mem_profiler_entry_t * e = &profiler.entries[h->info.entry_id];
+    e->live_cnt--;
+    e->live_size -= h->info.size;
+    total_entry.live_cnt--;
+    total_entry.live_size -= h->info.size;
+    unlock();
+
+    h->info.magic = 0;
+    lv_free_core(h);
+}
+
+static uint32_t get_entry_id(lv_mem_tag_t tag, const void * caller)
+{
+    if(tag != LV_MEM_TAG_NONE) caller = NULL;
+    uintptr_t key = caller ? (uintptr_t)caller : (uintptr_t)tag;
+    uint32_t h = (uint32_t)((key * 2654435761u) % HASH_SIZE);
+
+    while(profiler.hash[h]) {
+        uint32_t id = profiler.hash[h] - 1;
+        if(profiler.entries[id].tag == tag && profiler.entries[id].caller == caller) return id;
+        h = h + 1 < HASH_SIZE ? h + 1 : 0;
     }
 
-    return lv_mem_test_core();
+    /*There is always an empty slot as the hash table is larger than the entries*/
+    if(profiler.entry_cnt >= LV_MEM_PROFILER_ENTRY_CNT) return OTHERS_ID;
+    /*Keep the other half for the tags*/
+    if(tag == LV_MEM_TAG_NONE && profiler.call_site_cnt >= LV_MEM_PROFILER_ENTRY_CNT / 2) return OTHERS_ID;
+    if(tag == LV_MEM_TAG_NONE) profiler.call_site_cnt++;
+
+    uint32_t id = profiler.entry_cnt++;
+    profiler.entries[id].tag = (uint8_t)tag;
+    profiler.entries[id].caller = caller;
+    profiler.hash[h] = (uint16_t)(id + 1);
+    return id;
 }
 
-void lv_mem_monitor(lv_mem_monitor_t * mon_p)
+static void entry_add(lv_mem_profiler_entry_t * e, size_t size)
 {
-    lv_memzero(mon_p, sizeof(lv_mem_monitor_t));
-    lv_mem_monitor_core(mon_p);
+    e->live_size += size;
+    if(e->peak_size < e->live_size) e->peak_size = e->live_size;
+    if(e->frame_peak_size < e->live_size) e->frame_peak_size = e->live_size;
 }
 
-/**********************
- *   STATIC FUNCTIONS
- **********************/
+static void lock(void)
+{
+#if LV_USE_OS
+    lv_mutex_lock(&profiler.mutex);
+#endif
+}
+
+static void unlock(void)
+{
+#if LV_USE_OS
+    lv_mutex_unlock(&profiler.mutex);
+#endif
+}
+
+static const char * get_tag_name(uint32_t tag, char * buf, uint32_t buf_size)
+{
+    static const char * const names[] = {"none", "obj", "style", "draw", "image", "font", "gif"};
+    if(tag < LV_MEM_TAG_USER) return names[tag];
+
+    lv_snprintf(buf, buf_size, "user+%" LV_PRIu32, tag - LV_MEM_TAG_USER);
+    return buf;
+}
+
+static uint8_t * write_u32(uint8_t * p, uint32_t v)
+{
+    p[0] = (uint8_t)v;
+    p[1] = (uint8_t)(v >> 8);
+    p[2] = (uint8_t)(v >> 16);
+    p[3] = (uint8_t)(v >> 24);
+    return p + 4;
+}
+
+static uint8_t * write_record(uint8_t * p, const lv_mem_profiler_entry_t * e, uint8_t flags)
+{
+    *p++ = e->tag;
+    *p++ = flags;
+    *p++ = 0;
+    *p++ = 0;
+    p = write_u32(p, e->live_cnt);
+    p = write_u32(p, e->alloc_cnt);
+    p = write_u32(p, (uint32_t)LV_MIN(e->live_size, UINT32_MAX));
+    p = write_u32(p, (uint32_t)LV_MIN(e->peak_size, UINT32_MAX));
+    p = write_u32(p, (uint32_t)LV_MIN(e->last_frame_peak_size, UINT32_MAX));
+    p = write_u32(p, (uint32_t)LV_MIN(e->frame_max_size, UINT32_MAX));
+    uint64_t caller = (uintptr_t)e->caller;
+    p = write_u32(p, (uint32_t)caller);
+    p = write_u32(p, (uint32_t)(caller >> 32));
+    return p;
+}
+
+#endif /*LV_USE_MEM_PROFILER*/
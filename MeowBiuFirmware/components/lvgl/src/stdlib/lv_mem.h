@@ -29,6 +29,55 @@ extern "C" {
 
 typedef void * lv_mem_pool_t;
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB
+/**
+ * Information about a slab size class.
+ */
+typedef struct {
+    uint32_t slot_size;     /**< Size of the slots of the class */
+    uint32_t page_cnt;      /**< Number of pages used by the class */
+    uint32_t used_cnt;      /**< Number of slots in use */
+    uint32_t max_used_cnt;  /**< Max number of slots used at once */
+    uint32_t fallback_cnt;  /**< Number of allocations served by the heap as no slot was free */
+} lv_mem_slab_monitor_t;
+#endif
+#endif
+
+/**
+ * Subsystems the allocations can be attributed to by the memory profiler.
+ * The application can use further tags up to 255 from `LV_MEM_TAG_USER`.
+ */
+typedef enum {
+    LV_MEM_TAG_NONE = 0,    /**< Not tagged, counted per call site of `lv_malloc()` */
+    LV_MEM_TAG_OBJ,         /**< Widgets and what their constructors allocate */
+    LV_MEM_TAG_STYLE,       /**< Style properties and the style lists of widgets */
+    LV_MEM_TAG_DRAW,        /**< Draw tasks and layers allocated while rendering */
+    LV_MEM_TAG_IMAGE,       /**< Decoded images and image cache entries */
+    LV_MEM_TAG_FONT,        /**< Fonts loaded at run time */
+    LV_MEM_TAG_GIF,         /**< GIF decoders and their canvases */
+    LV_MEM_TAG_USER,        /**< First tag for the application */
+} lv_mem_tag_t;
+
+#if LV_USE_MEM_PROFILER
+/**
+ * Memory allocated with a tag or, if not tagged, from a call site.
+ * Untagged allocations from more call sites than fit in the table are counted
+ * in one entry with `LV_MEM_TAG_NONE` and a `NULL` caller.
+ */
+typedef struct {
+    const void * caller;        /**< Return address to the caller of `lv_malloc()` if not tagged */
+    size_t live_size;           /**< Size of the allocated blocks */
+    size_t peak_size;           /**< Max of `live_size` since the start or the last reset */
+    size_t frame_peak_size;     /**< Max of `live_size` in the frame being rendered */
+    size_t last_frame_peak_size;/**< Max of `live_size` in the last rendered frame */
+    size_t frame_max_size;      /**< Max of `last_frame_peak_size` since the start or the last reset */
+    uint32_t live_cnt;          /**< Number of allocated blocks */
+    uint32_t alloc_cnt;         /**< Number of allocations since the start */
+    uint8_t tag;                /**< An `lv_mem_tag_t` */
+} lv_mem_profiler_entry_t;
+#endif
+
 /**
  * Heap information structure.
  */
@@ -41,6 +90,12 @@ typedef struct {
     size_t max_used;    /**< Max size of Heap memory used */
     uint8_t used_pct;   /**< Percentage used */
     uint8_t frag_pct;   /**< Amount of fragmentation */
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB
+    uint32_t slab_free_page_cnt;                        /**< Number of slab pages not used by any class */
+    lv_mem_slab_monitor_t slab[LV_MEM_SLAB_CLASS_CNT];  /**< Information per slab size class */
+#endif
+#endif
 } lv_mem_monitor_t;
 
 /**********************
@@ -155,10 +210,93 @@ lv_result_t lv_mem_test(void);
  */
 void lv_mem_monitor(lv_mem_monitor_t * mon_p);
 
+#if LV_USE_MEM_PROFILER
+
+/**
+ * Set the tag of the allocations made from now on by the calling thread.
+ * The other threads, e.g. the drawing threads, keep their own tag.
+ * @param tag   an `lv_mem_tag_t`
+ * @return      the previous tag, to restore it when done
+ */
+lv_mem_tag_t lv_mem_set_tag(lv_mem_tag_t tag);
+
+/**
+ * Get the tag of the next allocations of the calling thread
+ * @return      an `lv_mem_tag_t`
+ */
+lv_mem_tag_t lv_mem_get_tag(void);
+
+/**
+ * Get the counters of a tag
+ * @param tag   an `lv_mem_tag_t`
+ * @return      pointer to the counters or `NULL` if nothing was allocated with the tag
+ */
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_tag(lv_mem_tag_t tag);
+
+/**
+ * Get the counters of all allocations
+ * @return      pointer to the counters, `tag` and `caller` are not used
+ */
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_total(void);
+
+/**
+ * Get the number of tags and call sites that allocated memory
+ * @return      number of entries
+ */
+uint32_t lv_mem_profiler_get_entry_count(void);
+
+/**
+ * Get the counters of a tag or call site
+ * @param idx   0 ... `lv_mem_profiler_get_entry_count() - 1`
+ * @return      pointer to the counters or `NULL` if `idx` is out of range
+ */
+const lv_mem_profiler_entry_t * lv_mem_profiler_get_entry(uint32_t idx);
+
+/**
+ * Reset the peak counters to the current allocations
+ */
+void lv_mem_profiler_reset_peak(void);
+
+/**
+ * Start measuring the high-water mark of a frame. Called by the display refresh.
+ */
+void lv_mem_profiler_frame_begin(void);
+
+/**
+ * Finish measuring the high-water mark of a frame. Called by the display refresh.
+ */
+void lv_mem_profiler_frame_end(void);
+
+/**
+ * Print the counters as a table, one line per call of `flush_cb`
+ * @param flush_cb  print a line of text, `NULL` to use `LV_LOG`
+ */
+void lv_mem_profiler_dump(void (*flush_cb)(const char * buf));
+
+/**
+ * Write the counters in a compact binary format to be decoded on the host by
+ * `scripts/mem_profiler_decode.py`
+ * @param buf       buffer to write to, can be `NULL` to only get the size
+ * @param buf_size  size of `buf`
+ * @return          size of the data in bytes, or 0 if `buf` is too small
+ */
+uint32_t lv_mem_profiler_dump_bin(void * buf, uint32_t buf_size);
+
+#endif /*LV_USE_MEM_PROFILER*/
+
 /**********************
  *      MACROS
  **********************/
 
+#if LV_USE_MEM_PROFILER
+/*Tag the allocations until `LV_MEM_TAG_END` in the same block*/
+#define LV_MEM_TAG_BEGIN(tag)   lv_mem_tag_t lv_mem_prev_tag = lv_mem_set_tag(tag)
+#define LV_MEM_TAG_END          lv_mem_set_tag(lv_mem_prev_tag)
+#else
+#define LV_MEM_TAG_BEGIN(tag)
+#define LV_MEM_TAG_END
+#endif
+
 #ifdef __cplusplus
 } /*extern "C"*/
 #endif
@@ -15,6 +15,7 @@ extern "C" {
  *********************/
 
 #include "lv_mem.h"
+#include "../osal/lv_os.h"
 
 /*********************
  *      DEFINES
@@ -24,10 +25,35 @@ extern "C" {
  *      TYPEDEFS
  **********************/
 
+#if LV_USE_MEM_PROFILER
+typedef struct {
+    /*The tags and call sites, then the call sites which didn't fit and the total*/
+    lv_mem_profiler_entry_t entries[LV_MEM_PROFILER_ENTRY_CNT + 2];
+    uint16_t hash[LV_MEM_PROFILER_ENTRY_CNT * 2];   /**< Index + 1 of the entries by their key*/
+    uint32_t entry_cnt;
+    uint32_t call_site_cnt;
+#if LV_USE_OS
+    lv_mutex_t mutex;
+#endif
+} lv_mem_profiler_state_t;
+#endif
+
 /**********************
  * GLOBAL PROTOTYPES
  **********************/
 
+#if LV_USE_MEM_PROFILER
+/**
+ * Initialize the memory profiler. Called by `lv_init()`.
+ */
+void lv_mem_profiler_init(void);
+
+/**
+ * Deinitialize the memory profiler. Called by `lv_deinit()`.
+ */
+void lv_mem_profiler_deinit(void);
+#endif
+
 /**********************
  *      MACROS
  **********************/
@@ -0,0 +1,625 @@
+/**
+ * @file lv_face.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_face_private.h"
+#include "../../core/lv_obj_class_private.h"
+
+#if LV_USE_FACE
+
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_area_private.h"
+#include "../../misc/lv_math.h"
+#include "../../draw/lv_draw.h"
+#include "../../stdlib/lv_string.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_face_class)
+
+/*The shapes are evaluated on 8 sub-scanlines per pixel row and with 1/16 px horizontal precision*/
+#define SUB_SHIFT   3
+#define SUB_CNT     (1 << SUB_SHIFT)
+#define COV_SHIFT   (SUB_SHIFT + 4)
+#define COV_MAX     (1 << COV_SHIFT)
+
+#define SPAN_MAX    4
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*All coordinates are absolute and in 1/16 px. The pixel `x` covers [16 * x, 16 * x + 16)*/
+
+typedef struct {
+    int32_t cx;
+    int32_t cy;
+    int32_t a;              /*Horizontal radius*/
+    int32_t b;              /*Vertical radius*/
+    int32_t lid_y;          /*Upper lid: lid_y + lid_h * u^2 + lid_tilt * u where u = (x - cx) / a*/
+    int32_t lid_h;
+    int32_t lid_tilt;
+    int32_t low_y;          /*Lower lid: low_y - low_h * u^2*/
+    int32_t low_h;
+    int32_t pupil_x;
+    int32_t pupil_y;
+    int32_t pupil_r;
+} eye_t;
+
+typedef struct {
+    int32_t cx;
+    int32_t y;              /*Center line: y - curve * u^2 where u = (x - cx) / hw*/
+    int32_t hw;
+    int32_t curve;
+    int32_t t;              /*Half thickness*/
+} mouth_t;
+
+typedef struct {
+    eye_t eyes[2];
+    mouth_t mouth;
+} face_geometry_t;
+
+/*A horizontal run of a shape on a sub-scanline. `ch` 0 is drawn first, `ch` 1 on it*/
+typedef struct {
+    int32_t l;
+    int32_t r;              /*Exclusive*/
+    int32_t ch;
+} span_t;
+
+typedef uint32_t (*get_spans_cb_t)(const void * shape, int32_t y, span_t * spans);
+
+typedef struct {
+    lv_color_t bg;
+    lv_color_t colors[2];
+    lv_opa_t opa;
+    bool opaque;            /*Compose the shapes with `bg` to RGB565 instead of drawing them with alpha*/
+} draw_ctx_t;
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_face_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void lv_face_event(const lv_obj_class_t * class_p, lv_event_t * e);
+static void draw_main(lv_event_t * e);
+static void draw_shape(lv_layer_t * layer, const lv_area_t * area, get_spans_cb_t spans_cb, const void * shape,
+                       const draw_ctx_t * ctx);
+static void get_geometry(lv_obj_t * obj, const lv_face_params_t * params, face_geometry_t * geo);
+static bool get_eye_area(const eye_t * eye, lv_area_t * area);
+static bool get_pupil_area(const eye_t * eye, lv_area_t * area);
+static bool get_mouth_area(const mouth_t * mouth, lv_area_t * area);
+static uint32_t get_eye_spans(const void * shape, int32_t y, span_t * spans);
+static uint32_t get_mouth_spans(const void * shape, int32_t y, span_t * spans);
+static bool get_ellipse_span(int32_t cx, int32_t cy, int32_t a, int32_t b, int32_t y, int32_t * l, int32_t * r);
+static void invalidate_areas(lv_obj_t * obj, bool old_en, const lv_area_t * old_area, bool new_en,
+                             const lv_area_t * new_area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+const lv_obj_class_t lv_face_class  = {
+    .base_class = &lv_obj_class,
+    .constructor_cb = lv_face_constructor,
+    .event_cb = lv_face_event,
+    .width_def = LV_PCT(100),
+    .height_def = LV_PCT(100),
+    .instance_size = sizeof(lv_face_t),
+    .name = "lv_face",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_face_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void lv_face_set_params(lv_obj_t * obj, const lv_face_params_t * params)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    LV_ASSERT_NULL(params);
+    lv_face_t * face = (lv_face_t *)obj;
+    const lv_face_params_t * old = &face->params;
+
+    bool gaze_changed = old->gaze_x != params->gaze_x || old->gaze_y != params->gaze_y;
+    bool lids_changed = old->openness != params->openness || old->squint != params->squint ||
+                        old->mood != params->mood;
+    bool mouth_changed = old->mood != params->mood;
+    if(!gaze_changed && !lids_changed) return;
+
+    /*Invalidate only what has changed: the old and new pupils if only the gaze changed and
+     *the old and new visible part of the eyes if the lids moved too. The old and new areas of a
+     *shape overlap in most of the frames of an animation, so invalidate their union once.*/
+    face_geometry_t old_geo;
+    face_geometry_t new_geo;
+    get_geometry(obj, old, &old_geo);
+    get_geometry(obj, params, &new_geo);
+
+    lv_area_t old_area;
+    lv_area_t new_area;
+    bool old_en;
+    bool new_en;
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        if(lids_changed) {
+            old_en = get_eye_area(&old_geo.eyes[i], &old_area);
+            new_en = get_eye_area(&new_geo.eyes[i], &new_area);
+        }
+        else {
+            old_en = get_pupil_area(&old_geo.eyes[i], &old_area);
+            new_en = get_pupil_area(&new_geo.eyes[i], &new_area);
+        }
+        invalidate_areas(obj, old_en, &old_area, new_en, &new_area);
+    }
+
+    if(mouth_changed) {
+        old_en = get_mouth_area(&old_geo.mouth, &old_area);
+        new_en = get_mouth_area(&new_geo.mouth, &new_area);
+        invalidate_areas(obj, old_en, &old_area, new_en, &new_area);
+    }
+
+    face->params = *params;
+}
+
+void lv_face_set_gaze(lv_obj_t * obj, int32_t x, int32_t y)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_params_t params = ((lv_face_t *)obj)->params;
+    params.gaze_x = (int8_t)LV_CLAMP(-127, x, 127);
+    params.gaze_y = (int8_t)LV_CLAMP(-127, y, 127);
+    lv_face_set_params(obj, &params);
+}
+
+void lv_face_set_gaze_x(lv_obj_t * obj, int32_t x)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_set_gaze(obj, x, ((lv_face_t *)obj)->params.gaze_y);
+}
+
+void lv_face_set_gaze_y(lv_obj_t * obj, int32_t y)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_set_gaze(obj, ((lv_face_t *)obj)->params.gaze_x, y);
+}
+
+void lv_face_set_openness(lv_obj_t * obj, int32_t openness)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_params_t params = ((lv_face_t *)obj)->params;
+    params.openness = (uint8_t)LV_CLAMP(0, openness, 255);
+    lv_face_set_params(obj, &params);
+}
+
+void lv_face_set_squint(lv_obj_t * obj, int32_t squint)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_params_t params = ((lv_face_t *)obj)->params;
+    params.squint = (uint8_t)LV_CLAMP(0, squint, 255);
+    lv_face_set_params(obj, &params);
+}
+
+void lv_face_set_mood(lv_obj_t * obj, int32_t mood)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_face_params_t params = ((lv_face_t *)obj)->params;
+    params.mood = (int8_t)LV_CLAMP(-127, mood, 127);
+    lv_face_set_params(obj, &params);
+}
+
+const lv_face_params_t * lv_face_get_params(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    return &((lv_face_t *)obj)->params;
+}
+
+void lv_face_params_mix(lv_face_params_t * res, const lv_face_params_t * a, const lv_face_params_t * b, int32_t mix)
+{
+    mix = LV_CLAMP(0, mix, LV_FACE_MIX_MAX);
+
+    /*`res` can be `a` or `b` too*/
+    lv_face_params_t p;
+    p.gaze_x = (int8_t)(a->gaze_x + (b->gaze_x - a->gaze_x) * mix / LV_FACE_MIX_MAX);
+    p.gaze_y = (int8_t)(a->gaze_y + (b->gaze_y - a->gaze_y) * mix / LV_FACE_MIX_MAX);
+    p.openness = (uint8_t)(a->openness + (b->openness - a->openness) * mix / LV_FACE_MIX_MAX);
+    p.squint = (uint8_t)(a->squint + (b->squint - a->squint) * mix / LV_FACE_MIX_MAX);
+    p.mood = (int8_t)(a->mood + (b->mood - a->mood) * mix / LV_FACE_MIX_MAX);
+    *res = p;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_face_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_face_t * face = (lv_face_t *)obj;
+    lv_memzero(&face->params, sizeof(face->params));
+    face->params.openness = 255;
+
+    lv_obj_remove_flag(obj, LV_OBJ_FLAG_SCROLLABLE);
+    lv_obj_set_style_bg_color(obj, lv_color_black(), LV_PART_MAIN);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_COVER, LV_PART_MAIN);
+    lv_obj_set_style_line_color(obj, lv_color_white(), LV_PART_MAIN);
+    lv_obj_set_style_line_width(obj, 6, LV_PART_MAIN);
+    lv_obj_set_style_bg_color(obj, lv_color_white(), LV_PART_ITEMS);
+    lv_obj_set_style_bg_color(obj, lv_color_black(), LV_PART_INDICATOR);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void lv_face_event(const lv_obj_class_t * class_p, lv_event_t * e)
+{
+    LV_UNUSED(class_p);
+
+    /*Call the ancestor's event handler*/
+    lv_result_t res = lv_obj_event_base(MY_CLASS, e);
+    if(res != LV_RESULT_OK) return;
+
+    if(lv_event_get_code(e) == LV_EVENT_DRAW_MAIN) {
+        draw_main(e);
+    }
+}
+
+static void draw_main(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_current_target(e);
+    lv_face_t * face = (lv_face_t *)obj;
+    lv_layer_t * layer = lv_event_get_layer(e);
+
+    face_geometry_t geo;
+    get_geometry(obj, &face->params, &geo);
+
+    /*On a plain opaque background the anti-aliased edges can be mixed with the background
+     *right away, so the shapes are only copied to the strip*/
+    draw_ctx_t ctx;
+    ctx.bg = lv_obj_get_style_bg_color(obj, LV_PART_MAIN);
+    ctx.opa = lv_obj_get_style_opa_recursive(obj, LV_PART_MAIN);
+    ctx.opaque = layer->color_format == LV_COLOR_FORMAT_RGB565 &&
+                 lv_obj_get_style_bg_opa(obj, LV_PART_MAIN) >= LV_OPA_MAX &&
+                 lv_obj_get_style_bg_grad_dir(obj, LV_PART_MAIN) == LV_GRAD_DIR_NONE &&
+                 lv_obj_get_style_bg_image_src(obj, LV_PART_MAIN) == NULL;
+
+    lv_area_t area;
+    uint32_t i;
+    ctx.colors[0] = lv_obj_get_style_bg_color(obj, LV_PART_ITEMS);
+    ctx.colors[1] = lv_obj_get_style_bg_color(obj, LV_PART_INDICATOR);
+    for(i = 0; i < 2; i++) {
+        if(get_eye_area(&geo.eyes[i], &area) && lv_area_intersect(&area, &area, &layer->_clip_area)) {
+            draw_shape(layer, &area, get_eye_spans, &geo.eyes[i], &ctx);
+        }
+    }
+
+    ctx.colors[0] = lv_obj_get_style_line_color(obj, LV_PART_MAIN);
+    ctx.colors[1] = ctx.colors[0];
+    if(get_mouth_area(&geo.mouth, &area) && lv_area_intersect(&area, &area, &layer->_clip_area)) {
+        draw_shape(layer, &area, get_mouth_spans, &geo.mouth, &ctx);
+    }
+}
+
+static void add_span(int16_t * diff, int32_t l, int32_t r, int32_t w)
+{
+    l = LV_MAX(l, 0);
+    r = LV_MIN(r, w * 16);
+    if(l >= r) return;
+
+    /*Partial coverage of the first and last pixels and full coverage between them*/
+    int32_t il = l >> 4;
+    int32_t ir = r >> 4;
+    diff[il] += (int16_t)(16 - (l & 0xf));
+    diff[il + 1] += (int16_t)(l & 0xf);
+    diff[ir] -= (int16_t)(16 - (r & 0xf));
+    diff[ir + 1] -= (int16_t)(r & 0xf);
+}
+
+/*Compute the coverage of the shape in `area` and draw it with a layer*/
+static void draw_shape(lv_layer_t * layer, const lv_area_t * area, get_spans_cb_t spans_cb, const void * shape,
+                       const draw_ctx_t * ctx)
+{
+    lv_color_format_t cf = ctx->opaque ? LV_COLOR_FORMAT_RGB565 : LV_COLOR_FORMAT_ARGB8888;
+    lv_layer_t * shape_layer = lv_draw_layer_create(layer, cf, area);
+    if(shape_layer == NULL) return;
+
+    int32_t w = lv_area_get_width(area);
+    int16_t * diff = lv_malloc(2 * (w + 2) * sizeof(int16_t));
+    LV_ASSERT_MALLOC(diff);
+
+    if(diff && lv_draw_layer_alloc_buf(shape_layer)) {
+        int16_t * diff1 = diff + w + 2;
+        uint16_t bg16 = lv_color_to_u16(ctx->bg);
+        uint16_t fg16[2] = {lv_color_to_u16(ctx->colors[0]), lv_color_to_u16(ctx->colors[1])};
+        span_t spans[SPAN_MAX];
+        int32_t x;
+        int32_t y;
+        for(y = area->y1; y <= area->y2; y++) {
+            lv_memzero(diff, 2 * (w + 2) * sizeof(int16_t));
+            int32_t s;
+            for(s = 0; s < SUB_CNT; s++) {
+                uint32_t cnt = spans_cb(shape, y * 16 + (s * 16 + 8) / SUB_CNT, spans);
+                uint32_t i;
+                for(i = 0; i < cnt; i++) {
+                    add_span(spans[i].ch ? diff1 : diff, spans[i].l - area->x1 * 16, spans[i].r - area->x1 * 16, w);
+                }
+            }
+
+            int32_t cov0 = 0;
+            int32_t cov1 = 0;
+            void * row = lv_draw_layer_go_to_xy(shape_layer, 0, y - area->y1);
+            if(ctx->opaque) {
+                uint16_t * px = row;
+                for(x = 0; x < w; x++) {
+                    cov0 += diff[x];
+                    cov1 += diff1[x];
+                    if(cov0 == 0) px[x] = bg16;
+                    else if(cov1 >= COV_MAX) px[x] = fg16[1];
+                    else if(cov0 >= COV_MAX && cov1 == 0) px[x] = fg16[0];
+                    else {
+                        /*`ch` 1 is inside `ch` 0 so it covers the part of the pixel covered by `ch` 0 only*/
+                        lv_color_t c = ctx->colors[0];
+                        if(cov1) c = lv_color_mix(ctx->colors[1], c, (lv_opa_t)LV_MIN(cov1 * 255 / cov0, 255));
+                        px[x] = lv_color_to_u16(lv_color_mix(c, ctx->bg, (lv_opa_t)((cov0 * 255) >> COV_SHIFT)));
+                    }
+                }
+            }
+            else {
+                /*`ch` 1 is inside `ch` 0 so the alpha is the coverage of `ch` 0*/
+                lv_color32_t * px = row;
+                for(x = 0; x < w; x++) {
+                    cov0 += diff[x];
+                    cov1 += diff1[x];
+                    lv_opa_t a = (lv_opa_t)((cov0 * 255) >> COV_SHIFT);
+                    if(cov1 == 0 || a == 0) px[x] = lv_color_to_32(ctx->colors[0], a);
+                    else {
+                        int32_t mix = LV_MIN(cov1 * 255 / cov0, 255);
+                        px[x] = lv_color_to_32(lv_color_mix(ctx->colors[1], ctx->colors[0], (lv_opa_t)mix), a);
+                    }
+                }
+            }
+        }
+    }
+    else {
+        LV_LOG_WARN("Couldn't allocate the buffers of a %" LV_PRId32 " px wide shape", w);
+    }
+
+    lv_free(diff);
+
+    /*Added even if the buffer couldn't be allocated, as the layer is freed when it's drawn*/
+    lv_draw_image_dsc_t dsc;
+    lv_draw_image_dsc_init(&dsc);
+    dsc.src = shape_layer;
+    dsc.opa = ctx->opa;
+    lv_draw_layer(layer, &dsc, area);
+}
+
+static void get_geometry(lv_obj_t * obj, const lv_face_params_t * params, face_geometry_t * geo)
+{
+    lv_area_t coords;
+    lv_obj_get_content_coords(obj, &coords);
+    int32_t w = lv_area_get_width(&coords);
+    int32_t h = lv_area_get_height(&coords);
+    int32_t s = LV_MAX(LV_MIN(w, h), 0) * 16;
+    int32_t cx = coords.x1 * 16 + w * 8;
+    int32_t cy = coords.y1 * 16 + h * 8;
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        eye_t * eye = &geo->eyes[i];
+        int32_t side = i == 0 ? -1 : 1;
+        eye->cx = cx + side * s / 6;
+        eye->cy = cy - s / 12;
+        eye->a = s * 7 / 60;
+        eye->b = s * 3 / 20;
+
+        /*The lids are parabolas through the corners of the eye. They are out of the eye when
+         *it's fully open and relaxed*/
+        eye->lid_h = LV_MAX(eye->b / 2, 1);
+        eye->lid_y = eye->cy + eye->b - 2 * eye->b * params->openness / 255;
+        eye->lid_tilt = params->mood < 0 ? side * -params->mood * eye->b / 127 : 0;  /*Sad: the outer corners droop*/
+        eye->low_h = LV_MAX(eye->b / 2, 1);
+        eye->low_y = eye->cy + eye->b - eye->b * params->squint / 255;
+
+        eye->pupil_r = s / 20;
+        eye->pupil_x = eye->cx + (eye->a - eye->pupil_r) * params->gaze_x / 127;
+        eye->pupil_y = eye->cy + (eye->b - eye->pupil_r) * params->gaze_y / 127;
+    }
+
+    mouth_t * mouth = &geo->mouth;
+    mouth->cx = cx;
+    mouth->hw = s * 3 / 20;
+    mouth->curve = s * params->mood / (20 * 127);
+    mouth->y = cy + s * 13 / 60 + mouth->curve / 2;
+    mouth->t = lv_obj_get_style_line_width(obj, LV_PART_MAIN) * 8;
+}
+
+static bool q4_to_area(int32_t x1, int32_t y1, int32_t x2, int32_t y2, lv_area_t * area)
+{
+    if(x1 >= x2 || y1 >= y2) return false;
+    lv_area_set(area, x1 >> 4, y1 >> 4, (x2 - 1) >> 4, (y2 - 1) >> 4);
+    return true;
+}
+
+/*The bounding box of the visible part of the eye*/
+static bool get_eye_area(const eye_t * eye, lv_area_t * area)
+{
+    /*The top of the upper lid*/
+    int32_t lid_top;
+    if(LV_ABS(eye->lid_tilt) <= 2 * eye->lid_h) {
+        lid_top = eye->lid_y - eye->lid_tilt * eye->lid_tilt / (4 * eye->lid_h);
+    }
+    else {
+        lid_top = eye->lid_y + eye->lid_h - LV_ABS(eye->lid_tilt);
+    }
+
+    int32_t y1 = LV_MAX(eye->cy - eye->b, lid_top);
+    int32_t y2 = LV_MIN(eye->cy + eye->b, eye->low_y);
+    return q4_to_area(eye->cx - eye->a, y1, eye->cx + eye->a, y2, area);
+}
+
+static bool get_pupil_area(const eye_t * eye, lv_area_t * area)
+{
+    lv_area_t eye_area;
+    lv_area_t pupil_area;
+    if(!get_eye_area(eye, &eye_area)) return false;
+    if(!q4_to_area(eye->pupil_x - eye->pupil_r, eye->pupil_y - eye->pupil_r,
+                   eye->pupil_x + eye->pupil_r, eye->pupil_y + eye->pupil_r, &pupil_area)) return false;
+    return lv_area_intersect(area, &eye_area, &pupil_area);
+}
+
+static bool get_mouth_area(const mouth_t * mouth, lv_area_t * area)
+{
+    int32_t y_end = mouth->y - mouth->curve;
+    return q4_to_area(mouth->cx - mouth->hw - mouth->t, LV_MIN(mouth->y, y_end) - mouth->t,
+                      mouth->cx + mouth->hw + mouth->t, LV_MAX(mouth->y, y_end) + mouth->t, area);
+}
+
+static bool get_ellipse_span(int32_t cx, int32_t cy, int32_t a, int32_t b, int32_t y, int32_t * l, int32_t * r)
+{
+    int32_t dy = y - cy;
+    if(dy <= -b || dy >= b) return false;
+
+    int32_t hw = (int32_t)((int64_t)a * lv_sqrt32((uint32_t)(b * b - dy * dy)) / b);
+    *l = cx - hw;
+    *r = cx + hw;
+    return true;
+}
+
+/*The eye inside the lids and the pupil inside the visible part of the eye*/
+static uint32_t get_eye_spans(const void * shape, int32_t y, span_t * spans)
+{
+    const eye_t * eye = shape;
+    int32_t l;
+    int32_t r;
+    if(!get_ellipse_span(eye->cx, eye->cy, eye->a, eye->b, y, &l, &r)) return 0;
+
+    /*Below the upper lid: lid_h * u^2 + lid_tilt * u + (lid_y - y) <= 0*/
+    int64_t d = (int64_t)eye->lid_tilt * eye->lid_tilt - 4 * (int64_t)eye->lid_h * (eye->lid_y - y);
+    if(d < 0) return 0;
+    int32_t d_sqrt = lv_sqrt32((uint32_t)LV_MIN(d, (int64_t)UINT32_MAX));
+    l = LV_MAX(l, eye->cx + (int32_t)((int64_t)eye->a * (-eye->lid_tilt - d_sqrt) / (2 * eye->lid_h)));
+    r = LV_MIN(r, eye->cx + (int32_t)((int64_t)eye->a * (-eye->lid_tilt + d_sqrt) / (2 * eye->lid_h)));
+
+    /*Above the lower lid: low_h * u^2 <= low_y - y*/
+    int32_t c = eye->low_y - y;
+    if(c < 0) return 0;
+    int32_t hw = (int32_t)((int64_t)eye->a * lv_sqrt32((uint32_t)(c * eye->low_h)) / eye->low_h);
+    l = LV_MAX(l, eye->cx - hw);
+    r = LV_MIN(r, eye->cx + hw);
+    if(l >= r) return 0;
+
+    spans[0].l = l;
+    spans[0].r = r;
+    spans[0].ch = 0;
+
+    int32_t pl;
+    int32_t pr;
+    if(!get_ellipse_span(eye->pupil_x, eye->pupil_y, eye->pupil_r, eye->pupil_r, y, &pl, &pr)) return 1;
+    pl = LV_MAX(pl, l);
+    pr = LV_MIN(pr, r);
+    if(pl >= pr) return 1;
+
+    spans[1].l = pl;
+    spans[1].r = pr;
+    spans[1].ch = 1;
+    return 2;
+}
+
+/*A thick parabola with round ends*/
+static uint32_t get_mouth_spans(const void * shape, int32_t y, span_t * spans)
+{
+    const mouth_t * mouth = shape;
+    uint32_t cnt = 0;
+
+    /*|y - (mouth->y - curve * u^2)| <= t, i.e. lo <= curve * u^2 <= hi*/
+    int32_t lo = mouth->y - y - mouth->t;
+    int32_t hi = mouth->y - y + mouth->t;
+    int32_t k = mouth->curve;
+    if(k < 0) {
+        int32_t tmp = lo;
+        lo = -hi;
+        hi = -tmp;
+        k = -k;
+    }
+
+    if(k == 0) {
+        if(lo <= 0 && hi >= 0) {
+            spans[cnt].l = mouth->cx - mouth->hw;
+            spans[cnt].r = mouth->cx + mouth->hw;
+            cnt++;
+        }
+    }
+    else if(hi >= 0) {
+        /*|u| = sqrt(v / k) so |x - cx| = hw * sqrt(v * k) / k*/
+        int32_t x_out = LV_MIN(mouth->hw, (int32_t)((int64_t)mouth->hw * lv_sqrt32((uint32_t)(hi * k)) / k));
+        int32_t x_in = lo > 0 ? (int32_t)((int64_t)mouth->hw * lv_sqrt32((uint32_t)(lo * k)) / k) : 0;
+        if(x_in == 0) {
+            spans[cnt].l = mouth->cx - x_out;
+            spans[cnt].r = mouth->cx + x_out;
+            cnt++;
+        }
+        else if(x_in < x_out) {
+            spans[cnt].l = mouth->cx - x_out;
+            spans[cnt].r = mouth->cx - x_in;
+            cnt++;
+            spans[cnt].l = mouth->cx + x_in;
+            spans[cnt].r = mouth->cx + x_out;
+            cnt++;
+        }
+    }
+
+    int32_t y_end = mouth->y - mouth->curve;
+    if(get_ellipse_span(mouth->cx - mouth->hw, y_end, mouth->t, mouth->t, y, &spans[cnt].l, &spans[cnt].r)) cnt++;
+    if(get_ellipse_span(mouth->cx + mouth->hw, y_end, mouth->t, mouth->t, y, &spans[cnt].l, &spans[cnt].r)) cnt++;
+
+    /*Sort and merge the overlapping spans to not count the same pixels twice*/
+    uint32_t i;
+    uint32_t j;
+    for(i = 1; i < cnt; i++) {
+        span_t tmp = spans[i];
+        for(j = i; j > 0 && spans[j - 1].l > tmp.l; j--) spans[j] = spans[j - 1];
+        spans[j] = tmp;
+    }
+
+    uint32_t merged_cnt = 0;
+    for(i = 0; i < cnt; i++) {
+        if(merged_cnt > 0 && spans[i].l <= spans[merged_cnt - 1].r) {
+            spans[merged_cnt - 1].r = LV_MAX(spans[merged_cnt - 1].r, spans[i].r);
+        }
+        else {
+            spans[merged_cnt] = spans[i];
+            merged_cnt++;
+        }
+    }
+
+    for(i = 0; i < merged_cnt; i++) spans[i].ch = 0;
+    return merged_cnt;
+}
+
+static void invalidate_areas(lv_obj_t * obj, bool old_en, const lv_area_t * old_area, bool new_en,
+                             const lv_area_t * new_area)
+{
+    lv_area_t area;
+    if(old_en && new_en) lv_area_join(&area, old_area, new_area);
+    else if(old_en) area = *old_area;
+    else if(new_en) area = *new_area;
+    else return;
+
+    lv_obj_invalidate_area(obj, &area);
+}
+
+#endif /*LV_USE_FACE*/
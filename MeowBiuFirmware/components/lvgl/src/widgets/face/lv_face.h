@@ -0,0 +1,131 @@
+/**
+ * @file lv_face.h
+ *
+ */
+
+#ifndef LV_FACE_H
+#define LV_FACE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_types.h"
+#if LV_USE_FACE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/** The `mix` of `lv_face_params_mix()` which results in the second parameter set*/
+#define LV_FACE_MIX_MAX     255
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** The expression of a face*/
+typedef struct {
+    int8_t gaze_x;      /**< Look left (-127) ... right (127)*/
+    int8_t gaze_y;      /**< Look up (-127) ... down (127)*/
+    uint8_t openness;   /**< Closed (0) ... fully open (255) eyes*/
+    uint8_t squint;     /**< Raise the lower lids from relaxed (0) to the middle of the eyes (255)*/
+    int8_t mood;        /**< Sad (-127) ... neutral (0) ... happy (127): curve of the mouth and tilt of the lids*/
+} lv_face_params_t;
+
+LV_ATTRIBUTE_EXTERN_DATA extern const lv_obj_class_t lv_face_class;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a face: two eyes and a mouth drawn from a few parameters.
+ * The background of the face is the background of `LV_PART_MAIN`, the eyes are drawn with the background color of
+ * `LV_PART_ITEMS`, the pupils with the background color of `LV_PART_INDICATOR` and the mouth with the line color
+ * and width of `LV_PART_MAIN`.
+ * @param parent    pointer to the parent widget
+ * @return          pointer to the created face widget
+ */
+lv_obj_t * lv_face_create(lv_obj_t * parent);
+
+/**
+ * Set all parameters of the face. Only the areas which change are invalidated.
+ * @param obj       pointer to a face widget
+ * @param params    the new parameters (copied)
+ */
+void lv_face_set_params(lv_obj_t * obj, const lv_face_params_t * params);
+
+/**
+ * Set where the eyes look. Can be used as the exec_cb of an animation with `lv_face_set_gaze_x/y()`.
+ * @param obj       pointer to a face widget
+ * @param x         -127 (left) ... 127 (right)
+ * @param y         -127 (up) ... 127 (down)
+ */
+void lv_face_set_gaze(lv_obj_t * obj, int32_t x, int32_t y);
+
+/**
+ * Set where the eyes look horizontally
+ * @param obj       pointer to a face widget
+ * @param x         -127 (left) ... 127 (right)
+ */
+void lv_face_set_gaze_x(lv_obj_t * obj, int32_t x);
+
+/**
+ * Set where the eyes look vertically
+ * @param obj       pointer to a face widget
+ * @param y         -127 (up) ... 127 (down)
+ */
+void lv_face_set_gaze_y(lv_obj_t * obj, int32_t y);
+
+/**
+ * Open or close the eyes, e.g. to blink
+ * @param obj       pointer to a face widget
+ * @param openness  0 (closed) ... 255 (fully open)
+ */
+void lv_face_set_openness(lv_obj_t * obj, int32_t openness);
+
+/**
+ * Raise the lower lids
+ * @param obj       pointer to a face widget
+ * @param squint    0 (relaxed) ... 255 (up to the middle of the eyes)
+ */
+void lv_face_set_squint(lv_obj_t * obj, int32_t squint);
+
+/**
+ * Set the mood shown by the mouth and the lids
+ * @param obj       pointer to a face widget
+ * @param mood      -127 (sad) ... 0 (neutral) ... 127 (happy)
+ */
+void lv_face_set_mood(lv_obj_t * obj, int32_t mood);
+
+/**
+ * Get the parameters of the face
+ * @param obj       pointer to a face widget
+ * @return          pointer to the parameters
+ */
+const lv_face_params_t * lv_face_get_params(lv_obj_t * obj);
+
+/**
+ * Interpolate between two expressions
+ * @param res       store the result here
+ * @param a         the first expression
+ * @param b         the second expression
+ * @param mix       0: `a` ... LV_FACE_MIX_MAX: `b`
+ */
+void lv_face_params_mix(lv_face_params_t * res, const lv_face_params_t * a, const lv_face_params_t * b, int32_t mix);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FACE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FACE_H*/
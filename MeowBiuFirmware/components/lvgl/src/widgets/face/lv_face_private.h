@@ -0,0 +1,49 @@
+/**
+ * @file lv_face_private.h
+ *
+ */
+
+#ifndef LV_FACE_PRIVATE_H
+#define LV_FACE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../core/lv_obj_private.h"
+#include "lv_face.h"
+
+#if LV_USE_FACE
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_obj_t obj;
+    lv_face_params_t params;
+} lv_face_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FACE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FACE_PRIVATE_H*/
@@ -0,0 +1,292 @@
+/**
+ * @file lv_face_timeline.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_face_timeline.h"
+
+#if LV_USE_FACE
+
+#include "../../core/lv_obj_private.h"
+#include "../../misc/lv_anim_private.h"
+#include "../../misc/lv_assert.h"
+#include "../../misc/lv_timer.h"
+#include "../../stdlib/lv_mem.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*A running expression, or the frozen parameters of an interrupted cross-fade if `expr` is `NULL`*/
+typedef struct {
+    const lv_face_expression_t * expr;
+    lv_face_params_t base;              /*Value of the parameters without tracks*/
+    uint32_t start;                     /*Tick when the expression was started*/
+} slot_t;
+
+struct _lv_face_timeline_t {
+    lv_obj_t * face;
+    lv_timer_t * timer;
+    lv_anim_t path_anim;                /*Passed to the `path_cb` of the tracks, never started*/
+    slot_t act;
+    slot_t prev;                        /*Faded out while `act` is faded in*/
+    uint32_t end_time;                  /*Time of the last keyframe of `act`*/
+    uint32_t fade_start;
+    uint32_t fade_time;
+    lv_face_timeline_completed_cb_t completed_cb;
+    void * user_data;
+};
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void timer_cb(lv_timer_t * t);
+static void face_delete_event_cb(lv_event_t * e);
+static void get_params(lv_face_timeline_t * tl, uint32_t now, lv_face_params_t * params);
+static void get_slot_params(lv_face_timeline_t * tl, const slot_t * slot, uint32_t now, lv_face_params_t * params);
+static int32_t get_track_value(lv_face_timeline_t * tl, const lv_face_track_t * track, uint32_t t);
+static void set_param(lv_face_params_t * params, lv_face_param_t param, int32_t value);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_face_timeline_t * lv_face_timeline_create(lv_obj_t * face)
+{
+    LV_ASSERT_OBJ(face, &lv_face_class);
+
+    lv_face_timeline_t * tl = lv_malloc_zeroed(sizeof(lv_face_timeline_t));
+    LV_ASSERT_MALLOC(tl);
+    if(tl == NULL) return NULL;
+
+    tl->timer = lv_timer_create(timer_cb, LV_DEF_REFR_PERIOD, tl);
+    LV_ASSERT_MALLOC(tl->timer);
+    if(tl->timer == NULL) {
+        lv_free(tl);
+        return NULL;
+    }
+    lv_timer_pause(tl->timer);
+
+    tl->face = face;
+    lv_obj_add_event_cb(face, face_delete_event_cb, LV_EVENT_DELETE, tl);
+    lv_anim_init(&tl->path_anim);
+
+    return tl;
+}
+
+void lv_face_timeline_delete(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+
+    if(tl->face) lv_obj_remove_event_cb_with_user_data(tl->face, face_delete_event_cb, tl);
+    lv_timer_delete(tl->timer);
+    lv_free(tl);
+}
+
+void lv_face_timeline_play(lv_face_timeline_t * tl, const lv_face_expression_t * expr, uint32_t fade_time)
+{
+    LV_ASSERT_NULL(tl);
+    LV_ASSERT_NULL(expr);
+    if(tl->face == NULL) return;
+
+    uint32_t now = lv_tick_get();
+    const lv_face_params_t * params = lv_face_get_params(tl->face);
+
+    /*Fade from the running expression. If it's fading in too, freeze the current mix
+     *to not depend on more than two expressions*/
+    if(tl->act.expr && (now - tl->fade_start) >= tl->fade_time) {
+        tl->prev = tl->act;
+    }
+    else {
+        tl->prev.expr = NULL;
+        tl->prev.base = *params;
+    }
+
+    tl->act.expr = expr;
+    tl->act.base = *params;
+    tl->act.start = now;
+    tl->fade_start = now;
+    tl->fade_time = fade_time;
+
+    tl->end_time = 0;
+    uint32_t i;
+    for(i = 0; i < expr->track_cnt; i++) {
+        const lv_face_track_t * track = &expr->tracks[i];
+        if(track->keyframe_cnt) tl->end_time = LV_MAX(tl->end_time, track->keyframes[track->keyframe_cnt - 1].time);
+    }
+
+    lv_timer_resume(tl->timer);
+    lv_timer_reset(tl->timer);
+    lv_face_timeline_update(tl);
+}
+
+void lv_face_timeline_stop(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+
+    tl->act.expr = NULL;
+    tl->prev.expr = NULL;
+    lv_timer_pause(tl->timer);
+}
+
+void lv_face_timeline_update(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+    if(tl->face == NULL || tl->act.expr == NULL) return;
+
+    uint32_t now = lv_tick_get();
+    lv_face_params_t params;
+    get_params(tl, now, &params);
+    lv_face_set_params(tl->face, &params);
+
+    if(!lv_face_timeline_is_running(tl)) {
+        lv_timer_pause(tl->timer);
+        if(tl->completed_cb) tl->completed_cb(tl);
+    }
+}
+
+void lv_face_timeline_set_completed_cb(lv_face_timeline_t * tl, lv_face_timeline_completed_cb_t cb)
+{
+    LV_ASSERT_NULL(tl);
+    tl->completed_cb = cb;
+}
+
+void lv_face_timeline_set_user_data(lv_face_timeline_t * tl, void * user_data)
+{
+    LV_ASSERT_NULL(tl);
+    tl->user_data = user_data;
+}
+
+void * lv_face_timeline_get_user_data(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+    return tl->user_data;
+}
+
+const lv_face_expression_t * lv_face_timeline_get_expression(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+    return tl->act.expr;
+}
+
+bool lv_face_timeline_is_running(lv_face_timeline_t * tl)
+{
+    LV_ASSERT_NULL(tl);
+    if(tl->face == NULL || tl->act.expr == NULL) return false;
+    if(tl->act.expr->period) return true;
+
+    uint32_t now = lv_tick_get();
+    return (now - tl->act.start) < tl->end_time || (now - tl->fade_start) < tl->fade_time;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void timer_cb(lv_timer_t * t)
+{
+    lv_face_timeline_update(lv_timer_get_user_data(t));
+}
+
+static void face_delete_event_cb(lv_event_t * e)
+{
+    lv_face_timeline_t * tl = lv_event_get_user_data(e);
+    tl->face = NULL;
+    lv_face_timeline_stop(tl);
+}
+
+static void get_params(lv_face_timeline_t * tl, uint32_t now, lv_face_params_t * params)
+{
+    get_slot_params(tl, &tl->act, now, params);
+
+    uint32_t elaps = now - tl->fade_start;
+    if(elaps >= tl->fade_time) return;
+
+    lv_face_params_t prev;
+    get_slot_params(tl, &tl->prev, now, &prev);
+
+    lv_anim_t * a = &tl->path_anim;
+    a->act_time = (int32_t)elaps;
+    a->duration = (int32_t)tl->fade_time;
+    a->start_value = 0;
+    a->end_value = LV_FACE_MIX_MAX;
+    lv_face_params_mix(params, &prev, params, lv_anim_path_ease_in_out(a));
+}
+
+static void get_slot_params(lv_face_timeline_t * tl, const slot_t * slot, uint32_t now, lv_face_params_t * params)
+{
+    *params = slot->base;
+    const lv_face_expression_t * expr = slot->expr;
+    if(expr == NULL) return;
+
+    uint32_t t = now - slot->start;
+    if(expr->period) t %= expr->period;
+
+    uint32_t i;
+    for(i = 0; i < expr->track_cnt; i++) {
+        const lv_face_track_t * track = &expr->tracks[i];
+        if(track->keyframe_cnt == 0) continue;
+        set_param(params, track->param, get_track_value(tl, track, t));
+    }
+}
+
+static int32_t get_track_value(lv_face_timeline_t * tl, const lv_face_track_t * track, uint32_t t)
+{
+    const lv_face_keyframe_t * kf = track->keyframes;
+    if(t <= kf[0].time) return kf[0].value;
+
+    uint32_t i;
+    for(i = 1; i < track->keyframe_cnt; i++) {
+        if(t < kf[i].time) {
+            /*Evaluate the easing like an animation between the two keyframes*/
+            lv_anim_t * a = &tl->path_anim;
+            a->act_time = (int32_t)(t - kf[i - 1].time);
+            a->duration = kf[i].time - kf[i - 1].time;
+            a->start_value = kf[i - 1].value;
+            a->end_value = kf[i].value;
+            return track->path_cb ? track->path_cb(a) : lv_anim_path_linear(a);
+        }
+    }
+
+    return kf[track->keyframe_cnt - 1].value;
+}
+
+static void set_param(lv_face_params_t * params, lv_face_param_t param, int32_t value)
+{
+    switch(param) {
+        case LV_FACE_PARAM_GAZE_X:
+            params->gaze_x = (int8_t)LV_CLAMP(-127, value, 127);
+            break;
+        case LV_FACE_PARAM_GAZE_Y:
+            params->gaze_y = (int8_t)LV_CLAMP(-127, value, 127);
+            break;
+        case LV_FACE_PARAM_OPENNESS:
+            params->openness = (uint8_t)LV_CLAMP(0, value, 255);
+            break;
+        case LV_FACE_PARAM_SQUINT:
+            params->squint = (uint8_t)LV_CLAMP(0, value, 255);
+            break;
+        case LV_FACE_PARAM_MOOD:
+            params->mood = (int8_t)LV_CLAMP(-127, value, 127);
+            break;
+        default:
+            break;
+    }
+}
+
+#endif /*LV_USE_FACE*/
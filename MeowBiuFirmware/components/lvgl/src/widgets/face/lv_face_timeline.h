@@ -0,0 +1,156 @@
+/**
+ * @file lv_face_timeline.h
+ *
+ */
+
+#ifndef LV_FACE_TIMELINE_H
+#define LV_FACE_TIMELINE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_face.h"
+#if LV_USE_FACE
+
+#include "../../misc/lv_anim.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** The parameters of `lv_face_params_t` which can be animated by a track*/
+typedef enum {
+    LV_FACE_PARAM_GAZE_X,
+    LV_FACE_PARAM_GAZE_Y,
+    LV_FACE_PARAM_OPENNESS,
+    LV_FACE_PARAM_SQUINT,
+    LV_FACE_PARAM_MOOD,
+} lv_face_param_t;
+
+/** A value of a parameter at a given time*/
+typedef struct {
+    uint16_t time;                      /**< Time in milliseconds from the start of the expression*/
+    int16_t value;                      /**< Value of the parameter, clamped to the range of the parameter*/
+} lv_face_keyframe_t;
+
+/** The keyframes of one parameter*/
+typedef struct {
+    const lv_face_keyframe_t * keyframes;   /**< Keyframes in increasing order of time*/
+    lv_anim_path_cb_t path_cb;          /**< Easing between the keyframes, `NULL`: linear*/
+    uint8_t param;                      /**< An `lv_face_param_t`*/
+    uint8_t keyframe_cnt;
+} lv_face_track_t;
+
+/**
+ * An expression is a set of tracks played together. Typically it's a constant.
+ * Before the first keyframe a track has the value of its first keyframe, after the last keyframe the
+ * value of its last keyframe. If several tracks animate the same parameter the last one is used.
+ * The parameters without tracks keep the value they had when the expression was started.
+ */
+typedef struct {
+    const lv_face_track_t * tracks;
+    uint32_t track_cnt;
+    uint32_t period;                    /**< Repeat the tracks with this period in milliseconds, 0: play only once*/
+} lv_face_expression_t;
+
+typedef struct _lv_face_timeline_t lv_face_timeline_t;
+
+typedef void (*lv_face_timeline_completed_cb_t)(lv_face_timeline_t * tl);
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a timeline to animate the expressions of a face.
+ * A single timer updates all tracks, playing or interrupting expressions doesn't allocate memory.
+ * @param face      pointer to a face widget
+ * @return          pointer to the timeline
+ */
+lv_face_timeline_t * lv_face_timeline_create(lv_obj_t * face);
+
+/**
+ * Delete a timeline. If the face was deleted earlier the timeline stops but it still needs to be deleted.
+ * @param tl        pointer to a timeline
+ */
+void lv_face_timeline_delete(lv_face_timeline_t * tl);
+
+/**
+ * Play an expression. If an other one is playing the face cross-fades from it to the new one while both
+ * are running. If a cross-fade is in progress, it continues from the current parameters.
+ * @param tl        pointer to a timeline
+ * @param expr      the expression to play. Only the pointer is saved, so it should be static, global or
+ *                  dynamically allocated and not a local variable.
+ * @param fade_time duration of the cross-fade in milliseconds
+ */
+void lv_face_timeline_play(lv_face_timeline_t * tl, const lv_face_expression_t * expr, uint32_t fade_time);
+
+/**
+ * Stop the timeline and keep the current parameters of the face.
+ * @param tl        pointer to a timeline
+ */
+void lv_face_timeline_stop(lv_face_timeline_t * tl);
+
+/**
+ * Apply the parameters of the current time to the face. It's called by the timer of the timeline
+ * so normally it's not required to call it manually.
+ * @param tl        pointer to a timeline
+ */
+void lv_face_timeline_update(lv_face_timeline_t * tl);
+
+/**
+ * Set a callback to call when a non-repeating expression reached its last keyframe and the cross-fade
+ * has finished. The next expression can be played from it.
+ * @param tl        pointer to a timeline
+ * @param cb        the callback, `NULL` to remove it
+ */
+void lv_face_timeline_set_completed_cb(lv_face_timeline_t * tl, lv_face_timeline_completed_cb_t cb);
+
+/**
+ * Set custom data for the timeline
+ * @param tl        pointer to a timeline
+ * @param user_data pointer to any data
+ */
+void lv_face_timeline_set_user_data(lv_face_timeline_t * tl, void * user_data);
+
+/**
+ * Get the custom data of the timeline
+ * @param tl        pointer to a timeline
+ * @return          the `user_data`
+ */
+void * lv_face_timeline_get_user_data(lv_face_timeline_t * tl);
+
+/**
+ * Get the expression being played
+ * @param tl        pointer to a timeline
+ * @return          the expression or `NULL` if stopped
+ */
+const lv_face_expression_t * lv_face_timeline_get_expression(lv_face_timeline_t * tl);
+
+/**
+ * Tell whether the timeline is running, i.e. an expression repeats, or it hasn't completed yet, or a
+ * cross-fade is in progress.
+ * @param tl        pointer to a timeline
+ * @return          true: running
+ */
+bool lv_face_timeline_is_running(lv_face_timeline_t * tl);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_FACE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_FACE_TIMELINE_H*/
@@ -24,6 +24,7 @@
 #include "../../misc/lv_text_private.h"
 #include "../../stdlib/lv_sprintf.h"
 #include "../../stdlib/lv_string.h"
+#include "../../misc/cache/instance/lv_image_cache.h"
 
 /*********************
  *      DEFINES
@@ -34,6 +35,7 @@
 #define LV_LABEL_SCROLL_DELAY       300
 #define LV_LABEL_DOT_BEGIN_INV 0xFFFFFFFF
 #define LV_LABEL_HINT_HEIGHT_LIMIT 1024 /*Enable "hint" to buffer info about labels larger than this. (Speed up drawing)*/
+#define LV_LABEL_GLYPH_DIFF_MAX_AREAS 4 /*Invalidate the changed glyphs in at most this many areas*/
 
 /**********************
  *      TYPEDEFS
@@ -48,6 +50,7 @@ static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e);
 static void draw_main(lv_event_t * e);
 
 static void lv_label_refr_text(lv_obj_t * obj);
+static void lv_label_refr_text_diff(lv_obj_t * obj, const char * old_text);
 static void lv_label_revert_dots(lv_obj_t * label);
 static void lv_label_set_dots(lv_obj_t * label, uint32_t dot_begin);
 
@@ -58,6 +61,14 @@ static void copy_text_to_label(lv_label_t * label, const char * text);
 static lv_text_flag_t get_label_flags(lv_label_t * label);
 static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, const char * txt,
                                    uint32_t length, const lv_font_t * font, int32_t letter_space, lv_area_t * txt_coords, lv_text_flag_t flags);
+static bool is_single_plain_line(lv_obj_t * obj);
+static void get_line_start(lv_obj_t * obj, lv_point_t * pos);
+static uint32_t get_next_glyph_area(const lv_font_t * font, int32_t letter_space, const char * txt, uint32_t * ofs,
+                                    int32_t * x, lv_area_t * area);
+static void invalidate_changed_glyphs(lv_obj_t * obj, const char * old_text);
+static void glyph_cache_drop(lv_label_t * label);
+static void glyph_cache_build(lv_obj_t * obj);
+static bool draw_glyph_cache(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * label_draw_dsc);
 
 /**********************
  *  STATIC VARIABLES
@@ -153,20 +164,31 @@ void lv_label_set_text(lv_obj_t * obj, const char * text)
 
     }
     else {
-        /*Free the old text*/
+        /*Free the old text, or keep it until the changed glyphs are found*/
+        char * old_text = NULL;
         if(label->text != NULL && label->static_txt == 0) {
-            lv_free(label->text);
+            if(label->glyph_diff) old_text = label->text;
+            else lv_free(label->text);
             label->text = NULL;
         }
 
         label->text = lv_malloc(text_len);
         LV_ASSERT_MALLOC(label->text);
-        if(label->text == NULL) return;
+        if(label->text == NULL) {
+            lv_free(old_text);
+            return;
+        }
 
         copy_text_to_label(label, text);
 
         /*Now the text is dynamically allocated*/
         label->static_txt = 0;
+
+        if(old_text) {
+            lv_label_refr_text_diff(obj, old_text);
+            lv_free(old_text);
+            return;
+        }
     }
 
     lv_label_refr_text(obj);
@@ -177,8 +199,8 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     LV_ASSERT_OBJ(obj, MY_CLASS);
     LV_ASSERT_NULL(fmt);
 
-    lv_obj_invalidate(obj);
     lv_label_t * label = (lv_label_t *)obj;
+    if(!label->glyph_diff) lv_obj_invalidate(obj);
 
     /*If text is NULL then refresh*/
     if(fmt == NULL) {
@@ -186,8 +208,12 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
         return;
     }
 
+    /*Free the old text, or keep it until the changed glyphs are found*/
+    char * old_text = NULL;
     if(label->text != NULL && label->static_txt == 0) {
-        lv_free(label->text);
+        lv_label_revert_dots(obj);
+        if(label->glyph_diff) old_text = label->text;
+        else lv_free(label->text);
         label->text = NULL;
     }
 
@@ -197,7 +223,8 @@ void lv_label_set_text_fmt(lv_obj_t * obj, const char * fmt, ...)
     va_end(args);
     label->static_txt = 0; /*Now the text is dynamically allocated*/
 
-    lv_label_refr_text(obj);
+    lv_label_refr_text_diff(obj, old_text);
+    lv_free(old_text);
 }
 
 void lv_label_set_text_static(lv_obj_t * obj, const char * text)
@@ -280,6 +307,26 @@ void lv_label_set_recolor(lv_obj_t * obj, bool en)
     lv_label_refr_text(obj);
 }
 
+void lv_label_set_glyph_diff(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    label->glyph_diff = en ? 1 : 0;
+}
+
+void lv_label_set_glyph_cache(lv_obj_t * obj, bool en)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->glyph_cache == en) return;
+
+    label->glyph_cache = en ? 1 : 0;
+    glyph_cache_drop(label);
+    lv_obj_invalidate(obj);
+}
+
 /*=====================
  * Getter functions
  *====================*/
@@ -653,6 +700,22 @@ bool lv_label_get_recolor(const lv_obj_t * obj)
     return label->recolor == 0 ? false : true;
 }
 
+bool lv_label_get_glyph_diff(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->glyph_diff == 0 ? false : true;
+}
+
+bool lv_label_get_glyph_cache(const lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+
+    lv_label_t * label = (lv_label_t *)obj;
+    return label->glyph_cache == 0 ? false : true;
+}
+
 /*=====================
  * Other functions
  *====================*/
@@ -746,6 +809,7 @@ static void lv_label_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
 
     if(!label->static_txt) lv_free(label->text);
     label->text = NULL;
+    glyph_cache_drop(label);
 }
 
 static void lv_label_event(const lv_obj_class_t * class_p, lv_event_t * e)
@@ -870,6 +934,8 @@ static void draw_main(lv_event_t * e)
         return;
     }
 
+    if(label->glyph_cache && draw_glyph_cache(obj, layer, &label_draw_dsc)) return;
+
     if(label->long_mode == LV_LABEL_LONG_MODE_WRAP) {
         int32_t s = lv_obj_get_scroll_top(obj);
         lv_area_move(&txt_coords, 0, -s);
@@ -944,6 +1010,16 @@ static void overwrite_anim_property(lv_anim_t * dest, const lv_anim_t * src, lv_
  * @param label pointer to a label object
  */
 static void lv_label_refr_text(lv_obj_t * obj)
+{
+    lv_label_refr_text_diff(obj, NULL);
+}
+
+/**
+ * Refresh the label and if `old_text` is not NULL invalidate only the glyphs which are different in it
+ * @param obj       pointer to a label object
+ * @param old_text  the text before the change or NULL
+ */
+static void lv_label_refr_text_diff(lv_obj_t * obj, const char * old_text)
 {
     lv_label_t * label = (lv_label_t *)obj;
     if(label->text == NULL) return;
@@ -951,6 +1027,8 @@ static void lv_label_refr_text(lv_obj_t * obj)
     label->hint.line_start = -1; /*The hint is invalid if the text changes*/
 #endif
     label->invalid_size_cache = true;
+    glyph_cache_drop(label);
+    lv_point_t old_size = label->text_size;
 
     lv_area_t txt_coords;
     lv_obj_get_content_coords(obj, &txt_coords);
@@ -1206,6 +1284,12 @@ static void lv_label_refr_text(lv_obj_t * obj)
         /*Do nothing*/
     }
 
+    /*If the size of the text is the same the label keeps its size and the glyphs start at the same position*/
+    if(old_text && old_size.x == size.x && old_size.y == size.y && is_single_plain_line(obj)) {
+        invalidate_changed_glyphs(obj, old_text);
+        return;
+    }
+
     lv_obj_invalidate(obj);
 }
 
@@ -1307,4 +1391,299 @@ static void calculate_x_coordinate(int32_t * x, const lv_text_align_t align, con
     }
 }
 
+/**
+ * Check if the text is one line drawn letter by letter from the start of the line,
+ * i.e. the glyphs can be located without drawing the text
+ */
+static bool is_single_plain_line(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->long_mode != LV_LABEL_LONG_MODE_WRAP && label->long_mode != LV_LABEL_LONG_MODE_CLIP) return false;
+    if(label->recolor) return false;
+    if(lv_label_get_text_selection_start(obj) != LV_DRAW_LABEL_NO_TXT_SEL) return false;
+
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    if(label->text_size.y > lv_font_get_line_height(font)) return false;
+
+#if LV_USE_BIDI
+    lv_base_dir_t base_dir = lv_obj_get_style_base_dir(obj, LV_PART_MAIN);
+    if(base_dir == LV_BASE_DIR_AUTO) base_dir = lv_bidi_detect_base_dir(label->text);
+    if(base_dir == LV_BASE_DIR_RTL) return false;
+#endif
+
+    return true;
+}
+
+/**
+ * Get where the line of a single line text starts, the same way as `lv_draw_label()`
+ * @param obj       pointer to a label object
+ * @param pos       store the absolute coordinates of the start of the line here
+ */
+static void get_line_start(lv_obj_t * obj, lv_point_t * pos)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    lv_text_align_t align = lv_obj_calculate_style_text_align(obj, LV_PART_MAIN, label->text);
+
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    pos->x = txt_coords.x1;
+    pos->y = txt_coords.y1;
+    if(label->long_mode == LV_LABEL_LONG_MODE_WRAP) pos->y -= lv_obj_get_scroll_top(obj);
+
+    if(align == LV_TEXT_ALIGN_CENTER || align == LV_TEXT_ALIGN_RIGHT) {
+        int32_t line_w = lv_text_get_width_with_flags(label->text, lv_strlen(label->text), font, letter_space,
+                                                      get_label_flags(label));
+        if(align == LV_TEXT_ALIGN_CENTER) pos->x += (lv_area_get_width(&txt_coords) - line_w) / 2;
+        else pos->x += lv_area_get_width(&txt_coords) - line_w;
+    }
+}
+
+/**
+ * Step to the next letter of a line and get the area of its glyph
+ * @param font          the font of the text
+ * @param letter_space  the letter space of the text
+ * @param txt           the text
+ * @param ofs           byte offset of the letter in `txt`, moved to the next letter
+ * @param x             x coordinate of the letter relative to the start of the line, moved to the next letter
+ * @param area          store the union of the letter's cell and the box of its glyph here,
+ *                      relative to the start of the line. `x2 < x1` if the letter has no area.
+ * @return              the letter
+ */
+static uint32_t get_next_glyph_area(const lv_font_t * font, int32_t letter_space, const char * txt, uint32_t * ofs,
+                                    int32_t * x, lv_area_t * area)
+{
+    uint32_t letter;
+    uint32_t letter_next;
+    lv_text_encoded_letter_next_2(txt, &letter, &letter_next, ofs);
+
+    int32_t letter_w = lv_font_get_glyph_width(font, letter, letter_next);
+    area->x1 = *x;
+    area->x2 = *x + letter_w - 1;
+    area->y1 = 0;
+    area->y2 = lv_font_get_line_height(font) - 1;
+
+    lv_font_glyph_dsc_t g;
+    if(!lv_text_is_marker(letter) && lv_font_get_glyph_dsc(font, &g, letter, '\0') && g.box_w && g.box_h) {
+        lv_area_t box;
+        box.x1 = *x + g.ofs_x;
+        box.x2 = box.x1 + g.box_w - 1;
+        box.y1 = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        box.y2 = box.y1 + g.box_h - 1;
+        if(letter_w > 0) lv_area_join(area, area, &box);
+        else *area = box;
+    }
+
+    if(letter_w > 0) *x += letter_w + letter_space;
+    return letter;
+}
+
+/**
+ * Invalidate the glyphs of a single line text which are different or at a different position in the old text
+ * @param obj       pointer to a label object
+ * @param old_text  the text before the change, it has the same size as the new text
+ */
+static void invalidate_changed_glyphs(lv_obj_t * obj, const char * old_text)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+
+    lv_point_t line_start;
+    get_line_start(obj, &line_start);
+
+    uint32_t old_ofs = 0;
+    uint32_t new_ofs = 0;
+    int32_t old_x = 0;
+    int32_t new_x = 0;
+    uint32_t area_cnt = 0;
+    lv_area_t changed;
+    bool has_changed = false;
+
+    while(old_text[old_ofs] != '\0' || label->text[new_ofs] != '\0') {
+        int32_t old_cell_x = old_x;
+        int32_t new_cell_x = new_x;
+        uint32_t old_letter = 0;
+        uint32_t new_letter = 0;
+        lv_area_t old_area;
+        lv_area_t new_area;
+        old_area.x2 = old_area.x1 - 1;
+        new_area.x2 = new_area.x1 - 1;
+        if(old_text[old_ofs] != '\0') old_letter = get_next_glyph_area(font, letter_space, old_text, &old_ofs, &old_x,
+                                                                           &old_area);
+        if(label->text[new_ofs] != '\0') new_letter = get_next_glyph_area(font, letter_space, label->text, &new_ofs,
+                                                                              &new_x, &new_area);
+
+        bool same = old_letter == new_letter && old_cell_x == new_cell_x;
+        if(!same) {
+            const lv_area_t * areas[2] = {&old_area, &new_area};
+            uint32_t i;
+            for(i = 0; i < 2; i++) {
+                if(areas[i]->x2 < areas[i]->x1) continue;
+                if(has_changed) lv_area_join(&changed, &changed, areas[i]);
+                else changed = *areas[i];
+                has_changed = true;
+            }
+        }
+
+        /*Invalidate the changed glyphs before an unchanged one.
+         *Merge the rest into the last area to not fill up the display's invalidated areas*/
+        bool last = old_text[old_ofs] == '\0' && label->text[new_ofs] == '\0';
+        if(has_changed && ((same && area_cnt < LV_LABEL_GLYPH_DIFF_MAX_AREAS - 1) || last)) {
+            lv_area_move(&changed, line_start.x, line_start.y);
+            lv_obj_invalidate_area(obj, &changed);
+            area_cnt++;
+            has_changed = false;
+        }
+    }
+}
+
+static void glyph_cache_drop(lv_label_t * label)
+{
+    label->glyph_buf_failed = 0;
+    if(label->glyph_buf == NULL) return;
+
+    lv_image_cache_drop(label->glyph_buf);
+    lv_draw_buf_destroy(label->glyph_buf);
+    label->glyph_buf = NULL;
+}
+
+/**
+ * Render the glyphs of a single line text into an A8 bitmap
+ * @param obj       pointer to a label object
+ */
+static void glyph_cache_build(lv_obj_t * obj)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    const lv_font_t * font = lv_obj_get_style_text_font(obj, LV_PART_MAIN);
+    int32_t letter_space = lv_obj_get_style_text_letter_space(obj, LV_PART_MAIN);
+    label->glyph_buf_failed = 1;
+
+    /*Find the area of the glyphs and check that all of them are bitmaps*/
+    lv_area_t buf_area;
+    bool has_glyph = false;
+    uint32_t ofs = 0;
+    int32_t x = 0;
+    while(label->text[ofs] != '\0') {
+        int32_t letter_x = x;
+        lv_area_t cell;
+        uint32_t letter = get_next_glyph_area(font, letter_space, label->text, &ofs, &x, &cell);
+        lv_font_glyph_dsc_t g;
+        if(lv_text_is_marker(letter) || !lv_font_get_glyph_dsc(font, &g, letter, '\0')) continue;
+        if(g.box_w == 0 || g.box_h == 0) continue;
+        if(g.format < LV_FONT_GLYPH_FORMAT_A1 || g.format > LV_FONT_GLYPH_FORMAT_A8) return;
+
+        lv_area_t box;
+        box.x1 = letter_x + g.ofs_x;
+        box.x2 = box.x1 + g.box_w - 1;
+        box.y1 = (font->line_height - font->base_line) - g.box_h - g.ofs_y;
+        box.y2 = box.y1 + g.box_h - 1;
+        if(has_glyph) lv_area_join(&buf_area, &buf_area, &box);
+        else buf_area = box;
+        has_glyph = true;
+    }
+    if(!has_glyph) return;
+
+    lv_draw_buf_t * buf = lv_draw_buf_create(lv_area_get_width(&buf_area), lv_area_get_height(&buf_area),
+                                             LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+    if(buf == NULL) return;
+    lv_draw_buf_clear(buf, NULL);
+
+    lv_draw_buf_t * glyph_buf = NULL;
+    ofs = 0;
+    x = 0;
+    while(label->text[ofs] != '\0') {
+        int32_t letter_x = x;
+        lv_area_t cell;
+        uint32_t letter = get_next_glyph_area(font, letter_space, label->text, &ofs, &x, &cell);
+        lv_font_glyph_dsc_t g;
+        if(lv_text_is_marker(letter) || !lv_font_get_glyph_dsc(font, &g, letter, '\0')) continue;
+        if(g.box_w == 0 || g.box_h == 0) continue;
+
+        /*Let the font decode the glyph into an A8 buffer as for drawing it*/
+        lv_draw_buf_t * tmp = glyph_buf ? lv_draw_buf_reshape(glyph_buf, LV_COLOR_FORMAT_A8, g.box_w, g.box_h,
+                                                                 LV_STRIDE_AUTO) : NULL;
+        if(tmp == NULL) {
+            if(glyph_buf) lv_draw_buf_destroy(glyph_buf);
+            glyph_buf = lv_draw_buf_create(g.box_w, g.box_h, LV_COLOR_FORMAT_A8, LV_STRIDE_AUTO);
+            if(glyph_buf == NULL) {
+                lv_draw_buf_destroy(buf);
+                return;
+            }
+        }
+
+        const lv_draw_buf_t * bitmap = lv_font_get_glyph_bitmap(&g, glyph_buf);
+        if(bitmap) {
+            int32_t gx = letter_x + g.ofs_x - buf_area.x1;
+            int32_t gy = (font->line_height - font->base_line) - g.box_h - g.ofs_y - buf_area.y1;
+            int32_t row;
+            int32_t col;
+            for(row = 0; row < g.box_h; row++) {
+                const uint8_t * src = bitmap->data + row * bitmap->header.stride;
+                uint8_t * dest = buf->data + (gy + row) * buf->header.stride + gx;
+                /*The glyphs might overlap*/
+                for(col = 0; col < g.box_w; col++) dest[col] = LV_MAX(dest[col], src[col]);
+            }
+        }
+        lv_font_glyph_release_draw_data(&g);
+    }
+
+    if(glyph_buf) lv_draw_buf_destroy(glyph_buf);
+
+    label->glyph_buf = buf;
+    label->glyph_buf_area = buf_area;
+    label->glyph_buf_failed = 0;
+}
+
+/**
+ * Draw the text from the cached glyphs
+ * @param obj               pointer to a label object
+ * @param layer             the layer to draw to
+ * @param label_draw_dsc    the descriptor the text would be drawn with
+ * @return                  true: the text is drawn; false: it can't be drawn from the cache
+ */
+static bool draw_glyph_cache(lv_obj_t * obj, lv_layer_t * layer, const lv_draw_label_dsc_t * label_draw_dsc)
+{
+    lv_label_t * label = (lv_label_t *)obj;
+    if(label->glyph_buf_failed) return false;
+    if(!is_single_plain_line(obj)) return false;
+    if(label_draw_dsc->outline_stroke_width > 0 || label_draw_dsc->decor != LV_TEXT_DECOR_NONE) return false;
+
+    if(label->glyph_buf == NULL) {
+        glyph_cache_build(obj);
+        if(label->glyph_buf == NULL) return false;
+    }
+
+    lv_point_t line_start;
+    get_line_start(obj, &line_start);
+
+    lv_area_t coords = label->glyph_buf_area;
+    lv_area_move(&coords, line_start.x, line_start.y);
+
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.base = label_draw_dsc->base;
+    img_dsc.src = label->glyph_buf;
+    img_dsc.recolor = label_draw_dsc->color;
+    img_dsc.recolor_opa = LV_OPA_COVER;
+    img_dsc.opa = label_draw_dsc->opa;
+
+    /*Clip the text to the content area as lv_draw_label() does*/
+    lv_area_t txt_coords;
+    lv_obj_get_content_coords(obj, &txt_coords);
+    if(label->long_mode == LV_LABEL_LONG_MODE_WRAP) txt_coords.y2 = obj->coords.y2;
+    lv_area_t clip_area;
+    const lv_area_t clip_area_ori = layer->_clip_area;
+    if(label->long_mode == LV_LABEL_LONG_MODE_CLIP) {
+        if(!lv_area_intersect(&clip_area, &clip_area_ori, &txt_coords)) return true;
+        layer->_clip_area = clip_area;
+    }
+
+    lv_draw_image(layer, &img_dsc, &coords);
+    layer->_clip_area = clip_area_ori;
+
+    return true;
+}
+
 #endif
@@ -137,6 +137,25 @@ void lv_label_set_text_selection_end(lv_obj_t * obj, uint32_t index);
  */
 void lv_label_set_recolor(lv_obj_t * obj, bool en);
 
+/**
+ * Invalidate only the glyphs which are different in the new text when the text is set.
+ * Useful for fixed format texts updated often, e.g. a clock ("12:59" -> "13:00") or a battery level.
+ * It applies to single line texts whose size doesn't change, in the other cases the whole label is invalidated.
+ * @param obj           pointer to a label object
+ * @param en            true: invalidate only the changed glyphs, false: invalidate the whole label
+ */
+void lv_label_set_glyph_diff(lv_obj_t * obj, bool en);
+
+/**
+ * Render the glyphs of the text once into an A8 bitmap and draw that bitmap until the text or the font changes.
+ * Useful if the label is redrawn often because of the widgets below it, e.g. a clock above an animation.
+ * It applies to single line texts without recoloring, selection, outline or decoration
+ * and to fonts with bitmap glyphs, in the other cases the label is drawn as usual.
+ * @param obj           pointer to a label object
+ * @param en            true: cache the glyphs, false: render the glyphs each time
+ */
+void lv_label_set_glyph_cache(lv_obj_t * obj, bool en);
+
 /*=====================
  * Getter functions
  *====================*/
@@ -203,6 +222,20 @@ uint32_t lv_label_get_text_selection_end(const lv_obj_t * obj);
  */
 bool lv_label_get_recolor(const lv_obj_t * obj);
 
+/**
+ * Get whether only the changed glyphs are invalidated when the text is set
+ * @param obj       pointer to a label object.
+ * @return          true: only the changed glyphs are invalidated
+ */
+bool lv_label_get_glyph_diff(const lv_obj_t * obj);
+
+/**
+ * Get whether the glyphs are cached in an A8 bitmap
+ * @param obj       pointer to a label object.
+ * @return          true: the glyphs are cached
+ */
+bool lv_label_get_glyph_cache(const lv_obj_t * obj);
+
 /*=====================
  * Other functions
  *====================*/
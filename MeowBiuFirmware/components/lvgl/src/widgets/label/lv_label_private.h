@@ -50,8 +50,13 @@ struct _lv_label_t {
     uint8_t recolor : 1;                /**< Enable in-line letter re-coloring*/
     uint8_t expand : 1;                 /**< Ignore real width (used by the library with LV_LABEL_LONG_MODE_SCROLL) */
     uint8_t invalid_size_cache : 1;     /**< 1: Recalculate size and update cache */
+    uint8_t glyph_diff : 1;             /**< 1: Invalidate only the changed glyphs when the text is set */
+    uint8_t glyph_cache : 1;            /**< 1: Draw the text from `glyph_buf` */
+    uint8_t glyph_buf_failed : 1;       /**< 1: The text can't be drawn from `glyph_buf` until it changes */
 
     lv_point_t text_size;
+    lv_draw_buf_t * glyph_buf;          /**< A8 bitmap of the glyphs if `glyph_cache` is set */
+    lv_area_t glyph_buf_area;           /**< Area of `glyph_buf` relative to the start of the line */
 };
 
 
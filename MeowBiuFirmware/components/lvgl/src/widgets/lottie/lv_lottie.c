@@ -25,6 +25,10 @@
  *********************/
 #define MY_CLASS (&lv_lottie_class)
 
+/*Signature of the pre-parsed animations made by scripts/lottie_compiler.py*/
+#define LOTTIE_BIN_MAGIC        "LTB1"
+#define LOTTIE_BIN_MAGIC_LEN    4
+
 /**********************
  *      TYPEDEFS
  **********************/
@@ -35,7 +39,10 @@
 static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void lv_lottie_destructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
 static void anim_exec_cb(void * var, int32_t v);
+static void render_frame(lv_lottie_t * lottie, int32_t v);
 static void lottie_update(lv_lottie_t * lottie, int32_t v);
+static void start_anim(lv_lottie_t * lottie);
+static void invalidate_rendered_area(lv_lottie_t * lottie);
 
 /**********************
  *  STATIC VARIABLES
@@ -81,14 +88,14 @@ void lv_lottie_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf)
     lv_canvas_set_buffer(obj, buf, w, h, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
     tvg_picture_set_size(lottie->tvg_paint, w, h);
 
-    /* Rendered output images are premultiplied */
+    /* Rendered output images are premultiplied and are redrawn on every frame */
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
-    lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED | LV_IMAGE_FLAGS_VOLATILE);
 
     /*Force updating when the buffer changes*/
     float f_current;
     tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    if(lv_obj_is_visible(obj)) render_frame(lottie, (int32_t) f_current);
 }
 
 void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
@@ -105,31 +112,27 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
     lv_canvas_set_draw_buf(obj, draw_buf);
     tvg_picture_set_size(lottie->tvg_paint, draw_buf->header.w, draw_buf->header.h);
 
-    /* Rendered output images are premultiplied */
-    lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED);
+    /* Rendered output images are premultiplied and are redrawn on every frame */
+    lv_draw_buf_set_flag(draw_buf, LV_IMAGE_FLAGS_PREMULTIPLIED | LV_IMAGE_FLAGS_VOLATILE);
 
     /*Force updating when the buffer changes*/
     float f_current;
     tvg_animation_get_frame(lottie->tvg_anim, &f_current);
-    anim_exec_cb(obj, (int32_t) f_current);
+    if(lv_obj_is_visible(obj)) render_frame(lottie, (int32_t) f_current);
 }
 
 void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size)
 {
     lv_lottie_t * lottie = (lv_lottie_t *)obj;
-    tvg_picture_load_data(lottie->tvg_paint, src, src_size, "lottie", true);
+    /*JSON is parsed in situ so it's copied to RAM, but the pre-parsed data is read in place*/
+    bool copy = src_size < LOTTIE_BIN_MAGIC_LEN || lv_memcmp(src, LOTTIE_BIN_MAGIC, LOTTIE_BIN_MAGIC_LEN) != 0;
+    tvg_picture_load_data(lottie->tvg_paint, src, src_size, "lottie", copy);
     lv_draw_buf_t * canvas_draw_buf = lv_canvas_get_draw_buf(obj);
     if(canvas_draw_buf) {
         tvg_picture_set_size(lottie->tvg_paint, canvas_draw_buf->header.w, canvas_draw_buf->header.h);
     }
 
-    float f_total;
-    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
-    lv_anim_set_duration(lottie->anim, (int32_t)f_total * 1000 / 60); /*60 FPS*/
-    lottie->anim->act_time = 0;
-    lottie->anim->end_value = (int32_t)f_total;
-    lottie->anim->reverse_play_in_progress = false;
-    lottie_update(lottie, 0);   /*Render immediately*/
+    start_anim(lottie);
 }
 
 void lv_lottie_set_src_file(lv_obj_t * obj, const char * src)
@@ -141,13 +144,7 @@ void lv_lottie_set_src_file(lv_obj_t * obj, const char * src)
         tvg_picture_set_size(lottie->tvg_paint, canvas_draw_buf->header.w, canvas_draw_buf->header.h);
     }
 
-    float f_total;
-    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
-    lv_anim_set_duration(lottie->anim, (int32_t)f_total * 1000 / 60); /*60 FPS*/
-    lottie->anim->act_time = 0;
-    lottie->anim->end_value = (int32_t)f_total;
-    lottie->anim->reverse_play_in_progress = false;
-    lottie_update(lottie, 0);   /*Render immediately*/
+    start_anim(lottie);
 }
 
 
@@ -158,6 +155,35 @@ lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj)
     return lottie->anim;
 }
 
+void lv_lottie_set_max_fps(lv_obj_t * obj, uint32_t fps)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    lottie->max_fps = fps;
+}
+
+uint32_t lv_lottie_get_target_fps(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+
+    float f_total = 0;
+    float duration = 0;
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+    tvg_animation_get_duration(lottie->tvg_anim, &duration);
+    uint32_t fps = duration > 0 ? (uint32_t)(f_total / duration + 0.5f) : 0;
+
+    if(lottie->max_fps && lottie->max_fps < fps) fps = lottie->max_fps;
+    return fps;
+}
+
+uint32_t lv_lottie_get_achieved_fps(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    return lottie->achieved_fps;
+}
+
 /**********************
  *   STATIC FUNCTIONS
  **********************/
@@ -183,6 +209,9 @@ static void lv_lottie_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj
     lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
     lottie->anim = lv_anim_start(&a);
 
+    lottie->rendered_frame = -1;
+    lottie->fps_start = lv_tick_get();
+
     LV_TRACE_OBJ_CREATE("finished");
 }
 
@@ -200,39 +229,116 @@ static void anim_exec_cb(void * var, int32_t v)
     lv_lottie_t * lottie = var;
 
     /*Do not render not visible animations.*/
-    if(lv_obj_is_visible(var)) {
-        lottie_update(lottie, v);
-        if(lottie->anim) {
-            lottie->last_rendered_time = lottie->anim->act_time;
-        }
-    }
-    else {
+    if(!lv_obj_is_visible(var)) {
         /*Artificially keep the animation on the last rendered frame's time
          *To avoid a jump when the widget becomes visible*/
         if(lottie->anim) {
             lottie->anim->act_time = lottie->last_rendered_time;
         }
+        return;
+    }
+
+    /*The frame comes from the elapsed time, so if rendering is slow, frames are skipped.
+     *Nothing to do if the frame hasn't changed or the render rate limit doesn't allow a new one yet.*/
+    if(v == lottie->rendered_frame) return;
+    if(lottie->max_fps && lottie->anim && v != lottie->anim->end_value &&
+       lv_tick_elaps(lottie->render_tick) < 1000 / lottie->max_fps) {
+        return;
+    }
+
+    render_frame(lottie, v);
+}
+
+static void render_frame(lv_lottie_t * lottie, int32_t v)
+{
+    lottie_update(lottie, v);
+    lottie->rendered_frame = v;
+    lottie->render_tick = lv_tick_get();
+    if(lottie->anim) {
+        lottie->last_rendered_time = lottie->anim->act_time;
+    }
+
+    lottie->fps_frame_cnt++;
+    uint32_t elaps = lv_tick_elaps(lottie->fps_start);
+    if(elaps >= 1000) {
+        lottie->achieved_fps = lottie->fps_frame_cnt * 1000 / elaps;
+        lottie->fps_frame_cnt = 0;
+        lottie->fps_start = lottie->render_tick;
     }
 }
 
+/*Restart the animation of a new source with its own duration*/
+static void start_anim(lv_lottie_t * lottie)
+{
+    float f_total;
+    float duration;
+    tvg_animation_get_total_frame(lottie->tvg_anim, &f_total);
+    tvg_animation_get_duration(lottie->tvg_anim, &duration);
+    lv_anim_set_duration(lottie->anim, (uint32_t)(duration * 1000));
+    lottie->anim->act_time = 0;
+    lottie->anim->end_value = (int32_t)f_total;
+    lottie->anim->reverse_play_in_progress = false;
+    lottie_update(lottie, 0);   /*Render immediately*/
+    lottie->rendered_frame = 0;
+}
+
 static void lottie_update(lv_lottie_t * lottie, int32_t v)
 {
     lv_obj_t * obj = (lv_obj_t *) lottie;
-
     lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(obj);
-    if(draw_buf) {
-        lv_draw_buf_clear(draw_buf, NULL);
 
-        /*Drop old cached image*/
-        lv_image_cache_drop(lv_image_get_src(obj));
+    tvg_animation_set_frame(lottie->tvg_anim, v);
+
+    /*Redraw only the area where the paints changed since the previous frame.
+     *The rest of the buffer still holds the previous frame.*/
+    bool tracked = false;
+    int32_t x = 0, y = 0, w = 0, h = 0;
+#if LV_USE_THORVG_INTERNAL
+    if(draw_buf) tracked = tvg_swcanvas_get_damage(lottie->tvg_canvas, &x, &y, &w, &h) == TVG_RESULT_SUCCESS;
+#endif
+
+    if(tracked) {
+        lv_area_set(&lottie->rendered_area, x, y, x + w - 1, y + h - 1);
+        if(w <= 0 || h <= 0) return;
+
+        lv_draw_buf_clear(draw_buf, &lottie->rendered_area);
+        tvg_canvas_set_viewport(lottie->tvg_canvas, x, y, w, h);
+    }
+    else if(draw_buf) {
+        lv_area_set(&lottie->rendered_area, 0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1);
+        lv_draw_buf_clear(draw_buf, NULL);
+    }
+    else {
+        lv_area_set(&lottie->rendered_area, 0, 0, -1, -1);
     }
 
-    tvg_animation_set_frame(lottie->tvg_anim, v);
     tvg_canvas_update(lottie->tvg_canvas);
     tvg_canvas_draw(lottie->tvg_canvas);
     tvg_canvas_sync(lottie->tvg_canvas);
 
-    lv_obj_invalidate(obj);
+    if(tracked) invalidate_rendered_area(lottie);
+    else lv_obj_invalidate(obj);
+}
+
+static void invalidate_rendered_area(lv_lottie_t * lottie)
+{
+    lv_obj_t * obj = (lv_obj_t *) lottie;
+    lv_image_t * img = (lv_image_t *) lottie;
+
+    /*Map the area to the screen the same way the image is drawn, if it's simple*/
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t image_area;
+    lv_area_set(&image_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &image_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t inv_area = lottie->rendered_area;
+    lv_area_move(&inv_area, image_area.x1, image_area.y1);
+    lv_obj_invalidate_area(obj, &inv_area);
 }
 
 #endif /*LV_USE_LOTTIE*/
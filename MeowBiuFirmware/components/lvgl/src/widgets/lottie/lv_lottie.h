@@ -65,7 +65,9 @@ void lv_lottie_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
 /**
  * Set the source for the animation as an array
  * @param obj       pointer to a lottie widget
- * @param src       the lottie animation converted to an nul terminated array
+ * @param src       the lottie animation converted to an nul terminated array or
+ *                  pre-parsed by `scripts/lottie_compiler.py`. The pre-parsed data is
+ *                  used in place so it needs to be valid while the animation is used.
  * @param src_size  size of the source array in bytes
  */
 void lv_lottie_set_src_data(lv_obj_t * obj, const void * src, size_t src_size);
@@ -85,6 +87,29 @@ void lv_lottie_set_src_file(lv_obj_t * obj, const char * src);
  */
 lv_anim_t * lv_lottie_get_anim(lv_obj_t * obj);
 
+/**
+ * Limit the render rate below the frame rate of the animation.
+ * The frames are picked by the elapsed time, so the duration stays the same.
+ * @param obj       pointer to a lottie widget
+ * @param fps       maximum frames per second, 0: the frame rate of the animation
+ */
+void lv_lottie_set_max_fps(lv_obj_t * obj, uint32_t fps);
+
+/**
+ * Get the render rate the widget aims for
+ * @param obj       pointer to a lottie widget
+ * @return          the frame rate of the animation or the limit set by `lv_lottie_set_max_fps()`
+ */
+uint32_t lv_lottie_get_target_fps(lv_obj_t * obj);
+
+/**
+ * Get the number of frames rendered in the last second while playing.
+ * It's below the target if the rendering is slow and frames are skipped.
+ * @param obj       pointer to a lottie widget
+ * @return          rendered frames per second
+ */
+uint32_t lv_lottie_get_achieved_fps(lv_obj_t * obj);
+
 /**********************
  * GLOBAL VARIABLES
  **********************/
@@ -41,6 +41,13 @@ typedef struct {
     Tvg_Animation * tvg_anim;
     lv_anim_t * anim;
     int32_t last_rendered_time;
+    lv_area_t rendered_area;    /**< Area of the buffer redrawn by the last update (w or h is 0 if nothing changed)*/
+    int32_t rendered_frame;     /**< Last frame rendered by the animation, -1 if none*/
+    uint32_t render_tick;       /**< Time of the last render*/
+    uint32_t max_fps;           /**< Limit of the render rate, 0: the frame rate of the animation*/
+    uint32_t fps_start;         /**< Start of the window measuring the achieved fps*/
+    uint32_t fps_frame_cnt;
+    uint32_t achieved_fps;
 } lv_lottie_t;
 
 /**********************
@@ -0,0 +1,265 @@
+/**
+ * @file lv_sprite.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_sprite_private.h"
+#if LV_USE_SPRITE
+
+#include "../../core/lv_obj_class_private.h"
+#include "../../misc/lv_anim_private.h"
+#include "../../misc/lv_area_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+#define MY_CLASS (&lv_sprite_class)
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+static void lv_sprite_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj);
+static void anim_exec_cb(void * var, int32_t v);
+static void buffer_changed(lv_sprite_t * sprite);
+static void show_image(lv_sprite_t * sprite, int32_t image);
+static void get_image_area(lv_sprite_t * sprite, int32_t image, lv_area_t * area);
+static void blit_image(lv_sprite_t * sprite, const lv_sprite_image_t * img, const lv_area_t * clip);
+static void invalidate_buf_area(lv_sprite_t * sprite, const lv_area_t * area);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+const lv_obj_class_t lv_sprite_class = {
+    .constructor_cb = lv_sprite_constructor,
+    .width_def = LV_DPI_DEF,
+    .height_def = LV_DPI_DEF,
+    .instance_size = sizeof(lv_sprite_t),
+    .base_class = &lv_canvas_class,
+    .name = "lv_sprite",
+};
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+lv_obj_t * lv_sprite_create(lv_obj_t * parent)
+{
+    LV_LOG_INFO("begin");
+    lv_obj_t * obj = lv_obj_class_create_obj(MY_CLASS, parent);
+    lv_obj_class_init_obj(obj);
+    return obj;
+}
+
+void lv_sprite_set_src(lv_obj_t * obj, const lv_sprite_sheet_t * sheet)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_sprite_t * sprite = (lv_sprite_t *)obj;
+
+    sprite->sheet = sheet;
+    sprite->frame = -1;
+    if(sheet == NULL || sheet->frame_cnt == 0 || sheet->fps == 0) {
+        sprite->sheet = NULL;
+        buffer_changed(sprite);
+        return;
+    }
+
+    lv_anim_set_duration(sprite->anim, (uint32_t)sheet->frame_cnt * 1000 / sheet->fps);
+    sprite->anim->act_time = 0;
+    sprite->anim->end_value = sheet->frame_cnt;
+    sprite->anim->current_value = 0;
+    buffer_changed(sprite);     /*Show the first frame immediately*/
+}
+
+void lv_sprite_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    buf = lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    lv_canvas_set_buffer(obj, buf, w, h, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED);
+    buffer_changed((lv_sprite_t *)obj);
+}
+
+void lv_sprite_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    if(draw_buf->header.cf != LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED &&
+       draw_buf->header.cf != LV_COLOR_FORMAT_RGB565) {
+        LV_LOG_WARN("The draw buf needs to have ARGB8888_PREMULTIPLIED or RGB565 color format");
+        return;
+    }
+
+    lv_canvas_set_draw_buf(obj, draw_buf);
+    buffer_changed((lv_sprite_t *)obj);
+}
+
+lv_anim_t * lv_sprite_get_anim(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_sprite_t * sprite = (lv_sprite_t *)obj;
+    return sprite->anim;
+}
+
+int32_t lv_sprite_get_frame(lv_obj_t * obj)
+{
+    LV_ASSERT_OBJ(obj, MY_CLASS);
+    lv_sprite_t * sprite = (lv_sprite_t *)obj;
+    return sprite->frame;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+static void lv_sprite_constructor(const lv_obj_class_t * class_p, lv_obj_t * obj)
+{
+    LV_UNUSED(class_p);
+    LV_TRACE_OBJ_CREATE("begin");
+
+    lv_obj_set_size(obj, LV_SIZE_CONTENT, LV_SIZE_CONTENT);
+
+    lv_sprite_t * sprite = (lv_sprite_t *)obj;
+    sprite->frame = -1;
+    sprite->image = -1;
+
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_exec_cb(&a, anim_exec_cb);
+    lv_anim_set_var(&a, obj);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    sprite->anim = lv_anim_start(&a);
+
+    LV_TRACE_OBJ_CREATE("finished");
+}
+
+static void anim_exec_cb(void * var, int32_t v)
+{
+    lv_sprite_t * sprite = var;
+    const lv_sprite_sheet_t * sheet = sprite->sheet;
+    if(sheet == NULL) return;
+
+    /*The end value is reached only at the end of the animation*/
+    if(v >= sheet->frame_cnt) v = sheet->frame_cnt - 1;
+    if(v == sprite->frame) return;
+
+    sprite->frame = v;
+    show_image(sprite, sheet->frames[v]);
+}
+
+/*The content of the buffer is unknown, clear it and draw the current frame*/
+static void buffer_changed(lv_sprite_t * sprite)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)sprite);
+    if(draw_buf) {
+        lv_draw_buf_clear(draw_buf, NULL);
+        lv_obj_invalidate((lv_obj_t *)sprite);
+    }
+    sprite->image = -1;
+
+    if(sprite->sheet == NULL) return;
+    if(sprite->frame < 0) sprite->frame = 0;
+    show_image(sprite, sprite->sheet->frames[sprite->frame]);
+}
+
+/*Replace the image in the buffer: clear the area of the old one and copy the pixels of the new one*/
+static void show_image(lv_sprite_t * sprite, int32_t image)
+{
+    if(image == sprite->image) return;
+
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)sprite);
+    if(draw_buf == NULL) return;
+
+    lv_area_t buf_area;
+    lv_area_set(&buf_area, 0, 0, draw_buf->header.w - 1, draw_buf->header.h - 1);
+
+    lv_area_t old_area;
+    lv_area_t new_area;
+    get_image_area(sprite, sprite->image, &old_area);
+    get_image_area(sprite, image, &new_area);
+
+    lv_area_t clip;
+    if(lv_area_intersect(&clip, &old_area, &buf_area)) {
+        lv_draw_buf_clear(draw_buf, &clip);
+        invalidate_buf_area(sprite, &clip);
+    }
+
+    if(lv_area_intersect(&clip, &new_area, &buf_area)) {
+        blit_image(sprite, &sprite->sheet->images[image], &clip);
+        invalidate_buf_area(sprite, &clip);
+    }
+
+    sprite->image = image;
+}
+
+static void get_image_area(lv_sprite_t * sprite, int32_t image, lv_area_t * area)
+{
+    if(image < 0 || sprite->sheet->images[image].w == 0) {
+        lv_area_set(area, 0, 0, -1, -1);
+        return;
+    }
+
+    const lv_sprite_image_t * img = &sprite->sheet->images[image];
+    lv_area_set(area, img->x, img->y, img->x + img->w - 1, img->y + img->h - 1);
+}
+
+static void blit_image(lv_sprite_t * sprite, const lv_sprite_image_t * img, const lv_area_t * clip)
+{
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf((lv_obj_t *)sprite);
+    const lv_sprite_sheet_t * sheet = sprite->sheet;
+    const uint8_t * src = sheet->indices + img->data_ofs + (clip->y1 - img->y) * img->w + (clip->x1 - img->x);
+    int32_t w = lv_area_get_width(clip);
+    int32_t y;
+    int32_t x;
+
+    if(draw_buf->header.cf == LV_COLOR_FORMAT_RGB565) {
+        for(y = clip->y1; y <= clip->y2; y++) {
+            uint16_t * dest = lv_draw_buf_goto_xy(draw_buf, clip->x1, y);
+            for(x = 0; x < w; x++) {
+                lv_color32_t c = sheet->palette[src[x]];
+                dest[x] = ((c.red & 0xF8) << 8) | ((c.green & 0xFC) << 3) | (c.blue >> 3);
+            }
+            src += img->w;
+        }
+    }
+    else {
+        for(y = clip->y1; y <= clip->y2; y++) {
+            lv_color32_t * dest = lv_draw_buf_goto_xy(draw_buf, clip->x1, y);
+            for(x = 0; x < w; x++) {
+                dest[x] = sheet->palette[src[x]];
+            }
+            src += img->w;
+        }
+    }
+}
+
+static void invalidate_buf_area(lv_sprite_t * sprite, const lv_area_t * area)
+{
+    lv_obj_t * obj = (lv_obj_t *) sprite;
+    lv_image_t * img = (lv_image_t *) sprite;
+
+    /*Map the area to the screen the same way the image is drawn, if it's simple*/
+    if(img->rotation != 0 || img->scale_x != LV_SCALE_NONE || img->scale_y != LV_SCALE_NONE ||
+       img->align >= LV_IMAGE_ALIGN_AUTO_TRANSFORM) {
+        lv_obj_invalidate(obj);
+        return;
+    }
+
+    lv_area_t image_area;
+    lv_area_set(&image_area, 0, 0, img->w - 1, img->h - 1);
+    lv_area_align(&obj->coords, &image_area, img->align, img->offset.x, img->offset.y);
+
+    lv_area_t inv_area = *area;
+    lv_area_move(&inv_area, image_area.x1, image_area.y1);
+    lv_obj_invalidate_area(obj, &inv_area);
+}
+
+#endif /*LV_USE_SPRITE*/
@@ -0,0 +1,151 @@
+/**
+ * @file lv_sprite.h
+ *
+ */
+
+#ifndef LV_SPRITE_H
+#define LV_SPRITE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "../../misc/lv_types.h"
+#if LV_USE_SPRITE
+
+/*Testing of dependencies*/
+#if LV_USE_CANVAS == 0
+#error "lv_sprite: lv_canvas is required. Enable it in lv_conf.h (LV_USE_CANVAS 1)"
+#endif
+
+#include "../../draw/lv_draw_buf.h"
+#include "../../misc/lv_color.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/** A unique frame of a sprite sheet: the bounding rectangle of its visible pixels*/
+typedef struct {
+    uint16_t x;
+    uint16_t y;
+    uint16_t w;             /**< 0 if the frame is fully transparent*/
+    uint16_t h;
+    uint32_t data_ofs;      /**< Offset of the `w x h` color indices in `lv_sprite_sheet_t::indices`*/
+} lv_sprite_image_t;
+
+/** Frames of an animation with indexed colors. Made by `lv_sprite_bake_lottie()`*/
+typedef struct {
+    uint16_t w;             /**< Size of the frames*/
+    uint16_t h;
+    uint16_t fps;
+    uint16_t frame_cnt;
+    uint16_t image_cnt;     /**< Number of unique frames*/
+    uint16_t palette_size;  /**< At most 256, index 0 is transparent*/
+    const lv_color32_t * palette;       /**< Premultiplied colors*/
+    const lv_sprite_image_t * images;
+    const uint16_t * frames;            /**< The index of the image of each frame*/
+    const uint8_t * indices;
+    uint32_t indices_size;
+} lv_sprite_sheet_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**
+ * Create a sprite sheet player
+ * @param parent    pointer to the parent widget
+ * @return          pointer to the created sprite widget
+ */
+lv_obj_t * lv_sprite_create(lv_obj_t * parent);
+
+/**
+ * Set the frames to play. Start playing from the first frame.
+ * @param obj       pointer to a sprite widget
+ * @param sheet     the sprite sheet. Only its pointer is saved so it needs to be valid while the widget is used.
+ */
+void lv_sprite_set_src(lv_obj_t * obj, const lv_sprite_sheet_t * sheet);
+
+/**
+ * Set a buffer for the frames
+ * @param obj       pointer to a sprite widget
+ * @param w         width of the buffer, usually the width of the frames
+ * @param h         height of the buffer, usually the height of the frames
+ * @param buf       a static buffer with `LV_DRAW_BUF_SIZE(w, h, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED)` byte size.
+ *                  Its start is aligned to `LV_DRAW_BUF_ALIGN` internally.
+ */
+void lv_sprite_set_buffer(lv_obj_t * obj, int32_t w, int32_t h, void * buf);
+
+/**
+ * Set a draw buffer for the frames
+ * @param obj       pointer to a sprite widget
+ * @param draw_buf  an initialized draw buffer with ARGB8888_PREMULTIPLIED or RGB565 color format.
+ *                  With RGB565 the transparent pixels are black.
+ */
+void lv_sprite_set_draw_buf(lv_obj_t * obj, lv_draw_buf_t * draw_buf);
+
+/**
+ * Get the LVGL animation which controls the frames
+ * @param obj       pointer to a sprite widget
+ * @return          the LVGL animation
+ */
+lv_anim_t * lv_sprite_get_anim(lv_obj_t * obj);
+
+/**
+ * Get the index of the shown frame
+ * @param obj       pointer to a sprite widget
+ * @return          index of the frame or -1 if no frame is shown yet
+ */
+int32_t lv_sprite_get_frame(lv_obj_t * obj);
+
+#if LV_USE_THORVG
+
+/**
+ * Render a Lottie animation and store its frames with indexed colors.
+ * Identical frames are stored once and only the bounding box of the visible pixels is kept.
+ * Meant to run on a PC; the result can be saved with `lv_sprite_sheet_write_c()`.
+ * @param src       Lottie JSON data
+ * @param src_size  size of `src` in bytes
+ * @param w         width of the frames
+ * @param h         height of the frames
+ * @param fps       frames per second to render
+ * @return          the sprite sheet or NULL on error. Free it with `lv_sprite_sheet_delete()`.
+ */
+lv_sprite_sheet_t * lv_sprite_bake_lottie(const void * src, size_t src_size, int32_t w, int32_t h, uint32_t fps);
+
+/**
+ * Free a sprite sheet created by `lv_sprite_bake_lottie()`
+ * @param sheet     pointer to a sprite sheet
+ */
+void lv_sprite_sheet_delete(lv_sprite_sheet_t * sheet);
+
+#endif /*LV_USE_THORVG*/
+
+/**
+ * Save a sprite sheet as a C file
+ * @param sheet     pointer to a sprite sheet
+ * @param name      name of the `lv_sprite_sheet_t` variable in the file
+ * @param path      path of the file with driver letter, e.g. "A:face.c"
+ * @return          LV_RESULT_OK: the file is written
+ */
+lv_result_t lv_sprite_sheet_write_c(const lv_sprite_sheet_t * sheet, const char * name, const char * path);
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SPRITE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SPRITE_H*/
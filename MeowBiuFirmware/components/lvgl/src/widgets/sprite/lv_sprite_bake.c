@@ -0,0 +1,542 @@
+/**
+ * @file lv_sprite_bake.c
+ *
+ */
+
+/*********************
+ *      INCLUDES
+ *********************/
+#include "lv_sprite_private.h"
+#if LV_USE_SPRITE
+
+#include "../../misc/lv_fs.h"
+#include "../../stdlib/lv_sprintf.h"
+
+#if LV_USE_THORVG
+#if LV_USE_THORVG_EXTERNAL
+    #include <thorvg_capi.h>
+#else
+    #include "../../libs/thorvg/thorvg_capi.h"
+#endif
+#endif
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/*Index 0 is the transparent color, 255 more colors are available*/
+#define COLOR_MAX       255
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+/*Open addressing hash table of non-zero colors*/
+typedef struct {
+    uint32_t * keys;
+    uint32_t * values;
+    uint32_t cap;
+    uint32_t cnt;
+} color_table_t;
+
+#if LV_USE_THORVG
+/*Renders the frames one by one into the same buffer*/
+typedef struct {
+    Tvg_Animation * anim;
+    Tvg_Canvas * canvas;
+    uint32_t * px;          /*Premultiplied ARGB8888 pixels of the last rendered frame*/
+    int32_t w;
+    int32_t h;
+    float total;            /*Number of frames of the Lottie animation*/
+    uint32_t frame_cnt;     /*Number of frames to bake*/
+} renderer_t;
+#endif
+
+/**********************
+ *  STATIC PROTOTYPES
+ **********************/
+#if LV_USE_THORVG
+    static bool table_init(color_table_t * t, uint32_t cap);
+    static void table_deinit(color_table_t * t);
+    static uint32_t * table_get(color_table_t * t, uint32_t key, bool add);
+    static bool renderer_init(renderer_t * r, const void * src, size_t src_size, int32_t w, int32_t h, uint32_t fps);
+    static void renderer_deinit(renderer_t * r);
+    static const uint32_t * render_frame(renderer_t * r, uint32_t i);
+    static bool count_colors(const uint32_t * px, size_t px_cnt, color_table_t * colors);
+    static uint32_t bucket_key(uint32_t c, uint32_t mask);
+    static lv_color32_t * make_palette(color_table_t * colors, uint32_t * palette_size);
+    static bool indices_reserve(uint8_t ** indices, size_t * cap, size_t used, size_t size);
+    static bool add_frames(lv_sprite_sheet_t * sheet, renderer_t * r, color_table_t * colors);
+#endif
+static lv_result_t write_str(lv_fs_file_t * f, const char * str);
+static lv_result_t write_item(lv_fs_file_t * f, const char * item, uint32_t i, uint32_t cnt);
+
+/**********************
+ *  STATIC VARIABLES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+/**********************
+ *   GLOBAL FUNCTIONS
+ **********************/
+
+#if LV_USE_THORVG
+
+lv_sprite_sheet_t * lv_sprite_bake_lottie(const void * src, size_t src_size, int32_t w, int32_t h, uint32_t fps)
+{
+    LV_ASSERT_NULL(src);
+    if(w <= 0 || h <= 0 || w > UINT16_MAX || h > UINT16_MAX || fps == 0 || fps > UINT16_MAX) return NULL;
+
+    renderer_t r;
+    if(!renderer_init(&r, src, src_size, w, h, fps)) {
+        renderer_deinit(&r);
+        return NULL;
+    }
+
+    lv_sprite_sheet_t * sheet = lv_zalloc(sizeof(lv_sprite_sheet_t));
+    color_table_t colors = {0};
+    bool ok = sheet && table_init(&colors, 1024);
+    if(ok) {
+        sheet->w = (uint16_t)w;
+        sheet->h = (uint16_t)h;
+        sheet->fps = (uint16_t)fps;
+        sheet->frame_cnt = (uint16_t)r.frame_cnt;
+
+        /*Only one frame is kept in memory, so the frames are rendered twice:
+         *first to find the palette, then to convert them to color indices*/
+        uint32_t i;
+        for(i = 0; i < r.frame_cnt && ok; i++) {
+            ok = count_colors(render_frame(&r, i), (size_t)w * h, &colors);
+        }
+
+        uint32_t palette_size = 0;
+        if(ok) sheet->palette = make_palette(&colors, &palette_size);
+        sheet->palette_size = (uint16_t)palette_size;
+        ok = sheet->palette && add_frames(sheet, &r, &colors);
+    }
+
+    table_deinit(&colors);
+    renderer_deinit(&r);
+
+    if(!ok) {
+        LV_LOG_WARN("Couldn't bake the frames");
+        if(sheet) lv_sprite_sheet_delete(sheet);
+        return NULL;
+    }
+
+    return sheet;
+}
+
+void lv_sprite_sheet_delete(lv_sprite_sheet_t * sheet)
+{
+    if(sheet == NULL) return;
+
+    lv_free((void *)sheet->palette);
+    lv_free((void *)sheet->images);
+    lv_free((void *)sheet->frames);
+    lv_free((void *)sheet->indices);
+    lv_free(sheet);
+}
+
+#endif /*LV_USE_THORVG*/
+
+lv_result_t lv_sprite_sheet_write_c(const lv_sprite_sheet_t * sheet, const char * name, const char * path)
+{
+    LV_ASSERT_NULL(sheet);
+
+    lv_fs_file_t f;
+    if(lv_fs_open(&f, path, LV_FS_MODE_WR) != LV_FS_RES_OK) {
+        LV_LOG_WARN("Couldn't open %s", path);
+        return LV_RESULT_INVALID;
+    }
+
+    char buf[256];
+    lv_result_t res = write_str(&f, "#if defined(LV_LVGL_H_INCLUDE_SIMPLE)\n"
+                                "#include \"lvgl.h\"\n"
+                                "#else\n"
+                                "#include \"lvgl/lvgl.h\"\n"
+                                "#endif\n\n");
+
+    /*lv_color32_t is stored as blue, green, red, alpha*/
+    lv_snprintf(buf, sizeof(buf), "static const lv_color32_t %s_palette[] = {\n", name);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+    uint32_t i;
+    for(i = 0; i < sheet->palette_size && res == LV_RESULT_OK; i++) {
+        const lv_color32_t * c = &sheet->palette[i];
+        lv_snprintf(buf, sizeof(buf), "{0x%02x, 0x%02x, 0x%02x, 0x%02x}, ", c->blue, c->green, c->red, c->alpha);
+        res = write_item(&f, buf, i, sheet->palette_size);
+    }
+
+    lv_snprintf(buf, sizeof(buf), "};\n\nstatic const lv_sprite_image_t %s_images[] = {\n", name);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+    for(i = 0; i < sheet->image_cnt && res == LV_RESULT_OK; i++) {
+        const lv_sprite_image_t * img = &sheet->images[i];
+        lv_snprintf(buf, sizeof(buf), "{%d, %d, %d, %d, %d}, ", img->x, img->y, img->w, img->h, (int)img->data_ofs);
+        res = write_item(&f, buf, i, sheet->image_cnt);
+    }
+
+    lv_snprintf(buf, sizeof(buf), "};\n\nstatic const uint16_t %s_frames[] = {\n", name);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+    for(i = 0; i < sheet->frame_cnt && res == LV_RESULT_OK; i++) {
+        lv_snprintf(buf, sizeof(buf), "%d, ", sheet->frames[i]);
+        res = write_item(&f, buf, i, sheet->frame_cnt);
+    }
+
+    lv_snprintf(buf, sizeof(buf), "};\n\nstatic const LV_ATTRIBUTE_LARGE_CONST uint8_t %s_indices[] = {\n", name);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+    for(i = 0; i < sheet->indices_size && res == LV_RESULT_OK; i++) {
+        lv_snprintf(buf, sizeof(buf), "0x%02x, ", sheet->indices[i]);
+        res = write_item(&f, buf, i, sheet->indices_size);
+    }
+
+    lv_snprintf(buf, sizeof(buf), "};\n\nconst lv_sprite_sheet_t %s = {\n"
+                "    .w = %d,\n    .h = %d,\n    .fps = %d,\n    .frame_cnt = %d,\n"
+                "    .image_cnt = %d,\n    .palette_size = %d,\n", name,
+                sheet->w, sheet->h, sheet->fps, sheet->frame_cnt, sheet->image_cnt, sheet->palette_size);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+    lv_snprintf(buf, sizeof(buf), "    .palette = %s_palette,\n    .images = %s_images,\n    .frames = %s_frames,\n"
+                "    .indices = %s_indices,\n    .indices_size = sizeof(%s_indices),\n};\n", name, name, name, name, name);
+    if(res == LV_RESULT_OK) res = write_str(&f, buf);
+
+    lv_fs_close(&f);
+    return res;
+}
+
+/**********************
+ *   STATIC FUNCTIONS
+ **********************/
+
+#if LV_USE_THORVG
+
+static bool table_init(color_table_t * t, uint32_t cap)
+{
+    t->keys = lv_zalloc(cap * sizeof(uint32_t));
+    t->values = lv_zalloc(cap * sizeof(uint32_t));
+    t->cap = cap;
+    t->cnt = 0;
+    return t->keys && t->values;
+}
+
+static void table_deinit(color_table_t * t)
+{
+    lv_free(t->keys);
+    lv_free(t->values);
+    lv_memzero(t, sizeof(*t));
+}
+
+/*Get the value of a non-zero key. With `add` a missing key is added with 0 value.*/
+static uint32_t * table_get(color_table_t * t, uint32_t key, bool add)
+{
+    uint32_t i = (key * 2654435761u) & (t->cap - 1);
+    while(t->keys[i] != 0) {
+        if(t->keys[i] == key) return &t->values[i];
+        i = (i + 1) & (t->cap - 1);
+    }
+    if(!add) return NULL;
+
+    if((t->cnt + 1) * 2 > t->cap) {
+        color_table_t bigger;
+        /*Keep the size of the arrays in 32 bits*/
+        if(t->cap > UINT32_MAX / 2 / sizeof(uint32_t)) return NULL;
+        if(!table_init(&bigger, t->cap * 2)) {
+            table_deinit(&bigger);
+            return NULL;
+        }
+        uint32_t j;
+        for(j = 0; j < t->cap; j++) {
+            if(t->keys[j]) *table_get(&bigger, t->keys[j], true) = t->values[j];
+        }
+        table_deinit(t);
+        *t = bigger;
+        return table_get(t, key, true);
+    }
+
+    t->keys[i] = key;
+    t->cnt++;
+    return &t->values[i];
+}
+
+static bool renderer_init(renderer_t * r, const void * src, size_t src_size, int32_t w, int32_t h, uint32_t fps)
+{
+    lv_memzero(r, sizeof(*r));
+    r->anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(r->anim);
+    if(tvg_picture_load_data(picture, src, (uint32_t)src_size, "lottie", true) != TVG_RESULT_SUCCESS) {
+        LV_LOG_WARN("Couldn't load the Lottie animation");
+        return false;
+    }
+    tvg_picture_set_size(picture, (float)w, (float)h);
+
+    float duration;
+    tvg_animation_get_total_frame(r->anim, &r->total);
+    tvg_animation_get_duration(r->anim, &duration);
+    uint32_t cnt = (uint32_t)(duration * fps + 0.5f);
+    if(cnt == 0) cnt = 1;
+    if(cnt > UINT16_MAX) cnt = UINT16_MAX;
+    r->frame_cnt = cnt;
+
+    /*With 16 bit sizes a frame can be larger than a 32 bit size_t*/
+    if((size_t)w > SIZE_MAX / sizeof(uint32_t) / (size_t)h) {
+        LV_LOG_WARN("The frames are too large");
+        return false;
+    }
+
+    r->w = w;
+    r->h = h;
+    r->px = lv_malloc((size_t)w * h * sizeof(uint32_t));
+    r->canvas = tvg_swcanvas_create();
+    if(r->px == NULL || r->canvas == NULL) {
+        LV_LOG_WARN("Out of memory");
+        return false;
+    }
+
+    tvg_swcanvas_set_target(r->canvas, r->px, w, w, h, TVG_COLORSPACE_ARGB8888);
+    tvg_canvas_push(r->canvas, picture);
+    return true;
+}
+
+static void renderer_deinit(renderer_t * r)
+{
+    if(r->anim) tvg_animation_del(r->anim);
+    if(r->canvas) tvg_canvas_destroy(r->canvas);
+    lv_free(r->px);
+    lv_memzero(r, sizeof(*r));
+}
+
+/*Render the `i`th frame as premultiplied ARGB8888 pixels*/
+static const uint32_t * render_frame(renderer_t * r, uint32_t i)
+{
+    lv_memzero(r->px, (size_t)r->w * r->h * sizeof(uint32_t));
+    tvg_swcanvas_set_target(r->canvas, r->px, r->w, r->w, r->h, TVG_COLORSPACE_ARGB8888);
+    tvg_animation_set_frame(r->anim, r->total * i / r->frame_cnt);
+    tvg_canvas_update(r->canvas);
+    tvg_canvas_draw(r->canvas);
+    tvg_canvas_sync(r->canvas);
+    return r->px;
+}
+
+/*Count the pixels of each non-zero color*/
+static bool count_colors(const uint32_t * px, size_t px_cnt, color_table_t * colors)
+{
+    size_t i;
+    for(i = 0; i < px_cnt; i++) {
+        if(px[i] == 0) continue;
+        uint32_t * cnt = table_get(colors, px[i], true);
+        if(cnt == NULL) return false;
+        (*cnt)++;
+    }
+    return true;
+}
+
+/*The key of the palette bucket of `c`. 0 means transparent, so it's used only for alpha == 0.*/
+static uint32_t bucket_key(uint32_t c, uint32_t mask)
+{
+    if((c >> 24) == 0) return 0;
+
+    /*If bits are dropped, the lowest bit of the keys is 0, so 1 can't be another bucket*/
+    uint32_t key = c & mask;
+    return key ? key : 1;
+}
+
+/*Find the colors of the palette. Drop more and more lower bits of the channels until at most
+ *COLOR_MAX colors remain and use the weighted average of the merged colors.
+ *`colors` holds the pixel count of the original colors, and is changed to map them to the palette index.*/
+static lv_color32_t * make_palette(color_table_t * colors, uint32_t * palette_size)
+{
+    uint32_t i;
+    color_table_t buckets;
+    if(!table_init(&buckets, 1024)) {
+        table_deinit(&buckets);
+        return NULL;
+    }
+
+    uint32_t mask = 0xffffffff;
+    uint32_t shift;
+    for(shift = 0; shift < 8; shift++) {
+        mask = (0xffu << shift) & 0xff;
+        mask = mask | (mask << 8) | (mask << 16) | (mask << 24);
+
+        lv_memzero(buckets.keys, buckets.cap * sizeof(uint32_t));
+        buckets.cnt = 0;
+        for(i = 0; i < colors->cap && buckets.cnt <= COLOR_MAX; i++) {
+            uint32_t key = bucket_key(colors->keys[i], mask);
+            if(key && table_get(&buckets, key, true) == NULL) {
+                table_deinit(&buckets);
+                return NULL;
+            }
+        }
+        if(buckets.cnt <= COLOR_MAX) break;
+    }
+
+    /*Number the buckets and sum their colors*/
+    uint64_t sums[COLOR_MAX + 1][5];
+    lv_memzero(sums, sizeof(sums));
+    uint32_t size = 1;
+    for(i = 0; i < buckets.cap; i++) {
+        if(buckets.keys[i]) buckets.values[i] = size++;
+    }
+
+    for(i = 0; i < colors->cap; i++) {
+        if(colors->keys[i] == 0) continue;
+        uint32_t key = bucket_key(colors->keys[i], mask);
+        uint32_t idx = key ? *table_get(&buckets, key, false) : 0;
+        uint32_t w = colors->values[i];
+        uint32_t c = colors->keys[i];
+        sums[idx][0] += (c & 0xff) * w;
+        sums[idx][1] += ((c >> 8) & 0xff) * w;
+        sums[idx][2] += ((c >> 16) & 0xff) * w;
+        sums[idx][3] += (c >> 24) * w;
+        sums[idx][4] += w;
+        colors->values[i] = idx;
+    }
+    table_deinit(&buckets);
+
+    lv_color32_t * palette = lv_zalloc(size * sizeof(lv_color32_t));
+    if(palette == NULL) return NULL;
+    for(i = 1; i < size; i++) {
+        uint64_t w = sums[i][4];
+        palette[i].blue = (uint8_t)((sums[i][0] + w / 2) / w);
+        palette[i].green = (uint8_t)((sums[i][1] + w / 2) / w);
+        palette[i].red = (uint8_t)((sums[i][2] + w / 2) / w);
+        palette[i].alpha = (uint8_t)((sums[i][3] + w / 2) / w);
+    }
+
+    *palette_size = size;
+    return palette;
+}
+
+/*Make room for `size` more bytes in `indices` which has `cap` bytes.
+ *The total has to fit into `lv_sprite_sheet_t::indices_size`.*/
+static bool indices_reserve(uint8_t ** indices, size_t * cap, size_t used, size_t size)
+{
+    if(size > UINT32_MAX - used) return false;
+    if(used + size <= *cap) return true;
+
+    size_t new_cap = *cap > SIZE_MAX / 2 ? SIZE_MAX : *cap * 2;
+    if(new_cap < used + size) new_cap = used + size;
+    uint8_t * new_indices = lv_realloc(*indices, new_cap);
+    if(new_indices == NULL) return false;
+    *indices = new_indices;
+    *cap = new_cap;
+    return true;
+}
+
+/*Crop the frames to their visible pixels and store each different one once*/
+static bool add_frames(lv_sprite_sheet_t * sheet, renderer_t * r, color_table_t * colors)
+{
+    size_t px_cnt = (size_t)sheet->w * sheet->h;
+    size_t indices_cap = px_cnt;
+    uint16_t * frame_images = lv_malloc(sheet->frame_cnt * sizeof(uint16_t));
+    lv_sprite_image_t * images = lv_malloc(sheet->frame_cnt * sizeof(lv_sprite_image_t));
+    uint8_t * indices = lv_malloc(indices_cap);
+    uint8_t * frame_indices = lv_malloc(px_cnt);
+    sheet->frames = frame_images;
+    sheet->images = images;
+    sheet->indices = indices;
+    if(frame_images == NULL || images == NULL || indices == NULL || frame_indices == NULL) {
+        lv_free(frame_indices);
+        return false;
+    }
+
+    size_t indices_size = 0;
+    uint32_t image_cnt = 0;
+    uint32_t f;
+    for(f = 0; f < sheet->frame_cnt; f++) {
+        const uint32_t * px = render_frame(r, f);
+        int32_t x1 = sheet->w, y1 = sheet->h, x2 = -1, y2 = -1;
+        int32_t x, y;
+        for(y = 0; y < sheet->h; y++) {
+            for(x = 0; x < sheet->w; x++) {
+                size_t ofs = (size_t)y * sheet->w + x;
+                uint32_t c = px[ofs];
+                uint8_t idx = 0;
+                if(c) {
+                    /*Rendering the same frame again should give the same colors*/
+                    const uint32_t * palette_idx = table_get(colors, c, false);
+                    if(palette_idx == NULL) {
+                        LV_LOG_WARN("Frame %" LV_PRIu32 " has a color which wasn't in the first pass", f);
+                        lv_free(frame_indices);
+                        return false;
+                    }
+                    idx = (uint8_t) * palette_idx;
+                }
+                frame_indices[ofs] = idx;
+                if(idx == 0) continue;
+                if(x < x1) x1 = x;
+                if(x > x2) x2 = x;
+                if(y < y1) y1 = y;
+                if(y > y2) y2 = y;
+            }
+        }
+
+        lv_sprite_image_t img = {0};
+        if(x2 >= 0) {
+            img.x = (uint16_t)x1;
+            img.y = (uint16_t)y1;
+            img.w = (uint16_t)(x2 - x1 + 1);
+            img.h = (uint16_t)(y2 - y1 + 1);
+        }
+
+        /*Copy the cropped indices to the end of the buffer and drop them if there is the same image already*/
+        size_t crop_size = (size_t)img.w * img.h;
+        if(!indices_reserve(&indices, &indices_cap, indices_size, crop_size)) {
+            sheet->indices = indices;
+            lv_free(frame_indices);
+            return false;
+        }
+        sheet->indices = indices;
+
+        uint8_t * crop = indices + indices_size;
+        for(y = 0; y < img.h; y++) {
+            lv_memcpy(crop + (size_t)y * img.w, frame_indices + (size_t)(img.y + y) * sheet->w + img.x, img.w);
+        }
+
+        uint32_t i;
+        for(i = 0; i < image_cnt; i++) {
+            if(images[i].x == img.x && images[i].y == img.y && images[i].w == img.w && images[i].h == img.h &&
+               lv_memcmp(indices + images[i].data_ofs, crop, crop_size) == 0) break;
+        }
+
+        if(i == image_cnt) {
+            img.data_ofs = (uint32_t)indices_size;
+            images[image_cnt++] = img;
+            indices_size += crop_size;
+        }
+        frame_images[f] = (uint16_t)i;
+    }
+    lv_free(frame_indices);
+
+    sheet->image_cnt = (uint16_t)image_cnt;
+    sheet->indices_size = (uint32_t)indices_size;
+
+    /*Shrink to the used size. Keep at least one byte to have a valid pointer.*/
+    sheet->images = lv_realloc(images, image_cnt * sizeof(lv_sprite_image_t));
+    sheet->indices = lv_realloc(indices, indices_size ? indices_size : 1);
+    if(sheet->images == NULL) sheet->images = images;
+    if(sheet->indices == NULL) sheet->indices = indices;
+    return true;
+}
+
+#endif /*LV_USE_THORVG*/
+
+static lv_result_t write_str(lv_fs_file_t * f, const char * str)
+{
+    uint32_t len = lv_strlen(str);
+    uint32_t bw;
+    if(lv_fs_write(f, str, len, &bw) != LV_FS_RES_OK || bw != len) return LV_RESULT_INVALID;
+    return LV_RESULT_OK;
+}
+
+/*Write the `i`th of `cnt` array items, 16 per line*/
+static lv_result_t write_item(lv_fs_file_t * f, const char * item, uint32_t i, uint32_t cnt)
+{
+    if(i % 16 == 0 && write_str(f, "    ") != LV_RESULT_OK) return LV_RESULT_INVALID;
+    if(write_str(f, item) != LV_RESULT_OK) return LV_RESULT_INVALID;
+    if((i % 16 == 15 || i == cnt - 1) && write_str(f, "\n") != LV_RESULT_OK) return LV_RESULT_INVALID;
+    return LV_RESULT_OK;
+}
+
+#endif /*LV_USE_SPRITE*/
@@ -0,0 +1,53 @@
+/**
+ * @file lv_sprite_private.h
+ *
+ */
+
+#ifndef LV_SPRITE_PRIVATE_H
+#define LV_SPRITE_PRIVATE_H
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+/*********************
+ *      INCLUDES
+ *********************/
+
+#include "../../lv_conf_internal.h"
+#if LV_USE_SPRITE
+
+#include "lv_sprite.h"
+#include "../canvas/lv_canvas_private.h"
+
+/*********************
+ *      DEFINES
+ *********************/
+
+/**********************
+ *      TYPEDEFS
+ **********************/
+
+typedef struct {
+    lv_canvas_t canvas;
+    const lv_sprite_sheet_t * sheet;
+    lv_anim_t * anim;
+    int32_t frame;              /**< Shown frame, -1 if none*/
+    int32_t image;              /**< Image drawn to the buffer, -1 if none*/
+} lv_sprite_t;
+
+/**********************
+ * GLOBAL PROTOTYPES
+ **********************/
+
+/**********************
+ *      MACROS
+ **********************/
+
+#endif /*LV_USE_SPRITE*/
+
+#ifdef __cplusplus
+} /*extern "C"*/
+#endif
+
+#endif /*LV_SPRITE_PRIVATE_H*/
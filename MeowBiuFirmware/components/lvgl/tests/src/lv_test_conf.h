@@ -22,7 +22,12 @@ extern "C" {
 #define LV_USE_STDLIB_SPRINTF       LV_STDLIB_CLIB
 #define LV_USE_OS                   LV_OS_PTHREAD
 #define LV_OBJ_STYLE_CACHE          0
+#define LV_OBJ_STYLE_RESOLVED_CACHE 1
+#define LV_USE_TIMER_HEAP           1
 #define LV_BIN_DECODER_RAM_LOAD     1   /* Run test with bin image loaded to RAM */
+#if defined(__SSE2__)
+#define LV_USE_DRAW_SW_ASM          LV_DRAW_SW_ASM_X86  /* The other config covers the generic C renderer */
+#endif
 #endif
 
 #ifdef LVGL_CI_USING_DEF_HEAP
@@ -30,7 +35,10 @@ extern "C" {
 #define LV_USE_STDLIB_STRING    LV_STDLIB_BUILTIN
 #define LV_USE_STDLIB_SPRINTF   LV_STDLIB_BUILTIN
 #define LV_OBJ_STYLE_CACHE      1
+#define LV_OBJ_STYLE_RESOLVED_CACHE 0
+#define LV_USE_TIMER_HEAP       0
 #define LV_BIN_DECODER_RAM_LOAD 0
+#define LV_MEM_SLAB             1
 #endif
 
 #ifdef MICROPYTHON
@@ -2,6 +2,7 @@
 #define LV_TEST_CONF_FULL_H
 
 #define LV_MEM_SIZE                     (32 * 1024 * 1024)
+#define LV_USE_MEM_PROFILER             1
 #define LV_DRAW_SW_SHADOW_CACHE_SIZE    8
 #define LV_DRAW_THREAD_STACK_SIZE    (64 * 1024) /*Increase stack size to 64KB in order to run ThorVG*/
 #define LV_USE_LOG              1
@@ -45,6 +46,7 @@
 #define LV_FONT_DEFAULT         &lv_font_montserrat_14
 #define LV_FONT_FMT_TXT_LARGE   1
 #define LV_USE_FONT_COMPRESSED  1
+#define LV_FONT_COMPRESSED_CACHE_SIZE   (16 * 1024)
 #define LV_USE_BIDI 1
 #define LV_USE_ARABIC_PERSIAN_CHARS 1
 #define LV_USE_PERF_MONITOR         1
@@ -53,6 +55,8 @@
 
 #define LV_USE_CALENDAR_CHINESE 1
 #define LV_USE_LOTTIE 1
+#define LV_USE_SPRITE 1
+#define LV_USE_FACE 1
 
 #define LV_USE_FLEX 1
 #define LV_USE_GRID 1
@@ -0,0 +1,318 @@
+#include "../../../lvgl.h"
+#if LV_BUILD_TEST
+
+/*The 80x80 `excited_start` GIF of the firmware's face component*/
+
+#ifndef LV_ATTRIBUTE_MEM_ALIGN
+    #define LV_ATTRIBUTE_MEM_ALIGN
+#endif
+
+#ifndef LV_ATTRIBUTE_IMG_TEST_IMG_FACE_GIF
+    #define LV_ATTRIBUTE_IMG_TEST_IMG_FACE_GIF
+#endif
+
+const LV_ATTRIBUTE_MEM_ALIGN LV_ATTRIBUTE_LARGE_CONST LV_ATTRIBUTE_IMG_TEST_IMG_FACE_GIF uint8_t
+test_img_face_gif_map[] = {
+    0x47,0x49,0x46,0x38,0x39,0x61,0x50,0x00,0x50,0x00,0xf7,0x00,0x00,0x00,0x00,0x00,
+    0x00,0x01,0x00,0x01,0x01,0x01,0x02,0x02,0x02,0x03,0x03,0x03,0x04,0x04,0x04,0x05,
+    0x05,0x05,0x06,0x06,0x06,0x07,0x07,0x07,0x08,0x08,0x08,0x09,0x09,0x09,0x0a,0x0a,
+    0x0a,0x0b,0x0b,0x0b,0x0c,0x0c,0x0c,0x0d,0x0d,0x0d,0x0e,0x0e,0x0e,0x0f,0x0f,0x0f,
+    0x10,0x10,0x10,0x11,0x11,0x11,0x12,0x12,0x12,0x13,0x13,0x13,0x14,0x14,0x14,0x15,
+    0x15,0x15,0x16,0x16,0x16,0x17,0x17,0x17,0x18,0x18,0x18,0x19,0x19,0x19,0x1a,0x1a,
+    0x1a,0x1b,0x1b,0x1b,0x1c,0x1c,0x1c,0x1d,0x1d,0x1d,0x1e,0x1e,0x1e,0x1f,0x1f,0x1f,
+    0x20,0x20,0x20,0x21,0x21,0x21,0x22,0x22,0x22,0x23,0x23,0x23,0x24,0x24,0x24,0x25,
+    0x25,0x25,0x26,0x26,0x26,0x27,0x27,0x27,0x28,0x28,0x28,0x29,0x29,0x29,0x2a,0x2a,
+    0x2a,0x2b,0x2b,0x2b,0x2c,0x2c,0x2c,0x2d,0x2d,0x2d,0x2e,0x2e,0x2e,0x2f,0x2f,0x2f,
+    0x30,0x30,0x30,0x31,0x31,0x31,0x32,0x32,0x32,0x33,0x33,0x33,0x34,0x34,0x34,0x35,
+    0x35,0x35,0x36,0x36,0x36,0x37,0x37,0x37,0x38,0x38,0x38,0x39,0x39,0x39,0x3a,0x3a,
+    0x3a,0x3b,0x3b,0x3b,0x3c,0x3c,0x3c,0x3d,0x3d,0x3d,0x3e,0x3e,0x3e,0x3f,0x3f,0x3f,
+    0x40,0x40,0x40,0x41,0x41,0x41,0x42,0x42,0x42,0x43,0x43,0x43,0x44,0x44,0x44,0x45,
+    0x45,0x45,0x46,0x46,0x46,0x47,0x47,0x47,0x48,0x48,0x48,0x49,0x49,0x49,0x4a,0x4a,
+    0x4a,0x4b,0x4b,0x4b,0x4c,0x4c,0x4c,0x4d,0x4d,0x4d,0x4e,0x4e,0x4e,0x4f,0x4f,0x4f,
+    0x50,0x50,0x50,0x51,0x51,0x51,0x52,0x52,0x52,0x53,0x53,0x53,0x54,0x54,0x54,0x55,
+    0x55,0x55,0x56,0x56,0x56,0x57,0x57,0x57,0x58,0x58,0x58,0x59,0x59,0x59,0x5a,0x5a,
+    0x5a,0x5b,0x5b,0x5b,0x5c,0x5c,0x5c,0x5d,0x5d,0x5d,0x5e,0x5e,0x5e,0x5f,0x5f,0x5f,
+    0x60,0x60,0x60,0x61,0x61,0x61,0x62,0x62,0x62,0x63,0x63,0x63,0x64,0x64,0x64,0x65,
+    0x65,0x65,0x66,0x66,0x66,0x67,0x67,0x67,0x68,0x68,0x68,0x69,0x69,0x69,0x6a,0x6a,
+    0x6a,0x6b,0x6b,0x6b,0x6c,0x6c,0x6c,0x6d,0x6d,0x6d,0x6e,0x6e,0x6e,0x6f,0x6f,0x6f,
+    0x70,0x70,0x70,0x71,0x71,0x71,0x72,0x72,0x72,0x73,0x73,0x73,0x74,0x74,0x74,0x75,
+    0x75,0x75,0x76,0x76,0x76,0x77,0x77,0x77,0x78,0x78,0x78,0x79,0x79,0x79,0x7a,0x7a,
+    0x7a,0x7b,0x7b,0x7b,0x7c,0x7c,0x7c,0x7d,0x7d,0x7d,0x7e,0x7e,0x7e,0x7f,0x7f,0x7f,
+    0x80,0x80,0x80,0x81,0x81,0x81,0x82,0x82,0x82,0x83,0x83,0x83,0x84,0x84,0x84,0x86,
+    0x86,0x86,0x87,0x87,0x87,0x88,0x88,0x88,0x89,0x89,0x89,0x8a,0x8a,0x8a,0x8b,0x8b,
+    0x8b,0x8c,0x8c,0x8c,0x8d,0x8d,0x8d,0x8e,0x8e,0x8e,0x8f,0x8f,0x8f,0x90,0x90,0x90,
+    0x91,0x91,0x91,0x92,0x92,0x92,0x93,0x93,0x93,0x94,0x94,0x94,0x95,0x95,0x95,0x96,
+    0x96,0x96,0x97,0x97,0x97,0x98,0x98,0x98,0x99,0x99,0x99,0x9a,0x9a,0x9a,0x9b,0x9b,
+    0x9b,0x9c,0x9c,0x9c,0x9d,0x9d,0x9d,0x9e,0x9e,0x9e,0x9f,0x9f,0x9f,0xa0,0xa0,0xa0,
+    0xa2,0xa2,0xa2,0xa3,0xa3,0xa3,0xa4,0xa4,0xa4,0xa5,0xa5,0xa5,0xa6,0xa6,0xa6,0xa7,
+    0xa7,0xa7,0xa8,0xa8,0xa8,0xa9,0xa9,0xa9,0xaa,0xaa,0xaa,0xab,0xab,0xab,0xac,0xac,
+    0xac,0xad,0xad,0xad,0xae,0xae,0xae,0xaf,0xaf,0xaf,0xb0,0xb0,0xb0,0xb1,0xb1,0xb1,
+    0xb2,0xb2,0xb2,0xb3,0xb3,0xb3,0xb4,0xb4,0xb4,0xb5,0xb5,0xb5,0xb6,0xb6,0xb6,0xb7,
+    0xb7,0xb7,0xb8,0xb8,0xb8,0xb9,0xb9,0xb9,0xba,0xba,0xba,0xbb,0xbb,0xbb,0xbc,0xbc,
+    0xbc,0xbd,0xbd,0xbd,0xbe,0xbe,0xbe,0xbf,0xbf,0xbf,0xc0,0xc0,0xc0,0xc1,0xc1,0xc1,
+    0xc2,0xc2,0xc2,0xc3,0xc3,0xc3,0xc4,0xc4,0xc4,0xc5,0xc5,0xc5,0xc6,0xc6,0xc6,0xc7,
+    0xc7,0xc7,0xc8,0xc8,0xc8,0xc9,0xc9,0xc9,0xca,0xca,0xca,0xcb,0xcb,0xcb,0xcc,0xcc,
+    0xcc,0xcd,0xcd,0xcd,0xce,0xce,0xce,0xcf,0xcf,0xcf,0xd0,0xd0,0xd0,0xd1,0xd1,0xd1,
+    0xd2,0xd2,0xd2,0xd3,0xd3,0xd3,0xd4,0xd4,0xd4,0xd5,0xd5,0xd5,0xd6,0xd6,0xd6,0xd7,
+    0xd7,0xd7,0xd8,0xd8,0xd8,0xd9,0xd9,0xd9,0xda,0xda,0xda,0xdb,0xdb,0xdb,0xdc,0xdc,
+    0xdc,0xdd,0xdd,0xdd,0xde,0xde,0xde,0xdf,0xdf,0xdf,0xe0,0xe0,0xe0,0xe1,0xe1,0xe1,
+    0xe2,0xe2,0xe2,0xe3,0xe3,0xe3,0xe4,0xe4,0xe4,0xe5,0xe5,0xe5,0xe6,0xe6,0xe6,0xe7,
+    0xe7,0xe7,0xe8,0xe8,0xe8,0xe9,0xe9,0xe9,0xea,0xea,0xea,0xeb,0xeb,0xeb,0xec,0xec,
+    0xec,0xed,0xed,0xed,0xee,0xee,0xee,0xef,0xef,0xef,0xf0,0xf0,0xf0,0xf1,0xf1,0xf1,
+    0xf2,0xf2,0xf2,0xf3,0xf3,0xf3,0xf4,0xf4,0xf4,0xf5,0xf5,0xf5,0xf6,0xf6,0xf6,0xf7,
+    0xf7,0xf7,0xf8,0xf8,0xf8,0xf9,0xf9,0xf9,0xfa,0xfa,0xfa,0xfb,0xfb,0xfb,0xfc,0xfc,
+    0xfc,0xfd,0xfd,0xfd,0xfe,0xfe,0xfe,0xff,0xff,0xff,0x00,0xff,0x00,0x21,0xff,0x0b,
+    0x4e,0x45,0x54,0x53,0x43,0x41,0x50,0x45,0x32,0x2e,0x30,0x03,0x01,0x00,0x00,0x00,
+    0x21,0xfe,0x29,0x47,0x49,0x46,0x20,0x72,0x65,0x73,0x69,0x7a,0x65,0x64,0x20,0x77,
+    0x69,0x74,0x68,0x20,0x68,0x74,0x74,0x70,0x73,0x3a,0x2f,0x2f,0x65,0x7a,0x67,0x69,
+    0x66,0x2e,0x63,0x6f,0x6d,0x2f,0x72,0x65,0x73,0x69,0x7a,0x65,0x00,0x21,0xf9,0x04,
+    0x05,0x08,0x00,0xff,0x00,0x2c,0x00,0x00,0x00,0x00,0x50,0x00,0x50,0x00,0x00,0x08,
+    0xff,0x00,0x01,0x08,0x1c,0x48,0xb0,0xa0,0xc1,0x83,0x08,0x13,0x2a,0x5c,0xc8,0xb0,
+    0xa1,0xc3,0x87,0x10,0x23,0x4a,0x9c,0x48,0xb1,0xa2,0xc5,0x8b,0x18,0x33,0x6a,0xdc,
+    0xc8,0xb1,0xa3,0xc7,0x8f,0x20,0x43,0x8a,0x1c,0x49,0xb2,0xa4,0xc9,0x93,0x28,0x53,
+    0xaa,0x5c,0xc9,0xb2,0xa5,0xcb,0x97,0x30,0x63,0xca,0x9c,0x49,0xb3,0xa6,0xcd,0x9b,
+    0x38,0x73,0xea,0xdc,0xc9,0xb3,0xa7,0xcf,0x9f,0x40,0x83,0x8a,0x2c,0xa3,0xaa,0xd9,
+    0x37,0x73,0xe2,0xa6,0xd1,0xe2,0x73,0xc0,0x22,0x8e,0x4a,0xc0,0xb0,0x91,0x1b,0x77,
+    0xed,0x97,0x24,0x19,0x24,0x11,0x71,0xeb,0xc7,0xb5,0x6b,0xd7,0x74,0xa3,0x34,0x48,
+    0xb4,0x32,0xec,0x9e,0x57,0xaf,0xf5,0x7e,0x3d,0x01,0x29,0xe4,0xd9,0xd9,0xb7,0x5c,
+    0xc7,0xa9,0x81,0x38,0xca,0x1e,0xdc,0xb3,0xf4,0x38,0x79,0xec,0x92,0xee,0x2e,0x5c,
+    0x7b,0x86,0x1a,0x3e,0x20,0xe6,0x17,0x6e,0x2f,0x02,0x1b,0x9b,0xac,0x2b,0x0c,0x17,
+    0x9f,0x1f,0x86,0xc2,0x18,0xc3,0xd5,0xa5,0x11,0x41,0x36,0xc9,0x70,0xe1,0x25,0x51,
+    0xf8,0x09,0xf3,0x5b,0x7e,0x94,0x32,0x82,0xf2,0x0c,0x17,0x59,0x42,0x26,0xf4,0x48,
+    0x9f,0x8d,0xe7,0xe3,0x62,0x87,0x76,0xaa,0xcf,0xee,0x2b,0x83,0x70,0x57,0xec,0xb3,
+    0xb2,0x2e,0x3e,0xba,0x7d,0x96,0xd7,0x41,0x11,0xf2,0x78,0x77,0x75,0xa7,0xc0,0x62,
+    0x32,0xe1,0x5f,0x0f,0x16,0x42,0xde,0xf5,0x8e,0x45,0x74,0xcc,0xb9,0x1e,0x31,0x28,
+    0x2b,0x7a,0xbf,0x54,0x15,0x0f,0xe0,0xb3,0xbe,0xc7,0xe0,0xf1,0xe8,0xc1,0x2a,0xa2,
+    0xe2,0xb0,0xde,0x0f,0x91,0xc1,0x69,0xd6,0x95,0x55,0xdc,0xc0,0xcf,0x7a,0x21,0x83,
+    0x6e,0xa3,0x9b,0xae,0x18,0x3c,0x7a,0x1a,0x83,0xc1,0xac,0xe3,0xb2,0xb8,0x2d,0xfa,
+    0x3d,0x0e,0x06,0x85,0x62,0xdd,0x25,0x16,0xc5,0x12,0x9d,0x35,0x07,0x79,0x11,0xdd,
+    0x3e,0x4c,0x58,0xf4,0xc5,0x3e,0xcc,0xe9,0x75,0x90,0x37,0xcc,0x5d,0x83,0x11,0x34,
+    0xc8,0xb5,0x43,0x02,0x42,0x93,0x30,0x77,0x08,0x46,0x63,0x98,0xc5,0x1b,0x81,0x08,
+    0x0d,0xd0,0x1f,0x6f,0xd4,0x68,0x24,0x0a,0x6f,0xea,0x29,0xf4,0xc5,0x3c,0xb7,0xc1,
+    0x23,0xc5,0x46,0xb6,0xa9,0xb6,0x0d,0x0b,0x0c,0x05,0x22,0xa2,0x67,0xf5,0x38,0xb7,
+    0x91,0x00,0xb0,0x40,0x88,0xd9,0x33,0x30,0x38,0xc4,0x07,0x3c,0x9e,0xb5,0x33,0xc7,
+    0x47,0x82,0x9c,0xc3,0x98,0x3c,0xa1,0x0c,0x00,0xd1,0x13,0xce,0xb4,0xe7,0xd7,0x3e,
+    0xc9,0x14,0x11,0x92,0x05,0x98,0x64,0xa3,0xcf,0x59,0xfc,0x8c,0xb3,0xca,0x0e,0x14,
+    0xd5,0x81,0x4c,0x6a,0x67,0xc9,0x53,0x8c,0x1b,0x26,0xdd,0x00,0x48,0x27,0xa7,0x80,
+    0x92,0x48,0x13,0x19,0x61,0x20,0x07,0x26,0xa8,0x9c,0x72,0xc9,0x1b,0x10,0x08,0xe5,
+    0xe7,0x9f,0x80,0x06,0x2a,0xe8,0xa0,0x84,0x16,0x6a,0xe8,0xa1,0x88,0x26,0xaa,0xe8,
+    0xa2,0x8c,0x36,0xea,0xe8,0xa3,0x90,0x46,0x2a,0xe9,0xa4,0x94,0x56,0x6a,0xe9,0xa5,
+    0x2f,0x05,0x04,0x00,0x21,0xf9,0x04,0x05,0x09,0x00,0xff,0x00,0x2c,0x09,0x00,0x15,
+    0x00,0x3d,0x00,0x20,0x00,0x00,0x08,0xff,0x00,0xff,0x09,0x1c,0x48,0x50,0x47,0x21,
+    0x52,0xb5,0x74,0xe5,0x72,0x65,0x69,0x0c,0x01,0x82,0x10,0x23,0x4a,0xfc,0x37,0x00,
+    0x89,0x9d,0x42,0x88,0xfe,0x7c,0xa9,0x30,0xb1,0x23,0x8e,0x53,0xde,0xf4,0xf5,0x1b,
+    0x49,0x72,0xa4,0x3b,0x61,0x6b,0x3a,0x76,0xb4,0xf1,0x49,0x1a,0x3c,0x7e,0x25,0xfb,
+    0xdd,0xeb,0x16,0xcb,0x8a,0x4a,0x81,0x14,0x50,0xcd,0x8b,0xc9,0x73,0x24,0xbf,0x66,
+    0x51,0x6e,0x0e,0xb4,0x71,0xab,0x5e,0xcf,0x98,0xfa,0x92,0x4d,0xe9,0x98,0x64,0xdb,
+    0xd1,0xa7,0xf2,0x06,0x09,0xdd,0xc3,0xee,0x69,0x4f,0x7a,0x91,0x24,0x26,0x31,0x67,
+    0xf5,0x29,0x3e,0x43,0x2a,0x1f,0xe1,0xeb,0xda,0x73,0x1f,0x28,0x88,0x10,0xb4,0x91,
+    0x7d,0x4a,0x8f,0xcb,0xc4,0x3b,0x63,0xd7,0xf2,0xdc,0x07,0x76,0x20,0x29,0xb9,0x4f,
+    0xa7,0x49,0x4c,0x91,0x0e,0x6f,0xcf,0x76,0x33,0x04,0x82,0x78,0xd7,0xb3,0xe3,0xd1,
+    0x39,0x11,0x51,0x1d,0x9d,0x78,0x74,0x95,0x40,0x47,0x3c,0x85,0xfe,0xe3,0x09,0x2c,
+    0x22,0xba,0xc8,0x37,0x79,0xa2,0x13,0x28,0x2c,0xa6,0x64,0x81,0x31,0xcd,0x41,0x1c,
+    0xe3,0xf9,0xf3,0xe4,0x92,0x6e,0x9d,0x92,0x34,0x0d,0x9a,0x64,0x3e,0x07,0x04,0x35,
+    0x95,0x64,0xdd,0x7a,0x64,0xd6,0x72,0xab,0x69,0x9f,0x1e,0x99,0x83,0x60,0xab,0xdc,
+    0xb4,0x4b,0x96,0xfa,0x47,0x6e,0xa4,0xee,0x81,0x24,0x61,0x10,0x7c,0x05,0x3c,0xf8,
+    0xc8,0x53,0xff,0xb0,0x19,0x3f,0x7e,0xba,0xde,0x00,0x82,0xa3,0xa6,0x53,0x1f,0x69,
+    0xe9,0x9f,0xaf,0x7e,0xd4,0x91,0x7f,0xff,0x83,0x18,0x48,0xfb,0xf1,0x91,0x6d,0xfe,
+    0x31,0x02,0x1f,0x7e,0xf2,0x2d,0x88,0x30,0xf0,0xb5,0x17,0x38,0x6f,0xc2,0xbf,0x12,
+    0xf3,0xe6,0xff,0x73,0x13,0x91,0x9a,0xfe,0x64,0x02,0x01,0xa0,0xcb,0x7c,0xdb,0x00,
+    0x10,0x11,0x23,0xfa,0xed,0x11,0x20,0x12,0xf4,0x84,0xc7,0x8f,0x1f,0x06,0x42,0x54,
+    0x40,0x38,0xed,0x5d,0x13,0x21,0x00,0x00,0x9c,0x45,0x5d,0x31,0x18,0x46,0x04,0x80,
+    0x1e,0xfb,0x50,0x87,0x4f,0x1a,0x11,0xfe,0x83,0xa1,0x32,0xc7,0x89,0x13,0x43,0x87,
+    0x10,0x61,0x18,0x0b,0x75,0xa3,0xb0,0x68,0x22,0x00,0x24,0xf8,0xc7,0xda,0x39,0x4e,
+    0x60,0x58,0xe2,0x40,0x18,0x16,0x60,0x8c,0x6e,0xb9,0xe8,0xc8,0x23,0x86,0x1f,0x08,
+    0x63,0xda,0x35,0x44,0x08,0xe9,0x21,0x86,0x0b,0xf0,0x62,0xda,0x3e,0xaf,0xe8,0x58,
+    0xa2,0x94,0x00,0x30,0x92,0xce,0x4d,0xf1,0x8c,0x82,0x80,0x94,0x13,0x49,0x09,0x89,
+    0x3b,0x42,0xa5,0x23,0x08,0x97,0x04,0x51,0x99,0x81,0x25,0xd5,0xd8,0x03,0x11,0x3e,
+    0xdb,0x88,0xb2,0x22,0x95,0x5d,0x4a,0x09,0x83,0x2a,0xa2,0x45,0xc4,0x0f,0x38,0x9f,
+    0x78,0x00,0x67,0x99,0x54,0x62,0x78,0x41,0x1a,0x89,0x50,0xc2,0xc8,0x1b,0x23,0xf4,
+    0x29,0xe3,0x92,0x7d,0x82,0xd1,0xc9,0x2d,0xc1,0x00,0x33,0x8b,0x25,0x52,0x18,0x2a,
+    0x91,0xa1,0x94,0xf6,0x79,0x53,0xa5,0x98,0x2a,0x89,0x68,0xa6,0x96,0x5e,0xca,0xa9,
+    0xa4,0x71,0x7e,0x4a,0xa6,0x50,0xa2,0x8e,0xda,0x51,0xa9,0x3b,0x92,0x5a,0xea,0x67,
+    0x9f,0x52,0xc7,0xe9,0x71,0xa0,0xce,0x05,0x47,0xa9,0x4a,0x01,0x01,0x00,0x21,0xf9,
+    0x04,0x05,0x08,0x00,0xff,0x00,0x2c,0x09,0x00,0x15,0x00,0x3e,0x00,0x1a,0x00,0x00,
+    0x08,0xff,0x00,0xff,0x09,0x1c,0x48,0x10,0x80,0xc1,0x83,0x08,0x09,0x2a,0x5c,0xc8,
+    0xf0,0x1f,0xc2,0x84,0x0d,0x23,0x3e,0x9c,0x08,0x31,0x22,0x43,0x8a,0x14,0x2d,0x0e,
+    0xc4,0x48,0x80,0x45,0x13,0x2a,0x54,0x92,0x74,0xa8,0xa8,0x11,0xa3,0x49,0x00,0x16,
+    0x0d,0x32,0x98,0x33,0x2a,0x98,0xb5,0x72,0xf1,0xf6,0x2d,0xa4,0x47,0xae,0xd9,0x29,
+    0x2c,0x1a,0x1d,0x1e,0x64,0x70,0x66,0x92,0x2b,0x61,0xd1,0xba,0x9d,0x6b,0x27,0x2f,
+    0xde,0x3a,0x71,0xd2,0x6c,0x11,0x8a,0x70,0x11,0xcf,0xb1,0x78,0x39,0x15,0xee,0x83,
+    0xb6,0x45,0x22,0x80,0x32,0xb0,0xb0,0xd5,0x8b,0xfa,0xaf,0xdf,0xba,0x4c,0x0a,0x9b,
+    0x48,0xe3,0xc7,0x75,0x61,0x3f,0x79,0x6f,0x2e,0x32,0xf2,0x46,0xb6,0xac,0xc0,0x7e,
+    0xfd,0x68,0x0d,0x74,0xb2,0xce,0x2d,0xc3,0x7e,0xe4,0x0a,0x28,0xcc,0x01,0xcd,0xae,
+    0xc2,0x7e,0xfc,0xe0,0x08,0x64,0xd6,0xcf,0xaf,0x59,0x39,0x04,0x29,0x68,0x33,0xfc,
+    0x97,0xd7,0xbf,0x10,0xf8,0x18,0xff,0xbd,0x44,0x90,0x53,0x61,0xc9,0x6f,0xa5,0xfd,
+    0xd3,0x72,0x19,0x73,0x57,0x4b,0x04,0xfb,0x7a,0x16,0x48,0xed,0x5f,0x8e,0xb6,0x9e,
+    0xfb,0xf5,0x21,0x98,0x6d,0xb4,0xc0,0x63,0x02,0xdb,0xb9,0xde,0xd7,0x83,0xe0,0x32,
+    0xd7,0xff,0x5a,0x09,0x74,0xe6,0x9a,0x1c,0xca,0x81,0xa5,0x70,0xfb,0x11,0x58,0xc9,
+    0x35,0xad,0xdf,0x02,0xb3,0xa0,0x96,0x4c,0xcf,0x83,0xc0,0x13,0x50,0x31,0xef,0xeb,
+    0xa2,0x10,0xc0,0x62,0xcf,0xc7,0x7e,0x03,0x90,0xe5,0xd9,0x19,0x72,0x81,0x00,0x18,
+    0x79,0xa8,0xe6,0x27,0x47,0xfb,0x8d,0x77,0x92,0xf1,0x8d,0xf9,0x2e,0x50,0x40,0x37,
+    0xcc,0xd2,0xbe,0x03,0x78,0xb4,0xdc,0xad,0x2b,0xf6,0xe0,0xe1,0xe4,0x63,0x6c,0x0f,
+    0x8c,0x7c,0x00,0xbb,0x18,0x06,0x4d,0x02,0xf8,0xe9,0x74,0x8a,0x61,0xfc,0x6c,0x82,
+    0x1f,0x00,0x09,0x14,0x63,0xd7,0x34,0x29,0x14,0x08,0x1e,0x00,0xbe,0xf8,0x75,0x5f,
+    0x81,0x00,0x10,0xf0,0x8a,0x3e,0x51,0xed,0x83,0x8b,0x05,0x06,0xa5,0x34,0xc0,0x2c,
+    0xf5,0x45,0x84,0x0f,0x28,0x21,0x5e,0x64,0x10,0x1c,0xd7,0x94,0x38,0xd0,0x3e,0xd4,
+    0x94,0x97,0xa2,0x55,0x00,0x18,0x92,0x4e,0x4e,0xd7,0xa4,0x31,0xa3,0x8a,0x06,0xa5,
+    0x31,0x4b,0x36,0xee,0xec,0x67,0x8f,0x3a,0xd2,0xb0,0xe2,0x05,0x49,0x34,0x7a,0xc0,
+    0x49,0x36,0x1c,0x2a,0xc4,0xce,0x30,0x77,0x1c,0x14,0x15,0x45,0x03,0x60,0xe4,0x16,
+    0x42,0x30,0xe4,0x41,0x09,0x27,0x97,0x0c,0x02,0xc5,0x43,0x65,0x9d,0x24,0xa5,0x5f,
+    0x62,0x8e,0x69,0x57,0x46,0xa3,0x59,0x69,0x51,0x40,0x00,0x21,0xf9,0x04,0x05,0x08,
+    0x00,0xff,0x00,0x2c,0x09,0x00,0x17,0x00,0x3e,0x00,0x16,0x00,0x00,0x08,0xff,0x00,
+    0xff,0x09,0x1c,0x48,0x70,0x20,0x80,0x83,0x08,0x01,0x14,0x5c,0xc8,0xb0,0xa1,0xc3,
+    0x87,0x06,0x13,0x4a,0x9c,0x88,0x10,0x62,0x41,0x8a,0x18,0x0f,0x36,0xa4,0x58,0x60,
+    0xc6,0x17,0x3c,0x86,0x2c,0x79,0x3a,0x95,0x4a,0x15,0xaa,0x50,0x93,0xec,0xcc,0x50,
+    0xf8,0x30,0xa3,0x80,0x17,0x68,0x0c,0x69,0x4a,0x35,0x0b,0x17,0x2e,0x59,0xa1,0xe2,
+    0x14,0x20,0x78,0x50,0xc0,0x96,0x49,0xb4,0x9a,0x75,0x5b,0x67,0xcf,0xe2,0x3f,0x7d,
+    0xdd,0x12,0x6d,0x4c,0x68,0x22,0xce,0x26,0x5c,0xd0,0xc4,0xc5,0xe3,0xf7,0x90,0x9c,
+    0x17,0x81,0x00,0xe0,0x0c,0x6b,0x67,0xd4,0xe1,0xbe,0x3a,0x17,0x0f,0x3a,0xd9,0x64,
+    0xac,0x5c,0xbe,0xae,0x03,0xfb,0x25,0x13,0x58,0x8b,0x2a,0x5a,0x87,0xaa,0x78,0x72,
+    0xe8,0xd4,0xcd,0xed,0x5b,0x82,0xdc,0xfe,0x7d,0xb1,0x7b,0x77,0xe1,0x29,0x82,0x57,
+    0xc6,0xf5,0x65,0xb8,0xed,0xdf,0x9b,0xc1,0x0d,0x21,0x11,0x7c,0x86,0x78,0x61,0xb4,
+    0x7f,0x29,0xce,0x36,0x26,0x18,0x86,0x60,0xb7,0xc9,0x04,0x7b,0x09,0xfc,0x86,0x59,
+    0x60,0x3c,0x03,0x04,0x81,0x75,0x16,0x98,0x49,0xa0,0xac,0xd1,0xca,0x0a,0x1a,0x1a,
+    0xcd,0x6f,0x8a,0xc0,0x2d,0xfb,0x3a,0x23,0x2a,0x78,0xe1,0x5d,0xe7,0x70,0x2c,0x01,
+    0x48,0xc3,0x8c,0x6e,0xc1,0xc2,0xd3,0x98,0x49,0x11,0x84,0x13,0xbb,0xf1,0x25,0x86,
+    0x40,0xe6,0x4d,0x86,0x07,0x83,0x67,0xb0,0xc6,0xd7,0x06,0x30,0x04,0x20,0xbc,0xb1,
+    0xa7,0x85,0x31,0xca,0x0d,0x76,0x07,0xc5,0x21,0x82,0x6b,0x88,0xa3,0x09,0x74,0x60,
+    0xa8,0x85,0xdd,0x5d,0x78,0x6c,0x58,0x36,0x3c,0x82,0xae,0x2f,0xb8,0x1b,0x1b,0xaf,
+    0x88,0x43,0x1b,0x8e,0x8b,0x7a,0x87,0x55,0xcc,0xbd,0xad,0xa6,0xa3,0x25,0x09,0x5a,
+    0x45,0x3d,0x04,0x4f,0x2a,0x1a,0xdc,0xe7,0x10,0x00,0x39,0x24,0xc3,0x57,0x43,0xf3,
+    0x98,0xa2,0x80,0x51,0x00,0x10,0xb1,0xca,0x36,0x01,0x0a,0xc4,0xcf,0x3a,0xcd,0x5c,
+    0x62,0x82,0x81,0x16,0x01,0xc0,0xc7,0x34,0xfa,0x30,0xc4,0xcf,0x38,0xad,0xf8,0xc0,
+    0x61,0x4b,0x00,0x38,0x90,0xc5,0x1d,0x7b,0x98,0xb1,0x92,0x46,0x83,0x1d,0x44,0x04,
+    0x25,0xb5,0x10,0x93,0x8c,0x30,0xb2,0x50,0x42,0x05,0x8c,0x8d,0x9d,0xd8,0xe3,0x44,
+    0x16,0x05,0x04,0x00,0x21,0xf9,0x04,0x05,0x09,0x00,0xff,0x00,0x2c,0x09,0x00,0x19,
+    0x00,0x3e,0x00,0x13,0x00,0x00,0x08,0xff,0x00,0xff,0x09,0x1c,0x48,0xf0,0x1f,0x80,
+    0x83,0x08,0x13,0x2a,0x2c,0xc8,0xb0,0xe1,0x40,0x85,0x10,0x0f,0x32,0x8c,0x98,0x30,
+    0x42,0x90,0x30,0x75,0x04,0x39,0xb2,0x94,0x49,0xd3,0xa5,0x46,0x71,0x44,0x38,0x2c,
+    0x48,0x51,0xc0,0x10,0x3b,0x94,0x56,0xf5,0x5a,0x46,0xed,0x5a,0xb5,0x61,0x69,0x1e,
+    0x1e,0x7c,0xe0,0xa5,0xd0,0xa7,0x59,0xc4,0xa4,0x7d,0x4b,0x37,0x4f,0xdf,0x48,0x81,
+    0xf4,0x00,0x39,0x84,0x88,0x22,0x0e,0xa6,0x5a,0xce,0xc4,0xd1,0xfb,0x59,0x4d,0x60,
+    0x0c,0x4d,0xc7,0xc6,0xe1,0xfb,0x49,0xf5,0x9f,0x2b,0x92,0x08,0x87,0x30,0x92,0xf5,
+    0x0c,0xdd,0xbe,0xaa,0x04,0xbd,0xfd,0x83,0xf2,0x0e,0x2c,0x58,0x53,0x04,0x01,0x64,
+    0x58,0x34,0xec,0x1c,0x3f,0xb3,0x23,0xdd,0xc0,0xad,0xda,0x88,0x60,0xa2,0x76,0x73,
+    0xa9,0x8a,0x98,0x9a,0xd7,0xe1,0x16,0x82,0xda,0xfa,0x52,0xed,0x26,0x98,0xe1,0x3b,
+    0x01,0x04,0x7b,0x15,0x1e,0xd9,0x6a,0x31,0xc1,0x63,0x05,0xff,0x38,0x6e,0x28,0xc5,
+    0xe7,0x64,0x42,0x05,0x17,0xac,0x9b,0xcc,0xb0,0xd9,0xe4,0x72,0x04,0x18,0xae,0xe2,
+    0x2c,0x8a,0x20,0x1a,0xcb,0x85,0x1f,0x35,0x9c,0x51,0x76,0xb1,0x3b,0x16,0x05,0x73,
+    0x2d,0x7e,0x06,0xc0,0xa1,0x26,0xc7,0x96,0x18,0x8e,0xf8,0x26,0xf8,0xdc,0x8f,0x91,
+    0x00,0x9c,0x15,0x3e,0x56,0x9b,0xa1,0x92,0x72,0x79,0xcf,0x55,0xa1,0x6a,0x23,0x5c,
+    0xdf,0x69,0x22,0x1d,0x0a,0x69,0x6a,0xb6,0x99,0x0f,0xb0,0x42,0xb8,0xc1,0xe5,0x07,
+    0xcc,0x03,0xd5,0x02,0x9d,0xd8,0xfd,0x3f,0xe4,0xc7,0xad,0x50,0x71,0xb0,0x20,0x6e,
+    0xe5,0xab,0x3a,0xce,0xbc,0xd9,0x0a,0x8c,0x88,0x89,0x9b,0xb7,0x8f,0x1f,0xbd,0x73,
+    0xd1,0x5a,0x8d,0x39,0x3f,0xd7,0x4b,0x30,0x78,0x0d,0xbd,0x93,0x8c,0x21,0x05,0x08,
+    0x06,0x80,0x00,0x08,0x24,0x20,0x00,0x7f,0x8b,0x25,0xe0,0x46,0x26,0xa9,0xb4,0x42,
+    0x8a,0x23,0x5e,0x0c,0x40,0x55,0x40,0x00,0x21,0xf9,0x04,0x05,0x08,0x00,0xff,0x00,
+    0x2c,0x09,0x00,0x19,0x00,0x3e,0x00,0x1a,0x00,0x00,0x08,0xff,0x00,0xff,0x09,0x1c,
+    0x48,0xb0,0xa0,0xc1,0x83,0x08,0x13,0x2a,0x5c,0xb8,0x10,0x80,0xc3,0x87,0x10,0x1f,
+    0x32,0x4c,0x18,0xb1,0x22,0x00,0x83,0x16,0x33,0x6a,0x9c,0xf8,0x4f,0xe3,0xc6,0x8e,
+    0x1e,0x43,0x56,0xa4,0x28,0xd2,0x23,0xc8,0x92,0x28,0x0b,0xa2,0x2c,0x79,0x72,0x65,
+    0x48,0x82,0x2e,0x45,0xb6,0x8c,0x99,0x11,0x26,0xcd,0x8f,0x37,0x3f,0x0a,0xcc,0x19,
+    0x51,0x40,0x05,0x08,0x3b,0x79,0x46,0x54,0x19,0xd3,0x46,0x9d,0x4d,0xb4,0x92,0x69,
+    0x4b,0x47,0xef,0x5f,0x3e,0x49,0x33,0x85,0x12,0xf5,0x58,0x24,0x50,0xa9,0x61,0xda,
+    0xdc,0xf1,0x3b,0xd8,0xaf,0xdf,0xaa,0xa0,0x22,0x07,0xf0,0x10,0xb3,0x87,0xd1,0xa6,
+    0x53,0xb0,0x74,0xfd,0x22,0x26,0x0c,0x97,0x1c,0x9b,0x0f,0x3d,0xc4,0xf1,0xe4,0x4b,
+    0x1b,0xbc,0xad,0x0c,0xbb,0x7e,0x6d,0x29,0x00,0x88,0x1d,0x4a,0xa8,0x74,0x25,0xbb,
+    0x36,0xee,0x5d,0xbe,0x84,0x5d,0xfb,0x05,0x83,0x59,0xc4,0x12,0x30,0x70,0xf8,0x38,
+    0x12,0x4c,0x1c,0x6a,0x20,0x0a,0x59,0x76,0x25,0x0f,0x4c,0xdc,0x2f,0xd7,0x40,0x09,
+    0xd0,0xf4,0x69,0x36,0x98,0x38,0xd1,0x40,0x29,0xfd,0x46,0x0b,0xe4,0xdc,0x6f,0xd4,
+    0x40,0x02,0xf1,0xba,0xaa,0x5e,0xdd,0x95,0xdf,0x94,0x81,0x03,0x62,0x8f,0x66,0xdd,
+    0x8f,0x0f,0xc1,0x65,0x89,0x55,0x73,0x66,0x27,0x80,0xe0,0x33,0xd9,0x1c,0x79,0xdb,
+    0x1b,0x41,0x70,0x11,0x67,0xc9,0xbc,0x8d,0x15,0xd4,0xf4,0x1c,0x31,0xef,0xae,0xd2,
+    0x0a,0x4e,0x58,0xc7,0x3a,0x2f,0x6f,0xdf,0x04,0x59,0xc8,0x98,0xbb,0x4e,0xfe,0xba,
+    0x23,0x83,0xa3,0xae,0x73,0x25,0xef,0xed,0x20,0xad,0xf2,0xf0,0xbb,0x9a,0x73,0x60,
+    0x70,0x43,0xb9,0xf8,0xf0,0xf9,0x81,0x2f,0x78,0xc3,0x1d,0xfe,0xeb,0xfc,0x14,0x82,
+    0x90,0x1d,0xf9,0xfc,0x77,0x9d,0x67,0x08,0x1d,0xb2,0x8f,0x81,0x9c,0xed,0xa2,0x50,
+    0x28,0xfc,0x30,0x98,0x98,0x33,0x12,0x28,0x64,0x4a,0x84,0x0c,0x22,0xf3,0xc0,0x42,
+    0xaa,0x60,0xf8,0x1f,0x3f,0xc0,0x64,0xc0,0x10,0x28,0x05,0xe2,0xa7,0x4f,0x2c,0x07,
+    0x4c,0xf4,0x48,0x6c,0xf8,0xa9,0xd3,0x88,0x64,0x6c,0x60,0x03,0xdf,0x3e,0xd0,0xac,
+    0xa1,0x19,0x11,0xb9,0xcc,0x43,0x9e,0x3e,0xda,0x68,0xe2,0x81,0x6a,0x6e,0xe4,0xc2,
+    0xcd,0x3b,0xf7,0xe0,0x23,0x4f,0x39,0xce,0x94,0x22,0xc5,0x6c,0xff,0x80,0x50,0xc8,
+    0x2c,0xca,0x50,0x23,0xcd,0x31,0xb1,0x2c,0xd2,0x03,0x93,0x05,0x11,0x60,0x00,0x96,
+    0x5c,0x0a,0x14,0x10,0x00,0x21,0xf9,0x04,0x05,0x08,0x00,0xff,0x00,0x2c,0x0b,0x00,
+    0x20,0x00,0x3d,0x00,0x1a,0x00,0x00,0x08,0xff,0x00,0xff,0x09,0x1c,0x48,0xb0,0xa0,
+    0xc1,0x83,0x08,0x13,0x2a,0xfc,0x07,0xa0,0xe1,0xc2,0x87,0x10,0x23,0x32,0x6c,0x48,
+    0xb1,0x22,0x00,0x89,0x18,0x21,0x5a,0xdc,0xb8,0x51,0x22,0x47,0x8e,0x09,0x3f,0x8a,
+    0xec,0x48,0x70,0xa4,0x49,0x8a,0x05,0x4f,0xaa,0x74,0x38,0x71,0xa5,0xc9,0x81,0x2e,
+    0x57,0x0a,0x8c,0xf9,0x72,0x26,0xcd,0x9a,0x37,0x45,0x96,0xcc,0x09,0x12,0x26,0x4f,
+    0x8b,0x3b,0x69,0x0a,0x78,0x62,0xa8,0xd4,0x2f,0x6a,0xe6,0xe8,0xed,0xfb,0x62,0xf3,
+    0x27,0x4b,0x9f,0x26,0x07,0x34,0x41,0xc4,0xea,0x98,0xb7,0x79,0x06,0xfb,0xf5,0xcb,
+    0xd3,0xd4,0xa9,0x41,0x8e,0x33,0xf4,0x88,0x1a,0xc6,0x2d,0xde,0x42,0xad,0xfd,0xec,
+    0x40,0xfd,0xf9,0x15,0xc0,0x11,0x45,0xb1,0xa2,0xa9,0xdb,0x27,0x11,0x6d,0x3f,0x2f,
+    0x6b,0x4f,0x0a,0xf8,0x60,0x45,0x8e,0xa1,0x4a,0xa1,0x52,0xb5,0x82,0x34,0x30,0x0a,
+    0xb1,0x74,0xfc,0x32,0x0e,0x44,0xab,0xcf,0x43,0xd0,0x86,0x26,0xc0,0x00,0xc2,0xa4,
+    0x4a,0xd7,0x31,0x6a,0xdf,0xd4,0xd1,0x4b,0x2c,0xd0,0xae,0xb6,0x81,0x57,0xec,0x2a,
+    0xb6,0x7b,0xce,0xe0,0xa8,0x68,0xe3,0xe2,0xd1,0x7d,0x68,0xb7,0x5f,0x34,0x82,0xe5,
+    0x44,0x47,0x6c,0xdd,0x0f,0x99,0x41,0x6b,0x5a,0x21,0xd2,0xee,0xc7,0x8b,0x20,0xac,
+    0xd6,0xba,0x69,0x47,0x32,0x58,0x0b,0xad,0xc2,0xdd,0x5a,0x33,0x11,0x64,0x72,0x8f,
+    0x36,0x42,0xe4,0xfd,0xe0,0x89,0x30,0x98,0x07,0xba,0x75,0xad,0xfb,0x96,0x14,0xfc,
+    0x75,0xbd,0x7b,0xab,0x83,0x03,0xd0,0x75,0x82,0x47,0x7e,0xcd,0x20,0x91,0x78,0xe3,
+    0x91,0xa3,0x43,0x81,0xb0,0x54,0x7a,0xda,0x89,0x0e,0x46,0xe2,0xf7,0xde,0xee,0xbd,
+    0x39,0x09,0x45,0x88,0xaf,0xdf,0xcf,0x5a,0x42,0x5a,0xfc,0xf5,0x83,0xcf,0x22,0x0b,
+    0xf1,0xa1,0x4f,0x7d,0xf0,0x4c,0xa1,0x10,0x2d,0xf4,0xa5,0xd7,0xce,0x1e,0x10,0x75,
+    0xb2,0x4f,0x7a,0xf1,0xc4,0xf1,0x90,0x24,0xf0,0x74,0x77,0x8f,0x2f,0x3d,0x48,0x14,
+    0x09,0x3d,0xdd,0x6d,0xa3,0x45,0x44,0x39,0xbc,0x92,0xce,0x6e,0xfb,0x78,0xc3,0x8a,
+    0x76,0x19,0x4d,0x41,0x4c,0x73,0xb4,0xed,0xa3,0x0d,0x24,0x03,0x28,0x26,0x86,0x25,
+    0xac,0xd0,0xe2,0xca,0x27,0x7f,0xd8,0xa0,0x58,0x41,0x34,0x34,0x42,0xcb,0x31,0xca,
+    0x10,0x33,0x0b,0x24,0x46,0xfc,0xa8,0xe4,0x3f,0x01,0x01,0x00,0x21,0xf9,0x04,0x05,
+    0x09,0x00,0xff,0x00,0x2c,0x0f,0x00,0x27,0x00,0x39,0x00,0x16,0x00,0x00,0x08,0xff,
+    0x00,0xff,0x09,0x1c,0x48,0xb0,0xa0,0xc1,0x83,0x08,0x13,0x2a,0x04,0xa0,0xb0,0xa1,
+    0xc3,0x87,0x02,0x01,0x48,0x9c,0x48,0x11,0xa2,0x45,0x87,0x14,0x33,0x6a,0x64,0x78,
+    0xb1,0x63,0xc4,0x8d,0x1a,0x31,0x90,0x89,0x14,0x2b,0x19,0x37,0x47,0x1e,0x1f,0x82,
+    0xcc,0x98,0xc0,0x0b,0x24,0x59,0xce,0xcc,0xe1,0x2b,0x88,0xca,0xe2,0x4a,0x8e,0xff,
+    0x6e,0x02,0x38,0x62,0x48,0xd5,0x31,0x70,0xf6,0x14,0xf6,0x4b,0x55,0x50,0xe7,0xca,
+    0x81,0x19,0x31,0xb4,0xe9,0xd4,0xeb,0x9a,0xbb,0x8b,0xfd,0x40,0xe5,0x34,0xaa,0x93,
+    0x60,0x1b,0x52,0xc8,0xc4,0xdd,0x4b,0x29,0xb0,0x9f,0xa2,0xa9,0x54,0x0b,0x0c,0x39,
+    0x03,0x48,0x52,0xa8,0x56,0xb9,0x7e,0x09,0x11,0x28,0x00,0x1e,0xd7,0x82,0xfd,0xae,
+    0x80,0x05,0x60,0xc0,0x48,0x9c,0x44,0x9e,0x5c,0xf5,0x5a,0x86,0x8d,0xdc,0xbb,0x7c,
+    0x07,0xfb,0x51,0x19,0xa8,0xac,0xdf,0xdb,0xae,0xed,0x04,0xe4,0x94,0xd5,0x8d,0xdd,
+    0x4c,0xa8,0xfc,0x42,0x0c,0x6c,0x64,0xf8,0x70,0x3f,0x63,0x11,0x91,0x71,0xed,0xb7,
+    0x8e,0xe0,0x84,0x75,0x95,0x53,0xf6,0xeb,0xf7,0x67,0xa0,0x54,0xd1,0xcc,0x0a,0x92,
+    0x1a,0x2d,0xba,0x9f,0x37,0xc5,0x02,0x95,0xe8,0xf3,0x38,0x5a,0x53,0xc1,0x0d,0xe6,
+    0x42,0x5b,0x1c,0xbd,0x4f,0x4f,0xc1,0x68,0xba,0x1d,0x8e,0x96,0xf7,0xc2,0xe0,0x9d,
+    0x7c,0xac,0x21,0x8e,0xee,0x57,0xcb,0xa0,0x1d,0x7e,0xc1,0x13,0x2e,0x87,0x85,0x30,
+    0x14,0xf4,0xe8,0x06,0x97,0xf7,0x3b,0x86,0xe0,0xa0,0xb1,0xe4,0x42,0x47,0x97,0x61,
+    0x2b,0x91,0x10,0xd5,0x75,0xec,0xda,0xfb,0xf1,0xb3,0x95,0x00,0x61,0x0d,0x72,0xcb,
+    0x03,0x6b,0x87,0x17,0xa6,0xe1,0x22,0x78,0xe9,0xf3,0x8f,0x16,0xe7,0xa7,0x61,0x93,
+    0x71,0xfa,0xe5,0x77,0xce,0x18,0x0f,0xf5,0x50,0xcb,0x3b,0x01,0xd2,0xe3,0xcc,0x21,
+    0x04,0x3c,0xf4,0x42,0x2f,0xc8,0x25,0x58,0x8b,0x0b,0x17,0x41,0xa0,0xc7,0x2a,0xc0,
+    0x20,0x73,0x0c,0x2f,0xa4,0xe0,0xa1,0x81,0x47,0x55,0xc0,0xa2,0x0d,0x3c,0xfb,0xf0,
+    0x43,0x0f,0x39,0xc9,0x68,0x42,0xc3,0x61,0x2c,0x16,0x24,0x40,0x83,0x2d,0x7a,0x14,
+    0x10,0x00,0x21,0xf9,0x04,0x05,0x08,0x00,0xff,0x00,0x2c,0x10,0x00,0x29,0x00,0x38,
+    0x00,0x15,0x00,0x00,0x08,0xff,0x00,0xff,0x09,0x1c,0x48,0xb0,0xa0,0xc1,0x83,0x08,
+    0x13,0x2a,0x5c,0xc8,0xb0,0xa1,0x43,0x00,0x10,0x23,0x1e,0x70,0x48,0xf1,0x61,0x44,
+    0x88,0x50,0x0e,0xa5,0x32,0xe6,0x2d,0x9e,0xab,0x8a,0x20,0x0b,0x5e,0x04,0x70,0xc3,
+    0x0f,0x29,0x61,0xdb,0xe4,0x19,0xc4,0x15,0xd2,0x62,0xc4,0x08,0x65,0x2e,0xe1,0x9a,
+    0xb6,0x6e,0xdf,0xc2,0x5b,0x2d,0x13,0x5e,0x14,0x32,0x48,0x55,0xb2,0x70,0xf6,0x40,
+    0xb2,0xa2,0x38,0x72,0xa4,0x40,0x00,0x8c,0x6c,0x55,0x73,0xc7,0x2f,0xa7,0xc0,0x4b,
+    0x04,0x8b,0x16,0x1d,0x10,0x23,0x8c,0x9f,0x48,0xa1,0x5c,0xe5,0x1a,0x33,0xb0,0x9b,
+    0x53,0x82,0xfd,0xd0,0xfc,0xbb,0x68,0x40,0xc7,0x99,0x41,0x99,0x56,0xe9,0x42,0x56,
+    0x0d,0xdc,0xba,0xa0,0x05,0xfb,0x01,0x1a,0x18,0xeb,0xeb,0xc0,0x78,0x06,0xfe,0x01,
+    0x92,0xe6,0xf6,0x1e,0xc8,0x7e,0x66,0x06,0x7a,0xb1,0x69,0x17,0x99,0xc0,0x40,0x4e,
+    0xf3,0x7d,0x20,0x38,0xcd,0x6e,0x3f,0x3e,0x02,0x57,0xf8,0x6d,0xe9,0xad,0xa0,0x1d,
+    0xc2,0x2d,0xfb,0x69,0x63,0x9c,0x19,0x96,0x41,0x64,0xfd,0x72,0xe6,0x63,0x43,0x70,
+    0x51,0x68,0x90,0xf9,0xa8,0x18,0xf4,0xb1,0xee,0x74,0xc5,0x7e,0xa2,0x0a,0x1a,0x10,
+    0xf7,0x57,0x18,0xc2,0x36,0xf3,0x5c,0x33,0xec,0xc7,0xcf,0xb3,0x41,0x3c,0xfa,0x28,
+    0xf6,0x63,0xe7,0x23,0xa1,0x9c,0x77,0xba,0x13,0xf6,0xa3,0x07,0x15,0x21,0xaa,0xe4,
+    0x08,0xfb,0xcd,0x83,0xb3,0xd0,0x49,0x34,0x7e,0xd0,0x05,0xf6,0xeb,0x97,0xcf,0x98,
+    0x94,0x85,0xab,0xf6,0x65,0x3a,0xd7,0xde,0xef,0x9c,0x1a,0x87,0x7c,0x98,0xd1,0xdb,
+    0xce,0xbe,0xdf,0x3d,0x6d,0xac,0x9c,0x38,0xfc,0x23,0xae,0xbd,0x7d,0x78,0xaf,0x56,
+    0x80,0xb4,0x10,0x87,0x52,0xa8,0x4f,0x90,0xb8,0xb1,0x41,0x48,0x02,0xf4,0xa1,0x4b,
+    0x36,0xe7,0xa8,0x53,0x4e,0x35,0xba,0x1c,0xe2,0x81,0x5d,0x10,0x46,0xf8,0x55,0x40,
+    0x00,0x3b,
+};
+
+const lv_image_dsc_t test_img_face_gif = {
+  .header.magic = LV_IMAGE_HEADER_MAGIC,
+  .header.cf = LV_COLOR_FORMAT_RAW,
+  .header.flags = 0,
+  .header.w = 0,
+  .header.h = 0,
+  .header.stride = 0,
+  .data_size = sizeof(test_img_face_gif_map),
+  .data = test_img_face_gif_map,
+};
+
+#endif /*LV_BUILD_TEST*/
@@ -0,0 +1,185 @@
+/* test_lottie_approve.json pre-parsed by lvgl/scripts/lottie_compiler.py. E.g.
+   ./lottie_compiler.py test_lottie_approve.json --hex > output.txt
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+const uint8_t test_lottie_approve_bin[] = {
+    0x4c, 0x54, 0x42, 0x31, 0xe7, 0x0c, 0x00, 0x00, 0x00, 0x00, 0x70, 0x42, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x70,
+    0x42, 0x00, 0x00, 0x34, 0x44, 0x00, 0x00, 0x34, 0x44, 0x00, 0x0b, 0x00, 0x00, 0xc3, 0x01, 0x00, 0x00, 0x03, 0x07,
+    0x00, 0x08, 0x02, 0x07, 0x08, 0x03, 0x07, 0x0d, 0x08, 0x0f, 0x07, 0x24, 0x08, 0x26, 0x07, 0x27, 0x08, 0x26, 0x07,
+    0x29, 0x08, 0x26, 0x07, 0x2b, 0x08, 0x26, 0x04, 0x07, 0x2e, 0x09, 0x3c, 0x07, 0x31, 0x09, 0x00, 0x07, 0x34, 0x09,
+    0x3c, 0x07, 0x37, 0x0a, 0xd0, 0x02, 0x07, 0x39, 0x0a, 0xd0, 0x02, 0x07, 0x3b, 0x08, 0x3e, 0x07, 0x46, 0x09, 0x00,
+    0x07, 0x4a, 0x05, 0x06, 0x07, 0x51, 0x05, 0x03, 0x07, 0x46, 0x09, 0x00, 0x07, 0x58, 0x09, 0x01, 0x07, 0x5c, 0x09,
+    0x04, 0x07, 0x3b, 0x08, 0x5f, 0x07, 0x6d, 0x09, 0x01, 0x07, 0x70, 0x03, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00,
+    0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x0b, 0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09,
+    0x00, 0x07, 0x75, 0x09, 0x0a, 0x04, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0a, 0x50, 0x01,
+    0x0a, 0x8c, 0x01, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07,
+    0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24,
+    0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x75, 0x09, 0x06, 0x04, 0x04, 0x07,
+    0x7e, 0x09, 0x00, 0x07, 0x81, 0x01, 0x05, 0x03, 0x07, 0x5c, 0x08, 0x88, 0x01, 0x07, 0x8b, 0x01, 0x05, 0x03, 0x07,
+    0x58, 0x09, 0x00, 0x07, 0x5c, 0x08, 0x8e, 0x01, 0x07, 0x75, 0x09, 0x01, 0x07, 0x70, 0x03, 0x07, 0x24, 0x09, 0x00,
+    0x07, 0x27, 0x03, 0x07, 0x91, 0x01, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x73, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00,
+    0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x00, 0x05, 0x05, 0x09, 0x85, 0x09, 0xbe, 0x06,
+    0x05, 0x09, 0x06, 0x09, 0x2d, 0x06, 0x05, 0x0a, 0x41, 0x01, 0x0a, 0xf8, 0xfe, 0x06, 0x06, 0x07, 0x93, 0x01, 0x01,
+    0x04, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x3b, 0x08, 0x95, 0x01, 0x07, 0x9c, 0x01, 0x08, 0x9f, 0x01, 0x07, 0xb9,
+    0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xbc, 0x01, 0x07, 0x93, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27,
+    0x05, 0x0c, 0x99, 0x98, 0x98, 0x3e, 0x0c, 0xb0, 0xaf, 0x2f, 0x3f, 0x0c, 0xa1, 0xa0, 0xa0, 0x3e, 0x09, 0x01, 0x06,
+    0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09,
+    0x04, 0x04, 0x07, 0x37, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x34, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07,
+    0xbf, 0x01, 0x09, 0x02, 0x07, 0xc2, 0x01, 0x09, 0x02, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x07, 0x3b, 0x08, 0xc8, 0x01,
+    0x07, 0x9c, 0x01, 0x08, 0xd1, 0x01, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xee, 0x01, 0x07, 0x7a,
+    0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07,
+    0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x01, 0x04,
+    0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x75, 0x09, 0x03,
+    0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x06, 0x04, 0x07, 0x73,
+    0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x07, 0x04, 0x07, 0xf1, 0x01, 0x03, 0x07,
+    0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07, 0xf4, 0x01, 0x03, 0x07, 0x24, 0x09,
+    0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0x3b, 0x08, 0xf7, 0x01, 0x04, 0x06, 0x07, 0x3b,
+    0x08, 0x81, 0x02, 0x07, 0x89, 0x02, 0x09, 0x03, 0x07, 0x8c, 0x02, 0x09, 0x02, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x07,
+    0x75, 0x09, 0x01, 0x07, 0x9c, 0x01, 0x08, 0x90, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xa2,
+    0x02, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x01, 0x04, 0x07, 0xa5,
+    0x02, 0x03, 0x07, 0x24, 0x09, 0x01, 0x07, 0x27, 0x05, 0x03, 0x07, 0x91, 0x01, 0x03, 0x07, 0xa7, 0x02, 0x05, 0x0c,
+    0x7f, 0x6a, 0xbc, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x01, 0x06, 0x04, 0x07, 0x73, 0x03, 0x07, 0xa7, 0x02,
+    0x05, 0x0c, 0x12, 0x83, 0x80, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x00, 0x06, 0x04, 0x07, 0xab, 0x02, 0x09,
+    0x0a, 0x07, 0x7c, 0x05, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0xab, 0x02, 0x09, 0x2d, 0x07, 0x7c, 0x05, 0x09, 0x5c,
+    0x06, 0x04, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00,
+    0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0xad, 0x02, 0x09, 0x01, 0x07, 0x75, 0x09, 0x02, 0x07, 0x3b, 0x08, 0xaf, 0x02,
+    0x07, 0x9c, 0x01, 0x08, 0xbc, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x06, 0x07, 0x31, 0x09, 0x0a, 0x07, 0x34, 0x09,
+    0x3c, 0x07, 0xbc, 0x01, 0x09, 0x00, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x04, 0x03, 0x07, 0x46, 0x09, 0x00, 0x07, 0x58,
+    0x09, 0x02, 0x07, 0x5c, 0x09, 0x04, 0x07, 0x3b, 0x08, 0xd6, 0x02, 0x07, 0x6d, 0x09, 0x01, 0x07, 0x70, 0x03, 0x07,
+    0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x0b, 0x04, 0x07, 0x78, 0x03, 0x07,
+    0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x0a, 0x04, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00,
+    0x07, 0x27, 0x05, 0x0a, 0x50, 0x01, 0x0a, 0x8c, 0x01, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x24,
+    0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x01,
+    0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07,
+    0x75, 0x09, 0x06, 0x04, 0x04, 0x07, 0x7e, 0x09, 0x00, 0x07, 0x81, 0x01, 0x05, 0x03, 0x07, 0x5c, 0x08, 0x88, 0x01,
+    0x07, 0x8b, 0x01, 0x05, 0x03, 0x07, 0x58, 0x09, 0x00, 0x07, 0x5c, 0x08, 0x8e, 0x01, 0x07, 0x75, 0x09, 0x01, 0x07,
+    0x70, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x03, 0x07, 0x91, 0x01, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x73, 0x05, 0x05, 0x09, 0x00,
+    0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x00, 0x05,
+    0x05, 0x09, 0x85, 0x09, 0xbe, 0x06, 0x05, 0x09, 0x06, 0x09, 0x2d, 0x06, 0x05, 0x0a, 0x41, 0x01, 0x0a, 0xf8, 0xfe,
+    0x06, 0x06, 0x07, 0x93, 0x01, 0x01, 0x04, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x3b, 0x08, 0x95, 0x01, 0x07, 0x9c,
+    0x01, 0x08, 0x9f, 0x01, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xbc, 0x01, 0x07, 0x93, 0x01, 0x03,
+    0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0c, 0xe1, 0xe0, 0x60, 0x3e, 0x0c, 0x8f, 0x8e, 0x0e, 0x3f, 0x0c, 0xf1,
+    0xf0, 0x70, 0x3e, 0x09, 0x01, 0x06, 0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07,
+    0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07, 0x37, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x30,
+    0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0xbf, 0x01, 0x09, 0x02, 0x07, 0xc2, 0x01, 0x09, 0x02, 0x07, 0xc5, 0x01, 0x09,
+    0x00, 0x07, 0x3b, 0x08, 0xc8, 0x01, 0x07, 0x9c, 0x01, 0x08, 0xd1, 0x01, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07,
+    0x5c, 0x08, 0xee, 0x01, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00,
+    0x06, 0x07, 0x75, 0x09, 0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09,
+    0x64, 0x06, 0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07,
+    0x75, 0x09, 0x06, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x07,
+    0x04, 0x07, 0xf1, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07,
+    0xf4, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0x3b, 0x08,
+    0xf7, 0x01, 0x04, 0x06, 0x07, 0x3b, 0x08, 0x81, 0x02, 0x07, 0x89, 0x02, 0x09, 0x03, 0x07, 0x8c, 0x02, 0x09, 0x02,
+    0x07, 0xc5, 0x01, 0x09, 0x00, 0x07, 0x75, 0x09, 0x01, 0x07, 0x9c, 0x01, 0x08, 0x90, 0x02, 0x07, 0xb9, 0x01, 0x01,
+    0x04, 0x03, 0x07, 0x5c, 0x08, 0xa2, 0x02, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07,
+    0x75, 0x09, 0x01, 0x04, 0x07, 0xa5, 0x02, 0x03, 0x07, 0x24, 0x09, 0x01, 0x07, 0x27, 0x05, 0x03, 0x07, 0x91, 0x01,
+    0x03, 0x07, 0xa7, 0x02, 0x05, 0x0c, 0x7f, 0x6a, 0xbc, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x01, 0x06, 0x04,
+    0x07, 0x73, 0x03, 0x07, 0xa7, 0x02, 0x05, 0x0c, 0x12, 0x83, 0x80, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x00,
+    0x06, 0x04, 0x07, 0xab, 0x02, 0x09, 0x00, 0x07, 0x7c, 0x05, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0xab, 0x02, 0x09,
+    0x28, 0x07, 0x7c, 0x05, 0x09, 0x64, 0x06, 0x04, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24,
+    0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0xad, 0x02, 0x09, 0x01, 0x07, 0x75, 0x09,
+    0x02, 0x07, 0x3b, 0x08, 0xaf, 0x02, 0x07, 0x9c, 0x01, 0x08, 0xbc, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x06, 0x07,
+    0x31, 0x09, 0x00, 0x07, 0x34, 0x09, 0x3c, 0x07, 0xbc, 0x01, 0x09, 0x00, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x04, 0x03,
+    0x07, 0x46, 0x09, 0x00, 0x07, 0x58, 0x09, 0x03, 0x07, 0x5c, 0x09, 0x04, 0x07, 0x3b, 0x08, 0xe4, 0x02, 0x07, 0x6d,
+    0x09, 0x01, 0x07, 0x70, 0x03, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09,
+    0x0b, 0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x57, 0x07, 0x75, 0x09, 0x0a, 0x04, 0x07,
+    0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0a, 0x50, 0x01, 0x0a, 0x6e, 0x01, 0x09, 0x00, 0x06, 0x07,
+    0x75, 0x09, 0x02, 0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09,
+    0x00, 0x06, 0x07, 0x75, 0x09, 0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64,
+    0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x75, 0x09, 0x06, 0x04, 0x04, 0x07, 0x7e, 0x09, 0x00, 0x07, 0x81, 0x01, 0x05,
+    0x03, 0x07, 0x5c, 0x08, 0x88, 0x01, 0x07, 0x8b, 0x01, 0x05, 0x03, 0x07, 0x29, 0x09, 0x01, 0x07, 0x5c, 0x08, 0xf2,
+    0x02, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0a, 0x08, 0x02, 0x0a, 0x08, 0x02, 0x06, 0x07,
+    0x75, 0x09, 0x02, 0x04, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0x3b, 0x08, 0xf5, 0x02, 0x07, 0x9c, 0x01, 0x08, 0x84, 0x03, 0x07, 0xb9, 0x01,
+    0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xbc, 0x01, 0x07, 0x93, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05,
+    0x0c, 0x99, 0x98, 0x98, 0x3e, 0x0c, 0xb0, 0xaf, 0x2f, 0x3f, 0x0c, 0xa1, 0xa0, 0xa0, 0x3e, 0x09, 0x01, 0x06, 0x07,
+    0x75, 0x09, 0x03, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x04,
+    0x04, 0x07, 0x37, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x34, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0xbf,
+    0x01, 0x09, 0x02, 0x07, 0xc2, 0x01, 0x09, 0x01, 0x07, 0xa0, 0x03, 0x09, 0x04, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x07,
+    0x3b, 0x08, 0xc8, 0x01, 0x07, 0x9c, 0x01, 0x08, 0xd1, 0x01, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08,
+    0xee, 0x01, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75,
+    0x09, 0x02, 0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07,
+    0x75, 0x09, 0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64, 0x06,
+    0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09,
+    0x06, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x07, 0x04, 0x07,
+    0xf1, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07, 0xf4, 0x01,
+    0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0x3b, 0x08, 0xf7, 0x01,
+    0x04, 0x06, 0x07, 0x3b, 0x08, 0xa3, 0x03, 0x07, 0x89, 0x02, 0x09, 0x03, 0x07, 0x8c, 0x02, 0x09, 0x02, 0x07, 0xc5,
+    0x01, 0x09, 0x00, 0x07, 0x75, 0x09, 0x01, 0x07, 0x9c, 0x01, 0x08, 0x90, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03,
+    0x07, 0x5c, 0x08, 0xa2, 0x02, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09,
+    0x01, 0x04, 0x07, 0xa5, 0x02, 0x03, 0x07, 0x24, 0x09, 0x01, 0x07, 0x27, 0x05, 0x03, 0x07, 0x91, 0x01, 0x03, 0x07,
+    0xa7, 0x02, 0x05, 0x0c, 0x44, 0x8b, 0xac, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x01, 0x06, 0x04, 0x07, 0x73,
+    0x03, 0x07, 0xa7, 0x02, 0x05, 0x0c, 0x0c, 0x02, 0xab, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x00, 0x06, 0x04,
+    0x07, 0xab, 0x02, 0x09, 0x0a, 0x07, 0x7c, 0x05, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0xab, 0x02, 0x09, 0x2d, 0x07,
+    0x7c, 0x05, 0x09, 0x50, 0x06, 0x04, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00,
+    0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0xad, 0x02, 0x09, 0x01, 0x07, 0x75, 0x09, 0x02, 0x07,
+    0x3b, 0x08, 0xaf, 0x02, 0x07, 0x9c, 0x01, 0x08, 0xbc, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x06, 0x07, 0x31, 0x09,
+    0x0a, 0x07, 0x34, 0x09, 0x3c, 0x07, 0xbc, 0x01, 0x09, 0x0a, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x04, 0x03, 0x07, 0x46,
+    0x09, 0x00, 0x07, 0x58, 0x09, 0x04, 0x07, 0x5c, 0x09, 0x04, 0x07, 0x3b, 0x08, 0xad, 0x03, 0x07, 0x6d, 0x09, 0x01,
+    0x07, 0x70, 0x03, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x0b, 0x04,
+    0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x57, 0x07, 0x75, 0x09, 0x0a, 0x04, 0x07, 0x7a, 0x03,
+    0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0a, 0x50, 0x01, 0x0a, 0x6e, 0x01, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09,
+    0x02, 0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x07, 0x75, 0x09, 0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64,
+    0x09, 0x64, 0x06, 0x07, 0x75, 0x09, 0x06, 0x04, 0x04, 0x07, 0x7e, 0x09, 0x00, 0x07, 0x81, 0x01, 0x05, 0x03, 0x07,
+    0x5c, 0x08, 0x88, 0x01, 0x07, 0x8b, 0x01, 0x05, 0x03, 0x07, 0x29, 0x09, 0x01, 0x07, 0x5c, 0x08, 0xf2, 0x02, 0x07,
+    0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0a, 0x08, 0x02, 0x0a, 0x08, 0x02, 0x06, 0x07, 0x75, 0x09,
+    0x02, 0x04, 0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75,
+    0x09, 0x03, 0x04, 0x07, 0x3b, 0x08, 0xf5, 0x02, 0x07, 0x9c, 0x01, 0x08, 0x84, 0x03, 0x07, 0xb9, 0x01, 0x01, 0x04,
+    0x03, 0x07, 0x5c, 0x08, 0xbc, 0x01, 0x07, 0x93, 0x01, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x0c, 0xe1,
+    0xe0, 0x60, 0x3e, 0x0c, 0x8f, 0x8e, 0x0e, 0x3f, 0x0c, 0xf1, 0xf0, 0x70, 0x3e, 0x09, 0x01, 0x06, 0x07, 0x75, 0x09,
+    0x03, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07,
+    0x37, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x30, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0xbf, 0x01, 0x09,
+    0x02, 0x07, 0xc2, 0x01, 0x09, 0x01, 0x07, 0xa0, 0x03, 0x09, 0x04, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x07, 0x3b, 0x08,
+    0xc8, 0x01, 0x07, 0x9c, 0x01, 0x08, 0xd1, 0x01, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c, 0x08, 0xee, 0x01,
+    0x07, 0x7a, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09, 0x02,
+    0x04, 0x07, 0x24, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x75, 0x09,
+    0x01, 0x04, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x05, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x75,
+    0x09, 0x03, 0x04, 0x07, 0x78, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x06, 0x04,
+    0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x64, 0x07, 0x75, 0x09, 0x07, 0x04, 0x07, 0xf1, 0x01,
+    0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x04, 0x04, 0x07, 0xf4, 0x01, 0x03, 0x07,
+    0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x05, 0x04, 0x07, 0x3b, 0x08, 0xf7, 0x01, 0x04, 0x06,
+    0x07, 0x3b, 0x08, 0xa3, 0x03, 0x07, 0x89, 0x02, 0x09, 0x03, 0x07, 0x8c, 0x02, 0x09, 0x02, 0x07, 0xc5, 0x01, 0x09,
+    0x00, 0x07, 0x75, 0x09, 0x01, 0x07, 0x9c, 0x01, 0x08, 0x90, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x03, 0x07, 0x5c,
+    0x08, 0xa2, 0x02, 0x07, 0x7c, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27, 0x09, 0x00, 0x07, 0x75, 0x09, 0x01, 0x04,
+    0x07, 0xa5, 0x02, 0x03, 0x07, 0x24, 0x09, 0x01, 0x07, 0x27, 0x05, 0x03, 0x07, 0x91, 0x01, 0x03, 0x07, 0xa7, 0x02,
+    0x05, 0x0c, 0x7f, 0x6a, 0xbc, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x01, 0x06, 0x04, 0x07, 0x73, 0x03, 0x07,
+    0xa7, 0x02, 0x05, 0x0c, 0x12, 0x83, 0x80, 0x3e, 0x06, 0x07, 0xa9, 0x02, 0x05, 0x09, 0x00, 0x06, 0x04, 0x07, 0xab,
+    0x02, 0x09, 0x00, 0x07, 0x7c, 0x05, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0xab, 0x02, 0x09, 0x28, 0x07, 0x7c, 0x05,
+    0x09, 0x54, 0x06, 0x04, 0x06, 0x07, 0x75, 0x09, 0x02, 0x04, 0x07, 0x73, 0x03, 0x07, 0x24, 0x09, 0x00, 0x07, 0x27,
+    0x09, 0x00, 0x07, 0x75, 0x09, 0x03, 0x04, 0x07, 0xad, 0x02, 0x09, 0x01, 0x07, 0x75, 0x09, 0x02, 0x07, 0x3b, 0x08,
+    0xaf, 0x02, 0x07, 0x9c, 0x01, 0x08, 0xbc, 0x02, 0x07, 0xb9, 0x01, 0x01, 0x04, 0x06, 0x07, 0x31, 0x09, 0x00, 0x07,
+    0x34, 0x09, 0x3c, 0x07, 0xbc, 0x01, 0x09, 0x00, 0x07, 0xc5, 0x01, 0x09, 0x00, 0x04, 0x06, 0x07, 0xbb, 0x03, 0x05,
+    0x06, 0x04, 0x76, 0x00, 0x34, 0x2e, 0x38, 0x2e, 0x30, 0x00, 0x6d, 0x65, 0x74, 0x61, 0x00, 0x67, 0x00, 0x4c, 0x6f,
+    0x74, 0x74, 0x69, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x41, 0x45, 0x20, 0x31, 0x2e, 0x30, 0x2e, 0x30, 0x00,
+    0x61, 0x00, 0x00, 0x6b, 0x00, 0x64, 0x00, 0x74, 0x63, 0x00, 0x66, 0x72, 0x00, 0x69, 0x70, 0x00, 0x6f, 0x70, 0x00,
+    0x77, 0x00, 0x68, 0x00, 0x6e, 0x6d, 0x00, 0x53, 0x75, 0x63, 0x63, 0x65, 0x73, 0x73, 0x00, 0x64, 0x64, 0x64, 0x00,
+    0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x00, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x00, 0x69, 0x6e, 0x64, 0x00, 0x74,
+    0x79, 0x00, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x34, 0x00, 0x73, 0x72, 0x00,
+    0x6b, 0x73, 0x00, 0x6f, 0x00, 0x69, 0x78, 0x00, 0x72, 0x00, 0x70, 0x00, 0x73, 0x00, 0x61, 0x6f, 0x00, 0x73, 0x68,
+    0x61, 0x70, 0x65, 0x73, 0x00, 0x67, 0x72, 0x00, 0x69, 0x74, 0x00, 0x73, 0x68, 0x00, 0x69, 0x00, 0x63, 0x00, 0x50,
+    0x61, 0x74, 0x68, 0x20, 0x31, 0x00, 0x6d, 0x6e, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f,
+    0x72, 0x20, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x68, 0x64, 0x00,
+    0x73, 0x74, 0x00, 0x6c, 0x63, 0x00, 0x6c, 0x6a, 0x00, 0x62, 0x6d, 0x00, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x20,
+    0x31, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68,
+    0x69, 0x63, 0x20, 0x2d, 0x20, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x00, 0x74, 0x72, 0x00, 0x73, 0x6b, 0x00, 0x73,
+    0x61, 0x00, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x31,
+    0x00, 0x6e, 0x70, 0x00, 0x63, 0x69, 0x78, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72,
+    0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x74, 0x6d, 0x00, 0x65, 0x00, 0x78, 0x00, 0x79, 0x00, 0x74, 0x00, 0x6d,
+    0x00, 0x54, 0x72, 0x69, 0x6d, 0x20, 0x50, 0x61, 0x74, 0x68, 0x73, 0x20, 0x31, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20,
+    0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x46, 0x69, 0x6c, 0x74, 0x65, 0x72, 0x20, 0x2d, 0x20, 0x54, 0x72, 0x69,
+    0x6d, 0x00, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x33, 0x00, 0x53, 0x68, 0x61,
+    0x70, 0x65, 0x20, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x32, 0x00, 0x65, 0x6c, 0x00, 0x45, 0x6c, 0x6c, 0x69, 0x70,
+    0x73, 0x65, 0x20, 0x50, 0x61, 0x74, 0x68, 0x20, 0x31, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74,
+    0x6f, 0x72, 0x20, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x45, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x65, 0x00,
+    0x6d, 0x6c, 0x00, 0x45, 0x6c, 0x6c, 0x69, 0x70, 0x73, 0x65, 0x20, 0x31, 0x00, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20,
+    0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x31, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x00
+};
+
+const size_t test_lottie_approve_bin_size = sizeof(test_lottie_approve_bin);
@@ -0,0 +1,397 @@
+/* Test2.json and TestD.json of TFT_LVGL_LOTTIE/Animations as JSON (converted by lvgl/scripts/filetohex.py)
+   and pre-parsed by lvgl/scripts/lottie_compiler.py to compare their loading.
+*/
+
+#include <stdint.h>
+#include <stddef.h>
+
+const uint8_t test_lottie_empty_json[] = {
+    0x20, 0x7b, 0x22, 0x76, 0x22, 0x3a, 0x22, 0x35, 0x2e, 0x35, 0x2e, 0x32, 0x22, 0x2c, 0x22, 0x66, 0x72, 0x22, 0x3a,
+    0x32, 0x39, 0x2e, 0x39, 0x37, 0x2c, 0x22, 0x69, 0x70, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6f, 0x70, 0x22, 0x3a, 0x33,
+    0x30, 0x2c, 0x22, 0x77, 0x22, 0x3a, 0x31, 0x35, 0x30, 0x2c, 0x22, 0x68, 0x22, 0x3a, 0x31, 0x35, 0x30, 0x2c, 0x22,
+    0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x54, 0x65, 0x73, 0x74, 0x22, 0x2c, 0x22, 0x64, 0x64, 0x64, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x22, 0x3a, 0x5b, 0x5d, 0x2c, 0x22, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73,
+    0x22, 0x3a, 0x5b, 0x5d, 0x7d, 0x0a,
+    0x00 /*Close the string*/
+};
+
+const size_t test_lottie_empty_json_size = sizeof(test_lottie_empty_json);
+
+const uint8_t test_lottie_empty_bin[] = {
+    0x4c, 0x54, 0x42, 0x31, 0x82, 0x00, 0x00, 0x00, 0x8f, 0xc2, 0xef, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0xf0,
+    0x41, 0x00, 0x00, 0x16, 0x43, 0x00, 0x00, 0x16, 0x43, 0x2f, 0x00, 0x00, 0x00, 0x2f, 0x00, 0x00, 0x00, 0x03, 0x07,
+    0x00, 0x08, 0x02, 0x07, 0x08, 0x0c, 0x8f, 0xc2, 0xef, 0x41, 0x07, 0x0b, 0x09, 0x00, 0x07, 0x0e, 0x09, 0x1e, 0x07,
+    0x11, 0x0a, 0x96, 0x00, 0x07, 0x13, 0x0a, 0x96, 0x00, 0x07, 0x15, 0x08, 0x18, 0x07, 0x1d, 0x09, 0x00, 0x07, 0x21,
+    0x05, 0x06, 0x07, 0x28, 0x05, 0x06, 0x04, 0x76, 0x00, 0x35, 0x2e, 0x35, 0x2e, 0x32, 0x00, 0x66, 0x72, 0x00, 0x69,
+    0x70, 0x00, 0x6f, 0x70, 0x00, 0x77, 0x00, 0x68, 0x00, 0x6e, 0x6d, 0x00, 0x54, 0x65, 0x73, 0x74, 0x00, 0x64, 0x64,
+    0x64, 0x00, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x00, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x00
+};
+
+const size_t test_lottie_empty_bin_size = sizeof(test_lottie_empty_bin);
+
+const uint8_t test_lottie_arrow_json[] = {
+    0x7b, 0x22, 0x76, 0x22, 0x3a, 0x22, 0x35, 0x2e, 0x35, 0x2e, 0x37, 0x22, 0x2c, 0x22, 0x6d, 0x65, 0x74, 0x61, 0x22,
+    0x3a, 0x7b, 0x22, 0x67, 0x22, 0x3a, 0x22, 0x4c, 0x6f, 0x74, 0x74, 0x69, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x20,
+    0x41, 0x45, 0x20, 0x30, 0x2e, 0x31, 0x2e, 0x32, 0x30, 0x22, 0x2c, 0x22, 0x61, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22,
+    0x6b, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x64, 0x22, 0x3a, 0x22, 0x22, 0x2c, 0x22, 0x74, 0x63, 0x22, 0x3a, 0x22,
+    0x22, 0x7d, 0x2c, 0x22, 0x66, 0x72, 0x22, 0x3a, 0x33, 0x30, 0x2c, 0x22, 0x69, 0x70, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x6f, 0x70, 0x22, 0x3a, 0x33, 0x34, 0x2c, 0x22, 0x77, 0x22, 0x3a, 0x35, 0x30, 0x30, 0x2c, 0x22, 0x68, 0x22, 0x3a,
+    0x35, 0x30, 0x30, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x61, 0x6e, 0x69,
+    0x6d, 0x61, 0x74, 0x69, 0x6f, 0x6e, 0x22, 0x2c, 0x22, 0x64, 0x64, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x61, 0x73,
+    0x73, 0x65, 0x74, 0x73, 0x22, 0x3a, 0x5b, 0x5d, 0x2c, 0x22, 0x6c, 0x61, 0x79, 0x65, 0x72, 0x73, 0x22, 0x3a, 0x5b,
+    0x7b, 0x22, 0x64, 0x64, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x6e, 0x64, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x74,
+    0x79, 0x22, 0x3a, 0x34, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x35, 0x20,
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x22, 0x2c, 0x22, 0x73, 0x72, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b,
+    0x73, 0x22, 0x3a, 0x7b, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a,
+    0x35, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x31, 0x7d, 0x2c, 0x22, 0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61,
+    0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x30, 0x7d, 0x2c,
+    0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x69,
+    0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x31, 0x7d,
+    0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2c, 0x22, 0x79, 0x22,
+    0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35, 0x30, 0x2c,
+    0x31, 0x37, 0x38, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x6f, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36,
+    0x37, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x5d, 0x7d, 0x2c,
+    0x7b, 0x22, 0x69, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x22, 0x79, 0x22,
+    0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2c,
+    0x22, 0x79, 0x22, 0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a, 0x31, 0x36, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b,
+    0x32, 0x35, 0x30, 0x2c, 0x32, 0x31, 0x38, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x6f, 0x22, 0x3a, 0x5b, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36, 0x37, 0x2c,
+    0x30, 0x5d, 0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x22, 0x3a, 0x33, 0x30, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35,
+    0x30, 0x2c, 0x31, 0x37, 0x38, 0x2c, 0x30, 0x5d, 0x7d, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c,
+    0x22, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x37, 0x32, 0x2e,
+    0x35, 0x39, 0x36, 0x2c, 0x34, 0x31, 0x2e, 0x39, 0x35, 0x35, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a,
+    0x31, 0x7d, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b,
+    0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x36,
+    0x7d, 0x7d, 0x2c, 0x22, 0x61, 0x6f, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x22, 0x3a,
+    0x5b, 0x7b, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x67, 0x72, 0x22, 0x2c, 0x22, 0x69, 0x74, 0x22, 0x3a, 0x5b, 0x7b,
+    0x22, 0x69, 0x6e, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x73, 0x68, 0x22, 0x2c, 0x22,
+    0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x6b, 0x22, 0x3a, 0x7b, 0x22, 0x69, 0x22, 0x3a, 0x5b, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30,
+    0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x5d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x5b, 0x5b, 0x30, 0x2c, 0x30, 0x5d,
+    0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x5d, 0x2c, 0x22, 0x76, 0x22, 0x3a, 0x5b,
+    0x5b, 0x35, 0x37, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x2d, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x36, 0x5d, 0x2c, 0x5b, 0x2d,
+    0x30, 0x2e, 0x30, 0x30, 0x31, 0x2c, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x36, 0x5d, 0x2c, 0x5b, 0x2d, 0x35, 0x37, 0x2e,
+    0x35, 0x39, 0x37, 0x2c, 0x2d, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x36, 0x5d, 0x5d, 0x2c, 0x22, 0x63, 0x22, 0x3a, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a,
+    0x22, 0x50, 0x61, 0x74, 0x68, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45,
+    0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x47, 0x72, 0x6f,
+    0x75, 0x70, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x7b, 0x22, 0x74,
+    0x79, 0x22, 0x3a, 0x22, 0x73, 0x74, 0x22, 0x2c, 0x22, 0x63, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x30, 0x2e, 0x38, 0x2c, 0x30, 0x2e, 0x38, 0x2c, 0x30, 0x2e, 0x38, 0x2c, 0x31, 0x5d,
+    0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30,
+    0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x34, 0x7d, 0x2c, 0x22, 0x77,
+    0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x33, 0x30, 0x2c, 0x22, 0x69, 0x78,
+    0x22, 0x3a, 0x35, 0x7d, 0x2c, 0x22, 0x6c, 0x63, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x6c, 0x6a, 0x22, 0x3a, 0x32, 0x2c,
+    0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+    0x20, 0x31, 0x22, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74,
+    0x6f, 0x72, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x2d, 0x20, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65,
+    0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x79, 0x22,
+    0x3a, 0x22, 0x74, 0x72, 0x22, 0x2c, 0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b,
+    0x22, 0x3a, 0x5b, 0x37, 0x32, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x34, 0x31, 0x2e, 0x39, 0x35, 0x35, 0x5d, 0x2c, 0x22,
+    0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x6b, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x73,
+    0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x31, 0x30, 0x30, 0x2c, 0x31,
+    0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c, 0x22, 0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61,
+    0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x36, 0x7d, 0x2c, 0x22,
+    0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22,
+    0x69, 0x78, 0x22, 0x3a, 0x37, 0x7d, 0x2c, 0x22, 0x73, 0x6b, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x34, 0x7d, 0x2c, 0x22, 0x73, 0x61, 0x22, 0x3a,
+    0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x35,
+    0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x7d,
+    0x5d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6e,
+    0x70, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x63, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30,
+    0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45, 0x20,
+    0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x5d, 0x2c, 0x22, 0x69, 0x70, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6f, 0x70, 0x22,
+    0x3a, 0x33, 0x35, 0x2c, 0x22, 0x73, 0x74, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x7d, 0x2c,
+    0x7b, 0x22, 0x64, 0x64, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x6e, 0x64, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x74,
+    0x79, 0x22, 0x3a, 0x34, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x34, 0x20,
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x22, 0x2c, 0x22, 0x73, 0x72, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b,
+    0x73, 0x22, 0x3a, 0x7b, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a,
+    0x38, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x31, 0x7d, 0x2c, 0x22, 0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61,
+    0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x30, 0x7d, 0x2c,
+    0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x69,
+    0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x31, 0x7d,
+    0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2c, 0x22, 0x79, 0x22,
+    0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a, 0x33, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35, 0x30, 0x2c,
+    0x32, 0x35, 0x31, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x6f, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36,
+    0x37, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x5d, 0x7d, 0x2c,
+    0x7b, 0x22, 0x69, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x22, 0x79, 0x22,
+    0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2c,
+    0x22, 0x79, 0x22, 0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a, 0x31, 0x37, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b,
+    0x32, 0x35, 0x30, 0x2c, 0x32, 0x39, 0x31, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x6f, 0x22, 0x3a, 0x5b, 0x30, 0x2c,
+    0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36, 0x37, 0x2c,
+    0x30, 0x5d, 0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x22, 0x3a, 0x33, 0x32, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35,
+    0x30, 0x2c, 0x32, 0x35, 0x31, 0x2c, 0x30, 0x5d, 0x7d, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c,
+    0x22, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x37, 0x32, 0x2e,
+    0x35, 0x39, 0x36, 0x2c, 0x34, 0x31, 0x2e, 0x39, 0x35, 0x35, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a,
+    0x31, 0x7d, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b,
+    0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x36,
+    0x7d, 0x7d, 0x2c, 0x22, 0x61, 0x6f, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x22, 0x3a,
+    0x5b, 0x7b, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x67, 0x72, 0x22, 0x2c, 0x22, 0x69, 0x74, 0x22, 0x3a, 0x5b, 0x7b,
+    0x22, 0x69, 0x6e, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x73, 0x68, 0x22, 0x2c, 0x22,
+    0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x6b, 0x22, 0x3a, 0x7b, 0x22, 0x69, 0x22, 0x3a, 0x5b, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30,
+    0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x5d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x5b, 0x5b, 0x30, 0x2c, 0x30, 0x5d,
+    0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x5d, 0x2c, 0x22, 0x76, 0x22, 0x3a, 0x5b,
+    0x5b, 0x35, 0x37, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x2d, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x35, 0x5d, 0x2c, 0x5b, 0x2d,
+    0x30, 0x2e, 0x30, 0x30, 0x31, 0x2c, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x35, 0x5d, 0x2c, 0x5b, 0x2d, 0x35, 0x37, 0x2e,
+    0x35, 0x39, 0x37, 0x2c, 0x2d, 0x32, 0x36, 0x2e, 0x39, 0x35, 0x35, 0x5d, 0x5d, 0x2c, 0x22, 0x63, 0x22, 0x3a, 0x66,
+    0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a,
+    0x22, 0x50, 0x61, 0x74, 0x68, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45,
+    0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x47, 0x72, 0x6f,
+    0x75, 0x70, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x7b, 0x22, 0x74,
+    0x79, 0x22, 0x3a, 0x22, 0x73, 0x74, 0x22, 0x2c, 0x22, 0x63, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x30, 0x2e, 0x39, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x2c, 0x30, 0x2e, 0x39, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x2c, 0x30, 0x2e, 0x39, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33, 0x33,
+    0x33, 0x33, 0x33, 0x33, 0x2c, 0x31, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c, 0x22, 0x6f, 0x22,
+    0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78,
+    0x22, 0x3a, 0x34, 0x7d, 0x2c, 0x22, 0x77, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22,
+    0x3a, 0x33, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x35, 0x7d, 0x2c, 0x22, 0x6c, 0x63, 0x22, 0x3a, 0x32, 0x2c,
+    0x22, 0x6c, 0x6a, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a,
+    0x22, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44,
+    0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x2d,
+    0x20, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65,
+    0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x74, 0x72, 0x22, 0x2c, 0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22,
+    0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x37, 0x32, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x34, 0x31,
+    0x2e, 0x39, 0x35, 0x35, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x61, 0x22, 0x3a, 0x7b,
+    0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78,
+    0x22, 0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22,
+    0x3a, 0x5b, 0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c,
+    0x22, 0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69,
+    0x78, 0x22, 0x3a, 0x36, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b,
+    0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x37, 0x7d, 0x2c, 0x22, 0x73, 0x6b, 0x22, 0x3a,
+    0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x34,
+    0x7d, 0x2c, 0x22, 0x73, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30,
+    0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x35, 0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x54, 0x72, 0x61, 0x6e,
+    0x73, 0x66, 0x6f, 0x72, 0x6d, 0x22, 0x7d, 0x5d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x47, 0x72, 0x6f, 0x75,
+    0x70, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6e, 0x70, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x63, 0x69, 0x78, 0x22, 0x3a, 0x32,
+    0x2c, 0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6d, 0x6e, 0x22,
+    0x3a, 0x22, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70,
+    0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x5d, 0x2c, 0x22, 0x69, 0x70, 0x22,
+    0x3a, 0x30, 0x2c, 0x22, 0x6f, 0x70, 0x22, 0x3a, 0x33, 0x35, 0x2c, 0x22, 0x73, 0x74, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x62, 0x6d, 0x22, 0x3a, 0x30, 0x7d, 0x2c, 0x7b, 0x22, 0x64, 0x64, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x6e,
+    0x64, 0x22, 0x3a, 0x33, 0x2c, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x34, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x4c,
+    0x61, 0x79, 0x65, 0x72, 0x20, 0x33, 0x20, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x22, 0x2c, 0x22, 0x73,
+    0x72, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22,
+    0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x31, 0x7d,
+    0x2c, 0x22, 0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x69, 0x78, 0x22, 0x3a, 0x31, 0x30, 0x7d, 0x2c, 0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x31, 0x2c,
+    0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x69, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30, 0x2e, 0x36, 0x36,
+    0x37, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30,
+    0x2e, 0x33, 0x33, 0x33, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a, 0x34, 0x2c, 0x22,
+    0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35, 0x30, 0x2c, 0x33, 0x32, 0x34, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x6f, 0x22,
+    0x3a, 0x5b, 0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b,
+    0x30, 0x2c, 0x30, 0x2c, 0x30, 0x5d, 0x7d, 0x2c, 0x7b, 0x22, 0x69, 0x22, 0x3a, 0x7b, 0x22, 0x78, 0x22, 0x3a, 0x30,
+    0x2e, 0x36, 0x36, 0x37, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x78,
+    0x22, 0x3a, 0x30, 0x2e, 0x33, 0x33, 0x33, 0x2c, 0x22, 0x79, 0x22, 0x3a, 0x30, 0x7d, 0x2c, 0x22, 0x74, 0x22, 0x3a,
+    0x31, 0x38, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35, 0x30, 0x2c, 0x33, 0x36, 0x34, 0x2c, 0x30, 0x5d, 0x2c,
+    0x22, 0x74, 0x6f, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x74, 0x69, 0x22, 0x3a, 0x5b,
+    0x30, 0x2c, 0x36, 0x2e, 0x36, 0x36, 0x37, 0x2c, 0x30, 0x5d, 0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x22, 0x3a, 0x33, 0x34,
+    0x2c, 0x22, 0x73, 0x22, 0x3a, 0x5b, 0x32, 0x35, 0x30, 0x2c, 0x33, 0x32, 0x34, 0x2c, 0x30, 0x5d, 0x7d, 0x5d, 0x2c,
+    0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x31, 0x33, 0x32, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x31, 0x30, 0x31, 0x2e, 0x39, 0x35,
+    0x35, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x7b, 0x22,
+    0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x2c, 0x31,
+    0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x36, 0x7d, 0x7d, 0x2c, 0x22, 0x61, 0x6f, 0x22, 0x3a, 0x30,
+    0x2c, 0x22, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x67,
+    0x72, 0x22, 0x2c, 0x22, 0x69, 0x74, 0x22, 0x3a, 0x5b, 0x7b, 0x22, 0x69, 0x6e, 0x64, 0x22, 0x3a, 0x30, 0x2c, 0x22,
+    0x74, 0x79, 0x22, 0x3a, 0x22, 0x73, 0x68, 0x22, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6b, 0x73,
+    0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x7b, 0x22, 0x69, 0x22, 0x3a, 0x5b,
+    0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x5d, 0x2c,
+    0x22, 0x6f, 0x22, 0x3a, 0x5b, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x5b, 0x30,
+    0x2c, 0x30, 0x5d, 0x5d, 0x2c, 0x22, 0x76, 0x22, 0x3a, 0x5b, 0x5b, 0x35, 0x37, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x2d,
+    0x32, 0x36, 0x2e, 0x39, 0x35, 0x35, 0x5d, 0x2c, 0x5b, 0x2d, 0x30, 0x2e, 0x30, 0x30, 0x31, 0x2c, 0x32, 0x36, 0x2e,
+    0x39, 0x35, 0x35, 0x5d, 0x2c, 0x5b, 0x2d, 0x35, 0x37, 0x2e, 0x35, 0x39, 0x37, 0x2c, 0x2d, 0x32, 0x36, 0x2e, 0x39,
+    0x35, 0x35, 0x5d, 0x5d, 0x2c, 0x22, 0x63, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x22, 0x69, 0x78,
+    0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x50, 0x61, 0x74, 0x68, 0x20, 0x31, 0x22, 0x2c,
+    0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x53,
+    0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a,
+    0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x7b, 0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x73, 0x74, 0x22, 0x2c, 0x22,
+    0x63, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x31, 0x2c, 0x31, 0x2c,
+    0x31, 0x2c, 0x31, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22,
+    0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x34,
+    0x7d, 0x2c, 0x22, 0x77, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x33, 0x30,
+    0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x35, 0x7d, 0x2c, 0x22, 0x6c, 0x63, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x6c, 0x6a,
+    0x22, 0x3a, 0x32, 0x2c, 0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x53, 0x74,
+    0x72, 0x6f, 0x6b, 0x65, 0x20, 0x31, 0x22, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a, 0x22, 0x41, 0x44, 0x42, 0x45, 0x20,
+    0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x2d, 0x20, 0x53, 0x74,
+    0x72, 0x6f, 0x6b, 0x65, 0x22, 0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x2c, 0x7b,
+    0x22, 0x74, 0x79, 0x22, 0x3a, 0x22, 0x74, 0x72, 0x22, 0x2c, 0x22, 0x70, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a,
+    0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x31, 0x33, 0x32, 0x2e, 0x35, 0x39, 0x36, 0x2c, 0x31, 0x30, 0x31, 0x2e,
+    0x39, 0x35, 0x35, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x7d, 0x2c, 0x22, 0x61, 0x22, 0x3a, 0x7b, 0x22,
+    0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x5b, 0x30, 0x2c, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22,
+    0x3a, 0x31, 0x7d, 0x2c, 0x22, 0x73, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a,
+    0x5b, 0x31, 0x30, 0x30, 0x2c, 0x31, 0x30, 0x30, 0x5d, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x33, 0x7d, 0x2c, 0x22,
+    0x72, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78,
+    0x22, 0x3a, 0x36, 0x7d, 0x2c, 0x22, 0x6f, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22,
+    0x3a, 0x31, 0x30, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x37, 0x7d, 0x2c, 0x22, 0x73, 0x6b, 0x22, 0x3a, 0x7b,
+    0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x34, 0x7d,
+    0x2c, 0x22, 0x73, 0x61, 0x22, 0x3a, 0x7b, 0x22, 0x61, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x6b, 0x22, 0x3a, 0x30, 0x2c,
+    0x22, 0x69, 0x78, 0x22, 0x3a, 0x35, 0x7d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x54, 0x72, 0x61, 0x6e, 0x73,
+    0x66, 0x6f, 0x72, 0x6d, 0x22, 0x7d, 0x5d, 0x2c, 0x22, 0x6e, 0x6d, 0x22, 0x3a, 0x22, 0x47, 0x72, 0x6f, 0x75, 0x70,
+    0x20, 0x31, 0x22, 0x2c, 0x22, 0x6e, 0x70, 0x22, 0x3a, 0x32, 0x2c, 0x22, 0x63, 0x69, 0x78, 0x22, 0x3a, 0x32, 0x2c,
+    0x22, 0x62, 0x6d, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x69, 0x78, 0x22, 0x3a, 0x31, 0x2c, 0x22, 0x6d, 0x6e, 0x22, 0x3a,
+    0x22, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x22,
+    0x2c, 0x22, 0x68, 0x64, 0x22, 0x3a, 0x66, 0x61, 0x6c, 0x73, 0x65, 0x7d, 0x5d, 0x2c, 0x22, 0x69, 0x70, 0x22, 0x3a,
+    0x30, 0x2c, 0x22, 0x6f, 0x70, 0x22, 0x3a, 0x33, 0x35, 0x2c, 0x22, 0x73, 0x74, 0x22, 0x3a, 0x30, 0x2c, 0x22, 0x62,
+    0x6d, 0x22, 0x3a, 0x30, 0x7d, 0x5d, 0x2c, 0x22, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x22, 0x3a, 0x5b, 0x5d,
+    0x7d,
+    0x00 /*Close the string*/
+};
+
+const size_t test_lottie_arrow_json_size = sizeof(test_lottie_arrow_json);
+
+const uint8_t test_lottie_arrow_bin[] = {
+    0x4c, 0x54, 0x42, 0x31, 0xfa, 0x0a, 0x00, 0x00, 0x00, 0x00, 0xf0, 0x41, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x08,
+    0x42, 0x00, 0x00, 0xfa, 0x43, 0x00, 0x00, 0xfa, 0x43, 0x72, 0x09, 0x00, 0x00, 0x64, 0x01, 0x00, 0x00, 0x03, 0x07,
+    0x00, 0x08, 0x02, 0x07, 0x08, 0x03, 0x07, 0x0d, 0x08, 0x0f, 0x07, 0x25, 0x08, 0x27, 0x07, 0x28, 0x08, 0x27, 0x07,
+    0x2a, 0x08, 0x27, 0x07, 0x2c, 0x08, 0x27, 0x04, 0x07, 0x2f, 0x09, 0x1e, 0x07, 0x32, 0x09, 0x00, 0x07, 0x35, 0x09,
+    0x22, 0x07, 0x38, 0x0a, 0xf4, 0x01, 0x07, 0x3a, 0x0a, 0xf4, 0x01, 0x07, 0x3c, 0x08, 0x3f, 0x07, 0x4f, 0x09, 0x00,
+    0x07, 0x53, 0x05, 0x06, 0x07, 0x5a, 0x05, 0x03, 0x07, 0x4f, 0x09, 0x00, 0x07, 0x61, 0x09, 0x01, 0x07, 0x65, 0x09,
+    0x04, 0x07, 0x3c, 0x08, 0x68, 0x07, 0x79, 0x09, 0x01, 0x07, 0x7c, 0x03, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x09, 0x32, 0x07, 0x81, 0x01, 0x09, 0x0b, 0x04, 0x07, 0x84, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07,
+    0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x0a, 0x04, 0x07, 0x86, 0x01, 0x03, 0x07, 0x25, 0x09, 0x01, 0x07, 0x28,
+    0x05, 0x03, 0x07, 0x88, 0x01, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0x83, 0xc0, 0x2a, 0x3f, 0x07, 0x8c, 0x01, 0x09, 0x01,
+    0x04, 0x07, 0x7f, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0xfa, 0x7e, 0xaa, 0x3e, 0x07, 0x8c, 0x01, 0x09, 0x00, 0x04, 0x07,
+    0x8e, 0x01, 0x09, 0x02, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0xb2, 0x00, 0x09, 0x00, 0x06, 0x07, 0x92,
+    0x01, 0x05, 0x09, 0x00, 0x0c, 0x10, 0x58, 0xd5, 0x40, 0x09, 0x00, 0x06, 0x07, 0x95, 0x01, 0x05, 0x09, 0x00, 0x09,
+    0x00, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0x88, 0x01, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0x83, 0xc0, 0x2a, 0x3f, 0x07,
+    0x8c, 0x01, 0x09, 0x01, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0xfa, 0x7e, 0xaa, 0x3e, 0x07, 0x8c, 0x01,
+    0x09, 0x00, 0x04, 0x07, 0x8e, 0x01, 0x09, 0x10, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0xda, 0x00, 0x09,
+    0x00, 0x06, 0x07, 0x92, 0x01, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x95, 0x01, 0x05, 0x09, 0x00,
+    0x0c, 0x10, 0x58, 0xd5, 0x40, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0x8e, 0x01, 0x09, 0x1e, 0x07, 0x90, 0x01, 0x05,
+    0x0a, 0xfa, 0x00, 0x0a, 0xb2, 0x00, 0x09, 0x00, 0x06, 0x04, 0x06, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x25,
+    0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0x27, 0x31, 0x91, 0x42, 0x0c, 0xec, 0xd1, 0x27, 0x42, 0x09,
+    0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05,
+    0x09, 0x64, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x81, 0x01, 0x09, 0x06, 0x04, 0x04, 0x07, 0x98, 0x01, 0x09, 0x00,
+    0x07, 0x9b, 0x01, 0x05, 0x03, 0x07, 0x65, 0x08, 0xa2, 0x01, 0x07, 0xa5, 0x01, 0x05, 0x03, 0x07, 0x61, 0x09, 0x00,
+    0x07, 0x65, 0x08, 0xa8, 0x01, 0x07, 0x81, 0x01, 0x09, 0x01, 0x07, 0x7c, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28,
+    0x03, 0x07, 0x88, 0x01, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09,
+    0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x7f, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00,
+    0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x00, 0x05, 0x05, 0x0c, 0x4e, 0x62, 0x66, 0x42, 0x0c, 0xe3,
+    0xa5, 0xd7, 0xc1, 0x06, 0x05, 0x0c, 0x6f, 0x12, 0x83, 0xba, 0x0c, 0xe3, 0xa5, 0xd7, 0x41, 0x06, 0x05, 0x0c, 0x54,
+    0x63, 0x66, 0xc2, 0x0c, 0xe3, 0xa5, 0xd7, 0xc1, 0x06, 0x06, 0x07, 0xab, 0x01, 0x01, 0x04, 0x07, 0x81, 0x01, 0x09,
+    0x02, 0x04, 0x07, 0x3c, 0x08, 0xad, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xb7, 0x01, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x03,
+    0x07, 0x65, 0x08, 0xd4, 0x01, 0x07, 0xab, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0xcd, 0xcc,
+    0x4c, 0x3f, 0x0c, 0xcd, 0xcc, 0x4c, 0x3f, 0x0c, 0xcd, 0xcc, 0x4c, 0x3f, 0x09, 0x01, 0x06, 0x07, 0x81, 0x01, 0x09,
+    0x03, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x64, 0x07, 0x81, 0x01, 0x09, 0x04, 0x04,
+    0x07, 0x38, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x1e, 0x07, 0x81, 0x01, 0x09, 0x05, 0x04, 0x07, 0xd7,
+    0x01, 0x09, 0x02, 0x07, 0xda, 0x01, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x07, 0x3c, 0x08, 0xe0, 0x01, 0x07,
+    0xb4, 0x01, 0x08, 0xe9, 0x01, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x03, 0x07, 0x65, 0x08, 0x86, 0x02, 0x07, 0x86, 0x01,
+    0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0x27, 0x31, 0x91, 0x42, 0x0c, 0xec, 0xd1, 0x27, 0x42, 0x06,
+    0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x25, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x09, 0x00, 0x09,
+    0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05,
+    0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x81, 0x01, 0x09, 0x03, 0x04, 0x07, 0x84, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x06, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28,
+    0x09, 0x64, 0x07, 0x81, 0x01, 0x09, 0x07, 0x04, 0x07, 0x89, 0x02, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09,
+    0x00, 0x07, 0x81, 0x01, 0x09, 0x04, 0x04, 0x07, 0x8c, 0x02, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00,
+    0x07, 0x81, 0x01, 0x09, 0x05, 0x04, 0x07, 0x3c, 0x08, 0x8f, 0x02, 0x04, 0x06, 0x07, 0x3c, 0x08, 0x99, 0x02, 0x07,
+    0xa1, 0x02, 0x09, 0x02, 0x07, 0xa4, 0x02, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x01,
+    0x07, 0xb4, 0x01, 0x08, 0xa8, 0x02, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x06, 0x07, 0x32, 0x09, 0x00, 0x07, 0x35, 0x09,
+    0x23, 0x07, 0xd4, 0x01, 0x09, 0x00, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x04, 0x03, 0x07, 0x4f, 0x09, 0x00, 0x07, 0x61,
+    0x09, 0x02, 0x07, 0x65, 0x09, 0x04, 0x07, 0x3c, 0x08, 0xba, 0x02, 0x07, 0x79, 0x09, 0x01, 0x07, 0x7c, 0x03, 0x07,
+    0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x50, 0x07, 0x81, 0x01, 0x09, 0x0b, 0x04, 0x07, 0x84, 0x01,
+    0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x0a, 0x04, 0x07, 0x86, 0x01, 0x03,
+    0x07, 0x25, 0x09, 0x01, 0x07, 0x28, 0x05, 0x03, 0x07, 0x88, 0x01, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0x83, 0xc0, 0x2a,
+    0x3f, 0x07, 0x8c, 0x01, 0x09, 0x01, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0xfa, 0x7e, 0xaa, 0x3e, 0x07,
+    0x8c, 0x01, 0x09, 0x00, 0x04, 0x07, 0x8e, 0x01, 0x09, 0x03, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0xfb,
+    0x00, 0x09, 0x00, 0x06, 0x07, 0x92, 0x01, 0x05, 0x09, 0x00, 0x0c, 0x10, 0x58, 0xd5, 0x40, 0x09, 0x00, 0x06, 0x07,
+    0x95, 0x01, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0x88, 0x01, 0x03, 0x07, 0x8a, 0x01,
+    0x0c, 0x83, 0xc0, 0x2a, 0x3f, 0x07, 0x8c, 0x01, 0x09, 0x01, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0xfa,
+    0x7e, 0xaa, 0x3e, 0x07, 0x8c, 0x01, 0x09, 0x00, 0x04, 0x07, 0x8e, 0x01, 0x09, 0x11, 0x07, 0x90, 0x01, 0x05, 0x0a,
+    0xfa, 0x00, 0x0a, 0x23, 0x01, 0x09, 0x00, 0x06, 0x07, 0x92, 0x01, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x07, 0x95, 0x01, 0x05, 0x09, 0x00, 0x0c, 0x10, 0x58, 0xd5, 0x40, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07, 0x8e, 0x01,
+    0x09, 0x20, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0xfb, 0x00, 0x09, 0x00, 0x06, 0x04, 0x06, 0x07, 0x81,
+    0x01, 0x09, 0x02, 0x04, 0x07, 0x25, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0x27, 0x31, 0x91, 0x42,
+    0x0c, 0xec, 0xd1, 0x27, 0x42, 0x09, 0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07,
+    0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x09, 0x64, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x81, 0x01, 0x09, 0x06, 0x04,
+    0x04, 0x07, 0x98, 0x01, 0x09, 0x00, 0x07, 0x9b, 0x01, 0x05, 0x03, 0x07, 0x65, 0x08, 0xa2, 0x01, 0x07, 0xa5, 0x01,
+    0x05, 0x03, 0x07, 0x61, 0x09, 0x00, 0x07, 0x65, 0x08, 0xa8, 0x01, 0x07, 0x81, 0x01, 0x09, 0x01, 0x07, 0x7c, 0x03,
+    0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x03, 0x07, 0x88, 0x01, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09,
+    0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x7f, 0x05, 0x05, 0x09, 0x00, 0x09, 0x00,
+    0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x00, 0x05, 0x05, 0x0c,
+    0x4e, 0x62, 0x66, 0x42, 0x0c, 0xd7, 0xa3, 0xd7, 0xc1, 0x06, 0x05, 0x0c, 0x6f, 0x12, 0x83, 0xba, 0x0c, 0xd7, 0xa3,
+    0xd7, 0x41, 0x06, 0x05, 0x0c, 0x54, 0x63, 0x66, 0xc2, 0x0c, 0xd7, 0xa3, 0xd7, 0xc1, 0x06, 0x06, 0x07, 0xab, 0x01,
+    0x01, 0x04, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x3c, 0x08, 0xad, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xb7, 0x01,
+    0x07, 0xd1, 0x01, 0x01, 0x04, 0x03, 0x07, 0x65, 0x08, 0xd4, 0x01, 0x07, 0xab, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x05, 0x0c, 0xef, 0xee, 0x6e, 0x3f, 0x0c, 0xef, 0xee, 0x6e, 0x3f, 0x0c, 0xef, 0xee, 0x6e, 0x3f, 0x09,
+    0x01, 0x06, 0x07, 0x81, 0x01, 0x09, 0x03, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x64,
+    0x07, 0x81, 0x01, 0x09, 0x04, 0x04, 0x07, 0x38, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x1e, 0x07, 0x81,
+    0x01, 0x09, 0x05, 0x04, 0x07, 0xd7, 0x01, 0x09, 0x02, 0x07, 0xda, 0x01, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09, 0x00,
+    0x07, 0x3c, 0x08, 0xe0, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xe9, 0x01, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x03, 0x07, 0x65,
+    0x08, 0x86, 0x02, 0x07, 0x86, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0x27, 0x31, 0x91, 0x42,
+    0x0c, 0xec, 0xd1, 0x27, 0x42, 0x06, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x25, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07,
+    0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x81, 0x01, 0x09, 0x03, 0x04, 0x07, 0x84,
+    0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x06, 0x04, 0x07, 0x7f, 0x03,
+    0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x64, 0x07, 0x81, 0x01, 0x09, 0x07, 0x04, 0x07, 0x89, 0x02, 0x03, 0x07,
+    0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x04, 0x04, 0x07, 0x8c, 0x02, 0x03, 0x07, 0x25,
+    0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x05, 0x04, 0x07, 0x3c, 0x08, 0x8f, 0x02, 0x04, 0x06,
+    0x07, 0x3c, 0x08, 0x99, 0x02, 0x07, 0xa1, 0x02, 0x09, 0x02, 0x07, 0xa4, 0x02, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09,
+    0x00, 0x07, 0x81, 0x01, 0x09, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xa8, 0x02, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x06, 0x07,
+    0x32, 0x09, 0x00, 0x07, 0x35, 0x09, 0x23, 0x07, 0xd4, 0x01, 0x09, 0x00, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x04, 0x03,
+    0x07, 0x4f, 0x09, 0x00, 0x07, 0x61, 0x09, 0x03, 0x07, 0x65, 0x09, 0x04, 0x07, 0x3c, 0x08, 0xcb, 0x02, 0x07, 0x79,
+    0x09, 0x01, 0x07, 0x7c, 0x03, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x64, 0x07, 0x81, 0x01,
+    0x09, 0x0b, 0x04, 0x07, 0x84, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09,
+    0x0a, 0x04, 0x07, 0x86, 0x01, 0x03, 0x07, 0x25, 0x09, 0x01, 0x07, 0x28, 0x05, 0x03, 0x07, 0x88, 0x01, 0x03, 0x07,
+    0x8a, 0x01, 0x0c, 0x83, 0xc0, 0x2a, 0x3f, 0x07, 0x8c, 0x01, 0x09, 0x01, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x8a, 0x01,
+    0x0c, 0xfa, 0x7e, 0xaa, 0x3e, 0x07, 0x8c, 0x01, 0x09, 0x00, 0x04, 0x07, 0x8e, 0x01, 0x09, 0x04, 0x07, 0x90, 0x01,
+    0x05, 0x0a, 0xfa, 0x00, 0x0a, 0x44, 0x01, 0x09, 0x00, 0x06, 0x07, 0x92, 0x01, 0x05, 0x09, 0x00, 0x0c, 0x10, 0x58,
+    0xd5, 0x40, 0x09, 0x00, 0x06, 0x07, 0x95, 0x01, 0x05, 0x09, 0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x04, 0x03, 0x07,
+    0x88, 0x01, 0x03, 0x07, 0x8a, 0x01, 0x0c, 0x83, 0xc0, 0x2a, 0x3f, 0x07, 0x8c, 0x01, 0x09, 0x01, 0x04, 0x07, 0x7f,
+    0x03, 0x07, 0x8a, 0x01, 0x0c, 0xfa, 0x7e, 0xaa, 0x3e, 0x07, 0x8c, 0x01, 0x09, 0x00, 0x04, 0x07, 0x8e, 0x01, 0x09,
+    0x12, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0x6c, 0x01, 0x09, 0x00, 0x06, 0x07, 0x92, 0x01, 0x05, 0x09,
+    0x00, 0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x95, 0x01, 0x05, 0x09, 0x00, 0x0c, 0x10, 0x58, 0xd5, 0x40, 0x09, 0x00,
+    0x06, 0x04, 0x03, 0x07, 0x8e, 0x01, 0x09, 0x22, 0x07, 0x90, 0x01, 0x05, 0x0a, 0xfa, 0x00, 0x0a, 0x44, 0x01, 0x09,
+    0x00, 0x06, 0x04, 0x06, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x25, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28,
+    0x05, 0x0c, 0x93, 0x98, 0x04, 0x43, 0x0c, 0xf6, 0xe8, 0xcb, 0x42, 0x09, 0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01,
+    0x04, 0x07, 0x90, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x09, 0x64, 0x09, 0x64, 0x09, 0x64, 0x06,
+    0x07, 0x81, 0x01, 0x09, 0x06, 0x04, 0x04, 0x07, 0x98, 0x01, 0x09, 0x00, 0x07, 0x9b, 0x01, 0x05, 0x03, 0x07, 0x65,
+    0x08, 0xa2, 0x01, 0x07, 0xa5, 0x01, 0x05, 0x03, 0x07, 0x61, 0x09, 0x00, 0x07, 0x65, 0x08, 0xa8, 0x01, 0x07, 0x81,
+    0x01, 0x09, 0x01, 0x07, 0x7c, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x03, 0x07, 0x88, 0x01, 0x05, 0x05, 0x09,
+    0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x06, 0x07, 0x7f,
+    0x05, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06, 0x05, 0x09, 0x00, 0x09, 0x00, 0x06,
+    0x06, 0x07, 0x00, 0x05, 0x05, 0x0c, 0x4e, 0x62, 0x66, 0x42, 0x0c, 0xd7, 0xa3, 0xd7, 0xc1, 0x06, 0x05, 0x0c, 0x6f,
+    0x12, 0x83, 0xba, 0x0c, 0xd7, 0xa3, 0xd7, 0x41, 0x06, 0x05, 0x0c, 0x54, 0x63, 0x66, 0xc2, 0x0c, 0xd7, 0xa3, 0xd7,
+    0xc1, 0x06, 0x06, 0x07, 0xab, 0x01, 0x01, 0x04, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x3c, 0x08, 0xad, 0x01,
+    0x07, 0xb4, 0x01, 0x08, 0xb7, 0x01, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x03, 0x07, 0x65, 0x08, 0xd4, 0x01, 0x07, 0xab,
+    0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x09, 0x01, 0x06, 0x07,
+    0x81, 0x01, 0x09, 0x03, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x64, 0x07, 0x81, 0x01,
+    0x09, 0x04, 0x04, 0x07, 0x38, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x1e, 0x07, 0x81, 0x01, 0x09, 0x05,
+    0x04, 0x07, 0xd7, 0x01, 0x09, 0x02, 0x07, 0xda, 0x01, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x07, 0x3c, 0x08,
+    0xe0, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xe9, 0x01, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x03, 0x07, 0x65, 0x08, 0x86, 0x02,
+    0x07, 0x86, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05, 0x0c, 0x93, 0x98, 0x04, 0x43, 0x0c, 0xf6, 0xe8,
+    0xcb, 0x42, 0x06, 0x07, 0x81, 0x01, 0x09, 0x02, 0x04, 0x07, 0x25, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07, 0x28, 0x05,
+    0x09, 0x00, 0x09, 0x00, 0x06, 0x07, 0x81, 0x01, 0x09, 0x01, 0x04, 0x07, 0x90, 0x01, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x05, 0x09, 0x64, 0x09, 0x64, 0x06, 0x07, 0x81, 0x01, 0x09, 0x03, 0x04, 0x07, 0x84, 0x01, 0x03, 0x07,
+    0x25, 0x09, 0x00, 0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x06, 0x04, 0x07, 0x7f, 0x03, 0x07, 0x25, 0x09,
+    0x00, 0x07, 0x28, 0x09, 0x64, 0x07, 0x81, 0x01, 0x09, 0x07, 0x04, 0x07, 0x89, 0x02, 0x03, 0x07, 0x25, 0x09, 0x00,
+    0x07, 0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x04, 0x04, 0x07, 0x8c, 0x02, 0x03, 0x07, 0x25, 0x09, 0x00, 0x07,
+    0x28, 0x09, 0x00, 0x07, 0x81, 0x01, 0x09, 0x05, 0x04, 0x07, 0x3c, 0x08, 0x8f, 0x02, 0x04, 0x06, 0x07, 0x3c, 0x08,
+    0x99, 0x02, 0x07, 0xa1, 0x02, 0x09, 0x02, 0x07, 0xa4, 0x02, 0x09, 0x02, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x07, 0x81,
+    0x01, 0x09, 0x01, 0x07, 0xb4, 0x01, 0x08, 0xa8, 0x02, 0x07, 0xd1, 0x01, 0x01, 0x04, 0x06, 0x07, 0x32, 0x09, 0x00,
+    0x07, 0x35, 0x09, 0x23, 0x07, 0xd4, 0x01, 0x09, 0x00, 0x07, 0xdd, 0x01, 0x09, 0x00, 0x04, 0x06, 0x07, 0xdc, 0x02,
+    0x05, 0x06, 0x04, 0x76, 0x00, 0x35, 0x2e, 0x35, 0x2e, 0x37, 0x00, 0x6d, 0x65, 0x74, 0x61, 0x00, 0x67, 0x00, 0x4c,
+    0x6f, 0x74, 0x74, 0x69, 0x65, 0x46, 0x69, 0x6c, 0x65, 0x73, 0x20, 0x41, 0x45, 0x20, 0x30, 0x2e, 0x31, 0x2e, 0x32,
+    0x30, 0x00, 0x61, 0x00, 0x00, 0x6b, 0x00, 0x64, 0x00, 0x74, 0x63, 0x00, 0x66, 0x72, 0x00, 0x69, 0x70, 0x00, 0x6f,
+    0x70, 0x00, 0x77, 0x00, 0x68, 0x00, 0x6e, 0x6d, 0x00, 0x61, 0x72, 0x72, 0x6f, 0x77, 0x20, 0x61, 0x6e, 0x69, 0x6d,
+    0x61, 0x74, 0x69, 0x6f, 0x6e, 0x00, 0x64, 0x64, 0x64, 0x00, 0x61, 0x73, 0x73, 0x65, 0x74, 0x73, 0x00, 0x6c, 0x61,
+    0x79, 0x65, 0x72, 0x73, 0x00, 0x69, 0x6e, 0x64, 0x00, 0x74, 0x79, 0x00, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x35,
+    0x20, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x73, 0x72, 0x00, 0x6b, 0x73, 0x00, 0x6f, 0x00, 0x69,
+    0x78, 0x00, 0x72, 0x00, 0x70, 0x00, 0x69, 0x00, 0x78, 0x00, 0x79, 0x00, 0x74, 0x00, 0x73, 0x00, 0x74, 0x6f, 0x00,
+    0x74, 0x69, 0x00, 0x61, 0x6f, 0x00, 0x73, 0x68, 0x61, 0x70, 0x65, 0x73, 0x00, 0x67, 0x72, 0x00, 0x69, 0x74, 0x00,
+    0x73, 0x68, 0x00, 0x63, 0x00, 0x50, 0x61, 0x74, 0x68, 0x20, 0x31, 0x00, 0x6d, 0x6e, 0x00, 0x41, 0x44, 0x42, 0x45,
+    0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x53, 0x68, 0x61, 0x70, 0x65, 0x20, 0x2d, 0x20, 0x47, 0x72, 0x6f,
+    0x75, 0x70, 0x00, 0x68, 0x64, 0x00, 0x73, 0x74, 0x00, 0x6c, 0x63, 0x00, 0x6c, 0x6a, 0x00, 0x62, 0x6d, 0x00, 0x53,
+    0x74, 0x72, 0x6f, 0x6b, 0x65, 0x20, 0x31, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20, 0x56, 0x65, 0x63, 0x74, 0x6f, 0x72,
+    0x20, 0x47, 0x72, 0x61, 0x70, 0x68, 0x69, 0x63, 0x20, 0x2d, 0x20, 0x53, 0x74, 0x72, 0x6f, 0x6b, 0x65, 0x00, 0x74,
+    0x72, 0x00, 0x73, 0x6b, 0x00, 0x73, 0x61, 0x00, 0x54, 0x72, 0x61, 0x6e, 0x73, 0x66, 0x6f, 0x72, 0x6d, 0x00, 0x47,
+    0x72, 0x6f, 0x75, 0x70, 0x20, 0x31, 0x00, 0x6e, 0x70, 0x00, 0x63, 0x69, 0x78, 0x00, 0x41, 0x44, 0x42, 0x45, 0x20,
+    0x56, 0x65, 0x63, 0x74, 0x6f, 0x72, 0x20, 0x47, 0x72, 0x6f, 0x75, 0x70, 0x00, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20,
+    0x34, 0x20, 0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x4c, 0x61, 0x79, 0x65, 0x72, 0x20, 0x33, 0x20,
+    0x4f, 0x75, 0x74, 0x6c, 0x69, 0x6e, 0x65, 0x73, 0x00, 0x6d, 0x61, 0x72, 0x6b, 0x65, 0x72, 0x73, 0x00
+};
+
+const size_t test_lottie_arrow_bin_size = sizeof(test_lottie_arrow_bin);
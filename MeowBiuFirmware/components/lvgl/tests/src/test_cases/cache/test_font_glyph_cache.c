@@ -0,0 +1,165 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if LV_USE_FONT_COMPRESSED && LV_FONT_MONTSERRAT_28_COMPRESSED && LV_FONT_COMPRESSED_CACHE_SIZE
+
+#define glyph_cache_p (LV_GLOBAL_DEFAULT()->font_fmt_glyph_cache)
+
+static lv_obj_t * label;
+
+void setUp(void)
+{
+    label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label, "12:34:56");
+    lv_obj_set_pos(label, 0, 0);
+
+    lv_cache_drop_all(glyph_cache_p, NULL);
+    lv_cache_reset_stats(glyph_cache_p);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_cache_drop_all(glyph_cache_p, NULL);
+    lv_cache_set_max_size(glyph_cache_p, LV_FONT_COMPRESSED_CACHE_SIZE, NULL);
+}
+
+static void render_frame(void)
+{
+    lv_obj_invalidate(label);
+    lv_refr_now(NULL);
+}
+
+/*Copy the rows of the label from the frame buffer*/
+static uint8_t * label_rows_copy(void)
+{
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * lv_obj_get_height(label);
+    uint8_t * rows = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(rows);
+    lv_memcpy(rows, buf->data, size);
+    return rows;
+}
+
+void test_font_glyph_cache_renders_the_same(void)
+{
+    lv_cache_set_max_size(glyph_cache_p, 0, NULL);
+    render_frame();
+    uint8_t * ref = label_rows_copy();
+
+    lv_cache_set_max_size(glyph_cache_p, LV_FONT_COMPRESSED_CACHE_SIZE, NULL);
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        render_frame();
+        uint8_t * rows = label_rows_copy();
+        lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+        TEST_ASSERT_EQUAL_MEMORY(ref, rows, buf->header.stride * lv_obj_get_height(label));
+        lv_free(rows);
+    }
+
+    lv_free(ref);
+}
+
+void test_font_glyph_cache_hits(void)
+{
+    render_frame();
+
+    /*"12:34:56" has 7 different glyphs*/
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(glyph_cache_p, &stats);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+
+    /*The digits are not decompressed again, also not for an other label*/
+    lv_obj_t * label2 = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label2, &lv_font_montserrat_28_compressed, 0);
+    lv_label_set_text(label2, "65:43:21");
+    lv_obj_set_pos(label2, 0, 100);
+    render_frame();
+
+    lv_cache_get_stats(glyph_cache_p, &stats);
+    TEST_ASSERT_EQUAL_UINT32(7, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1 + 8 + 8, stats.hit_cnt);
+}
+
+void test_font_glyph_cache_budget(void)
+{
+    render_frame();
+    size_t full_size = lv_cache_get_size(glyph_cache_p, NULL);
+    TEST_ASSERT_GREATER_THAN(0, full_size);
+
+    /*With room for only a few glyphs the least recently used ones are evicted*/
+    lv_cache_drop_all(glyph_cache_p, NULL);
+    lv_cache_set_max_size(glyph_cache_p, full_size / 2, NULL);
+    lv_cache_reset_stats(glyph_cache_p);
+    render_frame();
+
+    lv_cache_stats_t stats;
+    lv_cache_get_stats(glyph_cache_p, &stats);
+    TEST_ASSERT_GREATER_THAN(0, stats.evict_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(full_size / 2, lv_cache_get_size(glyph_cache_p, NULL));
+    TEST_ASSERT_EQUAL_SCREENSHOT("cache/font_glyph_cache_budget.png");
+
+    /*Glyphs larger than the cache are drawn without caching*/
+    lv_cache_drop_all(glyph_cache_p, NULL);
+    lv_cache_set_max_size(glyph_cache_p, 16, NULL);
+    render_frame();
+    TEST_ASSERT_EQUAL(0, lv_cache_get_size(glyph_cache_p, NULL));
+    TEST_ASSERT_EQUAL_SCREENSHOT("cache/font_glyph_cache_budget.png");
+}
+
+/*Not a pass/fail test: print the redraw time of a clock label with and without the cache*/
+void test_font_glyph_cache_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    const uint32_t frame_cnt = 200;
+    static const char * const names[] = {"without cache", "with cache"};
+
+    uint32_t mode;
+    for(mode = 0; mode < 2; mode++) {
+        lv_cache_drop_all(glyph_cache_p, NULL);
+        lv_cache_set_max_size(glyph_cache_p, mode ? LV_FONT_COMPRESSED_CACHE_SIZE : 0, NULL);
+        render_frame();
+
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t i;
+        for(i = 0; i < frame_cnt; i++) {
+            lv_label_set_text_fmt(label, "12:%02d:%02d", (int)(i / 60) % 60, (int)i % 60);
+            lv_refr_now(NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+
+        TEST_PRINTF("label redraw %s: %d us", names[mode], (int)(us / frame_cnt));
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_font_glyph_cache_renders_the_same(void)
+{
+}
+
+#endif
+
+#endif
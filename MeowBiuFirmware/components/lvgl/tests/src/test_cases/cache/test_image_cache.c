@@ -0,0 +1,170 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define img_cache_p (LV_GLOBAL_DEFAULT()->img_cache)
+
+LV_IMAGE_DECLARE(test_image_cogwheel_i4);
+
+/*I4 images are converted on decode so they are put to the image cache*/
+static lv_image_dsc_t img_dsc;
+static uint8_t * img_data;
+
+void setUp(void)
+{
+    img_dsc = test_image_cogwheel_i4;
+    img_data = lv_malloc(img_dsc.data_size);
+    TEST_ASSERT_NOT_NULL(img_data);
+    lv_memcpy(img_data, test_image_cogwheel_i4.data, img_dsc.data_size);
+    img_dsc.data = img_data;
+
+    lv_image_cache_drop(NULL);
+    lv_image_cache_reset_stats();
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_image_cache_drop(NULL);
+    lv_free(img_data);
+}
+
+static void render_frame(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+void test_image_cache_stats(void)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &img_dsc);
+
+    render_frame();
+
+    lv_cache_stats_t stats;
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+
+    render_frame();
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.drop_cnt);
+
+    lv_image_cache_drop(&img_dsc);
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.drop_cnt);
+
+    /*Make room for only one image to force eviction*/
+    render_frame();
+    size_t max_size = lv_cache_get_max_size(img_cache_p, NULL);
+    lv_image_cache_resize(lv_cache_get_size(img_cache_p, NULL), false);
+    lv_obj_t * img2 = lv_image_create(lv_screen_active());
+    lv_image_set_src(img2, &test_image_cogwheel_i4);
+    render_frame();
+    lv_image_cache_resize(max_size, false);
+
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(1, stats.evict_cnt);
+
+    lv_image_cache_reset_stats();
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.evict_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.drop_cnt);
+}
+
+void test_image_cache_volatile(void)
+{
+    img_dsc.header.flags |= LV_IMAGE_FLAGS_VOLATILE;
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, &img_dsc);
+    lv_obj_set_pos(img, 0, 0);
+
+    render_frame();
+    render_frame();
+
+    /*Not looked up and not added*/
+    lv_cache_stats_t stats;
+    lv_image_cache_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.hit_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, stats.miss_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, lv_cache_get_size(img_cache_p, NULL));
+
+    /*Change the palette in place: the new colors should be used without dropping the image from the cache*/
+    lv_color32_t * palette = (lv_color32_t *)img_data;
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        palette[i] = lv_color32_make(0xff, 0x00, 0x00, 0xff);
+    }
+
+    render_frame();
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t * px = (uint32_t *)(buf->data + 50 * buf->header.stride);
+    TEST_ASSERT_EQUAL_HEX32(0xff0000, px[50] & 0xffffff);
+}
+
+/*Not a pass/fail test: report the per-frame cost of the image cache with several animations on the screen.
+ *"drop" emulates the former way of dropping every frame from the cache, "volatile" uses LV_IMAGE_FLAGS_VOLATILE.*/
+void test_image_cache_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    const uint32_t img_cnt = 8;
+    const uint32_t frame_cnt = 100;
+
+    lv_image_dsc_t dscs[8];
+    lv_obj_t * imgs[8];
+    uint32_t i;
+    for(i = 0; i < img_cnt; i++) {
+        dscs[i] = img_dsc;
+        imgs[i] = lv_image_create(lv_screen_active());
+        lv_image_set_src(imgs[i], &dscs[i]);
+        lv_obj_set_pos(imgs[i], (i % 4) * 110, (i / 4) * 110);
+    }
+    render_frame();
+
+    uint32_t mode;
+    for(mode = 0; mode < 2; mode++) {
+        for(i = 0; i < img_cnt; i++) {
+            if(mode == 0) dscs[i].header.flags &= ~LV_IMAGE_FLAGS_VOLATILE;
+            else dscs[i].header.flags |= LV_IMAGE_FLAGS_VOLATILE;
+        }
+        lv_image_cache_drop(NULL);
+        lv_image_cache_reset_stats();
+
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t f;
+        for(f = 0; f < frame_cnt; f++) {
+            /*Each frame of an animation changes the image in place*/
+            for(i = 0; i < img_cnt; i++) {
+                if(mode == 0) lv_image_cache_drop(&dscs[i]);
+                lv_obj_invalidate(imgs[i]);
+            }
+            lv_refr_now(NULL);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+
+        lv_cache_stats_t stats;
+        lv_image_cache_get_stats(&stats);
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+        TEST_PRINTF("%s: %d us/frame, hit: %d, miss: %d, evict: %d, drop: %d", mode == 0 ? "drop" : "volatile",
+                    (int)(us / frame_cnt), (int)stats.hit_cnt, (int)stats.miss_cnt, (int)stats.evict_cnt, (int)stats.drop_cnt);
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
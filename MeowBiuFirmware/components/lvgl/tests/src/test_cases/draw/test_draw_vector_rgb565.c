@@ -0,0 +1,247 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define CANVAS_W    240
+#define CANVAS_H    240
+
+static lv_draw_buf_t * direct_buf;
+static lv_draw_buf_t * ref_buf;
+static lv_draw_buf_t * argb_buf;
+
+void setUp(void)
+{
+    direct_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    ref_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    argb_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_ARGB8888, LV_STRIDE_AUTO);
+    TEST_ASSERT_NOT_NULL(direct_buf);
+    TEST_ASSERT_NOT_NULL(ref_buf);
+    TEST_ASSERT_NOT_NULL(argb_buf);
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    lv_draw_buf_destroy(direct_buf);
+    lv_draw_buf_destroy(ref_buf);
+    lv_draw_buf_destroy(argb_buf);
+}
+
+/*Eyes of a face: filled, translucent, gradient and stroked shapes*/
+static void draw_face(lv_layer_t * layer)
+{
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_area_t rect = {10, 180, 229, 229};
+    lv_vector_dsc_set_fill_color32(ctx, lv_color32_make(0x20, 0x40, 0x60, 0x80));
+    lv_vector_clear_area(ctx, &rect);
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_fpoint_t c = {70.0f + i * 100.0f, 90.0f};
+
+        lv_grad_stop_t stops[2];
+        lv_memzero(stops, sizeof(stops));
+        stops[0].color = lv_color_hex(0xffffff);
+        stops[0].opa = LV_OPA_COVER;
+        stops[0].frac = 0;
+        stops[1].color = lv_color_hex(0x2060ff);
+        stops[1].opa = LV_OPA_70;
+        stops[1].frac = 255;
+
+        lv_vector_path_clear(path);
+        lv_vector_path_append_circle(path, &c, 45.5f, 35.25f);
+        lv_matrix_t mt;
+        lv_matrix_identity(&mt);
+        lv_vector_dsc_set_fill_transform(ctx, &mt);
+        lv_vector_dsc_set_fill_radial_gradient(ctx, c.x, c.y, 45);
+        lv_vector_dsc_set_fill_gradient_color_stops(ctx, stops, 2);
+        lv_vector_dsc_set_fill_gradient_spread(ctx, LV_VECTOR_GRADIENT_SPREAD_PAD);
+        lv_vector_dsc_set_stroke_color(ctx, lv_color_hex(0x101010));
+        lv_vector_dsc_set_stroke_opa(ctx, LV_OPA_COVER);
+        lv_vector_dsc_set_stroke_width(ctx, 3.0f);
+        lv_vector_dsc_add_path(ctx, path);
+
+        lv_vector_path_clear(path);
+        lv_vector_path_append_circle(path, &c, 12.3f, 12.3f);
+        lv_vector_dsc_set_fill_color32(ctx, lv_color32_make(0x00, 0x00, 0x00, 0xc0));
+        lv_vector_dsc_set_stroke_opa(ctx, LV_OPA_TRANSP);
+        lv_vector_dsc_add_path(ctx, path);
+    }
+
+    /*Mouth: a gradient stroke*/
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0xff0000);
+    stops[0].opa = LV_OPA_COVER;
+    stops[0].frac = 0;
+    stops[1].color = lv_color_hex(0x00ff00);
+    stops[1].opa = LV_OPA_50;
+    stops[1].frac = 255;
+
+    lv_fpoint_t p0 = {60.5f, 200.0f};
+    lv_fpoint_t p1 = {120.0f, 240.0f};
+    lv_fpoint_t p2 = {180.5f, 200.0f};
+    lv_vector_path_clear(path);
+    lv_vector_path_move_to(path, &p0);
+    lv_vector_path_quad_to(path, &p1, &p2);
+    lv_vector_dsc_set_fill_opa(ctx, LV_OPA_TRANSP);
+    lv_vector_dsc_set_stroke_opa(ctx, LV_OPA_COVER);
+    lv_vector_dsc_set_stroke_width(ctx, 7.0f);
+    lv_vector_dsc_set_stroke_cap(ctx, LV_VECTOR_STROKE_CAP_ROUND);
+    lv_vector_dsc_set_stroke_linear_gradient(ctx, 60, 200, 180, 200);
+    lv_vector_dsc_set_stroke_gradient_color_stops(ctx, stops, 2);
+    lv_vector_dsc_add_path(ctx, path);
+
+    /*An opaque rectangle (fast track) and a translucent one*/
+    lv_area_t r1 = {5, 5, 40, 30};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_rect(path, &r1, 0, 0);
+    lv_vector_dsc_set_fill_color(ctx, lv_color_hex(0xffa000));
+    lv_vector_dsc_set_fill_opa(ctx, LV_OPA_COVER);
+    lv_vector_dsc_set_stroke_opa(ctx, LV_OPA_TRANSP);
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_area_t r2 = {20, 15, 80, 50};
+    lv_vector_path_clear(path);
+    lv_vector_path_append_rect(path, &r2, 6, 6);
+    lv_vector_dsc_set_fill_opa(ctx, LV_OPA_40);
+    lv_vector_dsc_set_fill_color(ctx, lv_color_hex(0x00a0ff));
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+}
+
+static lv_obj_t * create_canvas(lv_draw_buf_t * buf, lv_color_t bg_color, lv_opa_t bg_opa)
+{
+    lv_obj_t * canvas = lv_canvas_create(lv_screen_active());
+    lv_canvas_set_draw_buf(canvas, buf);
+    lv_canvas_fill_bg(canvas, bg_color, bg_opa);
+    return canvas;
+}
+
+/*Draw the face directly to the RGB565 canvas*/
+static void render_direct(lv_obj_t * canvas)
+{
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    draw_face(&layer);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+/*Draw the face to an ARGB8888 buffer and blend it to the RGB565 canvas, like the fallback path*/
+static void render_round_trip(lv_obj_t * canvas, lv_obj_t * argb_canvas)
+{
+    lv_canvas_fill_bg(argb_canvas, lv_color_black(), LV_OPA_TRANSP);
+    render_direct(argb_canvas);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_draw_image_dsc_t img_dsc;
+    lv_draw_image_dsc_init(&img_dsc);
+    img_dsc.src = argb_buf;
+    lv_area_t area = {0, 0, CANVAS_W - 1, CANVAS_H - 1};
+    lv_draw_image(&layer, &img_dsc, &area);
+    lv_canvas_finish_layer(canvas, &layer);
+}
+
+void test_draw_vector_rgb565_same_as_xrgb8888(void)
+{
+    /*The reference is the face drawn to an opaque 32 bit buffer (as on XRGB8888 displays)*/
+    lv_color_t bg_color = lv_color_hex(0x405060);
+    lv_draw_buf_t * xrgb_buf = lv_draw_buf_create(CANVAS_W, CANVAS_H, LV_COLOR_FORMAT_XRGB8888, LV_STRIDE_AUTO);
+    lv_obj_t * direct_canvas = create_canvas(direct_buf, bg_color, LV_OPA_COVER);
+    lv_obj_t * xrgb_canvas = create_canvas(xrgb_buf, bg_color, LV_OPA_COVER);
+
+    render_direct(direct_canvas);
+    render_direct(xrgb_canvas);
+
+    /*RGB565 blends with the already quantized background, so allow a small difference*/
+    uint32_t diff_cnt = 0;
+    uint32_t drawn_cnt = 0;
+    uint16_t bg565 = lv_color_to_u16(bg_color);
+    int32_t y;
+    for(y = 0; y < CANVAS_H; y++) {
+        const uint16_t * d = (const uint16_t *)(direct_buf->data + y * direct_buf->header.stride);
+        const lv_color32_t * r = (const lv_color32_t *)(xrgb_buf->data + y * xrgb_buf->header.stride);
+        int32_t x;
+        for(x = 0; x < CANVAS_W; x++) {
+            if(d[x] != bg565) drawn_cnt++;
+            uint16_t r565 = lv_color_to_u16(lv_color_make(r[x].red, r[x].green, r[x].blue));
+            if(d[x] == r565) continue;
+            diff_cnt++;
+            TEST_ASSERT_INT_WITHIN(1, (r565 >> 11) & 0x1f, (d[x] >> 11) & 0x1f);
+            TEST_ASSERT_INT_WITHIN(2, (r565 >> 5) & 0x3f, (d[x] >> 5) & 0x3f);
+            TEST_ASSERT_INT_WITHIN(1, r565 & 0x1f, d[x] & 0x1f);
+        }
+    }
+
+    TEST_PRINTF("drawn: %d px, slightly different: %d px", (int)drawn_cnt, (int)diff_cnt);
+    TEST_ASSERT_GREATER_THAN_UINT32(CANVAS_W * CANVAS_H / 8, drawn_cnt);
+
+    lv_obj_delete(xrgb_canvas);
+    lv_draw_buf_destroy(xrgb_buf);
+}
+
+void test_draw_vector_rgb565_unsupported_falls_back(void)
+{
+    /*Blend modes can't be drawn directly to RGB565, they should still be drawn*/
+    lv_obj_t * canvas = create_canvas(direct_buf, lv_color_hex(0x808080), LV_OPA_COVER);
+
+    lv_layer_t layer;
+    lv_canvas_init_layer(canvas, &layer);
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(&layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+    lv_area_t rect = {10, 10, 50, 50};
+    lv_vector_path_append_rect(path, &rect, 0, 0);
+    lv_vector_dsc_set_fill_color(ctx, lv_color_hex(0xff0000));
+    lv_vector_dsc_set_blend_mode(ctx, LV_VECTOR_BLEND_MULTIPLY);
+    lv_vector_dsc_add_path(ctx, path);
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+    lv_canvas_finish_layer(canvas, &layer);
+
+    const uint16_t * px = (const uint16_t *)(direct_buf->data + 30 * direct_buf->header.stride);
+    TEST_ASSERT_EQUAL_HEX16(lv_color_to_u16(lv_color_hex(0x808080)), px[5]);
+    TEST_ASSERT_NOT_EQUAL(lv_color_to_u16(lv_color_hex(0x808080)), px[30]);
+}
+
+/*Not a pass/fail test: report the time of drawing the face directly to RGB565 and with an ARGB8888 round trip*/
+void test_draw_vector_rgb565_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    const uint32_t frame_cnt = 50;
+    lv_obj_t * direct_canvas = create_canvas(direct_buf, lv_color_black(), LV_OPA_COVER);
+    lv_obj_t * ref_canvas = create_canvas(ref_buf, lv_color_black(), LV_OPA_COVER);
+    lv_obj_t * argb_canvas = create_canvas(argb_buf, lv_color_black(), LV_OPA_TRANSP);
+
+    uint32_t mode;
+    for(mode = 0; mode < 2; mode++) {
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t i;
+        for(i = 0; i < frame_cnt; i++) {
+            if(mode == 0) render_direct(direct_canvas);
+            else render_round_trip(ref_canvas, argb_canvas);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+        TEST_PRINTF("%s: %d us/frame", mode == 0 ? "direct RGB565" : "ARGB8888 round trip", (int)(us / frame_cnt));
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
@@ -0,0 +1,309 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+    /*From sanitizer/allocator_interface.h which is not always installed*/
+    int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                                  void (*free_hook)(const volatile void *));
+    #define COUNT_ALLOCS    1
+#else
+    #define COUNT_ALLOCS    0
+#endif
+
+#define DISP_W          480
+#define DISP_H          240
+#define STRIP_CNT       3
+
+static lv_display_t * disp;
+static lv_display_t * disp_ori;
+static lv_draw_buf_t * strip_buf;
+static uint16_t * frame;
+static bool drop_ctx;
+
+#if COUNT_ALLOCS
+static volatile bool count_allocs;
+static volatile uint32_t alloc_cnt;
+
+static void malloc_hook(const volatile void * ptr, size_t size)
+{
+    LV_UNUSED(ptr);
+    LV_UNUSED(size);
+    if(count_allocs) __atomic_fetch_add(&alloc_cnt, 1, __ATOMIC_RELAXED);
+}
+
+static void free_hook(const volatile void * ptr)
+{
+    LV_UNUSED(ptr);
+}
+#endif
+
+/*Free the canvases and buffers of the SW render threads as if they weren't kept between the tasks*/
+static void drop_vector_ctxs(void)
+{
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u) {
+        if(lv_streq(u->name, "SW")) {
+            lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)u;
+            uint32_t i;
+            for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+                lv_draw_sw_vector_ctx_deinit(&sw_unit->vector_ctxs[i]);
+            }
+        }
+        u = u->next;
+    }
+}
+
+/*The largest scratch buffer of the SW render threads*/
+static void get_scratch_buf_size(int32_t * w, int32_t * h)
+{
+    *w = 0;
+    *h = 0;
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u) {
+        if(lv_streq(u->name, "SW")) {
+            lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)u;
+            uint32_t i;
+            for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+                lv_draw_buf_t * buf = sw_unit->vector_ctxs[i].buf;
+                if(buf == NULL) continue;
+                *w = LV_MAX(*w, (int32_t)buf->header.w);
+                *h = LV_MAX(*h, (int32_t)buf->header.h);
+            }
+        }
+        u = u->next;
+    }
+}
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * DISP_W + area->x1], px_map + (y - area->y1) * stride, w * 2);
+    }
+
+    if(drop_ctx) drop_vector_ctxs();
+
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    static bool hooks_installed = false;
+#if COUNT_ALLOCS
+    if(!hooks_installed) {
+        __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+        hooks_installed = true;
+    }
+#else
+    LV_UNUSED(hooks_installed);
+#endif
+
+    disp_ori = lv_display_get_default();
+    disp = lv_display_create(DISP_W, DISP_H);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_flush_cb(disp, flush_cb);
+
+    /*Render the screen in 3 strips*/
+    strip_buf = lv_draw_buf_create(DISP_W, DISP_H / STRIP_CNT, LV_COLOR_FORMAT_RGB565, LV_STRIDE_AUTO);
+    lv_display_set_draw_buffers(disp, strip_buf, NULL);
+    lv_display_set_render_mode(disp, LV_DISPLAY_RENDER_MODE_PARTIAL);
+
+    frame = lv_malloc_zeroed(DISP_W * DISP_H * sizeof(uint16_t));
+    TEST_ASSERT_NOT_NULL(frame);
+    drop_ctx = false;
+}
+
+void tearDown(void)
+{
+    lv_display_delete(disp);
+    lv_display_set_default(disp_ori);
+    lv_draw_buf_destroy(strip_buf);
+    lv_free(frame);
+}
+
+/*An eye drawn directly to the RGB565 strips*/
+static void eye_draw_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    lv_fpoint_t c = {(coords.x1 + coords.x2) / 2.0f, (coords.y1 + coords.y2) / 2.0f};
+    float rx = lv_area_get_width(&coords) / 2.0f - 2;
+    float ry = lv_area_get_height(&coords) / 2.0f - 2;
+
+    lv_grad_stop_t stops[2];
+    lv_memzero(stops, sizeof(stops));
+    stops[0].color = lv_color_hex(0xffffff);
+    stops[0].opa = LV_OPA_COVER;
+    stops[1].color = lv_color_hex(0x2060ff);
+    stops[1].opa = LV_OPA_COVER;
+    stops[1].frac = 255;
+
+    lv_vector_path_append_circle(path, &c, rx, ry);
+    lv_vector_dsc_set_fill_radial_gradient(ctx, c.x, c.y, rx);
+    lv_vector_dsc_set_fill_gradient_color_stops(ctx, stops, 2);
+    lv_vector_dsc_set_stroke_color(ctx, lv_color_black());
+    lv_vector_dsc_set_stroke_width(ctx, 4.0f);
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_vector_path_clear(path);
+    lv_vector_path_append_circle(path, &c, rx / 3, ry / 3);
+    lv_vector_dsc_set_fill_color(ctx, lv_color_black());
+    lv_vector_dsc_set_stroke_opa(ctx, LV_OPA_TRANSP);
+    lv_vector_dsc_add_path(ctx, path);
+
+    lv_draw_vector(ctx);
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+}
+
+/*An icon with screen blending, rendered to the ARGB8888 scratch buffer and blended to the strip*/
+static void icon_draw_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target(e);
+    lv_layer_t * layer = lv_event_get_layer(e);
+    lv_area_t coords;
+    lv_obj_get_coords(obj, &coords);
+
+    lv_vector_dsc_t * ctx = lv_vector_dsc_create(layer);
+    lv_vector_path_t * path = lv_vector_path_create(LV_VECTOR_PATH_QUALITY_MEDIUM);
+
+    /*A star*/
+    float cx = (coords.x1 + coords.x2) / 2.0f;
+    float cy = (coords.y1 + coords.y2) / 2.0f;
+    float r_out = lv_area_get_width(&coords) / 2.0f;
+    static const float unit_pts[10][2] = {
+        {0.0f, -1.0f}, {0.22f, -0.31f}, {0.95f, -0.31f}, {0.36f, 0.12f}, {0.59f, 0.81f},
+        {0.0f, 0.38f}, {-0.59f, 0.81f}, {-0.36f, 0.12f}, {-0.95f, -0.31f}, {-0.22f, -0.31f}
+    };
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_fpoint_t p = {cx + unit_pts[i][0] * r_out, cy + unit_pts[i][1] * r_out};
+        if(i == 0) lv_vector_path_move_to(path, &p);
+        else lv_vector_path_line_to(path, &p);
+    }
+    lv_vector_path_close(path);
+
+    lv_vector_dsc_set_fill_color(ctx, lv_color_hex(0xc0a000));
+    lv_vector_dsc_set_blend_mode(ctx, LV_VECTOR_BLEND_SCREEN);
+    lv_vector_dsc_add_path(ctx, path);
+    lv_draw_vector(ctx);
+
+    lv_vector_path_delete(path);
+    lv_vector_dsc_delete(ctx);
+}
+
+static void create_scene(void)
+{
+    lv_obj_t * scr = lv_display_get_screen_active(disp);
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x304050), 0);
+
+    uint32_t i;
+    for(i = 0; i < 2; i++) {
+        lv_obj_t * eye = lv_obj_create(scr);
+        lv_obj_remove_style_all(eye);
+        lv_obj_set_size(eye, 150, 190);
+        lv_obj_align(eye, LV_ALIGN_CENTER, i == 0 ? -90 : 90, 0);
+        lv_obj_add_event_cb(eye, eye_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    }
+
+    for(i = 0; i < 16; i++) {
+        lv_obj_t * icon = lv_obj_create(scr);
+        lv_obj_remove_style_all(icon);
+        lv_obj_set_size(icon, 40, 40);
+        lv_obj_set_pos(icon, (i % 4) * 120 + 40, (i / 4) * 60);
+        lv_obj_add_event_cb(icon, icon_draw_cb, LV_EVENT_DRAW_MAIN, NULL);
+    }
+}
+
+static void render_frame(void)
+{
+    lv_obj_invalidate(lv_display_get_screen_active(disp));
+    lv_refr_now(disp);
+}
+
+void test_draw_vector_strips_reuse_renders_the_same(void)
+{
+    create_scene();
+
+    drop_ctx = true;
+    render_frame();
+    uint16_t * ref = lv_malloc(DISP_W * DISP_H * sizeof(uint16_t));
+    TEST_ASSERT_NOT_NULL(ref);
+    lv_memcpy(ref, frame, DISP_W * DISP_H * sizeof(uint16_t));
+
+    /*The canvas and the scratch buffer are reused between the tasks, strips and frames*/
+    drop_ctx = false;
+    uint32_t i;
+    for(i = 0; i < 3; i++) {
+        lv_memzero(frame, DISP_W * DISP_H * sizeof(uint16_t));
+        render_frame();
+        TEST_ASSERT_EQUAL_MEMORY(ref, frame, DISP_W * DISP_H * sizeof(uint16_t));
+    }
+
+    /*Only the area of the icons is rendered to the scratch buffer, not the whole strip*/
+    int32_t buf_w;
+    int32_t buf_h;
+    get_scratch_buf_size(&buf_w, &buf_h);
+    TEST_ASSERT_GREATER_THAN(0, buf_w);
+    TEST_ASSERT_LESS_OR_EQUAL(40, buf_w);
+    TEST_ASSERT_LESS_OR_EQUAL(40, buf_h);
+
+    lv_free(ref);
+}
+
+/*Not a pass/fail test: print the time and allocations of a frame drawn in 3 strips*/
+void test_draw_vector_strips_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    create_scene();
+
+    const uint32_t frame_cnt = 20;
+    uint32_t mode;
+    for(mode = 0; mode < 2; mode++) {
+        /*Mode 0: drop the canvas and buffer after each strip (close to creating them for each task)*/
+        drop_ctx = mode == 0;
+        render_frame();
+
+#if COUNT_ALLOCS
+        alloc_cnt = 0;
+        count_allocs = true;
+#endif
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t i;
+        for(i = 0; i < frame_cnt; i++) {
+            render_frame();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+#if COUNT_ALLOCS
+        count_allocs = false;
+        uint32_t allocs = alloc_cnt / frame_cnt;
+#else
+        uint32_t allocs = 0;
+#endif
+
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+        TEST_PRINTF("%s: %d us/frame, %d allocations/frame", mode == 0 ? "canvas per strip" : "persistent canvas",
+                    (int)(us / frame_cnt), (int)allocs);
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
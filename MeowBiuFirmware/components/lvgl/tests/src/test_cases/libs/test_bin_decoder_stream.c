@@ -0,0 +1,400 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <stdio.h>
+
+#if LV_USE_LZ4_INTERNAL
+    #include "../../src/libs/lz4/lz4.h"
+#endif
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+    /*From sanitizer/allocator_interface.h which is not always installed*/
+    int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                                  void (*free_hook)(const volatile void *));
+    size_t __sanitizer_get_allocated_size(const volatile void * p);
+    #define COUNT_HEAP      1
+#else
+    #define COUNT_HEAP      0
+#endif
+
+#if LV_USE_RLE && LV_USE_LZ4_INTERNAL
+
+#define BG_W        240
+#define BG_H        240
+#define BG_STRIDE   (BG_W * 2)
+#define STRIP_H     80
+#define CHUNK_ROWS  16
+#define OUT_FILE    "test_bin_decoder_stream.bin"
+
+static uint16_t bg_px[BG_W * BG_H];
+static uint16_t frame[BG_W * BG_H];
+static uint8_t strip_buf[BG_W * 4 * STRIP_H + LV_DRAW_BUF_ALIGN];
+static uint32_t strip_cnt;
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+
+#if COUNT_HEAP
+static volatile bool count_heap;
+static int64_t heap_cur;
+static int64_t heap_peak;
+
+static void malloc_hook(const volatile void * ptr, size_t size)
+{
+    LV_UNUSED(ptr);
+    if(!count_heap) return;
+    heap_cur += size;
+    if(heap_cur > heap_peak) heap_peak = heap_cur;
+}
+
+static void free_hook(const volatile void * ptr)
+{
+    if(!count_heap || ptr == NULL) return;
+    heap_cur -= __sanitizer_get_allocated_size(ptr);
+}
+#endif
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * BG_W + area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+    strip_cnt++;
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    static bool hooks_installed = false;
+#if COUNT_HEAP
+    if(!hooks_installed) {
+        __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+        hooks_installed = true;
+    }
+#else
+    LV_UNUSED(hooks_installed);
+#endif
+
+    /*A background: bands which compress well and a noisy circle which doesn't*/
+    int32_t x, y;
+    for(y = 0; y < BG_H; y++) {
+        for(x = 0; x < BG_W; x++) {
+            lv_color_t c;
+            int32_t dx = x - BG_W / 2;
+            int32_t dy = y - BG_H / 2;
+            if(dx * dx + dy * dy < 60 * 60) c = lv_color_make((x * 7) ^ (y * 13), x ^ y, (x * y) & 0xff);
+            else c = lv_color_make((y / 8) * 8, (x / 48) * 40, 0x80);
+            bg_px[y * BG_W + x] = lv_color_to_u16(c);
+        }
+    }
+
+    /*A display which renders in 80 rows high strips*/
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(BG_W, BG_H);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(strip_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(BG_W, LV_COLOR_FORMAT_RGB565) * STRIP_H, LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_black(), 0);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+static void put_u32(uint8_t * p, uint32_t v)
+{
+    p[0] = v & 0xff;
+    p[1] = (v >> 8) & 0xff;
+    p[2] = (v >> 16) & 0xff;
+    p[3] = (v >> 24) & 0xff;
+}
+
+static uint32_t rle_repeat_cnt(const uint8_t * in, uint32_t len, uint32_t blk)
+{
+    uint32_t cnt = 1;
+    while(cnt < 127 && (cnt + 1) * blk <= len && lv_memcmp(in, in + cnt * blk, blk) == 0) cnt++;
+    return cnt;
+}
+
+/*The same format as `RLEImage.rle_compress()` in LVGLImage.py*/
+static uint32_t rle_compress(const uint8_t * in, uint32_t len, uint32_t blk, uint8_t * out)
+{
+    uint32_t o = 0;
+    while(len) {
+        uint32_t cnt = rle_repeat_cnt(in, len, blk);
+        if(cnt >= 16) {
+            out[o++] = (uint8_t)cnt;
+            lv_memcpy(out + o, in, blk);
+            o += blk;
+        }
+        else {
+            cnt = 0;
+            while(cnt < 127 && cnt * blk < len && rle_repeat_cnt(in + cnt * blk, len - cnt * blk, blk) < 16) cnt++;
+            out[o++] = (uint8_t)(cnt | 0x80);
+            lv_memcpy(out + o, in, cnt * blk);
+            o += cnt * blk;
+        }
+        in += cnt * blk;
+        len -= cnt * blk;
+    }
+    return o;
+}
+
+/*Compress the background like `LVGLImage.py --compress <method> --rows <chunk_rows>`*/
+static lv_image_dsc_t * compressed_create(lv_image_compress_t method, uint32_t chunk_rows)
+{
+    uint32_t rows = chunk_rows ? chunk_rows : BG_H;
+    uint32_t chunk_cnt = (BG_H + rows - 1) / rows;
+    uint32_t index_size = chunk_rows ? (chunk_cnt + 1) * 4 : 0;
+    uint32_t chunk_max = rows * BG_STRIDE + rows * BG_STRIDE / 64 + 16;
+    uint8_t * data = lv_malloc(12 + index_size + chunk_cnt * chunk_max);
+    TEST_ASSERT_NOT_NULL(data);
+
+    uint8_t * out = data + 12 + index_size;
+    uint32_t ofs = 0;
+    uint32_t i;
+    for(i = 0; i < chunk_cnt; i++) {
+        const uint8_t * in = (const uint8_t *)bg_px + i * rows * BG_STRIDE;
+        uint32_t len = LV_MIN(rows, BG_H - i * rows) * BG_STRIDE;
+        if(index_size) put_u32(data + 12 + i * 4, ofs);
+        if(method == LV_IMAGE_COMPRESS_RLE) ofs += rle_compress(in, len, 2, out + ofs);
+        else ofs += LZ4_compress_default((const char *)in, (char *)out + ofs, (int)len, (int)chunk_max);
+    }
+    if(index_size) put_u32(data + 12 + chunk_cnt * 4, ofs);
+
+    put_u32(data, method | chunk_rows << 4);
+    put_u32(data + 4, index_size + ofs);
+    put_u32(data + 8, BG_STRIDE * BG_H);
+
+    lv_image_dsc_t * dsc = lv_malloc_zeroed(sizeof(lv_image_dsc_t));
+    TEST_ASSERT_NOT_NULL(dsc);
+    dsc->header.magic = LV_IMAGE_HEADER_MAGIC;
+    dsc->header.cf = LV_COLOR_FORMAT_RGB565;
+    dsc->header.flags = LV_IMAGE_FLAGS_COMPRESSED;
+    dsc->header.w = BG_W;
+    dsc->header.h = BG_H;
+    dsc->header.stride = BG_STRIDE;
+    dsc->data_size = 12 + index_size + ofs;
+    dsc->data = data;
+    return dsc;
+}
+
+static void compressed_delete(lv_image_dsc_t * dsc)
+{
+    lv_image_cache_drop(dsc);
+    lv_free((void *)dsc->data);
+    lv_free(dsc);
+}
+
+static void write_bin(const lv_image_dsc_t * dsc)
+{
+    lv_fs_file_t f;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:" OUT_FILE, LV_FS_MODE_WR));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, &dsc->header, sizeof(dsc->header), NULL));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_write(&f, dsc->data, dsc->data_size, NULL));
+    lv_fs_close(&f);
+}
+
+/*Render the screen with an image in strips and return the number of strips*/
+static uint32_t render(const void * src)
+{
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, src);
+
+    lv_memzero(frame, sizeof(frame));
+    strip_cnt = 0;
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+
+    lv_obj_delete(img);
+    return strip_cnt;
+}
+
+void test_bin_decoder_stream_rle(void)
+{
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_RLE, CHUNK_ROWS);
+    TEST_ASSERT_EQUAL_UINT32(BG_H / STRIP_H, render(dsc));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px, frame, BG_W * BG_H);
+    compressed_delete(dsc);
+}
+
+void test_bin_decoder_stream_lz4(void)
+{
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_LZ4, CHUNK_ROWS);
+    TEST_ASSERT_EQUAL_UINT32(BG_H / STRIP_H, render(dsc));
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px, frame, BG_W * BG_H);
+    compressed_delete(dsc);
+}
+
+void test_bin_decoder_stream_chunks_across_strips(void)
+{
+    /*7 rows per chunk: some chunks are in 2 strips and the last one is shorter*/
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_LZ4, 7);
+    render(dsc);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px, frame, BG_W * BG_H);
+    compressed_delete(dsc);
+}
+
+void test_bin_decoder_stream_file(void)
+{
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_RLE, CHUNK_ROWS);
+    write_bin(dsc);
+    compressed_delete(dsc);
+
+    render("A:" OUT_FILE);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px, frame, BG_W * BG_H);
+
+    lv_image_cache_drop("A:" OUT_FILE);
+    remove(OUT_FILE);
+}
+
+void test_bin_decoder_stream_invalid(void)
+{
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_LZ4, CHUNK_ROWS);
+    uint8_t * data = (uint8_t *)dsc->data;
+    uint32_t chunk_cnt = BG_H / CHUNK_ROWS;
+
+    /*An offset pointing after the data stops drawing the first strip, the others are drawn*/
+    uint8_t ofs[4];
+    lv_memcpy(ofs, data + 12 + 4, 4);
+    put_u32(data + 12 + 4, 0xffff0000);
+    render(dsc);
+    TEST_ASSERT_EACH_EQUAL_UINT16(0, frame, BG_W * STRIP_H);
+    TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px + BG_W * STRIP_H, frame + BG_W * STRIP_H, BG_W * (BG_H - STRIP_H));
+    lv_memcpy(data + 12 + 4, ofs, 4);
+
+    /*Index not matching the data size*/
+    lv_memcpy(ofs, data + 12 + chunk_cnt * 4, 4);
+    put_u32(data + 12 + chunk_cnt * 4, 12345);
+    render(dsc);
+    lv_memcpy(data + 12 + chunk_cnt * 4, ofs, 4);
+
+    /*Index larger than the data*/
+    put_u32(data, LV_IMAGE_COMPRESS_LZ4 | 1 << 4);
+    render(dsc);
+
+    /*Corrupted chunks*/
+    put_u32(data, LV_IMAGE_COMPRESS_LZ4 | CHUNK_ROWS << 4);
+    uint32_t i;
+    for(i = 12 + (chunk_cnt + 1) * 4; i < dsc->data_size; i += 97) {
+        data[i] ^= 0x5a;
+    }
+    render(dsc);
+
+    compressed_delete(dsc);
+}
+
+void test_bin_decoder_stream_memory_leak(void)
+{
+    lv_image_dsc_t * dsc = compressed_create(LV_IMAGE_COMPRESS_RLE, CHUNK_ROWS);
+    write_bin(dsc);
+
+    size_t mem_before = lv_test_get_free_mem();
+    uint32_t i;
+    for(i = 0; i < 8; i++) {
+        render(dsc);
+        render("A:" OUT_FILE);
+    }
+    lv_image_cache_drop("A:" OUT_FILE);
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 0);
+
+    compressed_delete(dsc);
+    remove(OUT_FILE);
+}
+
+/*Not a pass/fail test: print the heap peak and the render time of the whole and the chunked decompression*/
+void test_bin_decoder_stream_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    static const struct {
+        const char * name;
+        lv_image_compress_t method;
+        uint32_t chunk_rows;
+    } srcs[] = {
+#if LV_BIN_DECODER_RAM_LOAD
+        {"RLE whole image", LV_IMAGE_COMPRESS_RLE, 0},
+        {"LZ4 whole image", LV_IMAGE_COMPRESS_LZ4, 0},
+#endif
+        {"RLE 16 rows chunks", LV_IMAGE_COMPRESS_RLE, CHUNK_ROWS},
+        {"LZ4 16 rows chunks", LV_IMAGE_COMPRESS_LZ4, CHUNK_ROWS},
+    };
+
+    const uint32_t render_cnt = 20;
+    uint32_t s;
+    for(s = 0; s < sizeof(srcs) / sizeof(srcs[0]); s++) {
+        lv_image_dsc_t * dsc = compressed_create(srcs[s].method, srcs[s].chunk_rows);
+
+        /*Drop the decompressed image from the cache to measure the decompression every time*/
+        uint32_t us = 0;
+        uint32_t i;
+        for(i = 0; i < render_cnt; i++) {
+            lv_image_cache_drop(dsc);
+            struct timespec t1, t2;
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            render(dsc);
+            clock_gettime(CLOCK_MONOTONIC, &t2);
+            us += (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+        }
+        TEST_ASSERT_EQUAL_UINT16_ARRAY(bg_px, frame, BG_W * BG_H);
+
+        lv_image_cache_drop(dsc);
+#if COUNT_HEAP
+        heap_cur = 0;
+        heap_peak = 0;
+        count_heap = true;
+#endif
+        render(dsc);
+#if COUNT_HEAP
+        count_heap = false;
+        int32_t peak = (int32_t)heap_peak;
+#else
+        int32_t peak = 0;
+#endif
+
+        TEST_PRINTF("%s: %d bytes, heap peak %d bytes, %d us/frame in %d rows strips", srcs[s].name,
+                    (int)dsc->data_size, (int)peak, (int)(us / render_cnt), STRIP_H);
+
+        compressed_delete(dsc);
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_bin_decoder_stream_rle(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,155 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_GIF
+
+/*An 80x80 GIF with 9 frames*/
+extern const lv_image_dsc_t test_img_face_gif;
+
+static uint64_t gif_buf[LV_GIF_BUF_SIZE(80, 80) / 8];
+static lv_obj_t * gif;
+static uint32_t ready_cnt;
+static uint32_t restart_cnt;
+
+void setUp(void)
+{
+    gif = lv_gif_create(lv_screen_active());
+    ready_cnt = 0;
+    restart_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Play until `ready_cnt` reaches `cnt` in at most `max_ms`*/
+static void play_until_ready(uint32_t cnt, uint32_t max_ms)
+{
+    uint32_t ms;
+    for(ms = 0; ms < max_ms && ready_cnt < cnt; ms += 10) {
+        lv_tick_inc(10);
+        lv_timer_handler();
+    }
+}
+
+#if LV_USE_MEM_PROFILER
+static uint32_t gif_alloc_cnt(void)
+{
+    const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_tag(LV_MEM_TAG_GIF);
+    return e ? e->alloc_cnt : 0;
+}
+#endif
+
+static void ready_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    ready_cnt++;
+}
+
+static void restart_on_ready_cb(lv_event_t * e)
+{
+    ready_cnt++;
+    if(restart_cnt < 2) {
+        restart_cnt++;
+        /*Restarting reads the loop count of the GIF again*/
+        lv_gif_restart(lv_event_get_target_obj(e));
+        lv_gif_set_loop_count(lv_event_get_target_obj(e), 1);
+    }
+}
+
+static void set_src_on_ready_cb(lv_event_t * e)
+{
+    lv_obj_t * obj = lv_event_get_target_obj(e);
+    ready_cnt++;
+    if(restart_cnt < 2) {
+        restart_cnt++;
+        lv_gif_set_src(obj, &test_img_face_gif);
+        lv_gif_set_loop_count(obj, 1);
+    }
+}
+
+void test_gif_buf(void)
+{
+    /*A GIF which doesn't fit isn't loaded*/
+    lv_gif_set_buf(gif, gif_buf, LV_GIF_BUF_SIZE(80, 79));
+    lv_gif_set_src(gif, &test_img_face_gif);
+    TEST_ASSERT_FALSE(lv_gif_is_loaded(gif));
+
+#if LV_USE_MEM_PROFILER
+    uint32_t alloc_cnt = gif_alloc_cnt();
+#endif
+
+    /*Opening and decoding all frames into the buffer allocate nothing*/
+    lv_gif_set_buf(gif, gif_buf, sizeof(gif_buf));
+    lv_gif_set_src(gif, &test_img_face_gif);
+    TEST_ASSERT_TRUE(lv_gif_is_loaded(gif));
+    lv_gif_set_loop_count(gif, 2);
+    lv_obj_add_event_cb(gif, ready_cb, LV_EVENT_READY, NULL);
+    play_until_ready(1, 10000);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+
+#if LV_USE_MEM_PROFILER
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, gif_alloc_cnt());
+#endif
+}
+
+void test_gif_restart_on_ready(void)
+{
+    lv_gif_set_src(gif, &test_img_face_gif);
+    lv_gif_set_loop_count(gif, 1);
+    lv_obj_add_event_cb(gif, restart_on_ready_cb, LV_EVENT_READY, NULL);
+
+    /*The player is paused before LV_EVENT_READY, so restarting it there plays it again*/
+    play_until_ready(3, 10000);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+
+    /*Not restarted the last time: it stays paused*/
+    play_until_ready(4, 3000);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+}
+
+void test_gif_set_src_on_ready(void)
+{
+    lv_gif_set_buf(gif, gif_buf, sizeof(gif_buf));
+    lv_gif_set_src(gif, &test_img_face_gif);
+    lv_gif_set_loop_count(gif, 1);
+    lv_obj_add_event_cb(gif, set_src_on_ready_cb, LV_EVENT_READY, NULL);
+
+    /*A new source set in LV_EVENT_READY plays, in the same buffer*/
+    play_until_ready(3, 10000);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+    TEST_ASSERT_TRUE(lv_gif_is_loaded(gif));
+
+    play_until_ready(4, 3000);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_gif_buf(void)
+{
+}
+
+void test_gif_restart_on_ready(void)
+{
+}
+
+void test_gif_set_src_on_ready(void)
+{
+}
+
+#endif /*LV_USE_GIF*/
+
+#endif /*LV_BUILD_TEST*/
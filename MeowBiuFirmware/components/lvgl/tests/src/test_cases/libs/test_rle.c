@@ -0,0 +1,271 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if LV_USE_RLE
+
+#define BUF_SIZE    (4 * 127 * 64)
+#define IMG_W       240
+#define IMG_H       240
+
+static uint8_t raw[BUF_SIZE];
+static uint8_t compressed[BUF_SIZE * 2];
+static uint8_t out[BUF_SIZE + 16];
+static uint8_t out_ref[BUF_SIZE + 16];
+static uint32_t rnd_state;
+
+void setUp(void)
+{
+    rnd_state = 0x12345678;
+}
+
+void tearDown(void)
+{
+}
+
+static uint32_t rnd(void)
+{
+    /*xorshift32*/
+    rnd_state ^= rnd_state << 13;
+    rnd_state ^= rnd_state >> 17;
+    rnd_state ^= rnd_state << 5;
+    return rnd_state;
+}
+
+/*The format byte by byte: the reference to compare the optimized `lv_rle_decompress()` with*/
+static uint32_t rle_decompress_ref(const uint8_t * input, uint32_t input_len, uint8_t * output, uint32_t output_len,
+                                   uint32_t blk_size)
+{
+    uint32_t rd = 0;
+    uint32_t wr = 0;
+    while(rd < input_len) {
+        uint32_t ctrl = input[rd++];
+        uint32_t cnt = ctrl & 0x7f;
+        bool literal = ctrl & 0x80;
+        uint32_t in_bytes = literal ? cnt * blk_size : blk_size;
+        if(rd + in_bytes > input_len) return 0;
+        if(wr + cnt * blk_size > output_len + blk_size) return 0;
+
+        uint32_t i;
+        for(i = 0; i < cnt * blk_size; i++) {
+            if(wr == output_len) return output_len;     /*The padding of the last block*/
+            output[wr++] = literal ? input[rd + i] : input[rd + i % blk_size];
+        }
+        rd += in_bytes;
+    }
+    return wr;
+}
+
+static uint32_t repeat_cnt(const uint8_t * in, uint32_t len, uint32_t blk_size)
+{
+    uint32_t cnt = 1;
+    while(cnt < 127 && (cnt + 1) * blk_size <= len && lv_memcmp(in, in + cnt * blk_size, blk_size) == 0) cnt++;
+    return cnt;
+}
+
+/*Like `RLEImage.rle_compress()` in LVGLImage.py: runs of at least `threshold` blocks are repeats*/
+static uint32_t rle_compress(const uint8_t * in, uint32_t len, uint32_t blk_size, uint32_t threshold, uint8_t * output)
+{
+    uint32_t o = 0;
+    while(len >= blk_size) {
+        uint32_t cnt = repeat_cnt(in, len, blk_size);
+        if(cnt >= threshold) {
+            output[o++] = (uint8_t)cnt;
+            lv_memcpy(output + o, in, blk_size);
+            o += blk_size;
+        }
+        else {
+            cnt = 0;
+            while(cnt < 127 && (cnt + 1) * blk_size <= len &&
+                  repeat_cnt(in + cnt * blk_size, len - cnt * blk_size, blk_size) < threshold) cnt++;
+            output[o++] = (uint8_t)(cnt | 0x80);
+            lv_memcpy(output + o, in, cnt * blk_size);
+            o += cnt * blk_size;
+        }
+        in += cnt * blk_size;
+        len -= cnt * blk_size;
+    }
+    return o;
+}
+
+/*Runs of random length, some of them noise*/
+static void fill_random(uint8_t * buf, uint32_t len, uint32_t blk_size)
+{
+    uint32_t i = 0;
+    while(i < len) {
+        uint32_t run = (rnd() % 200 + 1) * blk_size;
+        bool noise = rnd() % 3 == 0;
+        uint8_t blk[4];
+        uint32_t b;
+        for(b = 0; b < blk_size; b++) blk[b] = (uint8_t)rnd();
+        uint32_t j;
+        for(j = 0; j < run && i < len; j++, i++) buf[i] = noise ? (uint8_t)rnd() : blk[j % blk_size];
+    }
+}
+
+static void check_same_as_ref(const uint8_t * input, uint32_t input_len, uint32_t output_len, uint32_t blk_size,
+                              uint32_t ofs)
+{
+    lv_memset(out, 0xaa, sizeof(out));
+    lv_memset(out_ref, 0xaa, sizeof(out_ref));
+    uint32_t res = lv_rle_decompress(input, input_len, out + ofs, output_len, (uint8_t)blk_size);
+    uint32_t res_ref = rle_decompress_ref(input, input_len, out_ref + ofs, output_len, blk_size);
+    TEST_ASSERT_EQUAL_UINT32(res_ref, res);
+    if(res) TEST_ASSERT_EQUAL_UINT8_ARRAY(out_ref, out, sizeof(out));
+}
+
+void test_rle_round_trip(void)
+{
+    uint32_t blk_size;
+    for(blk_size = 1; blk_size <= 4; blk_size++) {
+        uint32_t i;
+        for(i = 0; i < 50; i++) {
+            uint32_t len = (rnd() % (BUF_SIZE / blk_size - 1) + 1) * blk_size;
+            fill_random(raw, len, blk_size);
+            uint32_t clen = rle_compress(raw, len, blk_size, rnd() % 20 + 1, compressed);
+
+            /*At any output alignment*/
+            uint32_t ofs = rnd() % 4;
+            lv_memset(out, 0xaa, sizeof(out));
+            TEST_ASSERT_EQUAL_UINT32(len, lv_rle_decompress(compressed, clen, out + ofs, len, (uint8_t)blk_size));
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(raw, out + ofs, len);
+            TEST_ASSERT_EQUAL_UINT8(0xaa, out[ofs + len]);
+        }
+    }
+}
+
+void test_rle_truncated_last_block(void)
+{
+    /*The last pixel is padded to a whole block when compressed, only its real bytes are written*/
+    uint32_t blk_size;
+    for(blk_size = 2; blk_size <= 4; blk_size++) {
+        uint32_t pad;
+        for(pad = 1; pad < blk_size; pad++) {
+            /*Ending with a repeat*/
+            lv_memset(raw, 0x5a, 64 * blk_size);
+            uint32_t clen = rle_compress(raw, 64 * blk_size, blk_size, 16, compressed);
+            check_same_as_ref(compressed, clen, 64 * blk_size - pad, blk_size, 1);
+            TEST_ASSERT_EACH_EQUAL_UINT8(0x5a, out + 1, 64 * blk_size - pad);
+            TEST_ASSERT_EQUAL_UINT8(0xaa, out[1 + 64 * blk_size - pad]);
+
+            /*Ending with a literal*/
+            uint32_t i;
+            for(i = 0; i < 8 * blk_size; i++) raw[i] = (uint8_t)i;
+            clen = rle_compress(raw, 8 * blk_size, blk_size, 16, compressed);
+            check_same_as_ref(compressed, clen, 8 * blk_size - pad, blk_size, 0);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(raw, out, 8 * blk_size - pad);
+        }
+    }
+}
+
+void test_rle_fuzz(void)
+{
+    uint32_t i;
+    for(i = 0; i < 20000; i++) {
+        uint32_t blk_size = rnd() % 4 + 1;
+        uint32_t ofs = rnd() % 4;
+        uint32_t len;
+        uint32_t output_len;
+
+        if(i % 2) {
+            /*Valid data with a wrong output size*/
+            uint32_t raw_len = (rnd() % 512 + 1) * blk_size;
+            fill_random(raw, raw_len, blk_size);
+            len = rle_compress(raw, raw_len, blk_size, rnd() % 20 + 1, compressed);
+            if(rnd() % 2) len = rnd() % (len + 1);
+            output_len = raw_len + blk_size * 2 - rnd() % (blk_size * 4);
+        }
+        else {
+            /*Random data*/
+            len = rnd() % 1024;
+            uint32_t j;
+            for(j = 0; j < len; j++) compressed[j] = (uint8_t)rnd();
+            output_len = rnd() % BUF_SIZE;
+        }
+
+        check_same_as_ref(compressed, len, output_len, blk_size, ofs);
+    }
+}
+
+/*Flat shaded art: flat areas with anti-aliased edges*/
+static void fill_face(uint8_t * buf, uint32_t blk_size)
+{
+    int32_t x, y;
+    for(y = 0; y < IMG_H; y++) {
+        for(x = 0; x < IMG_W; x++) {
+            int32_t dx = x - IMG_W / 2;
+            int32_t dy = y - IMG_H / 2;
+            int32_t d = dx * dx + dy * dy;
+            uint8_t v;
+            if(d < 50 * 50) v = 0x20;
+            else if(d < 52 * 52) v = (uint8_t)(0x20 + (d - 50 * 50) / 2);
+            else if(d < 100 * 100) v = 0xc0;
+            else if(d < 102 * 102) v = (uint8_t)(0xc0 + (d - 100 * 100) / 16);
+            else v = 0xff;
+            uint32_t b;
+            for(b = 0; b < blk_size; b++) buf[(y * IMG_W + x) * blk_size + b] = (uint8_t)(v ^ (b * 0x35));
+        }
+    }
+}
+
+/*Not a pass/fail test: print the decompression speed with the old and the new run thresholds of LVGLImage.py*/
+void test_rle_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    static uint8_t img[IMG_W * IMG_H * 4];
+    static uint8_t img_compressed[IMG_W * IMG_H * 5];
+    static uint8_t img_out[IMG_W * IMG_H * 4];
+
+    const uint32_t repeat = 50;
+    uint32_t blk_size;
+    for(blk_size = 1; blk_size <= 4; blk_size++) {
+        uint32_t len = IMG_W * IMG_H * blk_size;
+        uint32_t thresholds[2] = {16, LV_MAX(16 / blk_size, 4)};
+        uint32_t t;
+        fill_face(img, blk_size);
+        for(t = 0; t < 2; t++) {
+            if(t == 1 && thresholds[1] == thresholds[0]) break;
+            uint32_t clen = rle_compress(img, len, blk_size, thresholds[t], img_compressed);
+
+            struct timespec t1, t2;
+            clock_gettime(CLOCK_MONOTONIC, &t1);
+            uint32_t i;
+            for(i = 0; i < repeat; i++) {
+                TEST_ASSERT_EQUAL_UINT32(len, lv_rle_decompress(img_compressed, clen, img_out, len, (uint8_t)blk_size));
+            }
+            clock_gettime(CLOCK_MONOTONIC, &t2);
+            uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+            TEST_ASSERT_EQUAL_UINT8_ARRAY(img, img_out, len);
+
+            TEST_PRINTF("%d bytes/px, threshold %d: %d -> %d bytes, %d MB/s", (int)blk_size, (int)thresholds[t],
+                        (int)len, (int)clen, (int)((uint64_t)len * repeat / LV_MAX(us, 1)));
+        }
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_rle_round_trip(void)
+{
+}
+
+#endif
+
+#endif
@@ -0,0 +1,172 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*Runs only if the rlottie library is found*/
+#if LV_USE_RLOTTIE
+
+#define SLOW_RENDER_MS  40
+
+extern const uint8_t test_lottie_arrow_json[];
+
+static lv_obj_t * player;
+static uint32_t ready_cnt;
+static uint32_t render_cnt;
+static bool slow_render;
+static lv_timer_cb_t next_frame_cb;
+
+/*Count the rendered frames. With `slow_render` rendering a frame takes SLOW_RENDER_MS*/
+static void render_cb(lv_timer_t * t)
+{
+    lv_rlottie_t * rlottie = lv_timer_get_user_data(t);
+    size_t prev_frame = rlottie->rendered_frame;
+    next_frame_cb(t);
+    if(rlottie->rendered_frame == prev_frame) return;
+
+    render_cnt++;
+    if(slow_render) lv_tick_inc(SLOW_RENDER_MS);
+}
+
+void setUp(void)
+{
+    player = lv_rlottie_create_from_raw(lv_screen_active(), 100, 100, (const char *)test_lottie_arrow_json);
+    lv_obj_center(player);
+
+    lv_rlottie_t * rlottie = (lv_rlottie_t *)player;
+    next_frame_cb = rlottie->task->timer_cb;
+    lv_timer_set_cb(rlottie->task, render_cb);
+
+    ready_cnt = 0;
+    render_cnt = 0;
+    slow_render = false;
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static uint32_t duration_get(void)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *)player;
+    return rlottie->total_frames * 1000 / rlottie->framerate;
+}
+
+static void ready_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    ready_cnt++;
+}
+
+static void play_again_on_ready_cb(lv_event_t * e)
+{
+    ready_cnt++;
+    if(ready_cnt < 3) lv_rlottie_set_play_mode(lv_event_get_target_obj(e), LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY);
+}
+
+/*Play until `ready_cnt` reaches `cnt` in at most `max_ms`, return the elapsed time*/
+static uint32_t play_until_ready(uint32_t cnt, uint32_t max_ms)
+{
+    uint32_t start = lv_tick_get();
+    while(ready_cnt < cnt && lv_tick_elaps(start) < max_ms) {
+        lv_test_fast_forward(10);
+    }
+    return lv_tick_elaps(start);
+}
+
+void test_rlottie_play_again_after_end(void)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *)player;
+    uint32_t duration = duration_get();
+    lv_obj_add_event_cb(player, ready_cb, LV_EVENT_READY, NULL);
+
+    lv_rlottie_set_play_mode(player, LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY);
+    uint32_t t = play_until_ready(1, 3 * duration);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_UINT32_WITHIN(100, duration, t);
+    TEST_ASSERT_EQUAL(rlottie->total_frames - 1, rlottie->rendered_frame);
+
+    /*Stays on the last frame*/
+    play_until_ready(2, duration);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+
+    /*Playing again starts over instead of ending at once*/
+    lv_rlottie_set_play_mode(player, LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY);
+    lv_test_fast_forward(10);
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_LESS_THAN(rlottie->total_frames / 2, rlottie->rendered_frame);
+
+    t = play_until_ready(2, 3 * duration);
+    TEST_ASSERT_EQUAL_UINT32(2, ready_cnt);
+    TEST_ASSERT_UINT32_WITHIN(100, duration, t);
+
+    /*Backward from the last frame too*/
+    lv_rlottie_set_play_mode(player, LV_RLOTTIE_CTRL_BACKWARD | LV_RLOTTIE_CTRL_PLAY);
+    t = play_until_ready(3, 3 * duration);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+    TEST_ASSERT_UINT32_WITHIN(100, duration, t);
+    TEST_ASSERT_EQUAL(0, rlottie->rendered_frame);
+}
+
+void test_rlottie_play_again_on_ready(void)
+{
+    uint32_t duration = duration_get();
+    lv_obj_add_event_cb(player, play_again_on_ready_cb, LV_EVENT_READY, NULL);
+
+    /*The timer is paused before LV_EVENT_READY, so playing it again there isn't undone*/
+    lv_rlottie_set_play_mode(player, LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY);
+    uint32_t t = play_until_ready(3, 6 * duration);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+    TEST_ASSERT_UINT32_WITHIN(200, 3 * duration, t);
+
+    play_until_ready(4, 2 * duration);
+    TEST_ASSERT_EQUAL_UINT32(3, ready_cnt);
+}
+
+void test_rlottie_slow_render_skips_frames(void)
+{
+    lv_rlottie_t * rlottie = (lv_rlottie_t *)player;
+    uint32_t duration = duration_get();
+    lv_obj_add_event_cb(player, ready_cb, LV_EVENT_READY, NULL);
+
+    slow_render = true;
+    lv_rlottie_set_play_mode(player, LV_RLOTTIE_CTRL_FORWARD | LV_RLOTTIE_CTRL_PLAY);
+    render_cnt = 0;
+    uint32_t t = play_until_ready(1, 3 * duration);
+    slow_render = false;
+    TEST_PRINTF("slow rendering: %d frames in %d ms", (int)render_cnt, (int)t);
+
+    /*The duration is kept by skipping frames*/
+    TEST_ASSERT_EQUAL_UINT32(1, ready_cnt);
+    TEST_ASSERT_UINT32_WITHIN(SLOW_RENDER_MS * 2, duration + SLOW_RENDER_MS, t);
+    TEST_ASSERT_LESS_THAN(rlottie->total_frames, render_cnt);
+    TEST_ASSERT_EQUAL(rlottie->total_frames - 1, rlottie->rendered_frame);
+}
+
+#else
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+
+void test_rlottie_play_again_after_end(void)
+{
+}
+
+void test_rlottie_play_again_on_ready(void)
+{
+}
+
+void test_rlottie_slow_render_skips_frames(void)
+{
+}
+
+#endif /*LV_USE_RLOTTIE*/
+
+#endif /*LV_BUILD_TEST*/
@@ -3,6 +3,7 @@
 #include "../../lvgl_private.h"
 
 #include "unity/unity.h"
+#include <time.h>
 
 void setUp(void)
 {
@@ -50,4 +51,234 @@ void test_memcpy_unaligned(void)
     }
 }
 
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+#if LV_MEM_SLAB
+
+#define TEST_SLAB   1
+
+/*Number of allocations of a class served by a slot or by the heap as no slot was free*/
+static uint32_t slab_alloc_cnt(const lv_mem_monitor_t * mon, uint32_t class_id)
+{
+    return mon->slab[class_id].used_cnt + mon->slab[class_id].fallback_cnt;
+}
+
+#endif
+#endif
+
+void test_mem_slab_classes(void)
+{
+#ifdef TEST_SLAB
+    lv_mem_monitor_t m1;
+    lv_mem_monitor_t m2;
+    lv_mem_monitor(&m1);
+
+    void * p[LV_MEM_SLAB_CLASS_CNT];
+    uint32_t i;
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        uint32_t size = (i + 1) * LV_MEM_SLAB_CLASS_STEP;
+        p[i] = lv_malloc(size);
+        TEST_ASSERT_NOT_NULL(p[i]);
+        lv_memset(p[i], (int)i, size);
+    }
+    void * large = lv_malloc(LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP + 1);
+    TEST_ASSERT_NOT_NULL(large);
+
+    lv_mem_monitor(&m2);
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL((i + 1) * LV_MEM_SLAB_CLASS_STEP, m2.slab[i].slot_size);
+        TEST_ASSERT_EQUAL(slab_alloc_cnt(&m1, i) + 1, slab_alloc_cnt(&m2, i));
+        TEST_ASSERT_GREATER_OR_EQUAL(m2.slab[i].used_cnt, m2.slab[i].max_used_cnt);
+    }
+
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_EACH_EQUAL_UINT8(i, p[i], (i + 1) * LV_MEM_SLAB_CLASS_STEP);
+        lv_free(p[i]);
+    }
+    lv_free(large);
+
+    lv_mem_monitor(&m2);
+    TEST_ASSERT_EQUAL(m1.used_cnt, m2.used_cnt);
+    for(i = 0; i < LV_MEM_SLAB_CLASS_CNT; i++) {
+        TEST_ASSERT_EQUAL(m1.slab[i].used_cnt, m2.slab[i].used_cnt);
+    }
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+void test_mem_slab_realloc(void)
+{
+    /*Grow from the smallest class through the larger ones to the heap and shrink again*/
+    static const uint32_t sizes[] = {5, 16, 17, 40, 128, 129, 1000, 100, 3};
+    uint8_t * p = lv_malloc(5);
+    TEST_ASSERT_NOT_NULL(p);
+    lv_memcpy(p, "face", 5);
+
+    uint32_t i;
+    for(i = 1; i < sizeof(sizes) / sizeof(sizes[0]); i++) {
+        p = lv_realloc(p, sizes[i]);
+        TEST_ASSERT_NOT_NULL(p);
+        TEST_ASSERT_EQUAL_STRING_LEN("face", p, LV_MIN(sizes[i], 5));
+        if(sizes[i] >= 5) lv_memset(p + 5, 0x55, sizes[i] - 5);
+    }
+    lv_free(p);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
+void test_mem_slab_fallback(void)
+{
+#ifdef TEST_SLAB
+    /*Allocate more objects than the pages can hold: the excess ones come from the heap*/
+    enum { CNT = LV_MEM_SLAB_PAGE_CNT * (LV_MEM_SLAB_PAGE_SIZE / LV_MEM_SLAB_CLASS_STEP) + 16 };
+    static void * p[CNT];
+    lv_mem_monitor_t m1;
+    lv_mem_monitor_t m2;
+    lv_mem_monitor(&m1);
+
+    uint32_t i;
+    for(i = 0; i < CNT; i++) {
+        p[i] = lv_malloc(LV_MEM_SLAB_CLASS_STEP);
+        TEST_ASSERT_NOT_NULL(p[i]);
+        *(uint32_t *)p[i] = i;
+    }
+
+    lv_mem_monitor(&m2);
+    TEST_ASSERT_EQUAL(0, m2.slab_free_page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL(m1.slab[0].fallback_cnt + 16, m2.slab[0].fallback_cnt);
+
+    /*All pages are free again except one kept by the class, and can be used by the other classes*/
+    for(i = 0; i < CNT; i++) {
+        TEST_ASSERT_EQUAL(i, *(uint32_t *)p[i]);
+        lv_free(p[i]);
+    }
+    lv_mem_monitor(&m2);
+    TEST_ASSERT_EQUAL(m1.slab[0].used_cnt, m2.slab[0].used_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL(LV_MAX(m1.slab[0].page_cnt, 1), m2.slab[0].page_cnt);
+    TEST_ASSERT_GREATER_OR_EQUAL_INT32((int32_t)m1.slab_free_page_cnt - 1, (int32_t)m2.slab_free_page_cnt);
+
+    void * large = lv_malloc(LV_MEM_SLAB_CLASS_CNT * LV_MEM_SLAB_CLASS_STEP);
+    lv_mem_monitor(&m1);
+    TEST_ASSERT_EQUAL(m2.slab[LV_MEM_SLAB_CLASS_CNT - 1].used_cnt + 1, m1.slab[LV_MEM_SLAB_CLASS_CNT - 1].used_cnt);
+    lv_free(large);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+#endif
+}
+
+#define TRACE_TRANSITION_CNT    200
+#define TRACE_FRAME_CNT         30
+#define TRACE_ANIM_MAX          8
+#define TRACE_TASK_MAX          6
+#define TRACE_RAND(max)         (seed = seed * 1103515245 + 12345, (seed >> 16) % (max))
+
+typedef struct {
+    uint32_t op_cnt;
+    uint32_t frag_max;
+    size_t biggest_min;
+} trace_res_t;
+
+/*Replay the allocations of the face firmware: a GIF player replaced after every GIF, while
+ *every frame allocates draw tasks and a layer, and animations start and finish.*/
+static void face_trace(bool monitor, trace_res_t * res)
+{
+    const uint32_t ll_node = 2 * sizeof(void *);
+    const uint32_t gif_sizes[] = {240, 400, 80 * 80 * 4, 80 * 80, sizeof(lv_timer_t) + ll_node, 3 * sizeof(lv_event_dsc_t), 64};
+    enum { GIF_BLOCK_CNT = sizeof(gif_sizes) / sizeof(gif_sizes[0]) };
+
+    void * gif[GIF_BLOCK_CNT] = {NULL};
+    void * anims[TRACE_ANIM_MAX] = {NULL};
+    uint32_t anim_end[TRACE_ANIM_MAX] = {0};
+    void * tasks[TRACE_TASK_MAX];
+    uint32_t seed = 1;
+    uint32_t frame = 0;
+    uint32_t i;
+
+    lv_memzero(res, sizeof(trace_res_t));
+    res->biggest_min = SIZE_MAX;
+
+    uint32_t tr;
+    for(tr = 0; tr < TRACE_TRANSITION_CNT; tr++) {
+        for(i = 0; i < GIF_BLOCK_CNT; i++) {
+            lv_free(gif[i]);
+            gif[i] = lv_malloc(gif_sizes[i]);
+            TEST_ASSERT_NOT_NULL(gif[i]);
+        }
+        res->op_cnt += 2 * GIF_BLOCK_CNT;
+
+        uint32_t f;
+        for(f = 0; f < TRACE_FRAME_CNT; f++, frame++) {
+            for(i = 0; i < TRACE_ANIM_MAX; i++) {
+                if(anims[i] && anim_end[i] == frame) {
+                    lv_free(anims[i]);
+                    anims[i] = NULL;
+                    res->op_cnt++;
+                }
+                if(anims[i] == NULL && TRACE_RAND(8) == 0) {
+                    anims[i] = lv_malloc(sizeof(lv_anim_t) + ll_node);
+                    TEST_ASSERT_NOT_NULL(anims[i]);
+                    anim_end[i] = frame + 5 + TRACE_RAND(10);
+                    res->op_cnt++;
+                }
+            }
+
+            uint32_t task_cnt = 1 + TRACE_RAND(TRACE_TASK_MAX);
+            for(i = 0; i < task_cnt; i++) {
+                tasks[i] = lv_malloc(sizeof(lv_draw_task_t) + 32 + TRACE_RAND(96));
+                TEST_ASSERT_NOT_NULL(tasks[i]);
+            }
+            void * layer = lv_malloc(1024 + TRACE_RAND(3072));
+            TEST_ASSERT_NOT_NULL(layer);
+            for(i = 0; i < task_cnt; i++) lv_free(tasks[i]);
+            lv_free(layer);
+            res->op_cnt += 2 * task_cnt + 2;
+
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+            if(monitor) {
+                lv_mem_monitor_t mon;
+                lv_mem_monitor(&mon);
+                res->frag_max = LV_MAX(res->frag_max, mon.frag_pct);
+                res->biggest_min = LV_MIN(res->biggest_min, mon.free_biggest_size);
+            }
+#else
+            LV_UNUSED(monitor);
+#endif
+        }
+    }
+
+    for(i = 0; i < GIF_BLOCK_CNT; i++) lv_free(gif[i]);
+    for(i = 0; i < TRACE_ANIM_MAX; i++) lv_free(anims[i]);
+}
+
+/*Print the time of an allocation or a free in the face trace,
+ *and the worst fragmentation of the heap if only 96 kB is free*/
+void test_mem_face_trace(void)
+{
+    trace_res_t res;
+    clock_t t = clock();
+    face_trace(false, &res);
+    t = clock() - t;
+
+    /*Take the rest of the heap in 1 MB blocks*/
+    void * ballast[64];
+    uint32_t ballast_cnt = 0;
+#if LV_USE_STDLIB_MALLOC == LV_STDLIB_BUILTIN
+    lv_mem_monitor_t mon;
+    lv_mem_monitor(&mon);
+    while(ballast_cnt < 64 && mon.free_size > 96 * 1024) {
+        size_t size = LV_MIN(mon.free_biggest_size - 96 * 1024, 1024 * 1024);
+        ballast[ballast_cnt] = lv_malloc(size);
+        if(ballast[ballast_cnt] == NULL) break;
+        ballast_cnt++;
+        lv_mem_monitor(&mon);
+        if(size < 1024 * 1024) break;
+    }
+#endif
+
+    face_trace(true, &res);
+    while(ballast_cnt) lv_free(ballast[--ballast_cnt]);
+
+    TEST_PRINTF("%d allocations and frees, %d ns each, worst fragmentation %d%%, smallest biggest free block %d bytes",
+                (int)res.op_cnt, (int)((double)t * 1e9 / CLOCKS_PER_SEC / res.op_cnt), (int)res.frag_max,
+                res.biggest_min == SIZE_MAX ? -1 : (int)res.biggest_min);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_mem_test());
+}
+
 #endif
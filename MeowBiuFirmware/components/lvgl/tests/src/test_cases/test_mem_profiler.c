@@ -0,0 +1,295 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+#include <string.h>
+
+void setUp(void)
+{
+    /* Function run before every test */
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_MEM_PROFILER
+
+extern const lv_image_dsc_t test_img_face_gif;
+
+static char dump_text[4096];
+
+static size_t tag_live_size(lv_mem_tag_t tag)
+{
+    const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_tag(tag);
+    return e ? e->live_size : 0;
+}
+
+static uint32_t tag_live_cnt(lv_mem_tag_t tag)
+{
+    const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_tag(tag);
+    return e ? e->live_cnt : 0;
+}
+
+static size_t call_site_live_size(void)
+{
+    size_t size = 0;
+    uint32_t i;
+    for(i = 0; i < lv_mem_profiler_get_entry_count(); i++) {
+        const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_entry(i);
+        if(e->tag == LV_MEM_TAG_NONE) size += e->live_size;
+    }
+    return size;
+}
+
+static void dump_cb(const char * buf)
+{
+    lv_strlcpy(dump_text + lv_strlen(dump_text), buf, sizeof(dump_text) - lv_strlen(dump_text));
+    lv_strlcpy(dump_text + lv_strlen(dump_text), "\n", sizeof(dump_text) - lv_strlen(dump_text));
+}
+
+static uint32_t read_u32(const uint8_t * p)
+{
+    return p[0] | (p[1] << 8) | (p[2] << 16) | ((uint32_t)p[3] << 24);
+}
+
+#if LV_USE_OS
+static lv_mem_tag_t other_thread_tag;
+
+static void other_thread_cb(void * user_data)
+{
+    other_thread_tag = lv_mem_get_tag();
+    LV_MEM_TAG_BEGIN(LV_MEM_TAG_USER + 3);
+    *(void **)user_data = lv_malloc(20);
+    LV_MEM_TAG_END;
+}
+#endif
+
+#endif
+
+void test_mem_profiler_tag(void)
+{
+#if LV_USE_MEM_PROFILER
+    const lv_mem_tag_t tag = LV_MEM_TAG_USER + 1;
+    size_t total = lv_mem_profiler_get_total()->live_size;
+
+    lv_mem_tag_t prev = lv_mem_set_tag(tag);
+    TEST_ASSERT_EQUAL(tag, lv_mem_get_tag());
+    uint8_t * p = lv_malloc(100);
+    lv_mem_set_tag(prev);
+
+    const lv_mem_profiler_entry_t * e = lv_mem_profiler_get_tag(tag);
+    TEST_ASSERT_NOT_NULL(e);
+    TEST_ASSERT_EQUAL(100, e->live_size);
+    TEST_ASSERT_EQUAL(1, e->live_cnt);
+    TEST_ASSERT_EQUAL(total + 100, lv_mem_profiler_get_total()->live_size);
+
+    /*Reallocated memory stays where it was allocated*/
+    p = lv_realloc(p, 300);
+    TEST_ASSERT_EQUAL(300, e->live_size);
+    p = lv_realloc(p, 50);
+    TEST_ASSERT_EQUAL(50, e->live_size);
+    TEST_ASSERT_EQUAL(300, e->peak_size);
+    TEST_ASSERT_EQUAL(1, e->alloc_cnt);
+
+    lv_free(p);
+    TEST_ASSERT_EQUAL(0, e->live_size);
+    TEST_ASSERT_EQUAL(0, e->live_cnt);
+    TEST_ASSERT_EQUAL(total, lv_mem_profiler_get_total()->live_size);
+
+    lv_mem_profiler_reset_peak();
+    TEST_ASSERT_EQUAL(0, e->peak_size);
+
+    /*Not tagged: counted for the call site*/
+    size_t sites = call_site_live_size();
+    p = lv_malloc(77);
+    TEST_ASSERT_EQUAL(sites + 77, call_site_live_size());
+    p = lv_realloc(p, 177);
+    TEST_ASSERT_EQUAL(sites + 177, call_site_live_size());
+    lv_free(p);
+    TEST_ASSERT_EQUAL(sites, call_site_live_size());
+
+    /*`lv_calloc` and `lv_zalloc` are counted for their caller too*/
+    p = lv_calloc(3, 10);
+    TEST_ASSERT_EQUAL(sites + 30, call_site_live_size());
+    lv_free(p);
+#endif
+}
+
+void test_mem_profiler_tag_per_thread(void)
+{
+#if LV_USE_MEM_PROFILER && LV_USE_OS
+    /*An other thread starts untagged and its tag doesn't change this thread's*/
+    lv_mem_tag_t prev = lv_mem_set_tag(LV_MEM_TAG_USER + 2);
+    void * p = NULL;
+    lv_thread_t thread;
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_thread_init(&thread, "mem_tag", LV_THREAD_PRIO_MID, other_thread_cb, 8 * 1024,
+                                                   &p));
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_thread_delete(&thread));
+    TEST_ASSERT_EQUAL(LV_MEM_TAG_NONE, other_thread_tag);
+    TEST_ASSERT_EQUAL(LV_MEM_TAG_USER + 2, lv_mem_get_tag());
+    lv_mem_set_tag(prev);
+
+    TEST_ASSERT_NOT_NULL(p);
+    TEST_ASSERT_EQUAL(20, tag_live_size(LV_MEM_TAG_USER + 3));
+    TEST_ASSERT_EQUAL(0, tag_live_size(LV_MEM_TAG_USER + 2));
+    lv_free(p);
+#endif
+}
+
+void test_mem_profiler_alignment(void)
+{
+#if LV_USE_MEM_PROFILER && LV_USE_STDLIB_MALLOC == LV_STDLIB_CLIB
+    /*The header before the memory keeps the alignment of `malloc()`, 16 bytes on 64-bit glibc*/
+    uint32_t i;
+    for(i = 1; i < 100; i += 7) {
+        void * p = lv_malloc(i);
+        TEST_ASSERT_EQUAL(0, (uintptr_t)p % (2 * sizeof(void *)));
+        p = lv_realloc(p, i * 3);
+        TEST_ASSERT_EQUAL(0, (uintptr_t)p % (2 * sizeof(void *)));
+        lv_free(p);
+    }
+#endif
+}
+
+void test_mem_profiler_gif(void)
+{
+#if LV_USE_MEM_PROFILER
+    /*Let the arrays of LVGL grow first, e.g. the heap of the timers*/
+    lv_obj_delete(lv_gif_create(lv_screen_active()));
+
+    size_t gif_size = tag_live_size(LV_MEM_TAG_GIF);
+    size_t obj_size = tag_live_size(LV_MEM_TAG_OBJ);
+
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    TEST_ASSERT_GREATER_THAN(obj_size + sizeof(lv_gif_t), tag_live_size(LV_MEM_TAG_OBJ));
+
+    /*The decoder with the 80x80 canvas, the frame and the previous frame*/
+    lv_gif_set_src(gif, &test_img_face_gif);
+    TEST_ASSERT_GREATER_OR_EQUAL(gif_size + 5 * 80 * 80, tag_live_size(LV_MEM_TAG_GIF));
+
+    /*Layers and draw tasks are freed at the end of the frame*/
+    size_t draw_size = tag_live_size(LV_MEM_TAG_DRAW);
+    lv_refr_now(NULL);
+    const lv_mem_profiler_entry_t * draw = lv_mem_profiler_get_tag(LV_MEM_TAG_DRAW);
+    TEST_ASSERT_NOT_NULL(draw);
+    TEST_ASSERT_EQUAL(draw_size, draw->live_size);
+    TEST_ASSERT_GREATER_THAN(draw_size, draw->last_frame_peak_size);
+    TEST_ASSERT_GREATER_OR_EQUAL(draw->last_frame_peak_size, draw->frame_max_size);
+
+    const lv_mem_profiler_entry_t * total = lv_mem_profiler_get_total();
+    TEST_ASSERT_GREATER_OR_EQUAL(total->live_size, total->last_frame_peak_size);
+
+    /*Decoding the next frames doesn't keep more memory*/
+    size_t gif_loaded_size = tag_live_size(LV_MEM_TAG_GIF);
+    uint32_t i;
+    for(i = 0; i < 20; i++) {
+        lv_tick_inc(50);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL(gif_loaded_size, tag_live_size(LV_MEM_TAG_GIF));
+
+    lv_obj_delete(gif);
+    TEST_ASSERT_EQUAL(gif_size, tag_live_size(LV_MEM_TAG_GIF));
+    TEST_ASSERT_EQUAL(obj_size, tag_live_size(LV_MEM_TAG_OBJ));
+#endif
+}
+
+void test_mem_profiler_image(void)
+{
+#if LV_USE_MEM_PROFILER && LV_USE_LODEPNG
+    lv_image_cache_drop(NULL);
+    size_t image_size = tag_live_size(LV_MEM_TAG_IMAGE);
+    uint32_t image_cnt = tag_live_cnt(LV_MEM_TAG_IMAGE);
+
+    lv_obj_t * img = lv_image_create(lv_screen_active());
+    lv_image_set_src(img, "A:src/test_assets/test_img_lvgl_logo.png");
+    lv_refr_now(NULL);
+
+    /*The decoded image is kept in the image cache*/
+    int32_t w = lv_obj_get_width(img);
+    int32_t h = lv_obj_get_height(img);
+    TEST_ASSERT_GREATER_OR_EQUAL(image_size + w * h * 4, tag_live_size(LV_MEM_TAG_IMAGE));
+    TEST_ASSERT_GREATER_THAN(image_cnt, tag_live_cnt(LV_MEM_TAG_IMAGE));
+
+    lv_obj_delete(img);
+    lv_image_cache_drop(NULL);
+    TEST_ASSERT_EQUAL(image_size, tag_live_size(LV_MEM_TAG_IMAGE));
+    TEST_ASSERT_EQUAL(image_cnt, tag_live_cnt(LV_MEM_TAG_IMAGE));
+#endif
+}
+
+void test_mem_profiler_dump(void)
+{
+#if LV_USE_MEM_PROFILER
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, &test_img_face_gif);
+
+    dump_text[0] = '\0';
+    lv_mem_profiler_dump(dump_cb);
+    TEST_ASSERT_NOT_NULL(strstr(dump_text, "tag/call site"));
+    TEST_ASSERT_NOT_NULL(strstr(dump_text, "\ngif "));
+    TEST_ASSERT_NOT_NULL(strstr(dump_text, "\ntotal "));
+
+    uint32_t cnt = lv_mem_profiler_get_entry_count();
+    uint32_t size = lv_mem_profiler_dump_bin(NULL, 0);
+    TEST_ASSERT_EQUAL(8 + (cnt + 1) * 36, size);
+
+    uint8_t * buf = lv_malloc(size);
+    TEST_ASSERT_EQUAL(0, lv_mem_profiler_dump_bin(buf, size - 1));
+    /*The buffer itself is counted in the dump*/
+    TEST_ASSERT_EQUAL(size, lv_mem_profiler_dump_bin(buf, size));
+    TEST_ASSERT_EQUAL_MEMORY("LVMP", buf, 4);
+    TEST_ASSERT_EQUAL(sizeof(void *), buf[5]);
+    TEST_ASSERT_EQUAL(cnt, buf[6] | (buf[7] << 8));
+
+    /*The first record is the total*/
+    TEST_ASSERT_EQUAL(0x04, buf[8 + 1]);
+    TEST_ASSERT_EQUAL(lv_mem_profiler_get_total()->live_cnt, read_u32(buf + 8 + 4));
+    TEST_ASSERT_EQUAL(lv_mem_profiler_get_total()->live_size, read_u32(buf + 8 + 12));
+
+    uint32_t i;
+    bool gif_found = false;
+    for(i = 0; i < cnt; i++) {
+        const uint8_t * r = buf + 8 + (i + 1) * 36;
+        if(r[0] == LV_MEM_TAG_GIF) {
+            TEST_ASSERT_EQUAL(tag_live_size(LV_MEM_TAG_GIF), read_u32(r + 12));
+            gif_found = true;
+        }
+    }
+    TEST_ASSERT_TRUE(gif_found);
+
+    lv_free(buf);
+#endif
+}
+
+/*Run it last as the tags fill the table*/
+void test_mem_profiler_overflow(void)
+{
+#if LV_USE_MEM_PROFILER
+    void * p[LV_MEM_PROFILER_ENTRY_CNT + 1];
+    uint32_t i;
+    for(i = 0; i <= LV_MEM_PROFILER_ENTRY_CNT; i++) {
+        lv_mem_tag_t prev = lv_mem_set_tag(LV_MEM_TAG_USER + 10 + i);
+        p[i] = lv_malloc(10);
+        lv_mem_set_tag(prev);
+    }
+
+    /*The last ones are counted together*/
+    uint32_t cnt = lv_mem_profiler_get_entry_count();
+    TEST_ASSERT_LESS_OR_EQUAL(LV_MEM_PROFILER_ENTRY_CNT + 1, cnt);
+    const lv_mem_profiler_entry_t * others = lv_mem_profiler_get_entry(cnt - 1);
+    TEST_ASSERT_EQUAL(LV_MEM_TAG_NONE, others->tag);
+    TEST_ASSERT_NULL(others->caller);
+    TEST_ASSERT_NULL(lv_mem_profiler_get_entry(cnt));
+    TEST_ASSERT_NULL(lv_mem_profiler_get_tag(LV_MEM_TAG_USER + 10 + LV_MEM_PROFILER_ENTRY_CNT));
+
+    size_t others_size = others->live_size;
+    for(i = 0; i <= LV_MEM_PROFILER_ENTRY_CNT; i++) lv_free(p[i]);
+    TEST_ASSERT_GREATER_OR_EQUAL(10, others_size - others->live_size);
+#endif
+}
+
+#endif
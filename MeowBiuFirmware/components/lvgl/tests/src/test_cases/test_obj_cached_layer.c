@@ -0,0 +1,343 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define HOR_RES     240
+#define VER_RES     240
+#define BUF_ROWS    80
+
+static uint16_t frame[HOR_RES * VER_RES];
+static uint16_t frame_ref[HOR_RES * VER_RES];
+static uint8_t draw_buf[LV_TEST_WIDTH_TO_STRIDE(HOR_RES, 2) * BUF_ROWS + LV_DRAW_BUF_ALIGN];
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+static uint32_t draw_cnt;
+
+extern const lv_image_dsc_t test_img_face_gif;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * HOR_RES + area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x102040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x804010), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_HOR, 0);
+    draw_cnt = 0;
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+static void draw_cnt_event_cb(lv_event_t * e)
+{
+    LV_UNUSED(e);
+    draw_cnt++;
+}
+
+/*A semi-transparent panel with a shadow and some text, drawn over the rest of the screen.
+ *The first label fits into the first 80 rows, so it's drawn once per frame without caching too.*/
+static lv_obj_t * overlay_create(lv_obj_t ** label_out)
+{
+    lv_obj_t * panel = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(panel, 160, 90);
+    lv_obj_align(panel, LV_ALIGN_TOP_MID, 0, 20);
+    lv_obj_set_style_bg_color(panel, lv_color_black(), 0);
+    lv_obj_set_style_bg_opa(panel, LV_OPA_50, 0);
+    lv_obj_set_style_border_width(panel, 0, 0);
+    lv_obj_set_style_radius(panel, 16, 0);
+    lv_obj_set_style_shadow_width(panel, 20, 0);
+    lv_obj_set_style_shadow_opa(panel, LV_OPA_60, 0);
+    lv_obj_remove_flag(panel, LV_OBJ_FLAG_SCROLLABLE);
+
+    lv_obj_t * label = lv_label_create(panel);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_obj_set_style_text_font(label, &lv_font_montserrat_28, 0);
+    lv_label_set_text(label, "12:34");
+    lv_obj_align(label, LV_ALIGN_TOP_MID, 0, 0);
+    lv_obj_add_event_cb(label, draw_cnt_event_cb, LV_EVENT_DRAW_MAIN, NULL);
+
+    lv_obj_t * label2 = lv_label_create(panel);
+    lv_obj_set_style_text_color(label2, lv_color_hex(0xffd080), 0);
+    lv_label_set_text(label2, "Tuesday, 21 May");
+    lv_obj_align(label2, LV_ALIGN_BOTTOM_MID, 0, 0);
+
+    if(label_out) *label_out = label;
+    return panel;
+}
+
+/*Something changing behind the overlay in every frame*/
+static lv_obj_t * background_create(void)
+{
+    lv_obj_t * rect = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(rect, 200, 200);
+    lv_obj_center(rect);
+    lv_obj_set_style_bg_color(rect, lv_palette_main(LV_PALETTE_GREEN), 0);
+    lv_obj_move_background(rect);
+    return rect;
+}
+
+static void render_reference(lv_obj_t * overlay)
+{
+    lv_obj_remove_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    lv_obj_add_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+}
+
+/*The semi-transparent pixels of the cached layer are blended twice, so they can be rounded differently*/
+static bool frames_similar(const uint16_t * a, const uint16_t * b)
+{
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        int32_t dr = (a[i] >> 11) - (b[i] >> 11);
+        int32_t dg = ((a[i] >> 5) & 0x3f) - ((b[i] >> 5) & 0x3f);
+        int32_t db = (a[i] & 0x1f) - (b[i] & 0x1f);
+        if(LV_ABS(dr) > 2 || LV_ABS(dg) > 2 || LV_ABS(db) > 2) return false;
+    }
+    return true;
+}
+
+void test_obj_cached_layer_looks_the_same(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * overlay = overlay_create(&label);
+    background_create();
+
+    render_reference(overlay);
+    TEST_ASSERT_NOT_NULL(overlay->spec_attr->layer_cache);
+    TEST_ASSERT_EQUAL(LV_COLOR_FORMAT_RGB565A8, overlay->spec_attr->layer_cache->header.cf);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    /*The extra draw size of the shadow is cached too*/
+    int32_t ext = lv_obj_get_ext_draw_size(overlay);
+    TEST_ASSERT_GREATER_THAN_INT32(0, ext);
+    TEST_ASSERT_EQUAL_INT32(lv_obj_get_width(overlay) + 2 * ext, overlay->spec_attr->layer_cache->header.w);
+}
+
+void test_obj_cached_layer_not_redrawn(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * overlay = overlay_create(&label);
+    lv_obj_t * bg = background_create();
+    lv_obj_add_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    /*The things behind the overlay change but its children are not drawn again*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_obj_set_style_bg_color(bg, lv_color_hsv_to_rgb(i * 36, 100, 100), 0);
+        lv_refr_now(disp);
+    }
+    TEST_ASSERT_EQUAL_UINT32(1, draw_cnt);
+
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    lv_obj_remove_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    TEST_ASSERT_NULL(overlay->spec_attr->layer_cache);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    /*Without the flag they are drawn in every frame*/
+    draw_cnt = 0;
+    for(i = 0; i < 10; i++) {
+        lv_obj_set_style_bg_color(bg, lv_color_hsv_to_rgb(i * 36, 100, 100), 0);
+        lv_refr_now(disp);
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, draw_cnt);
+}
+
+void test_obj_cached_layer_invalidated_by_children(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * overlay = overlay_create(&label);
+    background_create();
+    lv_obj_add_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    lv_refr_now(disp);
+    lv_draw_buf_t * cache = overlay->spec_attr->layer_cache;
+
+    /*The same buffer is rendered again*/
+    lv_label_set_text(label, "12:35");
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT32(2, draw_cnt);
+    TEST_ASSERT_EQUAL_PTR(cache, overlay->spec_attr->layer_cache);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    render_reference(overlay);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    /*New children and hidden children*/
+    lv_obj_t * btn = lv_button_create(overlay);
+    lv_obj_set_size(btn, 30, 30);
+    lv_refr_now(disp);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    render_reference(overlay);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    lv_obj_add_flag(btn, LV_OBJ_FLAG_HIDDEN);
+    lv_refr_now(disp);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    render_reference(overlay);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    /*A new size needs a new buffer*/
+    lv_obj_set_width(overlay, 200);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_INT32(200 + 2 * lv_obj_get_ext_draw_size(overlay), overlay->spec_attr->layer_cache->header.w);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    render_reference(overlay);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+}
+
+/*The number of times the label is drawn when only the background changes*/
+static uint32_t bg_frame_draw_cnt(lv_obj_t * bg)
+{
+    lv_refr_now(disp);
+    draw_cnt = 0;
+    lv_obj_invalidate(bg);
+    lv_refr_now(disp);
+    return draw_cnt;
+}
+
+void test_obj_cached_layer_fallback(void)
+{
+    lv_obj_t * label;
+    lv_obj_t * overlay = overlay_create(&label);
+    lv_obj_t * bg = background_create();
+    lv_obj_add_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER);
+    TEST_ASSERT_EQUAL_UINT32(0, bg_frame_draw_cnt(bg));
+
+    /*The opacity of the parents and transformations are not cached, so it's drawn as usual*/
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_70, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, bg_frame_draw_cnt(bg));
+    lv_obj_set_style_opa(lv_screen_active(), LV_OPA_COVER, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, bg_frame_draw_cnt(bg));
+
+    lv_obj_set_style_transform_rotation(overlay, 100, 0);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, bg_frame_draw_cnt(bg));
+    lv_obj_set_style_transform_rotation(overlay, 0, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, bg_frame_draw_cnt(bg));
+
+    /*The layered opacity is applied when blending the cached layer*/
+    lv_obj_set_style_opa_layered(overlay, LV_OPA_50, 0);
+    TEST_ASSERT_EQUAL_UINT32(0, bg_frame_draw_cnt(bg));
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    render_reference(overlay);
+    TEST_ASSERT_TRUE(frames_similar(frame_ref, frame));
+
+    /*Freed with the object*/
+    lv_obj_delete(overlay);
+    lv_refr_now(disp);
+}
+
+#if LV_USE_OS == LV_OS_PTHREAD
+static struct timespec render_start;
+static uint32_t render_us;
+static uint32_t render_cnt;
+
+static void render_time_event_cb(lv_event_t * e)
+{
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    if(lv_event_get_code(e) == LV_EVENT_RENDER_START) {
+        render_start = t;
+    }
+    else {
+        render_us += (uint32_t)((t.tv_sec - render_start.tv_sec) * 1000000 + (t.tv_nsec - render_start.tv_nsec) / 1000);
+        render_cnt++;
+    }
+}
+
+/*The best of a few runs of the average render time of the frames (the GIF decoding is not included)*/
+static uint32_t gif_frame_time(lv_obj_t * overlay, bool cached)
+{
+    lv_obj_set_flag(overlay, LV_OBJ_FLAG_CACHED_LAYER, cached);
+    lv_refr_now(disp);
+
+    uint32_t best = UINT32_MAX;
+    uint32_t r;
+    for(r = 0; r < 5; r++) {
+        render_us = 0;
+        render_cnt = 0;
+        uint32_t f;
+        for(f = 0; f < 60; f++) {
+            lv_tick_inc(33);
+            lv_timer_handler();
+        }
+        TEST_ASSERT_GREATER_THAN_UINT32(0, render_cnt);
+        best = LV_MIN(best, render_us / render_cnt);
+    }
+    return best;
+}
+#endif
+
+/*Not a pass/fail test: print the render time per frame of a text overlay on the GIF face
+ *at 30 FPS with and without LV_OBJ_FLAG_CACHED_LAYER*/
+void test_obj_cached_layer_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD && LV_USE_GIF
+    /*As in face.c of the firmware*/
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, &test_img_face_gif);
+    lv_obj_align(gif, LV_ALIGN_CENTER, 0, 0);
+    lv_image_set_scale(gif, 700);
+
+    lv_obj_t * overlay = overlay_create(NULL);
+    lv_display_add_event_cb(disp, render_time_event_cb, LV_EVENT_RENDER_START, NULL);
+    lv_display_add_event_cb(disp, render_time_event_cb, LV_EVENT_RENDER_READY, NULL);
+
+    uint32_t us_normal = gif_frame_time(overlay, false);
+    uint32_t draw_cnt_normal = draw_cnt;
+    draw_cnt = 0;
+    uint32_t us_cached = gif_frame_time(overlay, true);
+    uint32_t draw_cnt_cached = draw_cnt;
+    lv_obj_add_flag(overlay, LV_OBJ_FLAG_HIDDEN);
+    uint32_t us_gif = gif_frame_time(overlay, false);
+
+    TEST_PRINTF("GIF only: %d us rendering per frame", (int)us_gif);
+    TEST_PRINTF("GIF with a text overlay: %d us, with cached layer: %d us (%d vs %d text redraws)",
+                (int)us_normal, (int)us_cached, (int)draw_cnt_normal, (int)draw_cnt_cached);
+    TEST_ASSERT_LESS_THAN_UINT32(draw_cnt_normal, draw_cnt_cached);
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime and LV_USE_GIF");
+#endif
+}
+
+#endif
@@ -0,0 +1,330 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define HOR_RES     240
+#define VER_RES     240
+#define BUF_ROWS    80
+
+static uint8_t draw_buf[LV_TEST_WIDTH_TO_STRIDE(HOR_RES, 2) * BUF_ROWS + LV_DRAW_BUF_ALIGN];
+static uint32_t frame_hash;
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        int32_t x;
+        for(x = 0; x < w * 2; x++) frame_hash = frame_hash * 31 + px_map[x];
+        px_map += stride;
+    }
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    /*Like the display of the face: RGB565 rendered in 80 rows high strips*/
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+void test_obj_style_cache_local_style(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_refr_now(disp);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    TEST_ASSERT_NOT_NULL(obj->style_resolved);
+    /*Only the values set by the styles are stored*/
+    lv_obj_style_resolved_t * resolved = obj->style_resolved;
+    while(resolved->part != LV_PART_MAIN) resolved = resolved->next;
+    TEST_ASSERT_GREATER_THAN_UINT8(0, resolved->value_cnt);
+    TEST_ASSERT_LESS_THAN_UINT8(LV_OBJ_STYLE_RESOLVED_SLOT_CNT / 2, resolved->value_size);
+#endif
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_bg_color(obj, 0));
+
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, 0));
+
+    lv_obj_remove_local_style_prop(obj, LV_STYLE_BG_COLOR, 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_obj_get_style_bg_color(lv_obj_create(lv_screen_active()), 0),
+                            lv_obj_get_style_bg_color(obj, 0));
+}
+
+void test_obj_style_cache_shared_style(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_border_width(&style, 3);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_add_style(obj, &style, 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_INT32(3, lv_obj_get_style_border_width(obj, 0));
+
+    lv_style_set_border_width(&style, 5);
+    lv_obj_report_style_change(&style);
+    TEST_ASSERT_EQUAL_INT32(5, lv_obj_get_style_border_width(obj, 0));
+
+    /*Refreshing only the changed property*/
+    lv_style_set_border_width(&style, 4);
+    lv_obj_refresh_style(obj, LV_PART_MAIN, LV_STYLE_BORDER_WIDTH);
+    TEST_ASSERT_EQUAL_INT32(4, lv_obj_get_style_border_width(obj, 0));
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    /*Invalidating doesn't drop the cache, drawing doesn't have to resolve the properties again*/
+    lv_obj_invalidate(obj);
+    uint32_t resolve_cnt = LV_GLOBAL_DEFAULT()->style_resolve_cnt;
+    TEST_ASSERT_EQUAL_INT32(4, lv_obj_get_style_border_width(obj, 0));
+    TEST_ASSERT_EQUAL_UINT32(resolve_cnt, LV_GLOBAL_DEFAULT()->style_resolve_cnt);
+#endif
+
+    lv_obj_remove_style(obj, &style, 0);
+    TEST_ASSERT_NOT_EQUAL(5, lv_obj_get_style_border_width(obj, 0));
+
+    lv_style_reset(&style);
+}
+
+void test_obj_style_cache_inherited(void)
+{
+    lv_obj_t * parent = lv_obj_create(lv_screen_active());
+    lv_obj_t * cont = lv_obj_create(parent);
+    lv_obj_remove_style_all(cont);
+    lv_obj_t * label = lv_label_create(cont);
+    lv_obj_set_style_text_color(parent, lv_color_hex(0xff0000), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0xff0000), lv_obj_get_style_text_color(label, 0));
+
+    /*A change on the parent is seen by the children*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x0000ff), 0);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, 0));
+
+    /*Also if the parent's state changes*/
+    lv_obj_set_style_text_color(parent, lv_color_hex(0x00ff00), LV_STATE_CHECKED);
+    lv_obj_add_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_text_color(label, 0));
+    lv_obj_remove_state(parent, LV_STATE_CHECKED);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, 0));
+
+    /*And if the label is moved to an other parent*/
+    lv_obj_t * parent2 = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_text_color(parent2, lv_color_hex(0x123456), 0);
+    lv_obj_set_parent(label, parent2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_text_color(label, 0));
+
+    lv_obj_t * label2 = lv_label_create(cont);
+    lv_obj_get_style_text_color(label2, 0);
+    lv_obj_swap(label, label2);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x0000ff), lv_obj_get_style_text_color(label, 0));
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x123456), lv_obj_get_style_text_color(label2, 0));
+}
+
+void test_obj_style_cache_state(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_opa(obj, LV_OPA_50, LV_STATE_PRESSED);
+    lv_obj_set_style_border_width(obj, 7, LV_PART_SCROLLBAR);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_COVER, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_50, lv_obj_get_style_bg_opa(obj, 0));
+
+    /*The parts are cached separately*/
+    TEST_ASSERT_EQUAL_INT32(7, lv_obj_get_style_border_width(obj, LV_PART_SCROLLBAR));
+    TEST_ASSERT_NOT_EQUAL(7, lv_obj_get_style_border_width(obj, 0));
+}
+
+void test_obj_style_cache_transition(void)
+{
+    static const lv_style_prop_t props[] = {LV_STYLE_BG_OPA, 0};
+    static lv_style_transition_dsc_t tr;
+    lv_style_transition_dsc_init(&tr, props, lv_anim_path_linear, 100, 0, NULL);
+
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_opa(obj, LV_OPA_0, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_100, LV_STATE_PRESSED);
+    lv_obj_set_style_transition(obj, &tr, LV_STATE_PRESSED);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_0, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_obj_add_state(obj, LV_STATE_PRESSED);
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_0, lv_obj_get_style_bg_opa(obj, 0));
+
+    lv_tick_inc(50);
+    lv_timer_handler();
+    lv_opa_t opa = lv_obj_get_style_bg_opa(obj, 0);
+    TEST_ASSERT_GREATER_THAN_UINT8(LV_OPA_0, opa);
+    TEST_ASSERT_LESS_THAN_UINT8(LV_OPA_100, opa);
+
+    lv_tick_inc(100);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT8(LV_OPA_100, lv_obj_get_style_bg_opa(obj, 0));
+}
+
+void test_obj_style_cache_disable(void)
+{
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_refr_now(disp);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    TEST_ASSERT_NOT_NULL(obj->style_resolved);
+#endif
+
+    lv_obj_enable_style_resolved_cache(obj, false);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0x00ff00), 0);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_COLOR(lv_color_hex(0x00ff00), lv_obj_get_style_bg_color(obj, 0));
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    TEST_ASSERT_NULL(obj->style_resolved);
+#endif
+}
+
+static lv_obj_tree_walk_res_t enable_cache_cb(lv_obj_t * obj, void * user_data)
+{
+    lv_obj_enable_style_resolved_cache(obj, *(bool *)user_data);
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+/*The style lookups of drawing a widget without the rendering*/
+static lv_obj_tree_walk_res_t init_draw_dsc_cb(lv_obj_t * obj, void * user_data)
+{
+    LV_UNUSED(user_data);
+    lv_draw_rect_dsc_t rect_dsc;
+    lv_draw_rect_dsc_init(&rect_dsc);
+    lv_obj_init_draw_rect_dsc(obj, LV_PART_MAIN, &rect_dsc);
+    lv_draw_label_dsc_t label_dsc;
+    lv_draw_label_dsc_init(&label_dsc);
+    lv_obj_init_draw_label_dsc(obj, LV_PART_MAIN, &label_dsc);
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+static lv_obj_tree_walk_res_t cache_size_cb(lv_obj_t * obj, void * user_data)
+{
+    size_t * size = user_data;
+    lv_obj_style_resolved_t * resolved;
+    for(resolved = obj->style_resolved; resolved; resolved = resolved->next) {
+        *size += sizeof(lv_obj_style_resolved_t) + resolved->value_size * sizeof(lv_style_value_t);
+    }
+    return LV_OBJ_TREE_WALK_NEXT;
+}
+#endif
+
+static uint32_t get_us(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    struct timespec t;
+    clock_gettime(CLOCK_MONOTONIC, &t);
+    return (uint32_t)(t.tv_sec * 1000000 + t.tv_nsec / 1000);
+#else
+    return 0;
+#endif
+}
+
+/*Not a pass/fail test: redraw a screen of 200 widgets and print the number of style lookups
+ *which had to check the styles and the time of a redraw with and without the cache.
+ *Print the time of initializing the draw descriptors of the widgets in the 3 strips too.*/
+void test_obj_style_cache_benchmark(void)
+{
+    static lv_style_t style;
+    lv_style_init(&style);
+    lv_style_set_radius(&style, 4);
+    lv_style_set_shadow_width(&style, 0);
+    lv_style_set_border_width(&style, 1);
+    lv_style_set_border_color(&style, lv_color_white());
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_flex_flow(scr, LV_FLEX_FLOW_ROW_WRAP);
+    lv_obj_set_style_pad_all(scr, 2, 0);
+    lv_obj_set_style_pad_gap(scr, 2, 0);
+    uint32_t i;
+    for(i = 0; i < 100; i++) {
+        lv_obj_t * btn = lv_button_create(scr);
+        lv_obj_add_style(btn, &style, 0);
+        lv_obj_set_size(btn, 21, 21);
+        lv_obj_t * label = lv_label_create(btn);
+        lv_label_set_text_fmt(label, "%d", (int)(i % 10));
+        lv_obj_center(label);
+    }
+
+    const uint32_t repeat = 20;
+    uint32_t hash[2];
+    uint32_t lookups[2];
+    uint32_t us[2];
+    uint32_t dsc_us[2];
+    for(i = 0; i < 2; i++) {
+        bool en = i == 1;
+        lv_obj_tree_walk(scr, enable_cache_cb, &en);
+        lv_refr_now(disp);
+
+        frame_hash = 0;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+        LV_GLOBAL_DEFAULT()->style_resolve_cnt = 0;
+#endif
+        uint32_t t = get_us();
+        uint32_t r;
+        for(r = 0; r < repeat; r++) {
+            lv_obj_invalidate(scr);
+            lv_refr_now(disp);
+        }
+        us[i] = (get_us() - t) / repeat;
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+        lookups[i] = LV_GLOBAL_DEFAULT()->style_resolve_cnt / repeat;
+#else
+        lookups[i] = 0;
+#endif
+        hash[i] = frame_hash;
+
+        t = get_us();
+        for(r = 0; r < repeat * 3; r++) {
+            lv_obj_tree_walk(scr, init_draw_dsc_cb, NULL);
+        }
+        dsc_us[i] = (get_us() - t) / repeat;
+    }
+
+    TEST_PRINTF("without cache: %d style lookups, %d us per redraw, %d us to init the draw descriptors",
+                (int)lookups[0], (int)us[0], (int)dsc_us[0]);
+    TEST_PRINTF("with cache: %d style lookups, %d us per redraw, %d us to init the draw descriptors",
+                (int)lookups[1], (int)us[1], (int)dsc_us[1]);
+    TEST_ASSERT_EQUAL_UINT32(hash[0], hash[1]);
+#if LV_OBJ_STYLE_RESOLVED_CACHE
+    TEST_ASSERT_LESS_THAN_UINT32(lookups[0] / 10, lookups[1]);
+
+    size_t cache_size = 0;
+    lv_obj_tree_walk(scr, cache_size_cb, &cache_size);
+    TEST_PRINTF("cache size: %d bytes", (int)cache_size);
+#endif
+
+    lv_obj_clean(scr);
+    lv_style_reset(&style);
+}
+
+#endif
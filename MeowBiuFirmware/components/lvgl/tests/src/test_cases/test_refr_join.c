@@ -0,0 +1,212 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     240
+#define VER_RES     240
+#define BUF_ROWS    80
+
+/*A GC9A01 on a 40 MHz SPI bus with a single draw buffer: 16 bits per pixel and about 200 us per area
+ *to walk the widgets, set the window and wait for the DMA before rendering the next area*/
+#define AREA_COST   200000
+#define PX_COST     400
+
+/*The areas which change on each frame of an animation of the face*/
+typedef struct {
+    const char * name;
+    const lv_area_t * areas;
+    uint32_t area_cnt;
+    int32_t move;        /*Move the areas back and forth by this many pixels on every frame*/
+} trace_t;
+
+static const lv_area_t eyes[] = {
+    {52, 72, 107, 135}, {132, 72, 187, 135}
+};
+
+static const lv_area_t eyes_and_mouth[] = {
+    {52, 72, 107, 135}, {132, 72, 187, 135}, {80, 160, 159, 183}, {40, 150, 59, 161}, {180, 150, 199, 161}
+};
+
+static const lv_area_t pupils[] = {
+    {70, 96, 85, 111}, {150, 96, 165, 111}
+};
+
+static lv_area_t sparkles[40];
+
+/*Close small areas*/
+static const lv_area_t dots[] = {
+    {100, 100, 107, 107}, {112, 100, 119, 107}
+};
+
+static const lv_area_t gif[] = {
+    {36, 36, 203, 203}
+};
+
+static const trace_t traces[] = {
+    {"blink", eyes, 2, 0},
+    {"talk", eyes_and_mouth, 5, 0},
+    {"look around", pupils, 2, 6},
+    {"sparkles", sparkles, 40, 0},
+    {"gif", gif, 1, 0},
+};
+
+static uint16_t frame[HOR_RES * VER_RES];
+static uint8_t draw_buf[LV_TEST_WIDTH_TO_STRIDE(HOR_RES, 2) * BUF_ROWS + LV_DRAW_BUF_ALIGN];
+static uint32_t flush_cnt;
+static uint32_t flush_px;
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * HOR_RES + area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+    flush_cnt++;
+    flush_px += lv_area_get_size(area);
+    lv_display_flush_ready(d);
+}
+
+void setUp(void)
+{
+    /*Small stars on a ring around the face*/
+    uint32_t i;
+    for(i = 0; i < 40; i++) {
+        int32_t x = HOR_RES / 2 + lv_trigo_cos(i * 9) * 100 / LV_TRIGO_SIN_MAX;
+        int32_t y = VER_RES / 2 + lv_trigo_sin(i * 9) * 100 / LV_TRIGO_SIN_MAX;
+        lv_area_set(&sparkles[i], x - 4, y - 4, x + 3, y + 3);
+    }
+
+    /*The display of the face: RGB565 rendered in 80 rows high strips*/
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_set_default(disp);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+/*Replay a trace: create an object for every area and change them on every frame.
+ *Return the modelled transfer time of a frame in us.*/
+static uint32_t replay(const trace_t * trace, uint32_t frame_cnt)
+{
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_clean(scr);
+    lv_obj_set_style_bg_color(scr, lv_color_black(), 0);
+
+    lv_obj_t * objs[40];
+    uint32_t i;
+    for(i = 0; i < trace->area_cnt; i++) {
+        objs[i] = lv_obj_create(scr);
+        lv_obj_remove_style_all(objs[i]);
+        lv_obj_set_style_bg_opa(objs[i], LV_OPA_COVER, 0);
+        lv_obj_set_pos(objs[i], trace->areas[i].x1, trace->areas[i].y1);
+        lv_obj_set_size(objs[i], lv_area_get_width(&trace->areas[i]), lv_area_get_height(&trace->areas[i]));
+    }
+    lv_refr_now(disp);
+
+    flush_cnt = 0;
+    flush_px = 0;
+    uint32_t f;
+    for(f = 0; f < frame_cnt; f++) {
+        for(i = 0; i < trace->area_cnt; i++) {
+            lv_obj_set_style_bg_color(objs[i], lv_palette_main((lv_palette_t)((f + i) % LV_PALETTE_LAST)), 0);
+            if(trace->move) {
+                lv_obj_set_x(objs[i], trace->areas[i].x1 + (f % 2 ? trace->move : -trace->move));
+            }
+        }
+        lv_refr_now(disp);
+    }
+
+    return (uint32_t)(((uint64_t)flush_cnt * AREA_COST + (uint64_t)flush_px * PX_COST) / 1000 / frame_cnt);
+}
+
+void test_refr_join_renders_the_same(void)
+{
+    static uint16_t frame_ref[HOR_RES * VER_RES];
+
+    uint32_t t;
+    for(t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        lv_display_set_flush_cost(disp, 0, 1);
+        replay(&traces[t], 5);
+        lv_memcpy(frame_ref, frame, sizeof(frame));
+
+        lv_display_set_flush_cost(disp, AREA_COST, PX_COST);
+        replay(&traces[t], 5);
+        TEST_ASSERT_EQUAL_MEMORY(frame_ref, frame, sizeof(frame));
+    }
+}
+
+void test_refr_join_distinct_areas(void)
+{
+    const trace_t trace = {"dots", dots, 2, 0};
+
+    /*Two distinct areas are redrawn separately by default...*/
+    lv_display_set_flush_cost(disp, 0, 1);
+    replay(&trace, 1);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(2 * 8 * 8, flush_px);
+
+    /*...but together if a flush costs more than the pixels between them*/
+    lv_display_set_flush_cost(disp, AREA_COST, PX_COST);
+    replay(&trace, 1);
+    TEST_ASSERT_EQUAL_UINT32(1, flush_cnt);
+    TEST_ASSERT_EQUAL_UINT32(20 * 8, flush_px);
+
+    /*The far eyes are still redrawn separately*/
+    replay(&traces[0], 1);
+    TEST_ASSERT_EQUAL_UINT32(2, flush_cnt);
+}
+
+void test_refr_join_overflow(void)
+{
+    /*More areas than LV_INV_BUF_SIZE are joined to the closest ones instead of redrawing the screen*/
+    TEST_ASSERT_GREATER_THAN(LV_INV_BUF_SIZE, traces[3].area_cnt);
+    lv_display_set_flush_cost(disp, 0, 1);
+    replay(&traces[3], 1);
+    TEST_ASSERT_LESS_THAN_UINT32(HOR_RES * VER_RES / 2, flush_px);
+}
+
+/*Print the modelled transfer time of a frame with the pixel count and the transfer cost based joining.
+ *"full screen" is what the former overflow strategy sent for the sparkles.*/
+void test_refr_join_benchmark(void)
+{
+    uint32_t t;
+    for(t = 0; t < sizeof(traces) / sizeof(traces[0]); t++) {
+        lv_display_set_flush_cost(disp, 0, 1);
+        uint32_t us_px = replay(&traces[t], 20);
+        uint32_t flush_cnt_px = flush_cnt / 20;
+
+        lv_display_set_flush_cost(disp, AREA_COST, PX_COST);
+        uint32_t us_cost = replay(&traces[t], 20);
+
+        TEST_PRINTF("%s: %d us (%d flushes) with pixel count, %d us (%d flushes) with transfer cost based joining",
+                    traces[t].name, (int)us_px, (int)flush_cnt_px, (int)us_cost, (int)(flush_cnt / 20));
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(us_px, us_cost);
+    }
+
+    uint32_t full_screen_us = ((VER_RES + BUF_ROWS - 1) / BUF_ROWS * AREA_COST + HOR_RES * VER_RES * PX_COST) / 1000;
+    TEST_PRINTF("full screen: %d us", (int)full_screen_us);
+}
+
+#endif
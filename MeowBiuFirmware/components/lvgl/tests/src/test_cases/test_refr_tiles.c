@@ -0,0 +1,141 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+static uint32_t tile_cnt_ori;
+
+void setUp(void)
+{
+    tile_cnt_ori = lv_display_get_tile_cnt(NULL);
+}
+
+void tearDown(void)
+{
+    lv_display_set_tile_cnt(NULL, tile_cnt_ori);
+    lv_obj_clean(lv_screen_active());
+}
+
+/*A face-like screen: one large image covering most of the screen and a few widgets on it*/
+static void create_scene(int32_t img_scale)
+{
+    LV_IMAGE_DECLARE(test_image_cogwheel_argb8888);
+
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x203040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x406080), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_VER, 0);
+
+    lv_obj_t * img = lv_image_create(scr);
+    lv_image_set_src(img, &test_image_cogwheel_argb8888);
+    lv_image_set_scale(img, img_scale);
+    lv_obj_center(img);
+
+    lv_obj_t * obj = lv_obj_create(scr);
+    lv_obj_set_size(obj, 300, 120);
+    lv_obj_align(obj, LV_ALIGN_BOTTOM_MID, 0, -20);
+    lv_obj_set_style_radius(obj, 30, 0);
+    lv_obj_set_style_shadow_width(obj, 30, 0);
+    lv_obj_set_style_bg_opa(obj, LV_OPA_70, 0);
+
+    lv_obj_t * label = lv_label_create(obj);
+    lv_label_set_text(label, "Tiled rendering");
+    lv_obj_center(label);
+}
+
+static void render_frame(void)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(NULL);
+}
+
+void test_refr_tiles_render_the_same(void)
+{
+    /*Transformed images are sampled relative to the start of the clip area
+     *so a tile boundary could cause a rounding difference. Use a non-scaled image here.*/
+    create_scene(LV_SCALE_NONE);
+
+    lv_display_set_tile_cnt(NULL, 1);
+    render_frame();
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    uint32_t size = buf->header.stride * buf->header.h;
+    uint8_t * ref = lv_malloc(size);
+    TEST_ASSERT_NOT_NULL(ref);
+    lv_memcpy(ref, buf->data, size);
+
+    const uint32_t tile_cnts[] = {2, 3, 4, 8, 255};
+    uint32_t i;
+    for(i = 0; i < sizeof(tile_cnts) / sizeof(tile_cnts[0]); i++) {
+        lv_display_set_tile_cnt(NULL, tile_cnts[i]);
+        lv_memzero(buf->data, size);
+        render_frame();
+        TEST_ASSERT_EQUAL_MEMORY(ref, buf->data, size);
+    }
+
+    lv_free(ref);
+}
+
+void test_refr_tiles_small_area(void)
+{
+    create_scene(LV_SCALE_NONE);
+    lv_display_set_tile_cnt(NULL, 1);
+    render_frame();
+
+    /*Only a few rows are invalidated: more tiles than rows must not cause empty or inverted tiles*/
+    lv_obj_t * obj = lv_obj_create(lv_screen_active());
+    lv_obj_set_size(obj, 700, 3);
+    lv_obj_set_pos(obj, 10, 10);
+    lv_obj_set_style_border_width(obj, 0, 0);
+    lv_obj_set_style_radius(obj, 0, 0);
+    lv_obj_set_style_bg_color(obj, lv_color_hex(0xff0000), 0);
+    lv_obj_update_layout(obj);
+
+    lv_display_set_tile_cnt(NULL, 8);
+    lv_refr_now(NULL);
+
+    lv_draw_buf_t * buf = lv_display_get_buf_active(NULL);
+    int32_t y;
+    for(y = 10; y < 13; y++) {
+        uint32_t * row = (uint32_t *)(buf->data + y * buf->header.stride);
+        TEST_ASSERT_EQUAL_HEX32(0xff0000, row[10] & 0xffffff);
+        TEST_ASSERT_EQUAL_HEX32(0xff0000, row[709] & 0xffffff);
+    }
+}
+
+/*Not a pass/fail test: report the render time of a full frame with 1/2/4/8 tiles.
+ *The number of threads used is at most LV_DRAW_SW_DRAW_UNIT_CNT, so build the tests with
+ *e.g. `-DLV_DRAW_SW_DRAW_UNIT_CNT=8` to see the scaling.*/
+void test_refr_tiles_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    create_scene(700);
+
+    const uint32_t tile_cnts[] = {1, 2, 4, 8};
+    const uint32_t frame_cnt = 10;
+    uint32_t i;
+    for(i = 0; i < sizeof(tile_cnts) / sizeof(tile_cnts[0]); i++) {
+        lv_display_set_tile_cnt(NULL, tile_cnts[i]);
+        render_frame(); /*Warm up the caches*/
+
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t f;
+        for(f = 0; f < frame_cnt; f++) {
+            render_frame();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+        TEST_PRINTF("tiles: %d, draw units: %d, %d us/frame", (int)tile_cnts[i], LV_DRAW_SW_DRAW_UNIT_CNT,
+                    (int)(us / frame_cnt));
+    }
+#else
+    TEST_PASS_MESSAGE("Parallel rendering requires an OS");
+#endif
+}
+
+#endif
@@ -0,0 +1,349 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define MAX_TIMERS  8
+
+/*The timers created by LVGL (display refresh, animations, etc.) paused during the tests*/
+static lv_timer_t * paused_timers[MAX_TIMERS];
+static uint32_t paused_cnt;
+
+static uint32_t run_cnt[MAX_TIMERS];
+static uint32_t run_order[16];
+static uint32_t run_order_cnt;
+
+void setUp(void)
+{
+    lv_memzero(run_cnt, sizeof(run_cnt));
+    run_order_cnt = 0;
+
+    /*Make only the timers of the tests active*/
+    paused_cnt = 0;
+    lv_timer_t * t = lv_timer_get_next(NULL);
+    while(t) {
+        if(!lv_timer_get_paused(t)) {
+            TEST_ASSERT_LESS_THAN(MAX_TIMERS, paused_cnt);
+            paused_timers[paused_cnt++] = t;
+            lv_timer_pause(t);
+        }
+        t = lv_timer_get_next(t);
+    }
+}
+
+void tearDown(void)
+{
+    uint32_t i;
+    for(i = 0; i < paused_cnt; i++) {
+        lv_timer_resume(paused_timers[i]);
+    }
+}
+
+static void count_cb(lv_timer_t * t)
+{
+    uint32_t id = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+    run_cnt[id]++;
+    if(run_order_cnt < 16) run_order[run_order_cnt++] = id;
+}
+
+static void delete_self_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_delete(t);
+}
+
+static lv_timer_t * created_timer;
+static void create_other_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    if(created_timer == NULL) created_timer = lv_timer_create(count_cb, 0, (void *)2);
+}
+
+void test_timer_period(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, (void *)0);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 25, (void *)1);
+
+    lv_tick_inc(9);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+
+    lv_tick_inc(1);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[1]);
+
+    uint32_t i;
+    for(i = 0; i < 90; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(10, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(4, run_cnt[1]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+}
+
+void test_timer_order(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 30, (void *)0);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 10, (void *)1);
+    lv_timer_t * t3 = lv_timer_create(count_cb, 20, (void *)2);
+
+    /*All of them are expired, each should run once*/
+    lv_tick_inc(30);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(3, run_order_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[2]);
+
+    /*The due timers run in the order of the timer list (newest first) with the heap too*/
+    TEST_ASSERT_EQUAL_UINT32(2, run_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_order[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_time_until_next(void)
+{
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    lv_timer_t * t1 = lv_timer_create(count_cb, 100, (void *)0);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 30, (void *)1);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_get_time_until_next());
+
+    lv_tick_inc(20);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_timer_handler());
+
+    /*Paused timers are not considered*/
+    lv_timer_pause(t2);
+    TEST_ASSERT_EQUAL_UINT32(80, lv_timer_handler());
+
+    lv_timer_resume(t2);
+    lv_timer_reset(t2);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+
+    lv_timer_set_period(t1, 40);
+    TEST_ASSERT_EQUAL_UINT32(20, lv_timer_handler());
+
+    lv_timer_ready(t1);
+    TEST_ASSERT_EQUAL_UINT32(30, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+}
+
+/*The expiries in the heap are compared as signed differences, so longer periods are handled in steps*/
+void test_timer_long_period(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, UINT32_MAX, (void *)0);
+    lv_timer_t * t2 = lv_timer_create(count_cb, 10, (void *)1);
+    lv_timer_t * t3 = lv_timer_create(count_cb, 0x80000010, (void *)2);
+
+    lv_tick_inc(10);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(10, lv_timer_handler());
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+
+    /*Jump about 1.5 days at once, the short timer still runs every time*/
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_tick_inc(0x08000000);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(10, lv_timer_handler());
+    }
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(17, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[2]);
+
+    lv_tick_inc(6);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t2);
+    lv_timer_delete(t3);
+}
+
+void test_timer_repeat_count(void)
+{
+    lv_timer_t * t1 = lv_timer_create(count_cb, 10, (void *)0);
+    lv_timer_set_repeat_count(t1, 2);
+    lv_timer_set_auto_delete(t1, false);
+
+    lv_timer_t * t2 = lv_timer_create(count_cb, 5, (void *)1);
+    lv_timer_set_repeat_count(t2, 1);
+
+    uint32_t i;
+    for(i = 0; i < 50; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_TRUE(lv_timer_get_paused(t1));
+
+    /*t2 was deleted automatically, only the paused t1 remains*/
+    TEST_ASSERT_EQUAL_UINT32(LV_NO_TIMER_READY, lv_timer_handler());
+
+    lv_timer_delete(t1);
+}
+
+void test_timer_create_delete_in_cb(void)
+{
+    created_timer = NULL;
+    lv_timer_t * t1 = lv_timer_create(create_other_cb, 10, (void *)0);
+    lv_timer_create(delete_self_cb, 10, (void *)1);
+    lv_timer_t * t3 = lv_timer_create(count_cb, 10, (void *)3);
+
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_NOT_NULL(created_timer);
+
+    /*The deleted timer doesn't run anymore and the created one runs on every call*/
+    uint32_t i;
+    for(i = 0; i < 10; i++) {
+        lv_tick_inc(1);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_cnt[3]);
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(10, run_cnt[2]);
+
+    lv_timer_delete(t1);
+    lv_timer_delete(t3);
+    lv_timer_delete(created_timer);
+}
+
+static lv_timer_t * deleted_timer;
+static lv_timer_t * readied_timer;
+static void delete_other_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_delete(deleted_timer);
+}
+
+static void ready_other_cb(lv_timer_t * t)
+{
+    count_cb(t);
+    lv_timer_ready(readied_timer);
+}
+
+void test_timer_change_due_timers_in_cb(void)
+{
+    deleted_timer = lv_timer_create(count_cb, 10, (void *)0);
+    readied_timer = lv_timer_create(count_cb, 100, (void *)1);
+    lv_timer_t * t3 = lv_timer_create(ready_other_cb, 10, (void *)2);
+    lv_timer_t * t4 = lv_timer_create(delete_other_cb, 10, (void *)3);
+
+    /*t4 runs first and deletes the due timer, then t3 makes the not due timer ready which runs in the same call*/
+    lv_tick_inc(10);
+    lv_timer_handler();
+    TEST_ASSERT_EQUAL_UINT32(0, run_cnt[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[2]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_cnt[3]);
+    TEST_ASSERT_EQUAL_UINT32(3, run_order_cnt);
+    TEST_ASSERT_EQUAL_UINT32(3, run_order[0]);
+    TEST_ASSERT_EQUAL_UINT32(2, run_order[1]);
+    TEST_ASSERT_EQUAL_UINT32(1, run_order[2]);
+
+    lv_timer_delete(readied_timer);
+    lv_timer_delete(t3);
+    lv_timer_delete(t4);
+}
+
+static uint32_t last_id;
+static bool order_ok;
+static void check_order_cb(lv_timer_t * t)
+{
+    uint32_t id = (uint32_t)(lv_uintptr_t)lv_timer_get_user_data(t);
+    if(id >= last_id) order_ok = false;
+    last_id = id;
+}
+
+void test_timer_order_many(void)
+{
+    /*Different expiries so that the heap order differs from the creation order*/
+    lv_timer_t * timers[200];
+    uint32_t i;
+    for(i = 0; i < 200; i++) {
+        timers[i] = lv_timer_create(check_order_cb, (i * 37) % 50 + 1, (void *)(lv_uintptr_t)i);
+    }
+
+    for(i = 0; i < 5; i++) {
+        lv_tick_inc(50);
+        last_id = UINT32_MAX;
+        order_ok = true;
+        lv_timer_handler();
+        TEST_ASSERT_TRUE(order_ok);
+        TEST_ASSERT_EQUAL_UINT32(0, last_id);
+    }
+
+    for(i = 0; i < 200; i++) lv_timer_delete(timers[i]);
+}
+
+static void empty_cb(lv_timer_t * t)
+{
+    LV_UNUSED(t);
+}
+
+/*Not a pass/fail test: report the cost of `lv_timer_handler()` with many idle timers
+ *(e.g. paused animations or widgets polling rarely) and a few active ones.*/
+void test_timer_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    const uint32_t timer_cnts[] = {10, 100, 500};
+    const uint32_t call_cnt = 10000;
+    lv_timer_t * timers[500];
+
+    uint32_t i;
+    for(i = 0; i < sizeof(timer_cnts) / sizeof(timer_cnts[0]); i++) {
+        uint32_t j;
+        for(j = 0; j < timer_cnts[i]; j++) {
+            /*Half of the timers are paused, the others run rarely, and a few run often*/
+            timers[j] = lv_timer_create(empty_cb, j < 4 ? 10 : 1000, NULL);
+            if(j >= 4 && j % 2) lv_timer_pause(timers[j]);
+        }
+
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        for(j = 0; j < call_cnt; j++) {
+            lv_tick_inc(1);
+            lv_timer_handler();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+
+        uint32_t ns = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000000 + (t2.tv_nsec - t1.tv_nsec));
+        TEST_PRINTF("timers: %d, heap: %d, %d ns/call", (int)timer_cnts[i], LV_USE_TIMER_HEAP, (int)(ns / call_cnt));
+
+        for(j = 0; j < timer_cnts[i]; j++) {
+            lv_timer_delete(timers[j]);
+        }
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
@@ -0,0 +1,382 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define HOR_RES     240
+#define VER_RES     240
+#define BUF_ROWS    80
+
+static uint16_t frame[HOR_RES * VER_RES];
+static uint8_t draw_buf[LV_TEST_WIDTH_TO_STRIDE(HOR_RES, 2) * BUF_ROWS + LV_DRAW_BUF_ALIGN];
+static uint32_t inv_px;
+static uint32_t flush_px;
+static bool refreshing;
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+
+extern const lv_image_dsc_t test_img_face_gif;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * HOR_RES + area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+    flush_px += lv_area_get_size(area);
+    lv_display_flush_ready(d);
+}
+
+static void disp_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_RENDER_START) refreshing = true;
+    else if(code == LV_EVENT_RENDER_READY) refreshing = false;
+    /*Areas invalidated by the widgets, not the ones used to calculate the height of the strips*/
+    else if(code == LV_EVENT_INVALIDATE_AREA && !refreshing) inv_px += lv_area_get_size(lv_event_get_param(e));
+}
+
+/*The display of the face: 240x240 RGB565 rendered in 80 rows high strips*/
+static void face_display_create(void)
+{
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, disp_event_cb, LV_EVENT_ALL, NULL);
+    lv_display_set_default(disp);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+    lv_obj_set_style_bg_color(lv_screen_active(), lv_color_black(), 0);
+    lv_refr_now(disp);
+}
+
+static void face_display_delete(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+#if LV_USE_FACE
+
+static const lv_face_params_t expressions[] = {
+    {0, 0, 255, 0, 0},          /*Neutral*/
+    {100, -40, 255, 120, 127},  /*Happy, looking up to the right*/
+    {-90, 100, 150, 0, -127},   /*Sad, looking down to the left*/
+    {0, 0, 0, 0, 0},            /*Closed*/
+};
+
+static void render_full(uint16_t * buf)
+{
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    lv_memcpy(buf, frame, sizeof(frame));
+}
+
+/*Redraw the invalidated areas and compare the result with redrawing the whole screen*/
+static void check_same_as_full_redraw(void)
+{
+    static uint16_t frame_inv[HOR_RES * VER_RES];
+    static uint16_t frame_full[HOR_RES * VER_RES];
+
+    lv_refr_now(disp);
+    lv_memcpy(frame_inv, frame, sizeof(frame));
+    render_full(frame_full);
+    TEST_ASSERT_EQUAL_MEMORY(frame_full, frame_inv, sizeof(frame));
+}
+
+static bool frames_similar(const uint16_t * a, const uint16_t * b)
+{
+    uint32_t i;
+    for(i = 0; i < HOR_RES * VER_RES; i++) {
+        int32_t dr = (a[i] >> 11) - (b[i] >> 11);
+        int32_t dg = ((a[i] >> 5) & 0x3f) - ((b[i] >> 5) & 0x3f);
+        int32_t db = (a[i] & 0x1f) - (b[i] & 0x1f);
+        if(LV_ABS(dr) > 1 || LV_ABS(dg) > 1 || LV_ABS(db) > 1) return false;
+    }
+    return true;
+}
+
+#endif
+
+void test_face_expressions(void)
+{
+#if LV_USE_FACE
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    lv_obj_set_size(face, 240, 240);
+    lv_obj_center(face);
+
+    char path[64];
+    uint32_t i;
+    for(i = 0; i < sizeof(expressions) / sizeof(expressions[0]); i++) {
+        lv_face_set_params(face, &expressions[i]);
+        lv_snprintf(path, sizeof(path), "widgets/face_%d.png", (int)i + 1);
+        TEST_ASSERT_EQUAL_SCREENSHOT(path);
+    }
+
+    /*Custom colors and size*/
+    lv_obj_set_size(face, 400, 300);
+    lv_obj_set_style_radius(face, LV_RADIUS_CIRCLE, 0);
+    lv_obj_set_style_bg_color(face, lv_palette_lighten(LV_PALETTE_ORANGE, 2), 0);
+    lv_obj_set_style_line_color(face, lv_palette_darken(LV_PALETTE_BROWN, 3), 0);
+    lv_obj_set_style_line_width(face, 10, 0);
+    lv_obj_set_style_bg_color(face, lv_palette_main(LV_PALETTE_GREEN), LV_PART_INDICATOR);
+    lv_face_set_params(face, &expressions[1]);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/face_5.png");
+#endif
+}
+
+void test_face_params(void)
+{
+#if LV_USE_FACE
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    const lv_face_params_t * p = lv_face_get_params(face);
+    TEST_ASSERT_EQUAL_UINT8(255, p->openness);
+
+    lv_face_set_gaze(face, 300, -300);
+    lv_face_set_openness(face, -5);
+    lv_face_set_squint(face, 100);
+    lv_face_set_mood(face, -200);
+    TEST_ASSERT_EQUAL_INT8(127, p->gaze_x);
+    TEST_ASSERT_EQUAL_INT8(-127, p->gaze_y);
+    TEST_ASSERT_EQUAL_UINT8(0, p->openness);
+    TEST_ASSERT_EQUAL_UINT8(100, p->squint);
+    TEST_ASSERT_EQUAL_INT8(-127, p->mood);
+
+    lv_face_params_t res;
+    lv_face_params_mix(&res, &expressions[1], &expressions[2], 0);
+    TEST_ASSERT_EQUAL_MEMORY(&expressions[1], &res, sizeof(res));
+    lv_face_params_mix(&res, &expressions[1], &expressions[2], LV_FACE_MIX_MAX);
+    TEST_ASSERT_EQUAL_MEMORY(&expressions[2], &res, sizeof(res));
+
+    res = expressions[1];
+    lv_face_params_mix(&res, &res, &expressions[2], LV_FACE_MIX_MAX / 2);
+    TEST_ASSERT_EQUAL_INT8(6, res.gaze_x);
+    TEST_ASSERT_EQUAL_UINT8(203, res.openness);
+    TEST_ASSERT_EQUAL_INT8(1, res.mood);
+#endif
+}
+
+/*Only the changed parts are invalidated but the result is the same as redrawing the whole face*/
+void test_face_invalidate(void)
+{
+#if LV_USE_FACE
+    face_display_create();
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    lv_refr_now(disp);
+
+    /*The gaze changes only the pupils: the union of the old and new pupil of each eye,
+     *the pupils move about 8 px*/
+    inv_px = 0;
+    lv_face_set_gaze(face, 60, 0);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * 25 * (25 + 8), inv_px);
+    check_same_as_full_redraw();
+
+    /*The lids change the eyes but not the mouth*/
+    inv_px = 0;
+    lv_face_set_openness(face, 100);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(2 * 56 * 72, inv_px);
+    check_same_as_full_redraw();
+
+    /*Not changed: nothing to do*/
+    inv_px = 0;
+    lv_face_set_openness(face, 100);
+    TEST_ASSERT_EQUAL_UINT32(0, inv_px);
+
+    /*Go through all kinds of changes*/
+    uint32_t i;
+    for(i = 0; i < 30; i++) {
+        lv_face_params_t p;
+        lv_face_params_mix(&p, &expressions[i % 4], &expressions[(i * 7 + 1) % 4], (i * 37) % 256);
+        lv_face_set_params(face, &p);
+        check_same_as_full_redraw();
+    }
+
+    face_display_delete();
+#endif
+}
+
+/*On an opaque background the shapes are mixed with the background directly, with a
+ *gradient they are drawn with alpha. The results should look the same.*/
+void test_face_opaque_background(void)
+{
+#if LV_USE_FACE
+    static uint16_t frame_opaque[HOR_RES * VER_RES];
+
+    face_display_create();
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    lv_obj_set_style_bg_color(face, lv_palette_darken(LV_PALETTE_BLUE, 3), 0);
+    lv_obj_set_style_bg_grad_color(face, lv_palette_darken(LV_PALETTE_BLUE, 3), 0);
+
+    uint32_t i;
+    for(i = 0; i < sizeof(expressions) / sizeof(expressions[0]); i++) {
+        lv_face_set_params(face, &expressions[i]);
+        lv_obj_set_style_bg_grad_dir(face, LV_GRAD_DIR_NONE, 0);
+        render_full(frame_opaque);
+        lv_obj_set_style_bg_grad_dir(face, LV_GRAD_DIR_VER, 0);
+        render_full(frame);
+        TEST_ASSERT_TRUE(frames_similar(frame_opaque, frame));
+    }
+
+    face_display_delete();
+#endif
+}
+
+/*The eyes of TFT_LVGL_LOTTIE/src/main.cpp: nested widgets for the white and the pupil*/
+static lv_obj_t * rig_eye_create(lv_obj_t * parent, int32_t x)
+{
+    lv_obj_t * white = lv_obj_create(parent);
+    lv_obj_set_size(white, 60, 80);
+    lv_obj_set_pos(white, x, 80);
+    lv_obj_set_style_bg_color(white, lv_color_white(), 0);
+    lv_obj_set_style_radius(white, 30, 0);
+    lv_obj_set_style_border_width(white, 2, 0);
+
+    lv_obj_t * pupil = lv_obj_create(white);
+    lv_obj_set_size(pupil, 20, 20);
+    lv_obj_center(pupil);
+    lv_obj_set_style_bg_color(pupil, lv_color_black(), 0);
+    lv_obj_set_style_radius(pupil, LV_RADIUS_CIRCLE, 0);
+    lv_obj_remove_flag(pupil, LV_OBJ_FLAG_SCROLLABLE);
+    return pupil;
+}
+
+static void look_around_anim(void * var, lv_anim_exec_xcb_t exec_cb, int32_t v1, int32_t v2)
+{
+    lv_anim_t a;
+    lv_anim_init(&a);
+    lv_anim_set_var(&a, var);
+    lv_anim_set_exec_cb(&a, exec_cb);
+    lv_anim_set_values(&a, v1, v2);
+    lv_anim_set_duration(&a, 500);
+    lv_anim_set_playback_duration(&a, 500);
+    lv_anim_set_repeat_count(&a, LV_ANIM_REPEAT_INFINITE);
+    lv_anim_set_path_cb(&a, lv_anim_path_ease_in_out);
+    lv_anim_start(&a);
+}
+
+static void scene_rig(void)
+{
+    look_around_anim(rig_eye_create(lv_screen_active(), 60), (lv_anim_exec_xcb_t)lv_obj_set_x, -10, 10);
+    look_around_anim(rig_eye_create(lv_screen_active(), 120), (lv_anim_exec_xcb_t)lv_obj_set_x, -10, 10);
+}
+
+static void scene_gif(void)
+{
+#if LV_USE_GIF
+    /*As in face.c of the firmware*/
+    lv_obj_t * gif = lv_gif_create(lv_screen_active());
+    lv_gif_set_src(gif, &test_img_face_gif);
+    lv_obj_align(gif, LV_ALIGN_CENTER, 0, 0);
+    lv_image_set_scale(gif, 700);
+#endif
+}
+
+#if LV_USE_FACE
+
+static void scene_face_look(void)
+{
+    /*The pupils of the rig move 10 px, 10/16 of the way to the edge of the eyes of the face*/
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    look_around_anim(face, (lv_anim_exec_xcb_t)lv_face_set_gaze_x, -80, 80);
+}
+
+static void scene_face_blink(void)
+{
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    look_around_anim(face, (lv_anim_exec_xcb_t)lv_face_set_openness, 255, 0);
+}
+
+static void scene_face_mood(void)
+{
+    lv_obj_t * face = lv_face_create(lv_screen_active());
+    look_around_anim(face, (lv_anim_exec_xcb_t)lv_face_set_mood, -127, 127);
+}
+
+#endif
+
+/*Print the CPU time and the redrawn pixels of 2 seconds of animation at 30 FPS with the
+ *lv_obj eye rig, the GIF face and the face widget. Only the invalidated pixels are checked.*/
+void test_face_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    typedef struct {
+        const char * name;
+        void (*create)(void);
+    } scene_t;
+
+    static const scene_t scenes[] = {
+        {"lv_obj eye rig, look around", scene_rig},
+        {"GIF face", scene_gif},
+#if LV_USE_FACE
+        {"lv_face, look around", scene_face_look},
+        {"lv_face, blink", scene_face_blink},
+        {"lv_face, mood", scene_face_mood},
+#endif
+    };
+
+    const uint32_t frame_cnt = 60;
+    uint32_t inv_px_of_scene[sizeof(scenes) / sizeof(scenes[0])];
+    face_display_create();
+
+    uint32_t s;
+    for(s = 0; s < sizeof(scenes) / sizeof(scenes[0]); s++) {
+        lv_obj_clean(lv_screen_active());
+        scenes[s].create();
+        lv_refr_now(disp);
+
+        inv_px = 0;
+        flush_px = 0;
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t f;
+        for(f = 0; f < frame_cnt; f++) {
+            lv_tick_inc(33);
+            lv_timer_handler();
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+
+        TEST_PRINTF("%s: %d us, %d px invalidated, %d px flushed per frame", scenes[s].name, (int)(us / frame_cnt),
+                    (int)(inv_px / frame_cnt), (int)(flush_px / frame_cnt));
+        TEST_ASSERT_GREATER_THAN_UINT32(0, flush_px);
+        inv_px_of_scene[s] = inv_px;
+    }
+
+#if LV_USE_FACE
+    /*Looking around invalidates less than moving the pupils of the rig*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(inv_px_of_scene[0], inv_px_of_scene[2]);
+#endif
+
+    lv_obj_clean(lv_screen_active());
+    face_display_delete();
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
@@ -0,0 +1,264 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+static lv_obj_t * face;
+static lv_face_timeline_t * tl;
+
+void setUp(void)
+{
+#if LV_USE_FACE
+    face = lv_face_create(lv_screen_active());
+    tl = lv_face_timeline_create(face);
+#endif
+}
+
+void tearDown(void)
+{
+#if LV_USE_FACE
+    if(tl) lv_face_timeline_delete(tl);
+    tl = NULL;
+#endif
+    lv_obj_clean(lv_screen_active());
+}
+
+#if LV_USE_FACE
+
+static const lv_face_keyframe_t blink_kf[] = {{0, 255}, {100, 0}, {200, 255}};
+static const lv_face_keyframe_t look_kf[] = {{0, 0}, {400, 100}};
+static const lv_face_track_t blink_tracks[] = {
+    {blink_kf, NULL, LV_FACE_PARAM_OPENNESS, 3},
+    {look_kf, NULL, LV_FACE_PARAM_GAZE_X, 2},
+};
+static const lv_face_expression_t blink_expr = {blink_tracks, 2, 0};
+static const lv_face_expression_t blink_repeat_expr = {blink_tracks, 1, 200};
+
+static const lv_face_keyframe_t happy_kf[] = {{0, 100}};
+static const lv_face_keyframe_t sad_kf[] = {{0, -100}};
+static const lv_face_keyframe_t squint_kf[] = {{0, 200}};
+static const lv_face_track_t happy_track = {happy_kf, NULL, LV_FACE_PARAM_MOOD, 1};
+static const lv_face_track_t sad_track = {sad_kf, NULL, LV_FACE_PARAM_MOOD, 1};
+static const lv_face_track_t squint_track = {squint_kf, NULL, LV_FACE_PARAM_SQUINT, 1};
+static const lv_face_expression_t happy_expr = {&happy_track, 1, 0};
+static const lv_face_expression_t sad_expr = {&sad_track, 1, 0};
+static const lv_face_expression_t squint_expr = {&squint_track, 1, 0};
+
+static uint32_t completed_cnt;
+
+static void wait(uint32_t ms)
+{
+    lv_tick_inc(ms);
+    lv_face_timeline_update(tl);
+}
+
+static const lv_face_params_t * params(void)
+{
+    return lv_face_get_params(face);
+}
+
+static void chain_cb(lv_face_timeline_t * t)
+{
+    completed_cnt++;
+    if(lv_face_timeline_get_expression(t) == &blink_expr) lv_face_timeline_play(t, &happy_expr, 100);
+}
+
+#endif
+
+void test_face_timeline_keyframes(void)
+{
+#if LV_USE_FACE
+    lv_face_timeline_play(tl, &blink_expr, 0);
+    TEST_ASSERT_EQUAL(255, params()->openness);
+    TEST_ASSERT_EQUAL(0, params()->gaze_x);
+    TEST_ASSERT_TRUE(lv_face_timeline_is_running(tl));
+
+    wait(50);
+    TEST_ASSERT_INT_WITHIN(1, 128, params()->openness);
+    TEST_ASSERT_INT_WITHIN(1, 12, params()->gaze_x);
+
+    wait(50);
+    TEST_ASSERT_EQUAL(0, params()->openness);
+    TEST_ASSERT_INT_WITHIN(1, 25, params()->gaze_x);
+
+    wait(150);
+    TEST_ASSERT_EQUAL(255, params()->openness);
+    TEST_ASSERT_TRUE(lv_face_timeline_is_running(tl));
+
+    /*Held after the last keyframe*/
+    wait(150);
+    TEST_ASSERT_EQUAL(255, params()->openness);
+    TEST_ASSERT_EQUAL(100, params()->gaze_x);
+    TEST_ASSERT_FALSE(lv_face_timeline_is_running(tl));
+
+    /*The parameters without tracks are kept*/
+    TEST_ASSERT_EQUAL(0, params()->mood);
+#endif
+}
+
+void test_face_timeline_repeat(void)
+{
+#if LV_USE_FACE
+    lv_face_timeline_play(tl, &blink_repeat_expr, 0);
+    wait(50);
+    uint8_t openness = params()->openness;
+
+    wait(200);
+    TEST_ASSERT_EQUAL(openness, params()->openness);
+    wait(2000);
+    TEST_ASSERT_EQUAL(openness, params()->openness);
+    TEST_ASSERT_TRUE(lv_face_timeline_is_running(tl));
+
+    lv_face_timeline_stop(tl);
+    TEST_ASSERT_FALSE(lv_face_timeline_is_running(tl));
+    TEST_ASSERT_NULL(lv_face_timeline_get_expression(tl));
+    wait(50);
+    TEST_ASSERT_EQUAL(openness, params()->openness);
+#endif
+}
+
+void test_face_timeline_cross_fade(void)
+{
+#if LV_USE_FACE
+    lv_face_timeline_play(tl, &happy_expr, 0);
+    TEST_ASSERT_EQUAL(100, params()->mood);
+
+    lv_face_timeline_play(tl, &sad_expr, 200);
+    TEST_ASSERT_EQUAL(100, params()->mood);
+    wait(100);
+    TEST_ASSERT_INT_WITHIN(2, 0, params()->mood);
+    TEST_ASSERT_TRUE(lv_face_timeline_is_running(tl));
+
+    /*Interrupt the cross-fade: continue from the current parameters without a jump*/
+    int8_t mood = params()->mood;
+    lv_face_timeline_play(tl, &squint_expr, 100);
+    TEST_ASSERT_EQUAL(mood, params()->mood);
+    TEST_ASSERT_EQUAL(0, params()->squint);
+    wait(50);
+    TEST_ASSERT_EQUAL(mood, params()->mood);
+    TEST_ASSERT_INT_WITHIN(2, 100, params()->squint);
+    wait(50);
+    TEST_ASSERT_EQUAL(200, params()->squint);
+    TEST_ASSERT_FALSE(lv_face_timeline_is_running(tl));
+
+    /*Fade out a running expression: it keeps playing while fading*/
+    lv_face_timeline_play(tl, &blink_repeat_expr, 0);
+    wait(50);
+    lv_face_timeline_play(tl, &happy_expr, 100);
+    wait(50);
+    TEST_ASSERT_INT_WITHIN(3, 63, params()->openness);
+    wait(50);
+    TEST_ASSERT_EQUAL(127, params()->openness);
+    TEST_ASSERT_EQUAL(100, params()->mood);
+#endif
+}
+
+void test_face_timeline_completed_cb(void)
+{
+#if LV_USE_FACE
+    completed_cnt = 0;
+    lv_face_timeline_set_completed_cb(tl, chain_cb);
+    lv_face_timeline_play(tl, &blink_expr, 0);
+
+    /*Run by the timer*/
+    uint32_t i;
+    for(i = 0; i < 14; i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL(1, completed_cnt);
+    TEST_ASSERT_EQUAL_PTR(&happy_expr, lv_face_timeline_get_expression(tl));
+    TEST_ASSERT_EQUAL(100, params()->gaze_x);
+
+    for(i = 0; i < 10; i++) {
+        lv_tick_inc(LV_DEF_REFR_PERIOD);
+        lv_timer_handler();
+    }
+    TEST_ASSERT_EQUAL(2, completed_cnt);
+    TEST_ASSERT_EQUAL(100, params()->mood);
+#endif
+}
+
+void test_face_timeline_delete_face(void)
+{
+#if LV_USE_FACE
+    lv_face_timeline_play(tl, &blink_repeat_expr, 0);
+    lv_obj_delete(face);
+    TEST_ASSERT_FALSE(lv_face_timeline_is_running(tl));
+
+    lv_tick_inc(LV_DEF_REFR_PERIOD);
+    lv_timer_handler();
+    lv_face_timeline_play(tl, &blink_expr, 0);
+    TEST_ASSERT_NULL(lv_face_timeline_get_expression(tl));
+#endif
+}
+
+#if LV_USE_FACE
+
+#define SOAK_TRACK_CNT  50
+
+static lv_face_keyframe_t soak_kf[2][SOAK_TRACK_CNT][4];
+static lv_face_track_t soak_tracks[2][SOAK_TRACK_CNT];
+
+#endif
+
+/*Interrupt two expressions of 50 tracks many times: it shouldn't allocate and print the cost of an update*/
+void test_face_timeline_soak(void)
+{
+#if LV_USE_FACE
+    lv_face_expression_t exprs[2];
+    uint32_t e;
+    uint32_t i;
+    for(e = 0; e < 2; e++) {
+        for(i = 0; i < SOAK_TRACK_CNT; i++) {
+            uint32_t k;
+            for(k = 0; k < 4; k++) {
+                soak_kf[e][i][k].time = (uint16_t)(k * 300 + i * 7);
+                soak_kf[e][i][k].value = (int16_t)((e ? -1 : 1) * (int32_t)((k * 60 + i) % 250));
+            }
+            soak_tracks[e][i].keyframes = soak_kf[e][i];
+            soak_tracks[e][i].keyframe_cnt = 4;
+            soak_tracks[e][i].param = (uint8_t)(i % 5);
+            soak_tracks[e][i].path_cb = i & 1 ? lv_anim_path_ease_in_out : NULL;
+        }
+        exprs[e].tracks = soak_tracks[e];
+        exprs[e].track_cnt = SOAK_TRACK_CNT;
+        exprs[e].period = e ? 1000 : 0;
+    }
+
+    lv_face_timeline_play(tl, &exprs[0], 0);
+    wait(10);
+
+    /*Counts every allocation, also those which are freed right after*/
+    uint32_t alloc_cnt = lv_mem_profiler_get_total()->alloc_cnt;
+
+    const uint32_t transition_cnt = 1000;
+    const uint32_t update_per_transition = 10;
+#if LV_USE_OS == LV_OS_PTHREAD
+    struct timespec t1, t2;
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+#endif
+    for(i = 0; i < transition_cnt; i++) {
+        /*Mostly interrupted in the middle of the cross-fade*/
+        lv_face_timeline_play(tl, &exprs[i & 1], 150);
+        uint32_t u;
+        for(u = 0; u < update_per_transition; u++) wait(i % 17 + 1);
+    }
+#if LV_USE_OS == LV_OS_PTHREAD
+    clock_gettime(CLOCK_MONOTONIC, &t2);
+    uint64_t ns = (uint64_t)(t2.tv_sec - t1.tv_sec) * 1000000000 + (t2.tv_nsec - t1.tv_nsec);
+    TEST_PRINTF("%d tracks: %d ns per update", SOAK_TRACK_CNT, (int)(ns / (transition_cnt * update_per_transition)));
+#endif
+
+    TEST_ASSERT_EQUAL_UINT32(alloc_cnt, lv_mem_profiler_get_total()->alloc_cnt);
+
+    TEST_ASSERT_TRUE(lv_face_timeline_is_running(tl));
+#endif
+}
+
+#endif
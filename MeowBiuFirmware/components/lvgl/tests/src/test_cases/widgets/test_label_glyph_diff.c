@@ -0,0 +1,297 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define HOR_RES     240
+#define VER_RES     240
+#define BUF_ROWS    80
+#define CELL_PX     (16 * 17) /*A glyph cell of unscii_16: 16 px wide and 17 px high lines*/
+
+static uint16_t frame[HOR_RES * VER_RES];
+static uint8_t draw_buf[LV_TEST_WIDTH_TO_STRIDE(HOR_RES, 2) * BUF_ROWS + LV_DRAW_BUF_ALIGN];
+static uint32_t inv_px;
+static bool refreshing;
+static lv_display_t * disp;
+static lv_display_t * disp_default;
+
+static void flush_cb(lv_display_t * d, const lv_area_t * area, uint8_t * px_map)
+{
+    int32_t w = lv_area_get_width(area);
+    uint32_t stride = lv_draw_buf_width_to_stride(w, LV_COLOR_FORMAT_RGB565);
+    int32_t y;
+    for(y = area->y1; y <= area->y2; y++) {
+        lv_memcpy(&frame[y * HOR_RES + area->x1], px_map, w * 2);
+        px_map += stride;
+    }
+    lv_display_flush_ready(d);
+}
+
+static void disp_event_cb(lv_event_t * e)
+{
+    lv_event_code_t code = lv_event_get_code(e);
+    if(code == LV_EVENT_RENDER_START) refreshing = true;
+    else if(code == LV_EVENT_RENDER_READY) refreshing = false;
+    else if(code == LV_EVENT_INVALIDATE_AREA && !refreshing) inv_px += lv_area_get_size(lv_event_get_param(e));
+}
+
+void setUp(void)
+{
+    disp_default = lv_display_get_default();
+    disp = lv_display_create(HOR_RES, VER_RES);
+    lv_display_set_color_format(disp, LV_COLOR_FORMAT_RGB565);
+    lv_display_set_buffers(disp, lv_draw_buf_align(draw_buf, LV_COLOR_FORMAT_RGB565), NULL,
+                           lv_draw_buf_width_to_stride(HOR_RES, LV_COLOR_FORMAT_RGB565) * BUF_ROWS,
+                           LV_DISPLAY_RENDER_MODE_PARTIAL);
+    lv_display_set_flush_cb(disp, flush_cb);
+    lv_display_add_event_cb(disp, disp_event_cb, LV_EVENT_ALL, NULL);
+    lv_display_set_default(disp);
+#if LV_USE_PERF_MONITOR
+    lv_sysmon_hide_performance(disp);
+#endif
+#if LV_USE_MEM_MONITOR
+    lv_sysmon_hide_memory(disp);
+#endif
+
+    /*A gradient to see that only the glyphs are redrawn*/
+    lv_obj_t * scr = lv_screen_active();
+    lv_obj_set_style_bg_color(scr, lv_color_hex(0x102040), 0);
+    lv_obj_set_style_bg_grad_color(scr, lv_color_hex(0x804010), 0);
+    lv_obj_set_style_bg_grad_dir(scr, LV_GRAD_DIR_HOR, 0);
+    lv_refr_now(disp);
+}
+
+void tearDown(void)
+{
+    lv_display_set_default(disp_default);
+    lv_display_delete(disp);
+}
+
+static lv_obj_t * label_create(const lv_font_t * font, const char * text)
+{
+    lv_obj_t * label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_font(label, font, 0);
+    lv_obj_set_style_text_color(label, lv_color_white(), 0);
+    lv_label_set_glyph_diff(label, true);
+    lv_label_set_text(label, text);
+    lv_obj_center(label);
+    lv_refr_now(disp);
+    inv_px = 0;
+    return label;
+}
+
+/*The pixels invalidated by a label which redraws all of its text*/
+static uint32_t get_label_px(lv_obj_t * label)
+{
+    lv_area_t a;
+    lv_obj_get_coords(label, &a);
+    int32_t ext = lv_obj_get_ext_draw_size(label);
+    lv_area_increase(&a, ext, ext);
+    return lv_area_get_size(&a);
+}
+
+/*Redraw the invalidated areas and compare the result with redrawing the whole screen*/
+static void check_same_as_full_redraw(void)
+{
+    static uint16_t frame_inv[HOR_RES * VER_RES];
+
+    lv_refr_now(disp);
+    lv_memcpy(frame_inv, frame, sizeof(frame));
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(frame, frame_inv, sizeof(frame));
+}
+
+void test_label_glyph_diff_one_digit(void)
+{
+    lv_obj_t * label = label_create(&lv_font_unscii_16, "12:58");
+    uint32_t label_px = get_label_px(label);
+
+    lv_label_set_text(label, "12:59");
+    TEST_ASSERT_EQUAL_UINT32(CELL_PX, inv_px);
+    TEST_PRINTF("12:58 -> 12:59: %" LV_PRIu32 " px invalidated instead of %" LV_PRIu32, inv_px, label_px);
+    check_same_as_full_redraw();
+
+    /*Three cells changed, the colon between them is kept*/
+    inv_px = 0;
+    lv_label_set_text(label, "13:00");
+    TEST_ASSERT_EQUAL_UINT32(3 * CELL_PX, inv_px);
+    check_same_as_full_redraw();
+
+    /*Nothing changed*/
+    inv_px = 0;
+    lv_label_set_text(label, "13:00");
+    TEST_ASSERT_EQUAL_UINT32(0, inv_px);
+}
+
+void test_label_glyph_diff_fmt(void)
+{
+    lv_obj_t * label = label_create(&lv_font_unscii_16, "");
+    lv_label_set_text_fmt(label, "%02d:%02d", 9, 59);
+    lv_refr_now(disp);
+
+    inv_px = 0;
+    lv_label_set_text_fmt(label, "%02d:%02d", 10, 0);
+    TEST_ASSERT_EQUAL_UINT32(4 * CELL_PX, inv_px);
+    check_same_as_full_redraw();
+}
+
+void test_label_glyph_diff_proportional_font(void)
+{
+    /*The glyphs of 6 and 9 have the same width in Montserrat*/
+    lv_obj_t * label = label_create(&lv_font_montserrat_48, "12:56");
+    uint32_t label_px = get_label_px(label);
+
+    lv_label_set_text(label, "12:59");
+    TEST_ASSERT_NOT_EQUAL(0, inv_px);
+    TEST_ASSERT_LESS_THAN_UINT32(label_px / 3, inv_px);
+    TEST_PRINTF("12:56 -> 12:59: %" LV_PRIu32 " px invalidated instead of %" LV_PRIu32, inv_px, label_px);
+    check_same_as_full_redraw();
+
+    /*8 is wider so the label changes its size and it's redrawn*/
+    inv_px = 0;
+    lv_label_set_text(label, "12:58");
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(label_px, inv_px);
+    check_same_as_full_redraw();
+}
+
+void test_label_glyph_diff_size_change(void)
+{
+    lv_obj_t * label = label_create(&lv_font_unscii_16, "99%");
+    uint32_t label_px = get_label_px(label);
+
+    lv_label_set_text(label, "100%");
+    TEST_ASSERT_GREATER_OR_EQUAL_UINT32(label_px, inv_px);
+    check_same_as_full_redraw();
+
+    /*Multi line texts are always redrawn*/
+    lv_label_set_text(label, "12\n34");
+    lv_refr_now(disp);
+    label_px = get_label_px(label);
+    inv_px = 0;
+    lv_label_set_text(label, "12\n35");
+    TEST_ASSERT_EQUAL_UINT32(label_px, inv_px);
+    check_same_as_full_redraw();
+}
+
+void test_label_glyph_diff_disabled(void)
+{
+    lv_obj_t * label = label_create(&lv_font_unscii_16, "12:58");
+    lv_label_set_glyph_diff(label, false);
+    TEST_ASSERT_FALSE(lv_label_get_glyph_diff(label));
+    uint32_t label_px = get_label_px(label);
+
+    lv_label_set_text(label, "12:59");
+    TEST_ASSERT_EQUAL_UINT32(label_px, inv_px);
+    check_same_as_full_redraw();
+}
+
+void test_label_glyph_diff_aligned(void)
+{
+    lv_obj_t * label = label_create(&lv_font_montserrat_48, "56");
+    lv_obj_set_width(label, 200);
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_RIGHT, 0);
+    lv_refr_now(disp);
+
+    inv_px = 0;
+    lv_label_set_text(label, "59");
+    TEST_ASSERT_NOT_EQUAL(0, inv_px);
+    TEST_ASSERT_LESS_THAN_UINT32(get_label_px(label) / 4, inv_px);
+    check_same_as_full_redraw();
+
+    lv_obj_set_style_text_align(label, LV_TEXT_ALIGN_CENTER, 0);
+    lv_refr_now(disp);
+    inv_px = 0;
+    lv_label_set_text(label, "96");
+    TEST_ASSERT_NOT_EQUAL(0, inv_px);
+    check_same_as_full_redraw();
+}
+
+void test_label_glyph_diff_bind(void)
+{
+#if LV_USE_OBSERVER
+    lv_subject_t subject;
+    lv_subject_init_int(&subject, 57);
+
+    lv_obj_t * label = label_create(&lv_font_unscii_16, "");
+    lv_label_bind_text(label, &subject, "%d%%");
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_STRING("57%", lv_label_get_text(label));
+
+    inv_px = 0;
+    lv_subject_set_int(&subject, 58);
+    TEST_ASSERT_EQUAL_UINT32(CELL_PX, inv_px);
+    check_same_as_full_redraw();
+
+    inv_px = 0;
+    lv_subject_set_int(&subject, 60);
+    TEST_ASSERT_EQUAL_UINT32(2 * CELL_PX, inv_px);
+    check_same_as_full_redraw();
+
+    lv_obj_delete(label);
+    lv_subject_deinit(&subject);
+#endif
+}
+
+void test_label_glyph_cache(void)
+{
+    static uint16_t frame_ref[HOR_RES * VER_RES];
+    const lv_font_t * fonts[] = {&lv_font_montserrat_48, &lv_font_montserrat_28_compressed, &lv_font_unscii_16};
+    const char * texts[] = {"12:56", "12:59", "13:00", "100%"};
+
+    uint32_t i;
+    for(i = 0; i < sizeof(fonts) / sizeof(fonts[0]); i++) {
+        lv_obj_t * label = label_create(fonts[i], texts[0]);
+        lv_obj_set_style_text_color(label, lv_color_hex(0xffc020), 0);
+        lv_obj_set_style_text_opa(label, LV_OPA_80, 0);
+        lv_obj_set_style_text_letter_space(label, 2, 0);
+
+        uint32_t t;
+        for(t = 0; t < sizeof(texts) / sizeof(texts[0]); t++) {
+            lv_label_set_glyph_cache(label, false);
+            lv_label_set_text(label, texts[t]);
+            lv_obj_invalidate(lv_screen_active());
+            lv_refr_now(disp);
+            lv_memcpy(frame_ref, frame, sizeof(frame));
+
+            lv_label_set_glyph_cache(label, true);
+            TEST_ASSERT_TRUE(lv_label_get_glyph_cache(label));
+            lv_refr_now(disp);
+            TEST_ASSERT_NOT_NULL(((lv_label_t *)label)->glyph_buf);
+            TEST_ASSERT_EQUAL_MEMORY(frame_ref, frame, sizeof(frame));
+
+            /*The glyphs are drawn from the cache in the next frames too*/
+            check_same_as_full_redraw();
+            TEST_ASSERT_EQUAL_MEMORY(frame_ref, frame, sizeof(frame));
+        }
+
+        lv_obj_delete(label);
+    }
+}
+
+void test_label_glyph_cache_clip(void)
+{
+    static uint16_t frame_ref[HOR_RES * VER_RES];
+
+    lv_obj_t * label = label_create(&lv_font_montserrat_48, "12:59");
+    lv_label_set_long_mode(label, LV_LABEL_LONG_MODE_CLIP);
+    lv_obj_set_size(label, 80, 30);
+    lv_obj_invalidate(lv_screen_active());
+    lv_refr_now(disp);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+
+    lv_label_set_glyph_cache(label, true);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(frame_ref, frame, sizeof(frame));
+
+    /*The decoration is drawn by the label, so it's drawn without the cache*/
+    lv_obj_set_style_text_decor(label, LV_TEXT_DECOR_UNDERLINE, 0);
+    lv_refr_now(disp);
+    lv_memcpy(frame_ref, frame, sizeof(frame));
+    lv_label_set_glyph_cache(label, false);
+    lv_refr_now(disp);
+    TEST_ASSERT_EQUAL_MEMORY(frame_ref, frame, sizeof(frame));
+}
+
+#endif
@@ -0,0 +1,226 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+    /*From sanitizer/allocator_interface.h which is not always installed*/
+    int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                                  void (*free_hook)(const volatile void *));
+    size_t __sanitizer_get_allocated_size(const volatile void * p);
+    #define COUNT_HEAP      1
+#else
+    #define COUNT_HEAP      0
+#endif
+
+/*Size of the header written by scripts/lottie_compiler.py*/
+#define BIN_HEADER_SIZE 36
+
+static uint32_t buf[LV_TEST_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
+
+extern const uint8_t test_lottie_approve_bin[];
+extern const size_t test_lottie_approve_bin_size;
+extern const uint8_t test_lottie_empty_json[];
+extern const size_t test_lottie_empty_json_size;
+extern const uint8_t test_lottie_empty_bin[];
+extern const size_t test_lottie_empty_bin_size;
+extern const uint8_t test_lottie_arrow_json[];
+extern const size_t test_lottie_arrow_json_size;
+extern const uint8_t test_lottie_arrow_bin[];
+extern const size_t test_lottie_arrow_bin_size;
+
+/*Due to different floating point precision
+ *the rendered images are slightly different on different architectures
+ *So compare the screenshots only on AMD64*/
+#ifdef NON_AMD64_BUILD
+    #undef TEST_ASSERT_EQUAL_SCREENSHOT
+    #define TEST_ASSERT_EQUAL_SCREENSHOT(path) (void) path
+#endif
+
+#if COUNT_HEAP
+static volatile bool count_heap;
+static int64_t heap_cur;
+static int64_t heap_peak;
+
+static void malloc_hook(const volatile void * ptr, size_t size)
+{
+    LV_UNUSED(ptr);
+    if(!count_heap) return;
+    heap_cur += size;
+    if(heap_cur > heap_peak) heap_peak = heap_cur;
+}
+
+static void free_hook(const volatile void * ptr)
+{
+    if(!count_heap || ptr == NULL) return;
+    heap_cur -= __sanitizer_get_allocated_size(ptr);
+}
+#endif
+
+void setUp(void)
+{
+    static bool hooks_installed = false;
+#if COUNT_HEAP
+    if(!hooks_installed) {
+        __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+        hooks_installed = true;
+    }
+#else
+    LV_UNUSED(hooks_installed);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+void test_lottie_bin_renders_like_json(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve_bin, test_lottie_approve_bin_size);
+    lv_obj_center(lottie);
+
+    /*The same screenshots as the JSON in test_lottie.c*/
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_2.png");
+
+    lv_test_fast_forward(750);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_3.png");
+}
+
+void test_lottie_bin_header(void)
+{
+    Tvg_Animation * anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(anim);
+    TEST_ASSERT_EQUAL(TVG_RESULT_SUCCESS, tvg_picture_load_data(picture, (const char *)test_lottie_arrow_bin,
+                                                                test_lottie_arrow_bin_size, "lottie", false));
+
+    float w, h, frames, duration;
+    tvg_picture_get_size(picture, &w, &h);
+    tvg_animation_get_total_frame(anim, &frames);
+    tvg_animation_get_duration(anim, &duration);
+    TEST_ASSERT_EQUAL_FLOAT(500, w);
+    TEST_ASSERT_EQUAL_FLOAT(500, h);
+    TEST_ASSERT_EQUAL_FLOAT(34, frames);
+    TEST_ASSERT_EQUAL_FLOAT(34.0f / 30.0f, duration);
+
+    tvg_animation_del(anim);
+}
+
+void test_lottie_bin_invalid(void)
+{
+    uint8_t * data = lv_malloc(test_lottie_arrow_bin_size);
+    TEST_ASSERT_NOT_NULL(data);
+
+    Tvg_Animation * anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(anim);
+
+    /*Truncated*/
+    TEST_ASSERT_NOT_EQUAL(TVG_RESULT_SUCCESS, tvg_picture_load_data(picture, (const char *)test_lottie_arrow_bin,
+                                                                    test_lottie_arrow_bin_size - 1, "lottie", false));
+
+    /*Unknown token at the start of the stream*/
+    lv_memcpy(data, test_lottie_arrow_bin, test_lottie_arrow_bin_size);
+    data[BIN_HEADER_SIZE] = 0xff;
+    TEST_ASSERT_NOT_EQUAL(TVG_RESULT_SUCCESS, tvg_picture_load_data(picture, (const char *)data,
+                                                                    test_lottie_arrow_bin_size, "lottie", false));
+
+    /*Unterminated string table*/
+    lv_memcpy(data, test_lottie_arrow_bin, test_lottie_arrow_bin_size);
+    data[test_lottie_arrow_bin_size - 1] = 'x';
+    TEST_ASSERT_NOT_EQUAL(TVG_RESULT_SUCCESS, tvg_picture_load_data(picture, (const char *)data,
+                                                                    test_lottie_arrow_bin_size, "lottie", false));
+
+    /*Any corrupted byte shouldn't crash*/
+    uint32_t i;
+    for(i = BIN_HEADER_SIZE; i < test_lottie_arrow_bin_size; i += 7) {
+        lv_memcpy(data, test_lottie_arrow_bin, test_lottie_arrow_bin_size);
+        data[i] ^= 0x5a;
+        tvg_picture_load_data(picture, (const char *)data, test_lottie_arrow_bin_size, "lottie", false);
+    }
+
+    tvg_animation_del(anim);
+    lv_free(data);
+}
+
+void test_lottie_bin_memory_leak(void)
+{
+    size_t mem_before = lv_test_get_free_mem();
+
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+        lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+        lv_lottie_set_src_data(lottie, test_lottie_approve_bin, test_lottie_approve_bin_size);
+        lv_test_fast_forward(753 * i);
+        lv_obj_delete(lottie);
+    }
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 16);
+}
+
+/*Not a pass/fail test: print the load time and heap peak of the JSON and the pre-parsed data*/
+void test_lottie_bin_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    static const struct {
+        const char * name;
+        const uint8_t * data;
+        const size_t * size;
+        bool copy;
+    } srcs[] = {
+        {"Test2.json", test_lottie_empty_json, &test_lottie_empty_json_size, true},
+        {"Test2 pre-parsed", test_lottie_empty_bin, &test_lottie_empty_bin_size, false},
+        {"TestD.json", test_lottie_arrow_json, &test_lottie_arrow_json_size, true},
+        {"TestD pre-parsed", test_lottie_arrow_bin, &test_lottie_arrow_bin_size, false},
+    };
+
+    const uint32_t load_cnt = 50;
+    uint32_t s;
+    for(s = 0; s < sizeof(srcs) / sizeof(srcs[0]); s++) {
+        /*Parsing and building the scene happen in the load as ThorVG has no threads*/
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t i;
+        for(i = 0; i < load_cnt; i++) {
+            Tvg_Animation * anim = tvg_animation_new();
+            tvg_picture_load_data(tvg_animation_get_picture(anim), (const char *)srcs[s].data, *srcs[s].size,
+                                  "lottie", srcs[s].copy);
+            tvg_animation_del(anim);
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+
+        Tvg_Animation * anim = tvg_animation_new();
+#if COUNT_HEAP
+        heap_cur = 0;
+        heap_peak = 0;
+        count_heap = true;
+#endif
+        Tvg_Result res = tvg_picture_load_data(tvg_animation_get_picture(anim), (const char *)srcs[s].data,
+                                               *srcs[s].size, "lottie", srcs[s].copy);
+#if COUNT_HEAP
+        count_heap = false;
+        int32_t peak = (int32_t)heap_peak;
+        int32_t kept = (int32_t)heap_cur;
+#else
+        int32_t peak = 0;
+        int32_t kept = 0;
+#endif
+        tvg_animation_del(anim);
+
+        TEST_PRINTF("%s: %d bytes, %s, %d us/load, heap peak %d bytes, %d bytes kept", srcs[s].name, (int)*srcs[s].size,
+                    res == TVG_RESULT_SUCCESS ? "loaded" : "not loaded", (int)(us / load_cnt), (int)peak, (int)kept);
+    }
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
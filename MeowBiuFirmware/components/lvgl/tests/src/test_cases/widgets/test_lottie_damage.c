@@ -0,0 +1,152 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#define FACE_W  200
+#define FACE_H  100
+
+/*Two stroked eyes, the right one blinks between frame 10 and 20*/
+static const char face_json[] =
+    "{\"v\":\"5.7.0\",\"fr\":30,\"ip\":0,\"op\":30,\"w\":200,\"h\":100,\"layers\":["
+    "{\"ty\":4,\"ind\":1,\"ip\":0,\"op\":30,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"p\":{\"a\":0,\"k\":[50,50,0]},"
+    "\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":0,\"k\":[100,100,100]}},"
+    "\"shapes\":[{\"ty\":\"el\",\"p\":{\"a\":0,\"k\":[0,0]},\"s\":{\"a\":0,\"k\":[50,70]}},"
+    "{\"ty\":\"st\",\"c\":{\"a\":0,\"k\":[0,0,0,1]},\"o\":{\"a\":0,\"k\":100},\"w\":{\"a\":0,\"k\":6},\"lc\":2,\"lj\":1},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[0.2,0.4,0.9,1]},\"o\":{\"a\":0,\"k\":100}}]},"
+    "{\"ty\":4,\"ind\":2,\"ip\":0,\"op\":30,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"p\":{\"a\":0,\"k\":[150,50,0]},"
+    "\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":1,\"k\":["
+    "{\"t\":10,\"s\":[100,100,100],\"i\":{\"x\":[0.5],\"y\":[0.5]},\"o\":{\"x\":[0.5],\"y\":[0.5]}},"
+    "{\"t\":15,\"s\":[100,10,100],\"i\":{\"x\":[0.5],\"y\":[0.5]},\"o\":{\"x\":[0.5],\"y\":[0.5]}},"
+    "{\"t\":20,\"s\":[100,100,100]}]}},"
+    "\"shapes\":[{\"ty\":\"el\",\"p\":{\"a\":0,\"k\":[0,0]},\"s\":{\"a\":0,\"k\":[50,70]}},"
+    "{\"ty\":\"st\",\"c\":{\"a\":0,\"k\":[0,0,0,1]},\"o\":{\"a\":0,\"k\":100},\"w\":{\"a\":0,\"k\":6},\"lc\":2,\"lj\":1},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[0.2,0.4,0.9,1]},\"o\":{\"a\":0,\"k\":100}}]}"
+    "]}";
+
+static uint32_t buf_tracked[LV_TEST_WIDTH_TO_STRIDE(FACE_W, 4) * FACE_H + LV_DRAW_BUF_ALIGN];
+
+static lv_area_t inv_area;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Render the whole frame with a new ThorVG canvas*/
+static void render_reference(lv_draw_buf_t * draw_buf, float frame)
+{
+    lv_draw_buf_clear(draw_buf, NULL);
+
+    Tvg_Canvas * canvas = tvg_swcanvas_create();
+    Tvg_Animation * anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(anim);
+    tvg_swcanvas_set_target(canvas, (uint32_t *)draw_buf->data, draw_buf->header.stride / 4, FACE_W, FACE_H,
+                            TVG_COLORSPACE_ARGB8888);
+    tvg_canvas_push(canvas, picture);
+    tvg_picture_load_data(picture, face_json, sizeof(face_json), "lottie", true);
+    tvg_picture_set_size(picture, FACE_W, FACE_H);
+
+    tvg_animation_set_frame(anim, frame);
+    tvg_canvas_update(canvas);
+    tvg_canvas_draw(canvas);
+    tvg_canvas_sync(canvas);
+
+    tvg_animation_del(anim);
+    tvg_canvas_destroy(canvas);
+}
+
+static lv_obj_t * face_create(uint32_t * buf)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, FACE_W, FACE_H, buf);
+    lv_lottie_set_src_data(lottie, face_json, sizeof(face_json));
+    return lottie;
+}
+
+static void invalidate_area_cb(lv_event_t * e)
+{
+    lv_area_t * area = lv_event_get_param(e);
+    if(inv_area.x2 < inv_area.x1) inv_area = *area;
+    else lv_area_join(&inv_area, &inv_area, area);
+}
+
+void test_lottie_damage_renders_the_same(void)
+{
+    lv_obj_t * tracked = face_create(buf_tracked);
+    lv_obj_align(tracked, LV_ALIGN_TOP_LEFT, 10, 10);
+
+    lv_draw_buf_t * draw_buf_tracked = lv_canvas_get_draw_buf(tracked);
+    lv_draw_buf_t * draw_buf_ref = lv_draw_buf_create(FACE_W, FACE_H, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED,
+                                                      draw_buf_tracked->header.stride);
+    TEST_ASSERT_NOT_NULL(draw_buf_ref);
+    uint32_t size = draw_buf_tracked->header.stride * FACE_H;
+
+    /*Loading the source draws both eyes, wait for the next frame of the 30 FPS animation*/
+    lv_test_fast_forward(2 * 1000 / 30);
+
+    uint32_t frame_cnt = 0;
+    uint32_t px_sum = 0;
+    uint32_t unchanged_cnt = 0;
+    float last_frame = -1;
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_test_fast_forward(1000 / 60);
+
+        float frame;
+        tvg_animation_get_frame(((lv_lottie_t *)tracked)->tvg_anim, &frame);
+        if(frame == last_frame) continue;
+        last_frame = frame;
+        frame_cnt++;
+
+        render_reference(draw_buf_ref, frame);
+        TEST_ASSERT_EQUAL_MEMORY(draw_buf_ref->data, draw_buf_tracked->data, size);
+
+        /*Only the blinking right eye is redrawn*/
+        lv_area_t * area = &((lv_lottie_t *)tracked)->rendered_area;
+        uint32_t px = lv_area_get_size(area);
+        if(px == 0) unchanged_cnt++;
+        else TEST_ASSERT_GREATER_OR_EQUAL_INT32(FACE_W / 2, area->x1);
+        px_sum += px;
+    }
+
+    TEST_ASSERT_GREATER_THAN_UINT32(0, unchanged_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(frame_cnt * FACE_W * FACE_H / 4, px_sum);
+
+    TEST_PRINTF("rasterized pixels per frame: %d (full frame: %d)", (int)(px_sum / frame_cnt), FACE_W * FACE_H);
+
+    lv_draw_buf_destroy(draw_buf_ref);
+}
+
+void test_lottie_damage_invalidates_the_rendered_area(void)
+{
+    lv_obj_t * tracked = face_create(buf_tracked);
+    lv_obj_align(tracked, LV_ALIGN_TOP_LEFT, 30, 40);
+    lv_refr_now(NULL);
+
+    lv_display_t * disp = lv_display_get_default();
+    lv_display_add_event_cb(disp, invalidate_area_cb, LV_EVENT_INVALIDATE_AREA, NULL);
+
+    lv_lottie_t * lottie = (lv_lottie_t *)tracked;
+    uint32_t i;
+    for(i = 0; i < 60; i++) {
+        lv_area_set(&inv_area, 0, 0, -1, -1);
+        lv_test_fast_forward(1000 / 60);
+        if(inv_area.x2 < inv_area.x1) continue;
+
+        lv_area_t expected = lottie->rendered_area;
+        lv_area_move(&expected, tracked->coords.x1, tracked->coords.y1);
+        TEST_ASSERT_TRUE(lv_area_is_in(&inv_area, &expected, 0));
+    }
+
+    lv_display_remove_event_cb_with_user_data(disp, invalidate_area_cb, NULL);
+}
+
+#endif
@@ -0,0 +1,133 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+/*The arrow animation has 34 frames at 30 FPS*/
+#define ARROW_DURATION  (34 * 1000 / 30)
+#define SLOW_RENDER_MS  40
+
+static uint32_t buf[LV_TEST_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
+
+extern const uint8_t test_lottie_arrow_json[];
+extern const size_t test_lottie_arrow_json_size;
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+static uint32_t render_cnt;
+static bool slow_render;
+static bool completed;
+static lv_anim_exec_xcb_t lottie_exec_cb;
+
+/*Count the rendered frames. With `slow_render` rendering a frame takes SLOW_RENDER_MS*/
+static void render_cb(void * var, int32_t v)
+{
+    lv_lottie_t * lottie = var;
+    int32_t prev_frame = lottie->rendered_frame;
+    lottie_exec_cb(var, v);
+    if(lottie->rendered_frame == prev_frame) return;
+
+    render_cnt++;
+    if(slow_render) lv_tick_inc(SLOW_RENDER_MS);
+}
+
+static void completed_cb(lv_anim_t * a)
+{
+    LV_UNUSED(a);
+    completed = true;
+}
+
+static lv_obj_t * arrow_create(void)
+{
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_arrow_json, test_lottie_arrow_json_size);
+    lv_obj_center(lottie);
+
+    lv_anim_t * a = lv_lottie_get_anim(lottie);
+    lottie_exec_cb = a->exec_cb;
+    a->exec_cb = render_cb;
+    return lottie;
+}
+
+/*Play the animation once, return the elapsed time. `render_cnt` is the number of frames rendered meanwhile.*/
+static uint32_t play_once(lv_obj_t * obj, uint32_t step)
+{
+    lv_lottie_t * lottie = (lv_lottie_t *)obj;
+    int32_t end_value = lottie->anim->end_value;
+    lv_anim_set_repeat_count(lottie->anim, 1);
+    lv_anim_set_completed_cb(lottie->anim, completed_cb);
+    lv_refr_now(NULL);
+
+    uint32_t start = lv_tick_get();
+    render_cnt = 0;
+    completed = false;
+    while(!completed) {
+        lv_test_fast_forward(step);
+        TEST_ASSERT_LESS_THAN_UINT32(3 * ARROW_DURATION, lv_tick_elaps(start));
+    }
+
+    /*The last frame is rendered even if there was no time to render the previous ones*/
+    TEST_ASSERT_EQUAL_INT32(end_value, lottie->rendered_frame);
+    return lv_tick_elaps(start);
+}
+
+void test_lottie_fps_duration_of_the_source(void)
+{
+    lv_obj_t * lottie = arrow_create();
+
+    TEST_ASSERT_EQUAL_UINT32(ARROW_DURATION, lv_anim_get_time(lv_lottie_get_anim(lottie)));
+    TEST_ASSERT_EQUAL_UINT32(30, lv_lottie_get_target_fps(lottie));
+}
+
+void test_lottie_fps_slow_render_skips_frames(void)
+{
+    lv_obj_t * lottie = arrow_create();
+
+    slow_render = true;
+    uint32_t t = play_once(lottie, 10);
+    slow_render = false;
+    TEST_PRINTF("slow rendering: %d frames in %d ms, %d FPS", (int)render_cnt, (int)t,
+                (int)lv_lottie_get_achieved_fps(lottie));
+
+    /*The duration is kept by skipping frames*/
+    TEST_ASSERT_UINT32_WITHIN(SLOW_RENDER_MS * 2, ARROW_DURATION + SLOW_RENDER_MS, t);
+    /*The renders took most of the time, there was no time for all the frames*/
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(t / SLOW_RENDER_MS, render_cnt);
+    TEST_ASSERT_LESS_THAN_UINT32(34, render_cnt);
+
+    uint32_t fps = lv_lottie_get_achieved_fps(lottie);
+    TEST_ASSERT_GREATER_THAN_UINT32(0, fps);
+    TEST_ASSERT_LESS_THAN_UINT32(lv_lottie_get_target_fps(lottie), fps);
+}
+
+void test_lottie_fps_max_fps(void)
+{
+    lv_obj_t * lottie = arrow_create();
+    lv_lottie_set_max_fps(lottie, 10);
+    TEST_ASSERT_EQUAL_UINT32(10, lv_lottie_get_target_fps(lottie));
+
+    uint32_t t = play_once(lottie, 1000 / 60);
+    TEST_PRINTF("limited to 10 FPS: %d frames in %d ms", (int)render_cnt, (int)t);
+
+    TEST_ASSERT_UINT32_WITHIN(LV_DEF_REFR_PERIOD * 2, ARROW_DURATION, t);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT32(ARROW_DURATION / 100 + 1, render_cnt);
+
+    /*Without the limit all frames are rendered*/
+    lv_obj_delete(lottie);
+    lottie = arrow_create();
+    TEST_ASSERT_EQUAL_UINT32(30, lv_lottie_get_target_fps(lottie));
+    t = play_once(lottie, 1000 / 60);
+    TEST_PRINTF("not limited: %d frames in %d ms", (int)render_cnt, (int)t);
+    TEST_ASSERT_GREATER_THAN_UINT32(ARROW_DURATION / 100 + 1, render_cnt);
+}
+
+#endif
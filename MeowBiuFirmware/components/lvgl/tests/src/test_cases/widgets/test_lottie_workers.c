@@ -0,0 +1,153 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#define ARROW_SIZE      500
+
+static uint32_t buf[LV_TEST_WIDTH_TO_STRIDE(100, 4) * 100 + LV_DRAW_BUF_ALIGN];
+static uint32_t arrow_buf[ARROW_SIZE * ARROW_SIZE];
+
+extern const uint8_t test_lottie_approve[];
+extern const size_t test_lottie_approve_size;
+extern const uint8_t test_lottie_arrow_json[];
+extern const size_t test_lottie_arrow_json_size;
+
+/*Due to different floating point precision
+ *the rendered images are slightly different on different architectures
+ *So compare the screenshots only on AMD64*/
+#ifdef NON_AMD64_BUILD
+    #undef TEST_ASSERT_EQUAL_SCREENSHOT
+    #define TEST_ASSERT_EQUAL_SCREENSHOT(path) (void) path
+#endif
+
+/*Restart ThorVG with `cnt` worker threads. No ThorVG canvas can exist at this point.*/
+static void set_worker_cnt(uint32_t cnt)
+{
+    /*The canvases of the SW draw units have memory pools for the current number of workers*/
+    lv_draw_unit_t * u = LV_GLOBAL_DEFAULT()->draw_info.unit_head;
+    while(u) {
+        if(lv_streq(u->name, "SW")) {
+            lv_draw_sw_unit_t * sw_unit = (lv_draw_sw_unit_t *)u;
+            uint32_t i;
+            for(i = 0; i < LV_DRAW_SW_DRAW_UNIT_CNT; i++) {
+                lv_draw_sw_vector_ctx_deinit(&sw_unit->vector_ctxs[i]);
+            }
+        }
+        u = u->next;
+    }
+
+    tvg_engine_term(TVG_ENGINE_SW);
+    tvg_engine_init(TVG_ENGINE_SW, cnt);
+}
+
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+    set_worker_cnt(LV_THORVG_WORKER_CNT);
+}
+
+static uint32_t hash_buf(const uint32_t * data, uint32_t cnt)
+{
+    uint32_t h = 2166136261u;
+    uint32_t i;
+    for(i = 0; i < cnt; i++) {
+        h = (h ^ data[i]) * 16777619u;
+    }
+    return h;
+}
+
+/*Render all frames of the arrow animation, store the hash of the frames and return the time in us*/
+static uint32_t render_arrow(uint32_t * hashes, uint32_t max_frames, uint32_t * frame_cnt)
+{
+    Tvg_Canvas * canvas = tvg_swcanvas_create();
+    Tvg_Animation * anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(anim);
+    tvg_swcanvas_set_target(canvas, arrow_buf, ARROW_SIZE, ARROW_SIZE, ARROW_SIZE, TVG_COLORSPACE_ARGB8888);
+    tvg_canvas_push(canvas, picture);
+    TEST_ASSERT_EQUAL(TVG_RESULT_SUCCESS, tvg_picture_load_data(picture, (const char *)test_lottie_arrow_json,
+                                                                test_lottie_arrow_json_size, "lottie", true));
+    tvg_picture_set_size(picture, ARROW_SIZE, ARROW_SIZE);
+
+    float total;
+    tvg_animation_get_total_frame(anim, &total);
+    *frame_cnt = LV_MIN((uint32_t)total, max_frames);
+
+    uint32_t us = 0;
+    uint32_t i;
+    for(i = 0; i < *frame_cnt; i++) {
+        lv_memzero(arrow_buf, sizeof(arrow_buf));
+#if LV_USE_OS == LV_OS_PTHREAD
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+#endif
+        tvg_animation_set_frame(anim, (float)i);
+        tvg_canvas_update(canvas);
+        tvg_canvas_draw(canvas);
+        tvg_canvas_sync(canvas);
+#if LV_USE_OS == LV_OS_PTHREAD
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        us += (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+#endif
+        hashes[i] = hash_buf(arrow_buf, ARROW_SIZE * ARROW_SIZE);
+    }
+
+    tvg_animation_del(anim);
+    tvg_canvas_destroy(canvas);
+
+    return us;
+}
+
+void test_lottie_workers_widget(void)
+{
+    set_worker_cnt(2);
+
+    lv_obj_t * lottie = lv_lottie_create(lv_screen_active());
+    lv_lottie_set_buffer(lottie, 100, 100, lv_draw_buf_align(buf, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED));
+    lv_lottie_set_src_data(lottie, test_lottie_approve, test_lottie_approve_size);
+    lv_obj_center(lottie);
+
+    /*The same screenshots as without workers in test_lottie.c*/
+    lv_test_fast_forward(200);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_2.png");
+
+    lv_test_fast_forward(750);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/lottie_3.png");
+
+    lv_obj_delete(lottie);
+}
+
+/*Print the frame time with 0 (drawing thread only), 1, 2 and 4 workers and check that the frames are the same*/
+void test_lottie_workers_benchmark(void)
+{
+    static uint32_t ref_hashes[64];
+    static uint32_t hashes[64];
+    static const uint32_t worker_cnts[] = {0, 1, 2, 4};
+
+    uint32_t ref_frame_cnt = 0;
+    uint32_t w;
+    for(w = 0; w < sizeof(worker_cnts) / sizeof(worker_cnts[0]); w++) {
+        set_worker_cnt(worker_cnts[w]);
+
+        uint32_t frame_cnt;
+        uint32_t us = render_arrow(w == 0 ? ref_hashes : hashes, 64, &frame_cnt);
+        if(w == 0) ref_frame_cnt = frame_cnt;
+        else {
+            TEST_ASSERT_EQUAL_UINT32(ref_frame_cnt, frame_cnt);
+            TEST_ASSERT_EQUAL_UINT32_ARRAY(ref_hashes, hashes, frame_cnt);
+        }
+
+        TEST_PRINTF("%d workers: %d us/frame", (int)worker_cnts[w], (int)(us / frame_cnt));
+    }
+}
+
+#endif
@@ -0,0 +1,397 @@
+#if LV_BUILD_TEST
+#include "../lvgl.h"
+#include "../../lvgl_private.h"
+
+#include "unity/unity.h"
+
+#include <stdio.h>
+#include <string.h>
+#if LV_USE_OS == LV_OS_PTHREAD
+    #include <time.h>
+#endif
+
+#if defined(__SANITIZE_ADDRESS__)
+    /*From sanitizer/allocator_interface.h which is not always installed*/
+    int __sanitizer_install_malloc_and_free_hooks(void (*malloc_hook)(const volatile void *, size_t),
+                                                  void (*free_hook)(const volatile void *));
+    size_t __sanitizer_get_allocated_size(const volatile void * p);
+    #define COUNT_HEAP      1
+#else
+    #define COUNT_HEAP      0
+#endif
+
+#define SIZE            100
+#define OUT_FILE        "test_sprite_out.c"
+
+static uint8_t buf[LV_DRAW_BUF_SIZE(SIZE, SIZE, LV_COLOR_FORMAT_ARGB8888_PREMULTIPLIED)];
+static uint32_t ref_buf[SIZE * SIZE];
+
+extern const uint8_t test_lottie_empty_json[];
+extern const size_t test_lottie_empty_json_size;
+extern const uint8_t test_lottie_arrow_json[];
+extern const size_t test_lottie_arrow_json_size;
+
+/*A square which doesn't move for 1 second*/
+static const char still_json[] =
+    "{\"v\":\"5.7.0\",\"fr\":30,\"ip\":0,\"op\":30,\"w\":100,\"h\":100,\"layers\":["
+    "{\"ty\":4,\"ind\":1,\"ip\":0,\"op\":30,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"p\":{\"a\":0,\"k\":[50,50,0]},"
+    "\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":0,\"k\":[100,100,100]}},"
+    "\"shapes\":[{\"ty\":\"rc\",\"p\":{\"a\":0,\"k\":[0,0]},\"s\":{\"a\":0,\"k\":[40,20]},\"r\":{\"a\":0,\"k\":0}},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[0.9,0.3,0.1,1]},\"o\":{\"a\":0,\"k\":100}}]}"
+    "]}";
+
+#define GRADIENT_RECT(y, stops) \
+    "{\"ty\":\"rc\",\"p\":{\"a\":0,\"k\":[0," #y "]},\"s\":{\"a\":0,\"k\":[90,20]},\"r\":{\"a\":0,\"k\":0}}," \
+    "{\"ty\":\"gf\",\"o\":{\"a\":0,\"k\":100},\"r\":1,\"t\":1,\"s\":{\"a\":0,\"k\":[-45," #y "]}," \
+    "\"e\":{\"a\":0,\"k\":[45," #y "]},\"g\":{\"p\":2,\"k\":{\"a\":0,\"k\":[" stops "]}}}"
+
+/*Three gradients with more than 255 colors and an almost transparent square in the bottom left corner*/
+static const char faint_json[] =
+    "{\"v\":\"5.7.0\",\"fr\":30,\"ip\":0,\"op\":1,\"w\":100,\"h\":100,\"layers\":["
+    "{\"ty\":4,\"ind\":1,\"ip\":0,\"op\":1,\"st\":0,"
+    "\"ks\":{\"o\":{\"a\":0,\"k\":100},\"r\":{\"a\":0,\"k\":0},\"p\":{\"a\":0,\"k\":[50,50,0]},"
+    "\"a\":{\"a\":0,\"k\":[0,0,0]},\"s\":{\"a\":0,\"k\":[100,100,100]}},"
+    "\"shapes\":["
+    "{\"ty\":\"gr\",\"it\":[" GRADIENT_RECT(-30, "0,0,0,0,1,1,1,1") ",{\"ty\":\"tr\"}]},"
+    "{\"ty\":\"gr\",\"it\":[" GRADIENT_RECT(0, "0,1,0,0,1,0,1,0") ",{\"ty\":\"tr\"}]},"
+    "{\"ty\":\"gr\",\"it\":[" GRADIENT_RECT(30, "0,0,0,1,1,1,1,0") ",{\"ty\":\"tr\"}]},"
+    "{\"ty\":\"gr\",\"it\":["
+    "{\"ty\":\"rc\",\"p\":{\"a\":0,\"k\":[-45,45]},\"s\":{\"a\":0,\"k\":[10,10]},\"r\":{\"a\":0,\"k\":0}},"
+    "{\"ty\":\"fl\",\"c\":{\"a\":0,\"k\":[1,1,1,1]},\"o\":{\"a\":0,\"k\":0.4}},{\"ty\":\"tr\"}]}"
+    "]}]}";
+
+/*Due to different floating point precision
+ *the rendered images are slightly different on different architectures
+ *So compare the screenshots only on AMD64*/
+#ifdef NON_AMD64_BUILD
+    #undef TEST_ASSERT_EQUAL_SCREENSHOT
+    #define TEST_ASSERT_EQUAL_SCREENSHOT(path) (void) path
+#endif
+
+#if COUNT_HEAP
+static volatile bool count_heap;
+static int64_t heap_cur;
+static int64_t heap_peak;
+
+static void malloc_hook(const volatile void * ptr, size_t size)
+{
+    LV_UNUSED(ptr);
+    if(!count_heap) return;
+    heap_cur += size;
+    if(heap_cur > heap_peak) heap_peak = heap_cur;
+}
+
+static void free_hook(const volatile void * ptr)
+{
+    if(!count_heap || ptr == NULL) return;
+    heap_cur -= __sanitizer_get_allocated_size(ptr);
+}
+#endif
+
+void setUp(void)
+{
+    static bool hooks_installed = false;
+#if COUNT_HEAP
+    if(!hooks_installed) {
+        __sanitizer_install_malloc_and_free_hooks(malloc_hook, free_hook);
+        hooks_installed = true;
+    }
+#else
+    LV_UNUSED(hooks_installed);
+#endif
+}
+
+void tearDown(void)
+{
+    lv_obj_clean(lv_screen_active());
+}
+
+/*Render a frame of the arrow with ThorVG*/
+static void render_reference(float frame)
+{
+    lv_memzero(ref_buf, sizeof(ref_buf));
+
+    Tvg_Canvas * canvas = tvg_swcanvas_create();
+    Tvg_Animation * anim = tvg_animation_new();
+    Tvg_Paint * picture = tvg_animation_get_picture(anim);
+    tvg_swcanvas_set_target(canvas, ref_buf, SIZE, SIZE, SIZE, TVG_COLORSPACE_ARGB8888);
+    tvg_canvas_push(canvas, picture);
+    tvg_picture_load_data(picture, (const char *)test_lottie_arrow_json, test_lottie_arrow_json_size, "lottie", true);
+    tvg_picture_set_size(picture, SIZE, SIZE);
+
+    tvg_animation_set_frame(anim, frame);
+    tvg_canvas_update(canvas);
+    tvg_canvas_draw(canvas);
+    tvg_canvas_sync(canvas);
+
+    tvg_animation_del(anim);
+    tvg_canvas_destroy(canvas);
+}
+
+/*Show a frame of the sprite like the animation would do*/
+static void show_frame(lv_obj_t * sprite, int32_t frame)
+{
+    lv_anim_t * a = lv_sprite_get_anim(sprite);
+    a->exec_cb(a->var, frame);
+}
+
+static uint32_t max_channel_diff(const lv_draw_buf_t * draw_buf)
+{
+    uint32_t max_diff = 0;
+    uint32_t y;
+    for(y = 0; y < SIZE; y++) {
+        const uint8_t * px = lv_draw_buf_goto_xy(draw_buf, 0, y);
+        const uint8_t * ref = (const uint8_t *)&ref_buf[y * SIZE];
+        uint32_t i;
+        for(i = 0; i < SIZE * 4; i++) {
+            uint32_t diff = LV_ABS(px[i] - ref[i]);
+            if(diff > max_diff) max_diff = diff;
+        }
+    }
+    return max_diff;
+}
+
+void test_sprite_bake_lottie(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(test_lottie_arrow_json, test_lottie_arrow_json_size,
+                                                      SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    TEST_ASSERT_EQUAL_UINT16(SIZE, sheet->w);
+    TEST_ASSERT_EQUAL_UINT16(SIZE, sheet->h);
+    TEST_ASSERT_EQUAL_UINT16(30, sheet->fps);
+    TEST_ASSERT_EQUAL_UINT16(34, sheet->frame_cnt);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(256, sheet->palette_size);
+    TEST_ASSERT_LESS_OR_EQUAL_UINT16(sheet->frame_cnt, sheet->image_cnt);
+
+    /*Every frame is cropped*/
+    uint32_t i;
+    for(i = 0; i < sheet->image_cnt; i++) {
+        const lv_sprite_image_t * img = &sheet->images[i];
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(SIZE, img->x + img->w);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(SIZE, img->y + img->h);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(sheet->indices_size, img->data_ofs + img->w * img->h);
+    }
+    TEST_ASSERT_LESS_THAN_UINT32(sheet->frame_cnt * SIZE * SIZE, sheet->indices_size);
+
+    /*The played frames look like the Lottie frames with less colors*/
+    lv_obj_t * sprite = lv_sprite_create(lv_screen_active());
+    lv_sprite_set_buffer(sprite, SIZE, SIZE, buf);
+    lv_sprite_set_src(sprite, sheet);
+    lv_draw_buf_t * draw_buf = lv_canvas_get_draw_buf(sprite);
+
+    for(i = 0; i < sheet->frame_cnt; i++) {
+        show_frame(sprite, i);
+        TEST_ASSERT_EQUAL_INT32(i, lv_sprite_get_frame(sprite));
+        render_reference((float)i);
+        TEST_ASSERT_LESS_OR_EQUAL_UINT32(32, max_channel_diff(draw_buf));
+    }
+
+    lv_obj_delete(sprite);
+    lv_sprite_sheet_delete(sheet);
+}
+
+void test_sprite_bake_deduplicates_frames(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(still_json, sizeof(still_json), SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    TEST_ASSERT_EQUAL_UINT16(30, sheet->frame_cnt);
+    TEST_ASSERT_EQUAL_UINT16(1, sheet->image_cnt);
+
+    /*Only the square is stored*/
+    TEST_ASSERT_EQUAL_UINT16(30, sheet->images[0].x);
+    TEST_ASSERT_EQUAL_UINT16(40, sheet->images[0].y);
+    TEST_ASSERT_EQUAL_UINT16(40, sheet->images[0].w);
+    TEST_ASSERT_EQUAL_UINT16(20, sheet->images[0].h);
+    TEST_ASSERT_EQUAL_UINT32(40 * 20, sheet->indices_size);
+    TEST_ASSERT_EQUAL_UINT16(2, sheet->palette_size);
+    lv_sprite_sheet_delete(sheet);
+
+    /*Nothing is drawn*/
+    sheet = lv_sprite_bake_lottie(test_lottie_empty_json, test_lottie_empty_json_size, SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    TEST_ASSERT_EQUAL_UINT16(1, sheet->image_cnt);
+    TEST_ASSERT_EQUAL_UINT16(0, sheet->images[0].w);
+    TEST_ASSERT_EQUAL_UINT32(0, sheet->indices_size);
+    lv_sprite_sheet_delete(sheet);
+
+    TEST_ASSERT_NULL(lv_sprite_bake_lottie("not a lottie", 13, SIZE, SIZE, 30));
+    TEST_ASSERT_NULL(lv_sprite_bake_lottie(still_json, sizeof(still_json), SIZE, SIZE, 0));
+}
+
+void test_sprite_bake_keeps_faint_colors(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(faint_json, sizeof(faint_json), SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    TEST_ASSERT_EQUAL_UINT16(1, sheet->image_cnt);
+
+    /*The colors are merged, but the faint square isn't made transparent*/
+    const lv_sprite_image_t * img = &sheet->images[0];
+    TEST_ASSERT_EQUAL_UINT16(0, img->x);
+    TEST_ASSERT_EQUAL_UINT32(SIZE, img->y + img->h);
+    uint32_t i;
+    for(i = 1; i < sheet->palette_size; i++) {
+        TEST_ASSERT_NOT_EQUAL(0, sheet->palette[i].alpha);
+    }
+    lv_sprite_sheet_delete(sheet);
+}
+
+/*The frames are rendered one by one, so baking needs much less memory than all the rendered frames*/
+void test_sprite_bake_peak_memory(void)
+{
+#if COUNT_HEAP
+    heap_cur = 0;
+    heap_peak = 0;
+    count_heap = true;
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(test_lottie_arrow_json, test_lottie_arrow_json_size,
+                                                      SIZE, SIZE, 30);
+    count_heap = false;
+    TEST_ASSERT_NOT_NULL(sheet);
+
+    TEST_PRINTF("baking: %d bytes peak heap, %d bytes of rendered frames", (int)heap_peak,
+                (int)(sheet->frame_cnt * SIZE * SIZE * 4));
+    TEST_ASSERT_LESS_THAN_INT64(sheet->frame_cnt * SIZE * SIZE * 4 / 4, heap_peak);
+    lv_sprite_sheet_delete(sheet);
+#else
+    TEST_PASS_MESSAGE("Requires the allocator hooks of ASan");
+#endif
+}
+
+void test_sprite_play(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(test_lottie_arrow_json, test_lottie_arrow_json_size,
+                                                      SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+
+    lv_obj_t * sprite = lv_sprite_create(lv_screen_active());
+    lv_sprite_set_buffer(sprite, SIZE, SIZE, buf);
+    lv_sprite_set_src(sprite, sheet);
+    lv_obj_center(sprite);
+    TEST_ASSERT_EQUAL_UINT32(34 * 1000 / 30, lv_anim_get_time(lv_sprite_get_anim(sprite)));
+
+    lv_refr_now(NULL);
+    TEST_ASSERT_EQUAL_INT32(0, lv_sprite_get_frame(sprite));
+
+    /*The frames are picked by time*/
+    lv_test_fast_forward(500);
+    TEST_ASSERT_INT32_WITHIN(1, 15, lv_sprite_get_frame(sprite));
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/sprite_1.png");
+
+    lv_test_fast_forward(1000);
+    TEST_ASSERT_INT32_WITHIN(1, 11, lv_sprite_get_frame(sprite));
+
+    /*With RGB565 the transparent pixels are black*/
+    lv_draw_buf_t * draw_buf = lv_draw_buf_create(SIZE, SIZE, LV_COLOR_FORMAT_RGB565, 0);
+    lv_sprite_set_draw_buf(sprite, draw_buf);
+    lv_test_fast_forward(500);
+    TEST_ASSERT_EQUAL_SCREENSHOT("widgets/sprite_2.png");
+
+    lv_obj_delete(sprite);
+    lv_draw_buf_destroy(draw_buf);
+    lv_sprite_sheet_delete(sheet);
+}
+
+void test_sprite_write_c(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(still_json, sizeof(still_json), SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    TEST_ASSERT_EQUAL(LV_RESULT_OK, lv_sprite_sheet_write_c(sheet, "still", "A:" OUT_FILE));
+    lv_sprite_sheet_delete(sheet);
+
+    static char text[16 * 1024];
+    lv_fs_file_t f;
+    uint32_t br;
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_open(&f, "A:" OUT_FILE, LV_FS_MODE_RD));
+    TEST_ASSERT_EQUAL(LV_FS_RES_OK, lv_fs_read(&f, text, sizeof(text) - 1, &br));
+    lv_fs_close(&f);
+    text[br] = '\0';
+    remove(OUT_FILE);
+
+    TEST_ASSERT_NOT_NULL(strstr(text, "static const lv_color32_t still_palette[] = {\n    {0x00, 0x00, 0x00, 0x00}, "));
+    TEST_ASSERT_NOT_NULL(strstr(text, "static const lv_sprite_image_t still_images[] = {\n    {30, 40, 40, 20, 0}, \n"));
+    TEST_ASSERT_NOT_NULL(strstr(text, "const lv_sprite_sheet_t still = {\n    .w = 100,\n    .h = 100,\n    .fps = 30,\n"
+                                   "    .frame_cnt = 30,\n    .image_cnt = 1,\n    .palette_size = 2,\n"));
+    TEST_ASSERT_NOT_NULL(strstr(text, "    .indices_size = sizeof(still_indices),\n};\n"));
+}
+
+void test_sprite_memory_leak(void)
+{
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(test_lottie_arrow_json, test_lottie_arrow_json_size,
+                                                      SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+
+    size_t mem_before = lv_test_get_free_mem();
+    uint32_t i;
+    for(i = 0; i < 16; i++) {
+        lv_obj_t * sprite = lv_sprite_create(lv_screen_active());
+        lv_sprite_set_buffer(sprite, SIZE, SIZE, buf);
+        lv_sprite_set_src(sprite, sheet);
+        lv_test_fast_forward(753 * i);
+        lv_obj_delete(sprite);
+    }
+    TEST_ASSERT_MEM_LEAK_LESS_THAN(mem_before, 16);
+
+    lv_sprite_sheet_delete(sheet);
+}
+
+/*Not a pass/fail test: print the flash, RAM and CPU cost of playing the arrow with lv_lottie and lv_sprite*/
+void test_sprite_benchmark(void)
+{
+#if LV_USE_OS == LV_OS_PTHREAD
+    lv_sprite_sheet_t * sheet = lv_sprite_bake_lottie(test_lottie_arrow_json, test_lottie_arrow_json_size,
+                                                      SIZE, SIZE, 30);
+    TEST_ASSERT_NOT_NULL(sheet);
+    uint32_t sheet_size = sizeof(lv_sprite_sheet_t) + sheet->palette_size * sizeof(lv_color32_t) +
+                          sheet->image_cnt * sizeof(lv_sprite_image_t) + sheet->frame_cnt * sizeof(uint16_t) +
+                          sheet->indices_size;
+
+    uint32_t w;
+    for(w = 0; w < 2; w++) {
+#if COUNT_HEAP
+        heap_cur = 0;
+        heap_peak = 0;
+        count_heap = true;
+#endif
+        lv_obj_t * obj;
+        if(w == 0) {
+            obj = lv_lottie_create(lv_screen_active());
+            lv_lottie_set_buffer(obj, SIZE, SIZE, buf);
+            lv_lottie_set_src_data(obj, test_lottie_arrow_json, test_lottie_arrow_json_size);
+        }
+        else {
+            obj = lv_sprite_create(lv_screen_active());
+            lv_sprite_set_buffer(obj, SIZE, SIZE, buf);
+            lv_sprite_set_src(obj, sheet);
+        }
+#if COUNT_HEAP
+        count_heap = false;
+        int32_t ram = (int32_t)heap_cur;
+#else
+        int32_t ram = 0;
+#endif
+
+        /*Play all frames twice. The Lottie frames are rendered only if the widget is visible.*/
+        lv_obj_update_layout(obj);
+        lv_anim_t * a = w == 0 ? lv_lottie_get_anim(obj) : lv_sprite_get_anim(obj);
+        struct timespec t1, t2;
+        clock_gettime(CLOCK_MONOTONIC, &t1);
+        uint32_t i;
+        for(i = 0; i < 2 * 34; i++) {
+            a->exec_cb(a->var, (int32_t)(i % 34));
+        }
+        clock_gettime(CLOCK_MONOTONIC, &t2);
+        uint32_t us = (uint32_t)((t2.tv_sec - t1.tv_sec) * 1000000 + (t2.tv_nsec - t1.tv_nsec) / 1000);
+
+        TEST_PRINTF("%s: flash %d bytes, RAM %d bytes + %d bytes frame buffer, %d us/frame",
+                    w == 0 ? "lv_lottie" : "lv_sprite", (int)(w == 0 ? test_lottie_arrow_json_size : sheet_size),
+                    (int)ram, SIZE * SIZE * 4, (int)(us / (2 * 34)));
+        lv_obj_delete(obj);
+    }
+
+    lv_sprite_sheet_delete(sheet);
+#else
+    TEST_PASS_MESSAGE("Requires clock_gettime");
+#endif
+}
+
+#endif
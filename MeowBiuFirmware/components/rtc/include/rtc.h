@@ -0,0 +1,53 @@
+#pragma once
+#include <stdbool.h>
+#include <stddef.h>
+#include <stdint.h>
+#include "lvgl.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+typedef struct
+{
+    uint16_t year;   // 2000..2099
+    uint8_t month;   // 1..12
+    uint8_t day;     // 1..31
+    uint8_t weekday; // 0 = Sunday, computed from the date
+    uint8_t hour;    // 0..23
+    uint8_t minute;  // 0..59
+    uint8_t second;  // 0..59
+} rtc_time_t;
+
+/* The DS3231 on the I2C bus. Each call has to be one bus transaction:
+ * write the register address, then (after a repeated start for `read`) transfer `len` bytes. */
+typedef struct
+{
+    bool (*read)(void *ctx, uint8_t reg, uint8_t *data, size_t len);
+    bool (*write)(void *ctx, uint8_t reg, const uint8_t *data, size_t len);
+    void *ctx;
+} rtc_bus_t;
+
+/* The time is read from the DS3231 once and then advanced from lv_tick in an LVGL timer
+ * that runs once per second. The registers are read again every CONFIG_RTC_SYNC_PERIOD_S.
+ * With `sqw` the 1 Hz square wave of the DS3231 is enabled and rtc_sqw_isr() has to be called
+ * on its falling edges: the seconds start exactly on the edges then. */
+bool rtc_init(const rtc_bus_t *bus, bool sqw);  // call from the LVGL task after LVGL_Setup()
+bool rtc_init_ds3231(void);                     // set up the I2C bus and the SQW interrupt from Kconfig, then rtc_init()
+void rtc_sqw_isr(void);                         // call from the SQW interrupt
+
+bool rtc_sync(void);                            // read the registers now
+bool rtc_set_time(const rtc_time_t *t);         // write the time to the DS3231, false if `t` is out of range
+void rtc_get_time(rtc_time_t *t);
+
+/* Seconds/minutes since 2000-01-01 00:00:00 (read them as uint32_t). They change once per
+ * second/minute, so a label bound to them is invalidated once per second/minute. */
+lv_subject_t *rtc_get_second_subject(void);
+lv_subject_t *rtc_get_minute_subject(void);
+
+uint32_t rtc_time_to_seconds(const rtc_time_t *t); // `t` has to be in range
+void rtc_time_from_seconds(uint32_t seconds, rtc_time_t *t);
+
+#ifdef __cplusplus
+}
+#endif
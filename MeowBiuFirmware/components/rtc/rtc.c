@@ -0,0 +1,317 @@
+/*
+ * DS3231 time service: instead of reading the time registers whenever the time is needed
+ * the time is read in one burst and then advanced from lv_tick. An LVGL timer wakes up
+ * at the start of every second and publishes the time in two subjects, so the labels
+ * showing it are invalidated once per second (or minute) and the LVGL task can sleep in between.
+ *
+ * Only the bus access is platform specific (rtc_ds3231_esp.c), so this file builds on the host too.
+ */
+
+#include "rtc.h"
+
+#ifndef RTC_SYNC_PERIOD_S
+#define RTC_SYNC_PERIOD_S 60
+#endif
+
+#define SECOND_MS 1000
+
+#define DS3231_REG_TIME    0x00 // seconds, minutes, hours, day of week, date, month, year
+#define DS3231_REG_CONTROL 0x0E
+#define DS3231_TIME_LEN    7
+
+static rtc_bus_t bus;
+static bool sqw_enabled;
+static lv_timer_t *timer = NULL;
+static lv_subject_t second_subject;
+static lv_subject_t minute_subject;
+
+/* `base_seconds` started at `base_tick`. With SQW `base_tick` is the last falling edge */
+static uint32_t base_seconds;
+static uint32_t base_tick;
+static uint32_t sync_tick;
+
+static volatile bool edge_pending = false;
+static volatile uint32_t edge_tick;
+
+static uint8_t bcd_to_bin(uint8_t v)
+{
+    return (v >> 4) * 10 + (v & 0x0F);
+}
+
+static uint8_t bin_to_bcd(uint8_t v)
+{
+    return ((v / 10) << 4) | (v % 10);
+}
+
+static bool is_leap_year(uint32_t year)
+{
+    return (year % 4 == 0 && year % 100 != 0) || year % 400 == 0;
+}
+
+static uint8_t days_in_month(uint32_t year, uint32_t month)
+{
+    static const uint8_t days[12] = {31, 28, 31, 30, 31, 30, 31, 31, 30, 31, 30, 31};
+    if (month == 2 && is_leap_year(year))
+        return 29;
+    return days[month - 1];
+}
+
+static bool is_valid(const rtc_time_t *t)
+{
+    // The DS3231 counts the years from 2000 to 2099
+    return t->year >= 2000 && t->year <= 2099 && t->month >= 1 && t->month <= 12 && t->day >= 1 &&
+           t->day <= days_in_month(t->year, t->month) && t->hour <= 23 && t->minute <= 59 && t->second <= 59;
+}
+
+static bool read_time(uint32_t *seconds)
+{
+    uint8_t regs[DS3231_TIME_LEN];
+    if (!bus.read(bus.ctx, DS3231_REG_TIME, regs, sizeof(regs)))
+    {
+        LV_LOG_WARN("Failed to read the DS3231");
+        return false;
+    }
+
+    rtc_time_t t;
+    t.second = bcd_to_bin(regs[0] & 0x7F);
+    t.minute = bcd_to_bin(regs[1] & 0x7F);
+    if (regs[2] & 0x40)
+    {
+        // 12 hour mode, bit 5 is PM
+        t.hour = bcd_to_bin(regs[2] & 0x1F) % 12;
+        if (regs[2] & 0x20)
+            t.hour += 12;
+    }
+    else
+    {
+        t.hour = bcd_to_bin(regs[2] & 0x3F);
+    }
+    t.day = bcd_to_bin(regs[4] & 0x3F);
+    t.month = bcd_to_bin(regs[5] & 0x1F);
+    t.year = 2000 + bcd_to_bin(regs[6]);
+
+    if (!is_valid(&t))
+    {
+        LV_LOG_WARN("Invalid time in the DS3231");
+        return false;
+    }
+
+    *seconds = rtc_time_to_seconds(&t);
+    return true;
+}
+
+static void publish(void)
+{
+    uint32_t elapsed = lv_tick_elaps(base_tick);
+    uint32_t seconds = base_seconds + elapsed / SECOND_MS;
+
+    lv_subject_set_int(&second_subject, (int32_t)seconds);
+    lv_subject_set_int(&minute_subject, (int32_t)(seconds / 60));
+
+    // Wake up when the next second starts
+    lv_timer_set_period(timer, SECOND_MS - elapsed % SECOND_MS);
+}
+
+static void take_edge(void)
+{
+    if (!edge_pending)
+        return;
+
+    edge_pending = false;
+    uint32_t tick = edge_tick;
+
+    // The edge starts a new second: move the start of the seconds to it
+    int32_t diff = (int32_t)(tick - base_tick);
+    base_seconds += (uint32_t)((diff + SECOND_MS / 2) / SECOND_MS);
+    base_tick = tick;
+}
+
+static bool sync(void)
+{
+    take_edge();
+
+    uint32_t seconds;
+    if (!read_time(&seconds))
+        return false;
+
+    if (sqw_enabled)
+    {
+        // If an edge came during the read it's not known whether the value is from before
+        // or after it, so keep `sync_tick` to read again in the next second
+        if (edge_pending)
+            return true;
+
+        sync_tick = lv_tick_get();
+
+        // The value was read in the second started by the last edge
+        if (lv_tick_elaps(base_tick) < SECOND_MS)
+        {
+            base_seconds = seconds;
+            return true;
+        }
+    }
+    else
+    {
+        sync_tick = lv_tick_get();
+
+        // The DS3231 doesn't tell where its second started, so keep the current start if it agrees
+        if (base_seconds + lv_tick_elaps(base_tick) / SECOND_MS == seconds)
+            return true;
+    }
+
+    base_seconds = seconds;
+    base_tick = sync_tick;
+    return true;
+}
+
+static void timer_cb(lv_timer_t *t)
+{
+    LV_UNUSED(t);
+
+    if (lv_tick_elaps(sync_tick) >= RTC_SYNC_PERIOD_S * SECOND_MS)
+        sync();
+    else
+        take_edge();
+
+    publish();
+}
+
+bool rtc_init(const rtc_bus_t *b, bool sqw)
+{
+    bus = *b;
+    sqw_enabled = sqw;
+
+    if (sqw_enabled)
+    {
+        // 1 Hz square wave instead of the alarm interrupt, oscillator on
+        uint8_t control = 0x00;
+        if (!bus.write(bus.ctx, DS3231_REG_CONTROL, &control, 1))
+        {
+            LV_LOG_WARN("Failed to enable the square wave of the DS3231");
+            sqw_enabled = false;
+        }
+    }
+
+    base_tick = lv_tick_get();
+    sync_tick = base_tick;
+    bool ok = read_time(&base_seconds);
+    if (!ok)
+        base_seconds = 0;
+
+    if (timer == NULL)
+    {
+        lv_subject_init_int(&second_subject, (int32_t)base_seconds);
+        lv_subject_init_int(&minute_subject, (int32_t)(base_seconds / 60));
+        timer = lv_timer_create(timer_cb, SECOND_MS, NULL);
+    }
+
+    publish();
+    return ok;
+}
+
+void rtc_sqw_isr(void)
+{
+    edge_tick = lv_tick_get();
+    edge_pending = true;
+}
+
+bool rtc_sync(void)
+{
+    if (!sync())
+        return false;
+
+    publish();
+    return true;
+}
+
+bool rtc_set_time(const rtc_time_t *t)
+{
+    if (!is_valid(t))
+    {
+        LV_LOG_WARN("Invalid time: %d-%02d-%02d %02d:%02d:%02d", t->year, t->month, t->day, t->hour, t->minute,
+                    t->second);
+        return false;
+    }
+
+    // Compute the day of week
+    uint32_t seconds = rtc_time_to_seconds(t);
+    rtc_time_t n;
+    rtc_time_from_seconds(seconds, &n);
+
+    uint8_t regs[DS3231_TIME_LEN] = {
+        bin_to_bcd(n.second),
+        bin_to_bcd(n.minute),
+        bin_to_bcd(n.hour),
+        n.weekday + 1,
+        bin_to_bcd(n.day),
+        bin_to_bcd(n.month),
+        bin_to_bcd(n.year - 2000),
+    };
+
+    // Writing the seconds resets the countdown chain of the DS3231, so the new second starts now
+    if (!bus.write(bus.ctx, DS3231_REG_TIME, regs, sizeof(regs)))
+    {
+        LV_LOG_WARN("Failed to write the DS3231");
+        return false;
+    }
+
+    base_seconds = seconds;
+    base_tick = lv_tick_get();
+    sync_tick = base_tick;
+    edge_pending = false;
+    publish();
+    return true;
+}
+
+void rtc_get_time(rtc_time_t *t)
+{
+    rtc_time_from_seconds((uint32_t)lv_subject_get_int(&second_subject), t);
+}
+
+lv_subject_t *rtc_get_second_subject(void)
+{
+    return &second_subject;
+}
+
+lv_subject_t *rtc_get_minute_subject(void)
+{
+    return &minute_subject;
+}
+
+uint32_t rtc_time_to_seconds(const rtc_time_t *t)
+{
+    uint32_t days = 0;
+    for (uint32_t y = 2000; y < t->year; y++)
+        days += is_leap_year(y) ? 366 : 365;
+    for (uint32_t m = 1; m < t->month; m++)
+        days += days_in_month(t->year, m);
+    days += t->day - 1;
+
+    return ((days * 24 + t->hour) * 60 + t->minute) * 60 + t->second;
+}
+
+void rtc_time_from_seconds(uint32_t seconds, rtc_time_t *t)
+{
+    uint32_t days = seconds / 86400;
+    uint32_t rem = seconds % 86400;
+
+    t->hour = rem / 3600;
+    t->minute = rem / 60 % 60;
+    t->second = rem % 60;
+    t->weekday = (days + 6) % 7; // 2000-01-01 was a Saturday
+
+    t->year = 2000;
+    while (days >= (is_leap_year(t->year) ? 366 : 365))
+    {
+        days -= is_leap_year(t->year) ? 366 : 365;
+        t->year++;
+    }
+
+    t->month = 1;
+    while (days >= days_in_month(t->year, t->month))
+    {
+        days -= days_in_month(t->year, t->month);
+        t->month++;
+    }
+    t->day = days + 1;
+}
@@ -0,0 +1,92 @@
+/*
+ * The DS3231 on the ESP-IDF I2C master driver and its 1 Hz square wave on a GPIO interrupt.
+ */
+
+#include <string.h>
+
+#include "driver/gpio.h"
+#include "driver/i2c_master.h"
+#include "esp_log.h"
+#include "sdkconfig.h"
+#include "rtc.h"
+
+#define DS3231_I2C_ADDR  0x68
+#define I2C_TIMEOUT_MS   50
+
+static const char *TAG = "rtc";
+
+static i2c_master_dev_handle_t dev = NULL;
+
+static bool ds3231_read(void *ctx, uint8_t reg, uint8_t *data, size_t len)
+{
+    LV_UNUSED(ctx);
+    // Register address, repeated start and all the bytes in one transaction
+    return i2c_master_transmit_receive(dev, &reg, 1, data, len, I2C_TIMEOUT_MS) == ESP_OK;
+}
+
+static bool ds3231_write(void *ctx, uint8_t reg, const uint8_t *data, size_t len)
+{
+    LV_UNUSED(ctx);
+    uint8_t buf[1 + 8];
+    if (len > sizeof(buf) - 1)
+        return false;
+
+    buf[0] = reg;
+    memcpy(&buf[1], data, len);
+    return i2c_master_transmit(dev, buf, len + 1, I2C_TIMEOUT_MS) == ESP_OK;
+}
+
+#if CONFIG_RTC_SQW_GPIO >= 0
+static void sqw_isr(void *arg)
+{
+    LV_UNUSED(arg);
+    rtc_sqw_isr();
+}
+#endif
+
+bool rtc_init_ds3231(void)
+{
+    i2c_master_bus_config_t bus_config = {
+        .i2c_port = -1,
+        .sda_io_num = CONFIG_RTC_I2C_SDA_GPIO,
+        .scl_io_num = CONFIG_RTC_I2C_SCL_GPIO,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .flags.enable_internal_pullup = true,
+    };
+    i2c_master_bus_handle_t i2c_bus;
+    ESP_ERROR_CHECK(i2c_new_master_bus(&bus_config, &i2c_bus));
+
+    i2c_device_config_t dev_config = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = DS3231_I2C_ADDR,
+        .scl_speed_hz = 400000,
+    };
+    ESP_ERROR_CHECK(i2c_master_bus_add_device(i2c_bus, &dev_config, &dev));
+
+    bool sqw = false;
+#if CONFIG_RTC_SQW_GPIO >= 0
+    // SQW is open drain, a new second starts on the falling edge
+    gpio_config_t sqw_config = {
+        .pin_bit_mask = 1ULL << CONFIG_RTC_SQW_GPIO,
+        .mode = GPIO_MODE_INPUT,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+        .intr_type = GPIO_INTR_NEGEDGE,
+    };
+    ESP_ERROR_CHECK(gpio_config(&sqw_config));
+    esp_err_t err = gpio_install_isr_service(0);
+    if (err != ESP_OK && err != ESP_ERR_INVALID_STATE) // already installed
+        ESP_ERROR_CHECK(err);
+    ESP_ERROR_CHECK(gpio_isr_handler_add(CONFIG_RTC_SQW_GPIO, sqw_isr, NULL));
+    sqw = true;
+#endif
+
+    static const rtc_bus_t rtc_bus = {ds3231_read, ds3231_write, NULL};
+    bool ok = rtc_init(&rtc_bus, sqw);
+
+    rtc_time_t t;
+    rtc_get_time(&t);
+    ESP_LOGI(TAG, "DS3231 time: %04u-%02u-%02u %02u:%02u:%02u%s", t.year, t.month, t.day,
+             t.hour, t.minute, t.second, sqw ? ", synchronized to SQW" : "");
+    return ok;
+}
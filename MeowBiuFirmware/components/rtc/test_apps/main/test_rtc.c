@@ -0,0 +1,409 @@
+/*
+ * The RTC time service against a simulated DS3231: the bus transactions are counted and
+ * LVGL runs on a simulated tick, so minutes of time are tested in a moment.
+ */
+
+#include <string.h>
+#include "unity.h"
+#include "lvgl.h"
+#include "rtc.h"
+
+#define MINUTE_MS (60 * 1000)
+
+static uint32_t tick;
+
+// The simulated DS3231: `dev_seconds` started at `dev_tick` and its seconds last `dev_second_ms`
+static uint32_t dev_seconds;
+static uint32_t dev_tick;
+static uint32_t dev_second_ms;
+static bool dev_12h;
+static uint8_t dev_control;
+static bool dev_sqw;
+
+static uint32_t read_cnt;
+static uint32_t write_cnt;
+static size_t last_len;
+
+static uint32_t notify_cnt;
+static uint32_t minute_notify_cnt;
+static lv_observer_t *second_observer;
+static lv_observer_t *minute_observer;
+
+static uint32_t tick_cb(void)
+{
+    return tick;
+}
+
+static uint32_t dev_get_seconds(void)
+{
+    return dev_seconds + (tick - dev_tick) / dev_second_ms;
+}
+
+static uint8_t bcd(uint32_t v)
+{
+    return ((v / 10) << 4) | (v % 10);
+}
+
+static uint8_t bin(uint8_t v)
+{
+    return (v >> 4) * 10 + (v & 0x0F);
+}
+
+static bool mock_read(void *ctx, uint8_t reg, uint8_t *data, size_t len)
+{
+    LV_UNUSED(ctx);
+    read_cnt++;
+    last_len = len;
+    TEST_ASSERT_EQUAL_UINT8(0x00, reg);
+
+    rtc_time_t t;
+    rtc_time_from_seconds(dev_get_seconds(), &t);
+    uint8_t regs[7] = {bcd(t.second), bcd(t.minute), bcd(t.hour), t.weekday + 1, bcd(t.day), bcd(t.month),
+                       bcd(t.year - 2000)};
+    if (dev_12h)
+    {
+        uint32_t h12 = t.hour % 12 == 0 ? 12 : t.hour % 12;
+        regs[2] = 0x40 | (t.hour >= 12 ? 0x20 : 0) | bcd(h12);
+    }
+
+    memcpy(data, regs, len);
+    return true;
+}
+
+static bool mock_write(void *ctx, uint8_t reg, const uint8_t *data, size_t len)
+{
+    LV_UNUSED(ctx);
+    write_cnt++;
+    last_len = len;
+
+    if (reg == 0x0E)
+    {
+        dev_control = data[0];
+        return true;
+    }
+
+    TEST_ASSERT_EQUAL_UINT8(0x00, reg);
+    rtc_time_t t = {
+        .second = bin(data[0]),
+        .minute = bin(data[1]),
+        .hour = bin(data[2]),
+        .day = bin(data[4]),
+        .month = bin(data[5]),
+        .year = 2000 + bin(data[6]),
+    };
+    dev_seconds = rtc_time_to_seconds(&t);
+    dev_tick = tick;
+    return true;
+}
+
+static const rtc_bus_t mock_bus = {mock_read, mock_write, NULL};
+
+static void second_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    notify_cnt++;
+}
+
+static void minute_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    LV_UNUSED(observer);
+    LV_UNUSED(subject);
+    minute_notify_cnt++;
+}
+
+static void dev_set(const rtc_time_t *t, uint32_t second_ms)
+{
+    dev_seconds = rtc_time_to_seconds(t);
+    dev_tick = tick;
+    dev_second_ms = second_ms;
+    dev_12h = false;
+    dev_control = 0x1C; // reset value: alarm interrupt, no square wave
+    dev_sqw = false;
+}
+
+static void start(bool sqw)
+{
+    read_cnt = 0;
+    write_cnt = 0;
+    TEST_ASSERT_TRUE(rtc_init(&mock_bus, sqw));
+    dev_sqw = sqw;
+
+    // Observers are notified when they are added
+    second_observer = lv_subject_add_observer(rtc_get_second_subject(), second_observer_cb, NULL);
+    minute_observer = lv_subject_add_observer(rtc_get_minute_subject(), minute_observer_cb, NULL);
+    notify_cnt = 0;
+    minute_notify_cnt = 0;
+}
+
+static void stop(void)
+{
+    lv_observer_remove(second_observer);
+    lv_observer_remove(minute_observer);
+}
+
+static uint32_t published(void)
+{
+    return (uint32_t)lv_subject_get_int(rtc_get_second_subject());
+}
+
+// Let `ms` milliseconds pass and call the SQW interrupt on the edges
+static void run(uint32_t ms)
+{
+    while (ms--)
+    {
+        uint32_t prev = dev_get_seconds();
+        tick++;
+        if (dev_sqw && dev_get_seconds() != prev)
+            rtc_sqw_isr();
+        lv_timer_handler();
+    }
+}
+
+static void setup(void)
+{
+    if (!lv_is_initialized())
+        lv_init();
+    lv_tick_set_cb(tick_cb);
+    tick = 1000;
+}
+
+static void teardown(void)
+{
+    lv_tick_set_cb(NULL);
+}
+
+// The time is read in one burst, then once per minute
+void test_rtc_read_once_per_minute(void)
+{
+    setup();
+    rtc_time_t t = {.year = 2024, .month = 2, .day = 29, .hour = 23, .minute = 59, .second = 30};
+    dev_set(&t, 1000);
+    start(false);
+
+    TEST_ASSERT_EQUAL_UINT32(1, read_cnt);
+    TEST_ASSERT_EQUAL(7, last_len);
+    TEST_ASSERT_EQUAL_UINT32(dev_get_seconds(), published());
+
+    run(MINUTE_MS - 1);
+    TEST_ASSERT_EQUAL_UINT32(1, read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(59, notify_cnt);
+    TEST_ASSERT_EQUAL_UINT32(dev_get_seconds(), published());
+
+    run(1);
+    TEST_ASSERT_EQUAL_UINT32(2, read_cnt);
+
+    // 10 minutes: 11 bus transactions instead of 7 per loop iteration
+    run(9 * MINUTE_MS);
+    TEST_ASSERT_EQUAL_UINT32(11, read_cnt);
+    TEST_ASSERT_EQUAL_UINT32(0, write_cnt);
+    TEST_ASSERT_EQUAL_UINT32(600, notify_cnt);
+    TEST_ASSERT_EQUAL_UINT32(10, minute_notify_cnt);
+
+    rtc_time_t now;
+    rtc_get_time(&now);
+    TEST_ASSERT_EQUAL(2024, now.year);
+    TEST_ASSERT_EQUAL(3, now.month);
+    TEST_ASSERT_EQUAL(1, now.day);
+    TEST_ASSERT_EQUAL(0, now.hour);
+    TEST_ASSERT_EQUAL(9, now.minute);
+    TEST_ASSERT_EQUAL(30, now.second);
+    TEST_ASSERT_EQUAL(5, now.weekday); // Friday
+
+    stop();
+    teardown();
+}
+
+// The drift of the tick is corrected at the reads
+void test_rtc_drift_corrected(void)
+{
+    setup();
+    rtc_time_t t = {.year = 2025, .month = 6, .day = 1, .hour = 12};
+    dev_set(&t, 990); // 1% fast
+    start(false);
+
+    uint32_t prev = published();
+    uint32_t prev_read_cnt = read_cnt;
+    for (uint32_t i = 0; i < 10 * MINUTE_MS; i++)
+    {
+        run(1);
+
+        // Never backwards and at most one second is skipped at a read
+        uint32_t now = published();
+        TEST_ASSERT_TRUE(now >= prev && now <= prev + 2);
+        prev = now;
+
+        // The DS3231 doesn't show where its seconds start, so behind by less than a second
+        // plus the drift of a minute
+        TEST_ASSERT_TRUE(now <= dev_get_seconds() && now + 2 >= dev_get_seconds());
+        if (read_cnt != prev_read_cnt)
+            TEST_ASSERT_EQUAL_UINT32(dev_get_seconds(), now);
+        prev_read_cnt = read_cnt;
+    }
+    TEST_ASSERT_EQUAL_UINT32(11, read_cnt);
+
+    stop();
+    teardown();
+}
+
+// The seconds start on the edges of the square wave
+void test_rtc_sqw_edges(void)
+{
+    setup();
+    rtc_time_t t = {.year = 2025, .month = 12, .day = 31, .hour = 23, .minute = 58};
+    dev_set(&t, 999);
+    dev_tick -= 300; // read in the middle of a second
+    start(true);
+
+    TEST_ASSERT_EQUAL_UINT32(1, write_cnt);
+    TEST_ASSERT_EQUAL_HEX8(0x00, dev_control);
+
+    // The first edge is found at the end of the first second
+    run(1000);
+    TEST_ASSERT_EQUAL_UINT32(dev_get_seconds(), published());
+
+    uint32_t start_notify_cnt = notify_cnt;
+    uint32_t start_seconds = published();
+    // The reads are at the first second after a minute
+    for (uint32_t i = 0; i < 5 * MINUTE_MS + 5000; i++)
+    {
+        run(1);
+        // Late by at most the drift of one second
+        if (published() != dev_get_seconds())
+        {
+            run(1);
+            TEST_ASSERT_EQUAL_UINT32(dev_get_seconds(), published());
+            i++;
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT32(published() - start_seconds, notify_cnt - start_notify_cnt);
+    TEST_ASSERT_EQUAL_UINT32(1 + 5, read_cnt);
+
+    rtc_time_t now;
+    rtc_get_time(&now);
+    TEST_ASSERT_EQUAL(2026, now.year);
+    TEST_ASSERT_EQUAL(1, now.month);
+    TEST_ASSERT_EQUAL(1, now.day);
+
+    stop();
+    teardown();
+}
+
+// The time is set in one transaction
+void test_rtc_set_time(void)
+{
+    setup();
+    rtc_time_t t = {.year = 2030, .month = 1, .day = 1};
+    dev_set(&t, 1000);
+    dev_12h = true;
+    start(false);
+    run(500);
+
+    rtc_time_t set = {.year = 2031, .month = 7, .day = 15, .hour = 13, .minute = 5, .second = 59};
+    TEST_ASSERT_TRUE(rtc_set_time(&set));
+    TEST_ASSERT_EQUAL_UINT32(1, write_cnt);
+    TEST_ASSERT_EQUAL(7, last_len);
+    TEST_ASSERT_EQUAL_UINT32(rtc_time_to_seconds(&set), published());
+
+    // Read back in 12 hour mode
+    TEST_ASSERT_TRUE(rtc_sync());
+    TEST_ASSERT_EQUAL_UINT32(2, read_cnt);
+    rtc_time_t now;
+    rtc_get_time(&now);
+    TEST_ASSERT_EQUAL(13, now.hour);
+    TEST_ASSERT_EQUAL(5, now.minute);
+    TEST_ASSERT_EQUAL(59, now.second);
+    TEST_ASSERT_EQUAL(2, now.weekday); // Tuesday
+
+    run(1000);
+    rtc_get_time(&now);
+    TEST_ASSERT_EQUAL(6, now.minute);
+    TEST_ASSERT_EQUAL(0, now.second);
+
+    stop();
+    teardown();
+}
+
+// Times out of range are rejected without a bus transaction
+void test_rtc_set_time_out_of_range(void)
+{
+    setup();
+    rtc_time_t t = {.year = 2030, .month = 1, .day = 1};
+    dev_set(&t, 1000);
+    start(false);
+
+    static const rtc_time_t invalid[] = {
+        {.year = 2031, .month = 0, .day = 1},
+        {.year = 2031, .month = 13, .day = 1},
+        {.year = 2031, .month = 255, .day = 1},
+        {.year = 1999, .month = 12, .day = 31},
+        {.year = 2100, .month = 1, .day = 1},
+        {.year = 2031, .month = 1, .day = 0},
+        {.year = 2031, .month = 2, .day = 29},
+        {.year = 2031, .month = 4, .day = 31},
+        {.year = 2031, .month = 1, .day = 1, .hour = 24},
+        {.year = 2031, .month = 1, .day = 1, .minute = 60},
+        {.year = 2031, .month = 1, .day = 1, .second = 60},
+    };
+    for (uint32_t i = 0; i < sizeof(invalid) / sizeof(invalid[0]); i++)
+        TEST_ASSERT_FALSE(rtc_set_time(&invalid[i]));
+    TEST_ASSERT_EQUAL_UINT32(0, write_cnt);
+    TEST_ASSERT_EQUAL_UINT32(rtc_time_to_seconds(&t), published());
+
+    rtc_time_t leap = {.year = 2032, .month = 2, .day = 29};
+    TEST_ASSERT_TRUE(rtc_set_time(&leap));
+    TEST_ASSERT_EQUAL_UINT32(1, write_cnt);
+
+    stop();
+    teardown();
+}
+
+// Dates are converted to seconds and back
+void test_rtc_seconds_conversion(void)
+{
+    rtc_time_t t;
+    rtc_time_from_seconds(0, &t);
+    TEST_ASSERT_EQUAL(2000, t.year);
+    TEST_ASSERT_EQUAL(1, t.month);
+    TEST_ASSERT_EQUAL(1, t.day);
+    TEST_ASSERT_EQUAL(6, t.weekday); // Saturday
+
+    rtc_time_t last = {.year = 2099, .month = 12, .day = 31, .hour = 23, .minute = 59, .second = 59};
+    rtc_time_from_seconds(rtc_time_to_seconds(&last), &t);
+    TEST_ASSERT_EQUAL(2099, t.year);
+    TEST_ASSERT_EQUAL(12, t.month);
+    TEST_ASSERT_EQUAL(31, t.day);
+    TEST_ASSERT_EQUAL(23, t.hour);
+    TEST_ASSERT_EQUAL(59, t.minute);
+    TEST_ASSERT_EQUAL(59, t.second);
+    TEST_ASSERT_EQUAL(4, t.weekday); // Thursday
+
+    // 2100 isn't a leap year
+    rtc_time_from_seconds(rtc_time_to_seconds(&last) + 1 + 59 * 86400, &t);
+    TEST_ASSERT_EQUAL(2100, t.year);
+    TEST_ASSERT_EQUAL(3, t.month);
+    TEST_ASSERT_EQUAL(1, t.day);
+}
+
+#ifdef ESP_PLATFORM
+void app_main(void)
+{
+    UNITY_BEGIN();
+    RUN_TEST(test_rtc_read_once_per_minute);
+    RUN_TEST(test_rtc_drift_corrected);
+    RUN_TEST(test_rtc_sqw_edges);
+    RUN_TEST(test_rtc_set_time);
+    RUN_TEST(test_rtc_set_time_out_of_range);
+    RUN_TEST(test_rtc_seconds_conversion);
+    UNITY_END();
+}
+#else
+// On the host the tests run with the LVGL tests, which call these
+void setUp(void)
+{
+}
+
+void tearDown(void)
+{
+}
+#endif
@@ -15,8 +15,10 @@
 #include "freertos/task.h"
 #include "lvgl.h"
 #include "display.h"
+#include "display_loop.h"
 
 #include "face.h"
+#include "rtc.h"
 #include "lv_examples.h"
 
 static const char *TAG = "main";
@@ -24,6 +26,35 @@ static const char *TAG = "main";
 // LVGL task handle
 static TaskHandle_t lvgl_task_handle = NULL;
 
+#if LV_USE_MEM_PROFILER
+static void mem_profiler_print_cb(const char *buf)
+{
+    ESP_LOGI("mem", "%s", buf);
+}
+#endif
+
+#if CONFIG_RTC_CLOCK_LABEL
+static void clock_observer_cb(lv_observer_t *observer, lv_subject_t *subject)
+{
+    lv_obj_t *label = lv_observer_get_target_obj(observer);
+    uint32_t minutes = (uint32_t)lv_subject_get_int(subject);
+    lv_label_set_text_fmt(label, "%02" LV_PRIu32 ":%02" LV_PRIu32, minutes / 60 % 24, minutes % 60);
+}
+
+static void clock_label_create(void)
+{
+    lv_obj_t *label = lv_label_create(lv_screen_active());
+    lv_obj_set_style_text_color(label, lv_color_white(), LV_PART_MAIN);
+    // Equal width digits keep the size of the label, else every change would redraw the whole label
+    lv_obj_set_style_text_font(label, &lv_font_unscii_16, LV_PART_MAIN);
+    lv_obj_align(label, LV_ALIGN_BOTTOM_MID, 0, -24);
+    // Redraw only the changed digits and draw them from one bitmap while the face animates below
+    lv_label_set_glyph_diff(label, true);
+    lv_label_set_glyph_cache(label, true);
+    lv_subject_add_observer_obj(rtc_get_minute_subject(), clock_observer_cb, label, NULL);
+}
+#endif
+
 // LVGL task function - runs continuously in separate thread
 static void lvgl_task(void *pvParameters)
 {
@@ -40,21 +71,17 @@ static void lvgl_task(void *pvParameters)
     // lv_example_gif_1();
 
     face_init();
-    // char buf[32];
-
-    while (1)
-    {
-        // static int log_counter = 0;
-        // if (log_counter++ % 10 == 0)
-        // {
 
-        //     // snprintf(buf, sizeof(buf), "Hello! %lld ms", esp_timer_get_time()/1000ULL);
-        //     // lv_label_set_text(label, buf);
-        // }
+    // Read the DS3231 once, then the time is advanced from the tick and published once per second
+    rtc_init_ds3231();
+#if CONFIG_RTC_CLOCK_LABEL
+    clock_label_create();
+#endif
+    // char buf[32];
 
-        lv_timer_handler();
-        vTaskDelay(pdMS_TO_TICKS(5));
-    }
+    // Sleep until the next LVGL timer or a wake-up instead of polling every 5 ms
+    display_loop_init();
+    display_loop_run();
     vTaskDelete(NULL);
 }
 
@@ -124,5 +151,19 @@ void app_main()
         lv_mem_monitor(&mon);
         ESP_LOGI("face", "Memory after delete - free: %d, frag: %d%%",
                  mon.free_size, mon.frag_pct);
+
+#if LV_USE_MEM_PROFILER
+        // Who holds the memory: GIF canvases, draw buffers, styles, images...
+        static uint32_t dump_cnt = 0;
+        if (++dump_cnt % 10 == 0)
+        {
+            lv_mem_profiler_dump(mem_profiler_print_cb);
+        }
+#endif
+
+        static uint32_t last_wakeup_count = 0;
+        uint32_t wakeup_count = display_loop_get_wakeup_count();
+        ESP_LOGI(TAG, "LVGL task wake-ups: %lu/s", (unsigned long)(wakeup_count - last_wakeup_count));
+        last_wakeup_count = wakeup_count;
     }
 }
\ No newline at end of file
@@ -30,19 +30,29 @@ void setRTCRealTime(DS3231 &RTC)
     RTC.setDoW(dow);
 }
 
+static uint8_t bcd2bin(uint8_t v)
+{
+    return (v >> 4) * 10 + (v & 0x0F);
+}
+
 void getRTCRealTime(DS3231 &RTC, int& year, int& month, int& day, int& dow, int& hour, int& minute, int& second, bool verbose=false)
 {
-    bool h12_format = false;
-    bool pm_flag = false; // don't care
-    bool century = false; // don't care
+    // All the time registers in one transaction instead of one transaction per getter
+    Wire.beginTransmission(0x68);
+    Wire.write(0x00);
+    Wire.endTransmission(false);
+    if (Wire.requestFrom(0x68, 7) != 7) return;
 
-    year = (2000 + RTC.getYear());
-    month = (RTC.getMonth(century));
-    day = (RTC.getDate());
-    dow = (RTC.getDoW());
-    hour = (RTC.getHour(h12_format, pm_flag));
-    minute = (RTC.getMinute());
-    second = (RTC.getSecond());
+    uint8_t regs[7];
+    for (int i = 0; i < 7; i++) regs[i] = Wire.read();
+
+    second = bcd2bin(regs[0] & 0x7F);
+    minute = bcd2bin(regs[1] & 0x7F);
+    hour = bcd2bin(regs[2] & 0x3F); // 24 hour mode, set by setRTCRealTime()
+    dow = regs[3];
+    day = bcd2bin(regs[4] & 0x3F);
+    month = bcd2bin(regs[5] & 0x1F);
+    year = 2000 + bcd2bin(regs[6]);
 
     if(verbose==false) return;
     Serial.print(year);
@@ -72,4 +82,6 @@ int year, month, day, dow, hour, minute, second;
 void loop()
 {
     getRTCRealTime(RTC, year, month, day, dow, hour, minute, second, true);
+    // The time changes once per second, don't keep the bus busy in between
+    delay(1000);
 }